@@ -18,6 +18,10 @@ macro(setup_default_compiler_flags _project_name)
 		if(USE_SIMD_INSTRUCTIONS)
 			if(USE_AVX_INSTRUCTIONS)
 				target_compile_options(${_project_name} PRIVATE "/arch:AVX")
+
+				if(USE_AVX_8_WIDE_DECOMP)
+					add_definitions(-DACL_USE_AVX_8_WIDE_DECOMP)
+				endif()
 			endif()
 		else()
 			add_definitions(-DRTM_NO_INTRINSICS)
@@ -44,6 +48,10 @@ macro(setup_default_compiler_flags _project_name)
 				if(USE_AVX_INSTRUCTIONS)
 					target_compile_options(${_project_name} PRIVATE "-mavx")
 					target_compile_options(${_project_name} PRIVATE "-mbmi")
+
+					if(USE_AVX_8_WIDE_DECOMP)
+						add_definitions(-DACL_USE_AVX_8_WIDE_DECOMP)
+					endif()
 				else()
 					target_compile_options(${_project_name} PRIVATE "-msse4.1")
 				endif()
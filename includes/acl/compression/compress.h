@@ -99,6 +99,53 @@ namespace acl
 		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
 		compressed_tracks** out_compressed_tracks, compressed_database*& out_database);
 
+	//////////////////////////////////////////////////////////////////////////
+	// Takes an existing database along with a list of new compressed track instances that contain the contributing error
+	// metadata and builds a new database that contains every clip. The new clips are split between their tiers on their own
+	// and their chunks are appended: the existing chunks and their bulk data offsets remain identical, as do the compressed
+	// track instances already bound to the database. Only the new clips need to be compressed and shipped in a patch.
+	// The database must have inline bulk data and contain the range of chunks of each clip.
+	//
+	//    allocator:						The allocator instance to use
+	//    settings:							The settings to use when creating the new chunks
+	//    database:							The source database to append to
+	//    compressed_tracks_list:			The list of compressed tracks to add to the database (must have contributing error metadata)
+	//    num_compressed_tracks:			The number of compressed track instances in the above list
+	//    out_compressed_tracks:			The output list of compressed tracks bound to the output database (array allocated by the caller (must be large enough); compressed_tracks instances allocated by the function)
+	//    out_database:						The output database (allocated by the function)
+	//////////////////////////////////////////////////////////////////////////
+	error_result append_to_database(iallocator& allocator, const compression_database_settings& settings, const compressed_database& database,
+		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
+		compressed_tracks** out_compressed_tracks, compressed_database*& out_database);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Takes an existing database and a list of compressed track instances bound to it and builds a new database where
+	// they are removed. Removed clips are tombstoned: they can no longer be bound to a decompression context or streamed
+	// but their data remains until the database is compacted. The chunks and the other clips remain identical.
+	// The database must contain the range of chunks of each clip.
+	//
+	//    allocator:						The allocator instance to use
+	//    database:							The source database to remove from
+	//    compressed_tracks_list:			The list of compressed tracks bound to the database to remove
+	//    num_compressed_tracks:			The number of compressed track instances in the above list
+	//    out_database:						The output database (allocated by the function)
+	//////////////////////////////////////////////////////////////////////////
+	error_result remove_from_database(iallocator& allocator, const compressed_database& database,
+		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
+		compressed_database*& out_database);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Takes a database with inline bulk data and builds a new database where the chunks that only contain the data
+	// of removed clips are dropped. The chunks that follow the first dropped chunk move down, the ones before remain
+	// identical. Compressed track instances bound to the source database remain bound to the compacted database.
+	//
+	//    allocator:						The allocator instance to use
+	//    database:							The source database to compact
+	//    out_database:						The output database (allocated by the function)
+	//////////////////////////////////////////////////////////////////////////
+	error_result compact_database(iallocator& allocator, const compressed_database& database, compressed_database*& out_database);
+
+#if ACL_NUM_DATABASE_TIERS == 2
 	//////////////////////////////////////////////////////////////////////////
 	// Takes a compressed database with inline bulk data and duplicates it into
 	// a new database instance where the bulk data lives in separate buffers.
@@ -108,13 +155,45 @@ namespace acl
 	//    out_split_database:				The new database without inline bulk data.
 	//    out_bulk_data_medium:				The new database's bulk data for the medium importance tier.
 	//    out_bulk_data_low:				The new database's bulk data for the low importance tier.
+	//
+	// Only available when the database contains 2 tiers, see ACL_NUM_DATABASE_TIERS.
 	//////////////////////////////////////////////////////////////////////////
 	error_result split_database_bulk_data(iallocator& allocator, const compressed_database& database, compressed_database*& out_split_database, uint8_t*& out_bulk_data_medium, uint8_t*& out_bulk_data_low);
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Takes a compressed database with inline bulk data and duplicates it into
+	// a new database instance where the bulk data lives in separate buffers.
+	//
+	//    allocator:						The allocator instance to use to allocate the new database and its bulk data.
+	//    database:							The source database to split with inline bulk data.
+	//    out_split_database:				The new database without inline bulk data.
+	//    out_tier_bulk_data:				The new database's bulk data for every database tier, sorted from most important to least important.
+	//    num_tier_bulk_data:				The number of entries in 'out_tier_bulk_data', must be 'k_num_database_tiers'.
+	//////////////////////////////////////////////////////////////////////////
+	error_result split_database_bulk_data(iallocator& allocator, const compressed_database& database, compressed_database*& out_split_database, uint8_t** out_tier_bulk_data, uint32_t num_tier_bulk_data);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Takes the bulk data of a database tier, as output by split_database_bulk_data(..), and compresses
+	// every chunk independently to reduce its size on disk and the IO required to stream it in.
+	// Chunks that do not compress are stored as is. A streamer must decompress the chunks it reads
+	// before completing its requests, see decompress_database_bulk_data(..) and file_database_streamer_settings.
+	// Decompressed chunks are identical to the source bulk data.
+	//
+	//    allocator:						The allocator instance to use to allocate the compressed bulk data.
+	//    database:							The database the bulk data belongs to.
+	//    tier:								The quality tier of the bulk data.
+	//    bulk_data:						The bulk data to compress.
+	//    out_compressed_bulk_data:			The new compressed bulk data.
+	//    out_compressed_bulk_data_size:	The size in bytes of the compressed bulk data.
+	//////////////////////////////////////////////////////////////////////////
+	error_result compress_database_bulk_data(iallocator& allocator, const compressed_database& database, quality_tier tier, const uint8_t* bulk_data,
+		uint8_t*& out_compressed_bulk_data, uint32_t& out_compressed_bulk_data_size);
 
 	//////////////////////////////////////////////////////////////////////////
 	// Takes a compressed database and strips the specified quality tier from it.
 	// The database is duplicated including its remaining bulk data (if inline).
-	// Only the medium/lowest tiers can be stripped.
+	// Only the database tiers can be stripped.
 	//
 	//    allocator:						The allocator instance to use to allocate the new database.
 	//    database:							The source database to strip.
@@ -26,8 +26,10 @@
 
 #include "acl/version.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/core/database_clip_co_usage.h"
 #include "acl/core/error_result.h"
 #include "acl/core/hash.h"
+#include "acl/core/quality_tiers.h"
 #include "acl/core/track_formats.h"
 #include "acl/core/track_types.h"
 #include "acl/core/range_reduction_types.h"
@@ -68,6 +70,16 @@ namespace acl
 		// Defaults to '0.5' (the least important 50% of frames are moved to the database)
 		float low_importance_tier_proportion = 0.5F;
 
+		//////////////////////////////////////////////////////////////////////////
+		// When the database contains more than 2 tiers (see ACL_NUM_DATABASE_TIERS), the proportions
+		// of the tiers between the medium and low importance tiers. Index 0 is for quality_tier(2),
+		// index 1 for quality_tier(3), etc. Only the first 'k_num_database_tiers - 2' values are used.
+		// Each tier refines the key frames present in the tiers of higher importance, e.g. with 4
+		// database tiers, 20/20/25/25% leaves the 10% most important frames in the compressed tracks.
+		// Their sum with the medium and low importance proportions must be between 0.0 and 1.0.
+		// Defaults to '0.0' (the intermediate tiers are empty)
+		float intermediate_tier_proportions[k_num_database_tiers_max - 2] = { 0.0F, 0.0F, 0.0F, 0.0F, 0.0F };
+
 		//////////////////////////////////////////////////////////////////////////
 		// How large should each chunk be, in bytes.
 		// This value must be at least 4 KB and ideally it should be a multiple of
@@ -76,6 +88,24 @@ namespace acl
 		// Defaults to '1 MB'
 		uint32_t max_chunk_size = 1 * 1024 * 1024;
 
+		//////////////////////////////////////////////////////////////////////////
+		// An optional co-usage graph of the clips, see database_usage_trace.
+		// Chunks are filled with the segments of every clip in turn. When provided, clips
+		// that are used together are laid out next to each other and end up sharing
+		// chunks. Streaming in the clips of a gameplay scenario then requires fewer chunks.
+		// The graph isn't copied and must live until the database is built.
+		// Defaults to 'nullptr' (clips are laid out in the order provided)
+		const database_clip_co_usage* clip_co_usage = nullptr;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The number of edges in the clip co-usage graph.
+		// Defaults to '0'
+		uint32_t num_clip_co_usage_edges = 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the proportion of frames to move into the specified database tier.
+		float get_tier_proportion(quality_tier tier) const;
+
 		//////////////////////////////////////////////////////////////////////////
 		// Calculates a hash from the internal state to uniquely identify a configuration.
 		uint32_t get_hash() const;
@@ -117,7 +147,10 @@ namespace acl
 		// of each frame. These are sorted from lowest to largest error.
 		// This is required when the compressed tracks will later be merged into
 		// a database.
-		// Transform tracks only
+		// Scalar tracks are then always split into segments and
+		// 'scalar_segment_num_samples' is clamped to 16 (the default settings
+		// use 64). The last segment also holds the remaining samples and can
+		// contain up to 31 samples.
 		// Defaults to 'false'
 		bool include_contributing_error = false;
 
@@ -225,7 +258,6 @@ namespace acl
 		// Whether or not to enable database support on the output compressed clip.
 		// This enables the required metadata which will later be stripped once
 		// the database is built.
-		// Transform tracks only.
 		bool enable_database_support = false;
 
 		//////////////////////////////////////////////////////////////////////////
@@ -235,6 +267,34 @@ namespace acl
 		// See `sample_looping_policy` for details.
 		bool optimize_loops = false;
 
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to include a sub-track prefix index. For every group of 16
+		// tracks, it stores how many constant and animated sub-tracks precede it.
+		// This allows decompress_track(..) to count the sub-tracks that precede a
+		// single track without scanning the sub-track types of every track before it.
+		// Every segment also stores the number of bits used by every 16 animated sub-tracks
+		// to skip the animated data that precedes a track without summing every bit rate.
+		// It adds 8 bytes per sub-track type (rotation, translation, and scale if present)
+		// for every 16 tracks: 8 * ceil(num_tracks / 16) * 3 bytes with scale.
+		// It also adds 4 bytes per segment for every 16 animated sub-tracks with a variable bit rate.
+		// Transform tracks only.
+		// Defaults to 'false'
+		bool include_sub_track_prefix_index = false;
+
+		//////////////////////////////////////////////////////////////////////////
+		// How many samples each segment should contain when compressing scalar tracks.
+		// Every segment has its own range and bit rate per track which allows
+		// tracks with localized spikes to only use a high bit rate where needed.
+		// The last segment also holds the remaining samples. Segments are only
+		// retained when they lower the memory footprint unless the contributing
+		// error is included in which case segments are always retained and
+		// this value is clamped to 16 since a database segment cannot hold more
+		// than 32 samples.
+		// Must be '0' (no segmenting) or greater or equal to 8.
+		// Scalar tracks only.
+		// Defaults to '0' (no segmenting)
+		uint32_t scalar_segment_num_samples = 0;
+
 		//////////////////////////////////////////////////////////////////////////
 		// Keyframe stripping related settings. See [compression_keyframe_stripping_settings].
 		// Transform tracks only.
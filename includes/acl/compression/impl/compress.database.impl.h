@@ -28,12 +28,16 @@
 
 #include "acl/version.h"
 #include "acl/core/bitset.h"
+#include "acl/core/bulk_data_codec.h"
 #include "acl/core/compressed_database.h"
 #include "acl/core/error_result.h"
 #include "acl/core/hash.h"
 #include "acl/core/iallocator.h"
+#include "acl/compression/impl/scalar_segment_context.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 namespace acl
 {
@@ -72,6 +76,52 @@ namespace acl
 			uint32_t num_frames = 0;				// Number of keyframes in clip
 		};
 
+		// Returns the number of segments, scalar tracks must be split into segments
+		inline uint32_t get_db_num_segments(const compressed_tracks& tracks)
+		{
+			if (tracks.get_track_type() == track_type8::qvvf)
+				return get_transform_tracks_header(tracks).num_segments;
+
+			return get_scalar_tracks_header(tracks).get_segments_header()->num_segments;
+		}
+
+		// Returns the index of the first frame of a segment
+		inline uint32_t get_db_segment_start_frame_index(const compressed_tracks& tracks, uint32_t segment_index)
+		{
+			if (tracks.get_track_type() == track_type8::qvvf)
+			{
+				const transform_tracks_header& transforms_header = get_transform_tracks_header(tracks);
+				return transforms_header.has_multiple_segments() ? transforms_header.get_segment_start_indices()[segment_index] : 0;
+			}
+
+			// Every scalar segment has the same number of samples except the last
+			return segment_index * get_scalar_tracks_header(tracks).get_segments_header()->num_samples_per_segment;
+		}
+
+		// Returns a pointer to the animated data of a segment along with the size in bits of each of its frames
+		inline const uint8_t* get_db_segment_animated_data(const compressed_tracks& tracks, uint32_t segment_index, uint32_t& out_frame_bit_size)
+		{
+			if (tracks.get_track_type() == track_type8::qvvf)
+			{
+				const transform_tracks_header& transforms_header = get_transform_tracks_header(tracks);
+				const segment_header& header = transforms_header.get_segment_headers()[segment_index];
+
+				const uint8_t* format_per_track_data;
+				const uint8_t* range_data;
+				const uint8_t* animated_data;
+				transforms_header.get_segment_data(header, format_per_track_data, range_data, animated_data);
+
+				out_frame_bit_size = header.animated_pose_bit_size;
+				return animated_data;
+			}
+
+			const scalar_tracks_header& scalars_header = get_scalar_tracks_header(tracks);
+			const scalar_segment_header& header = scalars_header.get_segment_headers()[segment_index];
+
+			out_frame_bit_size = header.num_bits_per_frame;
+			return header.track_animated_values.add_to(&scalars_header);
+		}
+
 		struct frame_assignment_context
 		{
 			iallocator& allocator;
@@ -79,28 +129,43 @@ namespace acl
 			const compressed_tracks* const* compressed_tracks_list;
 			uint32_t num_compressed_tracks;
 
-			database_tier_mapping mappings[k_num_quality_tiers];		// 0 = high importance, 1 = medium importance, 2 = low importance
+			database_tier_mapping mappings[k_num_quality_tiers];		// 0 = high importance, 1 = medium importance, k_num_database_tiers = lowest importance
 			uint32_t num_movable_frames;
 
 			clip_contributing_error_t* contributing_error_per_clip;		// One instance per clip
 
-			frame_assignment_context(iallocator& allocator_, const compressed_tracks* const* compressed_tracks_list_, uint32_t num_compressed_tracks_, uint32_t num_movable_frames_)
+			uint32_t* clip_layout_order;								// Order in which clips are laid out in the chunks, one entry per clip
+			uint32_t* clip_header_offsets;								// Offset of the runtime clip header of every clip
+
+			frame_assignment_context(iallocator& allocator_, const compressed_tracks* const* compressed_tracks_list_, uint32_t num_compressed_tracks_, uint32_t num_movable_frames_, uint32_t first_clip_header_offset)
 				: allocator(allocator_)
 				, compressed_tracks_list(compressed_tracks_list_)
 				, num_compressed_tracks(num_compressed_tracks_)
 				, num_movable_frames(num_movable_frames_)
 				, contributing_error_per_clip(allocate_type_array<clip_contributing_error_t>(allocator_, num_compressed_tracks_))
+				, clip_layout_order(allocate_type_array<uint32_t>(allocator_, num_compressed_tracks_))
+				, clip_header_offsets(allocate_type_array<uint32_t>(allocator_, num_compressed_tracks_))
 			{
-				mappings[0].tier = quality_tier::highest_importance;
-				mappings[1].tier = quality_tier::medium_importance;
-				mappings[2].tier = quality_tier::lowest_importance;
+				for (uint32_t tier_index = 0; tier_index < k_num_quality_tiers; ++tier_index)
+					mappings[tier_index].tier = quality_tier(tier_index);
+
+				// Clips are laid out in the order provided by default and their runtime headers always follow that order
+				// When appending to an existing database, our runtime headers follow the existing ones
+				uint32_t clip_header_offset = first_clip_header_offset;
+				for (uint32_t list_index = 0; list_index < num_compressed_tracks_; ++list_index)
+				{
+					clip_layout_order[list_index] = list_index;
+					clip_header_offsets[list_index] = clip_header_offset;
+
+					clip_header_offset += sizeof(database_runtime_clip_header);
+					clip_header_offset += sizeof(database_runtime_segment_header) * get_db_num_segments(*compressed_tracks_list_[list_index]);
+				}
 
 				// Setup our error metadata to make iterating on it easier and track what has been assigned
 				for (uint32_t list_index = 0; list_index < num_compressed_tracks_; ++list_index)
 				{
 					const compressed_tracks* tracks = compressed_tracks_list_[list_index];
 					const tracks_header& header = get_tracks_header(*tracks);
-					const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
 					const optional_metadata_header& metadata_header = get_optional_metadata_header(*tracks);
 
 					clip_contributing_error_t& clip_error = contributing_error_per_clip[list_index];
@@ -112,6 +177,9 @@ namespace acl
 					}
 					else
 					{
+						// Only transform tracks could be bound to a database with older versions
+						const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
+
 						// Allocate and populate
 						keyframe_stripping_metadata_t* keyframe_metadata = allocate_type_array<keyframe_stripping_metadata_t>(allocator_, header.num_samples);
 
@@ -173,6 +241,8 @@ namespace acl
 				}
 
 				deallocate_type_array(allocator, contributing_error_per_clip, num_compressed_tracks);
+				deallocate_type_array(allocator, clip_layout_order, num_compressed_tracks);
+				deallocate_type_array(allocator, clip_header_offsets, num_compressed_tracks);
 			}
 
 			frame_assignment_context(const frame_assignment_context&) = delete;
@@ -216,7 +286,6 @@ namespace acl
 				const compressed_tracks* tracks = compressed_tracks_list[list_index];
 
 				const tracks_header& header = get_tracks_header(*tracks);
-				const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
 
 				// A frame is movable if it isn't the first or last frame of a segment
 				// If we have more than 1 frame, we can remove 2 frames per segment
@@ -224,7 +293,7 @@ namespace acl
 				// a single frame and thus has one segment
 				// If we have 0 or 1 frame, none are movable
 				if (header.num_samples >= 2)
-					num_movable_frames += header.num_samples - (transform_header.num_segments * 2);
+					num_movable_frames += header.num_samples - (get_db_num_segments(*tracks) * 2);
 			}
 
 			return num_movable_frames;
@@ -237,9 +306,8 @@ namespace acl
 			for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
 			{
 				const compressed_tracks* tracks = compressed_tracks_list[list_index];
-				const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
 
-				num_segments += transform_header.num_segments;
+				num_segments += get_db_num_segments(*tracks);
 			}
 
 			return num_segments;
@@ -257,10 +325,6 @@ namespace acl
 				for (uint32_t list_index = 0; list_index < context.num_compressed_tracks; ++list_index)
 				{
 					const compressed_tracks* tracks = context.compressed_tracks_list[list_index];
-					const transform_tracks_header& transforms_header = get_transform_tracks_header(*tracks);
-					const bool has_multiple_segments = transforms_header.has_multiple_segments();
-					const uint32_t* segment_start_indices = has_multiple_segments ? transforms_header.get_segment_start_indices() : nullptr;
-					const segment_header* segment_headers = transforms_header.get_segment_headers();
 
 					const clip_contributing_error_t& clip_error = context.contributing_error_per_clip[list_index];
 
@@ -279,17 +343,15 @@ namespace acl
 						// This frame has a lower error, use it
 						const uint32_t segment_index = next_keyframe_to_strip.segment_index;
 
-						const uint8_t* format_per_track_data;
-						const uint8_t* range_data;
-						const uint8_t* animated_data;
-						transforms_header.get_segment_data(segment_headers[segment_index], format_per_track_data, range_data, animated_data);
+						uint32_t frame_bit_size;
+						const uint8_t* animated_data = get_db_segment_animated_data(*tracks, segment_index, frame_bit_size);
 
-						const uint32_t segment_start_frame_index = has_multiple_segments ? segment_start_indices[segment_index] : 0;
+						const uint32_t segment_start_frame_index = get_db_segment_start_frame_index(*tracks, segment_index);
 
 						best_mapping.animated_data = animated_data;
 						best_mapping.tracks_index = list_index;
 						best_mapping.segment_index = segment_index;
-						best_mapping.frame_bit_size = segment_headers[segment_index].animated_pose_bit_size;
+						best_mapping.frame_bit_size = frame_bit_size;
 						best_mapping.clip_frame_index = next_keyframe_to_strip.keyframe_index;
 						best_mapping.segment_frame_index = next_keyframe_to_strip.keyframe_index - segment_start_frame_index;
 						best_mapping.contributing_error = next_keyframe_to_strip.stripping_error;
@@ -332,11 +394,10 @@ namespace acl
 
 		inline void assign_frames_to_tiers(frame_assignment_context& context)
 		{
-			// Assign frames to our lowest importance tier first
-			assign_frames_to_tier(context, context.get_tier_mapping(quality_tier::lowest_importance));
-
-			// Assign frames to our medium importance tier next
-			assign_frames_to_tier(context, context.get_tier_mapping(quality_tier::medium_importance));
+			// Assign frames to our lowest importance tier first and work our way up to the medium importance tier
+			// Each tier refines the key frames present in the tiers of higher importance
+			for (uint32_t tier_index = k_num_database_tiers; tier_index >= 1; --tier_index)
+				assign_frames_to_tier(context, context.get_tier_mapping(quality_tier(tier_index)));
 
 			// Then our high importance tier
 			assign_frames_to_tier(context, context.get_tier_mapping(quality_tier::highest_importance));
@@ -351,6 +412,121 @@ namespace acl
 #endif
 		}
 
+		// Finds the last clip of the chain that contains the provided clip, walking away from the provided neighbor
+		inline uint32_t find_clip_chain_end(const uint32_t* clip_neighbors, uint32_t clip_index, uint32_t prev_clip_index)
+		{
+			while (true)
+			{
+				const uint32_t neighbor0 = clip_neighbors[clip_index * 2 + 0];
+				const uint32_t neighbor1 = clip_neighbors[clip_index * 2 + 1];
+				const uint32_t next_clip_index = neighbor0 != prev_clip_index ? neighbor0 : neighbor1;
+				if (next_clip_index == k_invalid_track_index || next_clip_index == prev_clip_index)
+					return clip_index;
+
+				prev_clip_index = clip_index;
+				clip_index = next_clip_index;
+			}
+		}
+
+		// Orders our clips such that clips used together are laid out next to each other and end up sharing chunks.
+		// Edges are processed by decreasing weight and link two chains of clips when both clips are at the end of
+		// their respective chain. Chains are then laid out in the order of their smallest clip index.
+		inline void build_clip_layout_order(frame_assignment_context& context, const compression_database_settings& settings)
+		{
+			const uint32_t num_clips = context.num_compressed_tracks;
+			const uint32_t num_edges = settings.num_clip_co_usage_edges;
+			if (num_edges == 0 || num_clips <= 2)
+				return;	// Nothing to reorder
+
+			iallocator& allocator = context.allocator;
+			const database_clip_co_usage* edges = settings.clip_co_usage;
+
+			uint32_t* edge_order = allocate_type_array<uint32_t>(allocator, num_edges);
+			for (uint32_t edge_index = 0; edge_index < num_edges; ++edge_index)
+				edge_order[edge_index] = edge_index;
+
+			// Heaviest edges first, ties keep the order provided to remain deterministic
+			auto sort_predicate = [edges](uint32_t lhs_edge_index, uint32_t rhs_edge_index) { return edges[lhs_edge_index].weight > edges[rhs_edge_index].weight; };
+			std::stable_sort(edge_order, edge_order + num_edges, sort_predicate);
+
+			// Every clip has up to two neighbors within its chain and a parent used to find which chain it belongs to
+			uint32_t* clip_neighbors = allocate_type_array<uint32_t>(allocator, num_clips * 2);
+			uint32_t* chain_parents = allocate_type_array<uint32_t>(allocator, num_clips);
+			for (uint32_t clip_index = 0; clip_index < num_clips; ++clip_index)
+			{
+				clip_neighbors[clip_index * 2 + 0] = k_invalid_track_index;
+				clip_neighbors[clip_index * 2 + 1] = k_invalid_track_index;
+				chain_parents[clip_index] = clip_index;
+			}
+
+			auto find_chain_root = [chain_parents](uint32_t clip_index)
+			{
+				while (chain_parents[clip_index] != clip_index)
+				{
+					chain_parents[clip_index] = chain_parents[chain_parents[clip_index]];
+					clip_index = chain_parents[clip_index];
+				}
+
+				return clip_index;
+			};
+
+			for (uint32_t sorted_edge_index = 0; sorted_edge_index < num_edges; ++sorted_edge_index)
+			{
+				const database_clip_co_usage& edge = edges[edge_order[sorted_edge_index]];
+				const uint32_t clip_index0 = edge.clip_index0;
+				const uint32_t clip_index1 = edge.clip_index1;
+				if (edge.weight == 0 || clip_index0 == clip_index1)
+					continue;	// Nothing to link
+
+				// Only the ends of a chain can be linked
+				if (clip_neighbors[clip_index0 * 2 + 1] != k_invalid_track_index || clip_neighbors[clip_index1 * 2 + 1] != k_invalid_track_index)
+					continue;
+
+				// Linking two clips from the same chain would form a loop
+				const uint32_t chain_root0 = find_chain_root(clip_index0);
+				const uint32_t chain_root1 = find_chain_root(clip_index1);
+				if (chain_root0 == chain_root1)
+					continue;
+
+				clip_neighbors[clip_index0 * 2 + (clip_neighbors[clip_index0 * 2 + 0] == k_invalid_track_index ? 0 : 1)] = clip_index1;
+				clip_neighbors[clip_index1 * 2 + (clip_neighbors[clip_index1 * 2 + 0] == k_invalid_track_index ? 0 : 1)] = clip_index0;
+				chain_parents[chain_root1] = chain_root0;
+			}
+
+			// Lay out every chain starting from one of its ends
+			bool* is_clip_laid_out = allocate_type_array<bool>(allocator, num_clips);
+			std::fill(is_clip_laid_out, is_clip_laid_out + num_clips, false);
+
+			uint32_t layout_index = 0;
+			for (uint32_t clip_index = 0; clip_index < num_clips; ++clip_index)
+			{
+				if (is_clip_laid_out[clip_index])
+					continue;	// Already part of an earlier chain
+
+				uint32_t prev_clip_index = k_invalid_track_index;
+				uint32_t chain_clip_index = find_clip_chain_end(clip_neighbors, clip_index, k_invalid_track_index);
+				while (chain_clip_index != k_invalid_track_index)
+				{
+					context.clip_layout_order[layout_index++] = chain_clip_index;
+					is_clip_laid_out[chain_clip_index] = true;
+
+					const uint32_t neighbor0 = clip_neighbors[chain_clip_index * 2 + 0];
+					const uint32_t neighbor1 = clip_neighbors[chain_clip_index * 2 + 1];
+					const uint32_t next_clip_index = neighbor0 != prev_clip_index ? neighbor0 : neighbor1;
+
+					prev_clip_index = chain_clip_index;
+					chain_clip_index = next_clip_index != prev_clip_index ? next_clip_index : k_invalid_track_index;
+				}
+			}
+
+			ACL_ASSERT(layout_index == num_clips, "Every clip should have been laid out");
+
+			deallocate_type_array(allocator, is_clip_laid_out, num_clips);
+			deallocate_type_array(allocator, chain_parents, num_clips);
+			deallocate_type_array(allocator, clip_neighbors, num_clips * 2);
+			deallocate_type_array(allocator, edge_order, num_edges);
+		}
+
 		inline uint32_t find_first_metadata_offset(const optional_metadata_header& header)
 		{
 			if (header.track_list_name.is_valid())
@@ -438,6 +614,89 @@ namespace acl
 			return ~0U;
 		}
 
+		// Returns the size of the optional metadata once the contributing error is stripped
+		inline uint32_t get_stripped_metadata_size(const optional_metadata_header& input_metadata_header)
+		{
+			const uint32_t metadata_track_list_name_size = get_metadata_track_list_name_size(input_metadata_header);
+			const uint32_t metadata_track_names_size = get_metadata_track_names_size(input_metadata_header);
+			const uint32_t metadata_parent_track_indices_size = get_metadata_parent_track_indices_size(input_metadata_header);
+			const uint32_t metadata_track_descriptions_size = get_metadata_track_descriptions_size(input_metadata_header);
+			const uint32_t metadata_contributing_error_size = 0;	// We'll strip it!
+
+			uint32_t metadata_size = 0;
+			metadata_size += metadata_track_list_name_size;
+			metadata_size = align_to(metadata_size, 4);
+			metadata_size += metadata_track_names_size;
+			metadata_size = align_to(metadata_size, 4);
+			metadata_size += metadata_parent_track_indices_size;
+			metadata_size = align_to(metadata_size, 4);
+			metadata_size += metadata_track_descriptions_size;
+			metadata_size = align_to(metadata_size, 4);
+			metadata_size += metadata_contributing_error_size;
+
+			return metadata_size;
+		}
+
+		// Copies the optional metadata into the new compressed tracks buffer, the contributing error is stripped
+		// The optional metadata header lives at the end of the buffer
+		inline void write_stripped_metadata(const compressed_tracks& input_tracks, uint8_t* buffer_start, uint32_t buffer_size, uint32_t metadata_start_offset, uint32_t metadata_size)
+		{
+			const optional_metadata_header& input_metadata_header = get_optional_metadata_header(input_tracks);
+			compressed_tracks& output_tracks = *reinterpret_cast<compressed_tracks*>(buffer_start);
+
+			const uint32_t metadata_track_list_name_size = get_metadata_track_list_name_size(input_metadata_header);
+			const uint32_t metadata_track_names_size = get_metadata_track_names_size(input_metadata_header);
+			const uint32_t metadata_parent_track_indices_size = get_metadata_parent_track_indices_size(input_metadata_header);
+			const uint32_t metadata_track_descriptions_size = get_metadata_track_descriptions_size(input_metadata_header);
+
+			optional_metadata_header* metadata_header = reinterpret_cast<optional_metadata_header*>(buffer_start + buffer_size - sizeof(optional_metadata_header));
+			uint32_t metadata_offset = metadata_start_offset;	// Relative to the start of our compressed_tracks
+
+			// Setup our metadata offsets
+			if (metadata_track_list_name_size != 0)
+			{
+				metadata_header->track_list_name = metadata_offset;
+				metadata_offset += metadata_track_list_name_size;
+			}
+			else
+				metadata_header->track_list_name = invalid_ptr_offset();
+
+			if (metadata_track_names_size != 0)
+			{
+				metadata_header->track_name_offsets = metadata_offset;
+				metadata_offset += metadata_track_names_size;
+			}
+			else
+				metadata_header->track_name_offsets = invalid_ptr_offset();
+
+			if (metadata_parent_track_indices_size != 0)
+			{
+				metadata_header->parent_track_indices = metadata_offset;
+				metadata_offset += metadata_parent_track_indices_size;
+			}
+			else
+				metadata_header->parent_track_indices = invalid_ptr_offset();
+
+			if (metadata_track_descriptions_size != 0)
+			{
+				metadata_header->track_descriptions = metadata_offset;
+				metadata_offset += metadata_track_descriptions_size;
+			}
+			else
+				metadata_header->track_descriptions = invalid_ptr_offset();
+
+			// Strip the contributing error data, no longer needed
+			metadata_header->contributing_error = invalid_ptr_offset();
+
+			ACL_ASSERT((metadata_offset - metadata_start_offset) == metadata_size, "Unexpected metadata size"); (void)metadata_size;
+
+			// Copy our metadata, it does not change
+			std::memcpy(metadata_header->get_track_list_name(output_tracks), input_metadata_header.get_track_list_name(input_tracks), metadata_track_list_name_size);
+			std::memcpy(metadata_header->get_track_name_offsets(output_tracks), input_metadata_header.get_track_name_offsets(input_tracks), metadata_track_names_size);
+			std::memcpy(metadata_header->get_parent_track_indices(output_tracks), input_metadata_header.get_parent_track_indices(input_tracks), metadata_parent_track_indices_size);
+			std::memcpy(metadata_header->get_track_descriptions(output_tracks), input_metadata_header.get_track_descriptions(input_tracks), metadata_track_descriptions_size);
+		}
+
 		inline uint32_t build_sample_indices(const database_tier_mapping& tier_mapping, uint32_t tracks_index, uint32_t segment_index)
 		{
 			// TODO: Binary search our first entry and bail out once done?
@@ -549,16 +808,230 @@ namespace acl
 			}
 		}
 
+		inline compressed_tracks* build_compressed_scalar_tracks(const frame_assignment_context& context, uint32_t list_index, uint32_t clip_header_offset)
+		{
+			const bitset_description desc = bitset_description::make_from_num_bits<32>();
+
+			const database_tier_mapping& tier_mapping = context.get_tier_mapping(quality_tier::highest_importance);
+
+			const compressed_tracks* input_tracks = context.compressed_tracks_list[list_index];
+
+			const tracks_header& input_header = get_tracks_header(*input_tracks);
+			const scalar_tracks_header& input_scalars_header = get_scalar_tracks_header(*input_tracks);
+			const scalar_segments_header& input_segments_header = *input_scalars_header.get_segments_header();
+			const scalar_segment_header* input_segment_headers = input_scalars_header.get_segment_headers();
+			const optional_metadata_header& input_metadata_header = get_optional_metadata_header(*input_tracks);
+
+			const uint32_t num_segments = input_segments_header.num_segments;
+			const uint32_t segment_headers_size = sizeof(scalar_segment_header) * num_segments;
+
+			// The data from our first segment follows the constant data, use that to calculate our size
+			const uint32_t constant_values_size = (uint32_t)input_segment_headers[0].metadata_per_track - (uint32_t)input_scalars_header.track_constant_values;
+
+			// Calculate the new size of our track list
+			uint32_t buffer_size = 0;
+
+			// Per track list data
+			buffer_size += sizeof(raw_buffer_header);							// Header
+			buffer_size += sizeof(tracks_header);								// Header
+			buffer_size += sizeof(scalar_tracks_header);						// Header
+			buffer_size += sizeof(scalar_segments_header);						// Header
+			buffer_size += segment_headers_size;								// Segment headers
+
+			buffer_size = align_to(buffer_size, 4);								// Align database header
+			buffer_size += sizeof(tracks_database_header);						// Database header
+
+			buffer_size = align_to(buffer_size, 4);								// Align constant values
+			buffer_size += constant_values_size;								// Constant values
+
+			uint32_t num_remaining_keyframes = 0;
+
+			// Per segment data
+			for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+			{
+				const scalar_segment_header& input_segment_header = input_segment_headers[segment_index];
+
+				// Range values follow the per track metadata, use it to calculate our size
+				const uint32_t metadata_per_track_size = (uint32_t)input_segment_header.track_range_values - (uint32_t)input_segment_header.metadata_per_track;
+
+				// Animated values follow the range values, use it to calculate our size
+				const uint32_t range_values_size = (uint32_t)input_segment_header.track_animated_values - (uint32_t)input_segment_header.track_range_values;
+
+				buffer_size += metadata_per_track_size;							// Per track metadata
+				buffer_size = align_to(buffer_size, 4);							// Align range values
+				buffer_size += range_values_size;								// Range values
+
+				// Check our data mapping to find our how many frames we'll retain
+				const uint32_t sample_indices = build_sample_indices(tier_mapping, list_index, segment_index);
+				const uint32_t num_animated_frames = bitset_count_set_bits(&sample_indices, desc);
+
+				num_remaining_keyframes += num_animated_frames;
+
+				buffer_size += ((num_animated_frames * input_segment_header.num_bits_per_frame) + 7) / 8;	// Animated values
+			}
+
+			const uint32_t num_stripped_keyframes = input_header.num_samples - num_remaining_keyframes;
+
+			// Optional metadata
+			const uint32_t metadata_start_offset = align_to(buffer_size, 4);
+			const uint32_t metadata_size = get_stripped_metadata_size(input_metadata_header);
+
+			if (metadata_size != 0)
+			{
+				buffer_size = align_to(buffer_size, 4);
+				buffer_size += metadata_size;
+
+				buffer_size = align_to(buffer_size, 4);
+				buffer_size += sizeof(optional_metadata_header);
+			}
+			else
+				buffer_size += 15;	// Ensure we have sufficient padding for unaligned 16 byte loads
+
+			// Allocate our new buffer
+			uint8_t* buffer = allocate_type_array_aligned<uint8_t>(context.allocator, buffer_size, alignof(compressed_tracks));
+			std::memset(buffer, 0, buffer_size);
+
+			uint8_t* buffer_start = buffer;
+			compressed_tracks* out_compressed_tracks = reinterpret_cast<compressed_tracks*>(buffer);
+
+			raw_buffer_header* buffer_header = safe_ptr_cast<raw_buffer_header>(buffer);
+			buffer += sizeof(raw_buffer_header);
+
+			tracks_header* header = safe_ptr_cast<tracks_header>(buffer);
+			buffer += sizeof(tracks_header);
+
+			// Copy our header and update the parts that change
+			std::memcpy(header, &input_header, sizeof(tracks_header));
+
+			header->set_has_database(true);
+			header->set_has_stripped_keyframes(num_stripped_keyframes != 0);
+			header->set_has_metadata(metadata_size != 0);
+
+			scalar_tracks_header* scalars_header = safe_ptr_cast<scalar_tracks_header>(buffer);
+			buffer += sizeof(scalar_tracks_header);
+
+			// Copy our header, the offsets are updated below
+			std::memcpy(scalars_header, &input_scalars_header, sizeof(scalar_tracks_header));
+
+			const uint8_t* packed_data_start_offset = buffer - sizeof(scalar_tracks_header);	// Relative to our header
+
+			scalar_segments_header* segments_header = safe_ptr_cast<scalar_segments_header>(buffer);
+			buffer += sizeof(scalar_segments_header);
+
+			segments_header->num_segments = num_segments;
+			segments_header->num_samples_per_segment = input_segments_header.num_samples_per_segment;
+
+			scalar_segment_header* segment_headers = safe_ptr_cast<scalar_segment_header>(buffer);
+			buffer += segment_headers_size;
+
+			// Setup our database header
+			buffer = align_to(buffer, 4);
+			segments_header->database_header = uint32_t(buffer - packed_data_start_offset);
+
+			tracks_database_header* tracks_db_header = safe_ptr_cast<tracks_database_header>(buffer);
+			buffer += sizeof(tracks_database_header);
+
+			tracks_db_header->clip_header_offset = clip_header_offset;
+
+			// Copy our constant values, they do not change
+			buffer = align_to(buffer, 4);
+			scalars_header->track_constant_values = uint32_t(buffer - packed_data_start_offset);
+			std::memcpy(buffer, input_scalars_header.get_track_constant_values(), constant_values_size);
+			buffer += constant_values_size;
+
+			// Write our new segment headers and data
+			for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+			{
+				const scalar_segment_header& input_segment_header = input_segment_headers[segment_index];
+				scalar_segment_header& segment_header = segment_headers[segment_index];
+
+				const uint32_t metadata_per_track_size = (uint32_t)input_segment_header.track_range_values - (uint32_t)input_segment_header.metadata_per_track;
+				const uint32_t range_values_size = (uint32_t)input_segment_header.track_animated_values - (uint32_t)input_segment_header.track_range_values;
+
+				segment_header.num_bits_per_frame = input_segment_header.num_bits_per_frame;
+				segment_header.sample_indices = build_sample_indices(tier_mapping, list_index, segment_index);
+
+				// Copy our per track metadata, it does not change
+				segment_header.metadata_per_track = uint32_t(buffer - packed_data_start_offset);
+				std::memcpy(buffer, input_segment_header.metadata_per_track.add_to(&input_scalars_header), metadata_per_track_size);
+				buffer += metadata_per_track_size;
+
+				// Copy our range values, they do not change
+				buffer = align_to(buffer, 4);
+				segment_header.track_range_values = uint32_t(buffer - packed_data_start_offset);
+				std::memcpy(buffer, input_segment_header.track_range_values.add_to(&input_scalars_header), range_values_size);
+				buffer += range_values_size;
+
+				// Populate our new animated values from our sorted frame mapping data
+				segment_header.track_animated_values = uint32_t(buffer - packed_data_start_offset);
+
+				uint64_t output_animated_bit_offset = 0;
+				for (uint32_t frame_index = 0; frame_index < tier_mapping.num_frames; ++frame_index)
+				{
+					const frame_tier_mapping& frame = tier_mapping.frames[frame_index];
+					if (frame.tracks_index != list_index)
+						continue;	// This is not the tracks instance we care about
+
+					if (frame.segment_index != segment_index)
+						continue;	// This is not the segment we care about
+
+					// Append this frame
+					const uint32_t input_animated_bit_offset = frame.segment_frame_index * frame.frame_bit_size;
+					memcpy_bits(buffer, output_animated_bit_offset, frame.animated_data, input_animated_bit_offset, frame.frame_bit_size);
+					output_animated_bit_offset += frame.frame_bit_size;
+				}
+
+				buffer += uint32_t(output_animated_bit_offset + 7) / 8;
+			}
+
+			// The clip wide offsets point to our first segment
+			scalars_header->num_bits_per_frame = segment_headers[0].num_bits_per_frame;
+			scalars_header->metadata_per_track = segment_headers[0].metadata_per_track;
+			scalars_header->track_range_values = segment_headers[0].track_range_values;
+			scalars_header->track_animated_values = segment_headers[0].track_animated_values;
+
+			if (metadata_size != 0)
+			{
+				buffer = align_to(buffer, 4);
+				buffer += metadata_size;
+
+				buffer = align_to(buffer, 4);
+				buffer += sizeof(optional_metadata_header);
+
+				// Copy our metadata and strip the contributing error
+				write_stripped_metadata(*input_tracks, buffer_start, buffer_size, metadata_start_offset, metadata_size);
+			}
+			else
+				buffer += 15;
+
+			(void)buffer_start;	// Avoid VS2017 bug, it falsely reports this variable as unused even when asserts are enabled
+			ACL_ASSERT((buffer_start + buffer_size) == buffer, "Buffer size and pointer mismatch");
+
+			// Finish the compressed tracks raw buffer header
+			buffer_header->size = buffer_size;
+			buffer_header->hash = hash32(safe_ptr_cast<const uint8_t>(header), buffer_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+
+			ACL_ASSERT(out_compressed_tracks->is_valid(true).empty(), "Failed to build compressed tracks");
+
+			return out_compressed_tracks;
+		}
+
 		inline void build_compressed_tracks(const frame_assignment_context& context, compressed_tracks** out_compressed_tracks)
 		{
 			const bitset_description desc = bitset_description::make_from_num_bits<32>();
 
 			const database_tier_mapping& tier_mapping = context.get_tier_mapping(quality_tier::highest_importance);
-			uint32_t clip_header_offset = 0;
 
 			for (uint32_t list_index = 0; list_index < context.num_compressed_tracks; ++list_index)
 			{
 				const compressed_tracks* input_tracks = context.compressed_tracks_list[list_index];
+				const uint32_t clip_header_offset = context.clip_header_offsets[list_index];
+
+				if (input_tracks->get_track_type() != track_type8::qvvf)
+				{
+					out_compressed_tracks[list_index] = build_compressed_scalar_tracks(context, list_index, clip_header_offset);
+					continue;
+				}
 
 				const tracks_header& input_header = get_tracks_header(*input_tracks);
 				const transform_tracks_header& input_transforms_header = get_transform_tracks_header(*input_tracks);
@@ -573,7 +1046,12 @@ namespace acl
 				// For example, if we have 3 tracks made up of rotation/translation we'll have one entry for each with unused padding
 				// All rotation types come first, followed by all translation types, and with scale types at the end when present
 				const uint32_t num_sub_track_entries = ((input_header.num_tracks + k_num_sub_tracks_per_packed_entry - 1) / k_num_sub_tracks_per_packed_entry) * num_sub_tracks_per_bone;
-				const uint32_t packed_sub_track_buffer_size = num_sub_track_entries * sizeof(packed_sub_track_types);
+				const uint32_t packed_sub_track_types_size = num_sub_track_entries * sizeof(packed_sub_track_types);
+
+				// The optional prefix index follows the packed sub-track types, along with the bit size prefixes of every segment
+				const uint32_t segment_bit_size_prefixes_size = get_num_segment_bit_size_prefixes(input_transforms_header.num_animated_variable_sub_tracks) * input_transforms_header.num_segments * uint32_t(sizeof(uint32_t));
+				const uint32_t packed_sub_track_prefix_index_size = input_header.get_has_sub_track_prefix_index() ? (num_sub_track_entries * sizeof(packed_sub_track_prefix_counts) + segment_bit_size_prefixes_size) : 0;
+				const uint32_t packed_sub_track_buffer_size = packed_sub_track_types_size + packed_sub_track_prefix_index_size;
 
 				// Adding an extra index at the end to delimit things, the index is always invalid: 0xFFFFFFFF
 				const uint32_t segment_start_indices_size = input_transforms_header.num_segments > 1 ? (uint32_t(sizeof(uint32_t)) * (input_transforms_header.num_segments + 1)) : 0;
@@ -602,7 +1080,7 @@ namespace acl
 				buffer_size += sizeof(tracks_database_header);						// Database header
 
 				buffer_size = align_to(buffer_size, 4);								// Align sub-track types
-				buffer_size += packed_sub_track_buffer_size;						// Packed sub-track types sorted by type
+				buffer_size += packed_sub_track_buffer_size;						// Packed sub-track types sorted by type and optional prefix index
 				buffer_size = align_to(buffer_size, 4);								// Align constant track data
 				buffer_size += constant_data_size;									// Constant track data
 				buffer_size = align_to(buffer_size, 4);								// Align range data
@@ -646,22 +1124,7 @@ namespace acl
 
 				// Optional metadata
 				const uint32_t metadata_start_offset = align_to(buffer_size, 4);
-				const uint32_t metadata_track_list_name_size = get_metadata_track_list_name_size(input_metadata_header);
-				const uint32_t metadata_track_names_size = get_metadata_track_names_size(input_metadata_header);
-				const uint32_t metadata_parent_track_indices_size = get_metadata_parent_track_indices_size(input_metadata_header);
-				const uint32_t metadata_track_descriptions_size = get_metadata_track_descriptions_size(input_metadata_header);
-				const uint32_t metadata_contributing_error_size = 0;	// We'll strip it!
-
-				uint32_t metadata_size = 0;
-				metadata_size += metadata_track_list_name_size;
-				metadata_size = align_to(metadata_size, 4);
-				metadata_size += metadata_track_names_size;
-				metadata_size = align_to(metadata_size, 4);
-				metadata_size += metadata_parent_track_indices_size;
-				metadata_size = align_to(metadata_size, 4);
-				metadata_size += metadata_track_descriptions_size;
-				metadata_size = align_to(metadata_size, 4);
-				metadata_size += metadata_contributing_error_size;
+				const uint32_t metadata_size = get_stripped_metadata_size(input_metadata_header);
 
 				if (metadata_size != 0)
 				{
@@ -715,15 +1178,11 @@ namespace acl
 				tracks_database_header* tracks_db_header = transforms_header->get_database_header();
 				tracks_db_header->clip_header_offset = clip_header_offset;
 
-				// Update our clip header offset
-				clip_header_offset += sizeof(database_runtime_clip_header);
-				clip_header_offset += sizeof(database_runtime_segment_header) * input_transforms_header.num_segments;
-
 				// Write our new segment headers
 				const uint32_t segment_data_base_offset = transforms_header->clip_range_data_offset + clip_range_data_size;
 				rewrite_segment_headers(tier_mapping, list_index, input_transforms_header, input_segment_headers, segment_data_base_offset, transforms_header->get_stripped_segment_headers());
 
-				// Copy our sub-track types, they do not change
+				// Copy our sub-track types and their prefix index if present, they do not change
 				std::memcpy(transforms_header->get_sub_track_types(), input_transforms_header.get_sub_track_types(), packed_sub_track_buffer_size);
 
 				// Copy our constant track data, it does not change
@@ -735,55 +1194,9 @@ namespace acl
 				// Write our new segment data
 				rewrite_segment_data(tier_mapping, list_index, input_transforms_header, input_segment_headers, *transforms_header, transforms_header->get_stripped_segment_headers());
 
+				// Copy our metadata and strip the contributing error
 				if (metadata_size != 0)
-				{
-					optional_metadata_header* metadata_header = reinterpret_cast<optional_metadata_header*>(buffer_start + buffer_size - sizeof(optional_metadata_header));
-					uint32_t metadata_offset = metadata_start_offset;	// Relative to the start of our compressed_tracks
-
-					// Setup our metadata offsets
-					if (metadata_track_list_name_size != 0)
-					{
-						metadata_header->track_list_name = metadata_offset;
-						metadata_offset += metadata_track_list_name_size;
-					}
-					else
-						metadata_header->track_list_name = invalid_ptr_offset();
-
-					if (metadata_track_names_size != 0)
-					{
-						metadata_header->track_name_offsets = metadata_offset;
-						metadata_offset += metadata_track_names_size;
-					}
-					else
-						metadata_header->track_name_offsets = invalid_ptr_offset();
-
-					if (metadata_parent_track_indices_size != 0)
-					{
-						metadata_header->parent_track_indices = metadata_offset;
-						metadata_offset += metadata_parent_track_indices_size;
-					}
-					else
-						metadata_header->parent_track_indices = invalid_ptr_offset();
-
-					if (metadata_track_descriptions_size != 0)
-					{
-						metadata_header->track_descriptions = metadata_offset;
-						metadata_offset += metadata_track_descriptions_size;
-					}
-					else
-						metadata_header->track_descriptions = invalid_ptr_offset();
-
-					// Strip the contributing error data, no longer needed
-					metadata_header->contributing_error = invalid_ptr_offset();
-
-					ACL_ASSERT((metadata_offset - metadata_start_offset) == metadata_size, "Unexpected metadata size");
-
-					// Copy our metadata, it does not change
-					std::memcpy(metadata_header->get_track_list_name(*out_compressed_tracks[list_index]), input_metadata_header.get_track_list_name(*input_tracks), metadata_track_list_name_size);
-					std::memcpy(metadata_header->get_track_name_offsets(*out_compressed_tracks[list_index]), input_metadata_header.get_track_name_offsets(*input_tracks), metadata_track_names_size);
-					std::memcpy(metadata_header->get_parent_track_indices(*out_compressed_tracks[list_index]), input_metadata_header.get_parent_track_indices(*input_tracks), metadata_parent_track_indices_size);
-					std::memcpy(metadata_header->get_track_descriptions(*out_compressed_tracks[list_index]), input_metadata_header.get_track_descriptions(*input_tracks), metadata_track_descriptions_size);
-				}
+					write_stripped_metadata(*input_tracks, buffer_start, buffer_size, metadata_start_offset, metadata_size);
 
 				// Finish the compressed tracks raw buffer header
 				buffer_header->size = buffer_size;
@@ -794,28 +1207,117 @@ namespace acl
 		}
 
 		// Returns the number of clips written
-		inline uint32_t write_database_clip_metadata(const compressed_tracks* const* db_compressed_tracks_list, uint32_t num_tracks, database_clip_metadata* clip_metadatas)
+		inline uint32_t write_database_clip_metadata(const frame_assignment_context& context, const compressed_tracks* const* db_compressed_tracks_list, database_clip_metadata* clip_metadatas)
 		{
+			const uint32_t num_tracks = context.num_compressed_tracks;
 			if (clip_metadatas == nullptr)
 				return num_tracks;	// Nothing to write
 
-			uint32_t clip_header_offset = 0;
-
 			for (uint32_t tracks_index = 0; tracks_index < num_tracks; ++tracks_index)
 			{
 				const compressed_tracks* tracks = db_compressed_tracks_list[tracks_index];
 
 				database_clip_metadata& clip_metadata = clip_metadatas[tracks_index];
 				clip_metadata.clip_hash = tracks->get_hash();
-				clip_metadata.clip_header_offset = clip_header_offset;
-
-				const transform_tracks_header& transforms_header = get_transform_tracks_header(*tracks);
-				clip_header_offset += sizeof(database_runtime_clip_header) + sizeof(database_runtime_segment_header) * transforms_header.num_segments;
+				clip_metadata.clip_header_offset = context.clip_header_offsets[tracks_index];
 			}
 
 			return num_tracks;
 		}
 
+		// Inserts every clip in the hash index, see compressed_database::contains(..)
+		inline void write_database_clip_hash_index(const database_clip_metadata* clip_metadatas, uint32_t num_clips, uint32_t* clip_hash_index)
+		{
+			const uint32_t num_slots = get_clip_hash_index_num_slots(num_clips);
+			const uint32_t slot_mask = num_slots - 1;
+
+			std::fill(clip_hash_index, clip_hash_index + num_slots, k_invalid_clip_hash_index_entry);
+
+			for (uint32_t clip_index = 0; clip_index < num_clips; ++clip_index)
+			{
+				uint32_t slot_index = clip_metadatas[clip_index].clip_hash & slot_mask;
+				while (clip_hash_index[slot_index] != k_invalid_clip_hash_index_entry)
+					slot_index = (slot_index + 1) & slot_mask;
+
+				clip_hash_index[slot_index] = clip_index;
+			}
+		}
+
+		// Gathers where the samples of every segment live from the inline bulk data
+		// The runtime segment headers are initialized from it and stream in only needs to mark chunks as loaded
+		inline void write_database_segment_streaming_metadata(database_header& header)
+		{
+			ACL_ASSERT(header.get_is_bulk_data_inline(), "Bulk data must be inline to find the segments of every chunk");
+
+			const database_clip_metadata* clip_metadatas = header.get_clip_metadatas();
+			const database_clip_metadata* clip_metadatas_end = clip_metadatas + header.num_clips;
+			database_segment_streaming_metadata* segment_streaming_metadatas = header.get_segment_streaming_metadatas();
+
+			for (uint32_t segment_index = 0; segment_index < header.num_segments; ++segment_index)
+			{
+				database_segment_streaming_metadata& segment_streaming_metadata = segment_streaming_metadatas[segment_index];
+				for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				{
+					segment_streaming_metadata.chunk_index[tier_index] = k_invalid_chunk_index;
+					segment_streaming_metadata.sample_indices[tier_index] = 0;
+					segment_streaming_metadata.samples_offset[tier_index] = 0;
+				}
+			}
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
+				const uint8_t* bulk_data = header.get_bulk_data(tier_index);
+
+				const uint32_t num_chunks = header.num_chunks[tier_index];
+				for (uint32_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index)
+				{
+					const database_chunk_header* chunk_header = chunk_descriptions[chunk_index].get_chunk_header(bulk_data);
+					const database_chunk_segment_header* chunk_segment_headers = chunk_header->get_segment_headers();
+
+					for (uint32_t chunk_segment_index = 0; chunk_segment_index < chunk_header->num_segments; ++chunk_segment_index)
+					{
+						const database_chunk_segment_header& chunk_segment_header = chunk_segment_headers[chunk_segment_index];
+
+						// Clip metadata is sorted by runtime clip header offset
+						const uint32_t clip_header_offset = chunk_segment_header.clip_header_offset;
+						auto search_predicate = [](const database_clip_metadata& clip_metadata, uint32_t offset) { return uint32_t(clip_metadata.clip_header_offset) < offset; };
+						const database_clip_metadata* clip_metadata = std::lower_bound(clip_metadatas, clip_metadatas_end, clip_header_offset, search_predicate);
+						ACL_ASSERT(clip_metadata != clip_metadatas_end && uint32_t(clip_metadata->clip_header_offset) == clip_header_offset, "Chunk segment references an unknown clip");
+
+						const uint32_t clip_index = uint32_t(clip_metadata - clip_metadatas);
+						const uint32_t segment_index = get_database_runtime_segment_index(clip_index, chunk_segment_header.segment_header_offset);
+						ACL_ASSERT(segment_index < header.num_segments, "Invalid runtime segment index");
+
+						database_segment_streaming_metadata& segment_streaming_metadata = segment_streaming_metadatas[segment_index];
+						segment_streaming_metadata.chunk_index[tier_index] = chunk_index;
+						segment_streaming_metadata.sample_indices[tier_index] = chunk_segment_header.sample_indices;
+						segment_streaming_metadata.samples_offset[tier_index] = chunk_segment_header.samples_offset;
+					}
+				}
+			}
+		}
+
+		// Hashes every chunk from the inline bulk data so streamers can validate them as they arrive
+		inline void write_database_chunk_hashes(database_header& header)
+		{
+			ACL_ASSERT(header.get_is_bulk_data_inline(), "Bulk data must be inline to hash every chunk");
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
+				const uint8_t* bulk_data = header.get_bulk_data(tier_index);
+				uint32_t* chunk_hashes = header.get_chunk_hashes(tier_index);
+
+				const uint32_t num_chunks = header.num_chunks[tier_index];
+				for (uint32_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index)
+				{
+					const database_chunk_description& chunk_description = chunk_descriptions[chunk_index];
+					chunk_hashes[chunk_index] = fast_hash32(chunk_description.get_chunk_header(bulk_data), chunk_description.size);
+				}
+			}
+		}
+
 		// Returns a pointer to the first frame of the given segment and the number of frames contained
 		inline const frame_tier_mapping* find_segment_frames(const database_tier_mapping& tier_mapping, uint32_t tracks_index, uint32_t segment_index, uint32_t& out_num_frames)
 		{
@@ -910,12 +1412,13 @@ namespace acl
 			uint32_t chunk_size = sizeof(database_chunk_header);
 			uint32_t num_chunks = 0;
 
-			for (uint32_t tracks_index = 0; tracks_index < context.num_compressed_tracks; ++tracks_index)
+			for (uint32_t layout_index = 0; layout_index < context.num_compressed_tracks; ++layout_index)
 			{
+				const uint32_t tracks_index = context.clip_layout_order[layout_index];
 				const compressed_tracks* tracks = context.compressed_tracks_list[tracks_index];
-				const transform_tracks_header& transforms_header = get_transform_tracks_header(*tracks);
+				const uint32_t num_segments = get_db_num_segments(*tracks);
 
-				for (uint32_t segment_index = 0; segment_index < transforms_header.num_segments; ++segment_index)
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
 				{
 					uint32_t num_segment_frames;
 					const frame_tier_mapping* segment_frames = find_segment_frames(tier_mapping, tracks_index, segment_index, num_segment_frames);
@@ -961,47 +1464,108 @@ namespace acl
 			return num_chunks;
 		}
 
-		// Returns the size of the bulk data
-		inline uint32_t write_database_bulk_data(const frame_assignment_context& context, const compression_database_settings& settings, quality_tier tier, const compressed_tracks* const* db_compressed_tracks_list, uint8_t* bulk_data)
+		// Writes the range of chunks every clip spans in the specified tier
+		// This must match how write_database_chunk_descriptions(..) splits the chunks
+		inline void write_database_clip_chunk_ranges(const frame_assignment_context& context, const compression_database_settings& settings, quality_tier tier, database_clip_chunk_range* clip_chunk_ranges)
 		{
-			ACL_ASSERT(tier != quality_tier::highest_importance, "No bulk data for the high importance tier");
+			ACL_ASSERT(tier != quality_tier::highest_importance, "No chunks for the high importance tier");
+			const uint32_t tier_index = uint32_t(tier) - 1;
+
 			const database_tier_mapping& tier_mapping = context.get_tier_mapping(tier);
 			if (tier_mapping.is_empty())
-				return 0;	// No data
+			{
+				// No data
+				for (uint32_t tracks_index = 0; tracks_index < context.num_compressed_tracks; ++tracks_index)
+				{
+					clip_chunk_ranges[tracks_index].first_chunk_index[tier_index] = 0;
+					clip_chunk_ranges[tracks_index].num_chunks[tier_index] = 0;
+				}
+
+				return;
+			}
 
 			const uint32_t max_chunk_size = settings.max_chunk_size;
 			const uint32_t simd_padding = 15;
 
-			database_chunk_header* chunk_header = nullptr;
-			database_chunk_segment_header* segment_chunk_headers = nullptr;
-
-			uint32_t bulk_data_offset = 0;
-			uint32_t chunk_sample_data_offset = 0;
 			uint32_t chunk_size = sizeof(database_chunk_header);
 			uint32_t chunk_index = 0;
 
-			uint32_t clip_header_offset = 0;
-
-			if (bulk_data != nullptr)
+			for (uint32_t layout_index = 0; layout_index < context.num_compressed_tracks; ++layout_index)
 			{
-				// Setup our chunk headers
-				chunk_header = safe_ptr_cast<database_chunk_header>(bulk_data);
-				chunk_header->index = chunk_index;
-				chunk_header->size = 0;
+				const uint32_t tracks_index = context.clip_layout_order[layout_index];
+				const compressed_tracks* tracks = context.compressed_tracks_list[tracks_index];
+				const uint32_t num_segments = get_db_num_segments(*tracks);
+
+				uint32_t first_chunk_index = ~0U;
+
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				{
+					uint32_t num_segment_frames;
+					const frame_tier_mapping* segment_frames = find_segment_frames(tier_mapping, tracks_index, segment_index, num_segment_frames);
+
+					const uint32_t segment_data_bit_size = calculate_segment_animated_data_bit_size(segment_frames, num_segment_frames);
+					const uint32_t segment_data_size = (segment_data_bit_size + 7) / 8;
+
+					const uint32_t new_chunk_size = chunk_size + segment_data_size + simd_padding + sizeof(database_chunk_segment_header);
+					if (new_chunk_size >= max_chunk_size)
+					{
+						// Chunk is full, start a new one
+						chunk_size = sizeof(database_chunk_header);
+						chunk_index++;
+					}
+
+					if (first_chunk_index == ~0U)
+						first_chunk_index = chunk_index;
+
+					chunk_size += segment_data_size + sizeof(database_chunk_segment_header);
+				}
+
+				clip_chunk_ranges[tracks_index].first_chunk_index[tier_index] = first_chunk_index != ~0U ? first_chunk_index : chunk_index;
+				clip_chunk_ranges[tracks_index].num_chunks[tier_index] = first_chunk_index != ~0U ? (chunk_index - first_chunk_index + 1) : 0;
+			}
+		}
+
+		// Returns the size of the bulk data
+		inline uint32_t write_database_bulk_data(const frame_assignment_context& context, const compression_database_settings& settings, quality_tier tier, const compressed_tracks* const* db_compressed_tracks_list, uint8_t* bulk_data)
+		{
+			ACL_ASSERT(tier != quality_tier::highest_importance, "No bulk data for the high importance tier");
+			const database_tier_mapping& tier_mapping = context.get_tier_mapping(tier);
+			if (tier_mapping.is_empty())
+				return 0;	// No data
+
+			const uint32_t max_chunk_size = settings.max_chunk_size;
+			const uint32_t simd_padding = 15;
+
+			database_chunk_header* chunk_header = nullptr;
+			database_chunk_segment_header* segment_chunk_headers = nullptr;
+
+			uint32_t bulk_data_offset = 0;
+			uint32_t chunk_sample_data_offset = 0;
+			uint32_t chunk_size = sizeof(database_chunk_header);
+			uint32_t chunk_index = 0;
+
+			if (bulk_data != nullptr)
+			{
+				// Setup our chunk headers
+				chunk_header = safe_ptr_cast<database_chunk_header>(bulk_data);
+				chunk_header->index = chunk_index;
+				chunk_header->size = 0;
 				chunk_header->num_segments = 0;
 
 				segment_chunk_headers = chunk_header->get_segment_headers();
 			}
 
 			// We first iterate to find our chunk delimitations and write our headers
-			for (uint32_t tracks_index = 0; tracks_index < context.num_compressed_tracks; ++tracks_index)
+			for (uint32_t layout_index = 0; layout_index < context.num_compressed_tracks; ++layout_index)
 			{
+				const uint32_t tracks_index = context.clip_layout_order[layout_index];
 				const compressed_tracks* tracks = db_compressed_tracks_list[tracks_index];
-				const transform_tracks_header& transforms_header = get_transform_tracks_header(*tracks);
+				const uint32_t num_segments = get_db_num_segments(*tracks);
 
+				const uint32_t clip_header_offset = context.clip_header_offsets[tracks_index];
 				uint32_t segment_header_offset = clip_header_offset + sizeof(database_runtime_clip_header);
 
-				for (uint32_t segment_index = 0; segment_index < transforms_header.num_segments; ++segment_index)
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
 				{
 					uint32_t num_segment_frames;
 					const frame_tier_mapping* segment_frames = find_segment_frames(tier_mapping, tracks_index, segment_index, num_segment_frames);
@@ -1056,8 +1620,6 @@ namespace acl
 
 					ACL_ASSERT(chunk_size <= max_chunk_size, "Expected a valid chunk size, segment is larger than max chunk size?");
 				}
-
-				clip_header_offset = segment_header_offset;
 			}
 
 			// If we have leftover data, finalize our last chunk
@@ -1083,12 +1645,13 @@ namespace acl
 				segment_chunk_headers = chunk_header->get_segment_headers();
 
 				uint32_t chunk_segment_index = 0;
-				for (uint32_t tracks_index = 0; tracks_index < context.num_compressed_tracks; ++tracks_index)
+				for (uint32_t layout_index = 0; layout_index < context.num_compressed_tracks; ++layout_index)
 				{
+					const uint32_t tracks_index = context.clip_layout_order[layout_index];
 					const compressed_tracks* tracks = db_compressed_tracks_list[tracks_index];
-					const transform_tracks_header& transforms_header = get_transform_tracks_header(*tracks);
+					const uint32_t num_segments = get_db_num_segments(*tracks);
 
-					for (uint32_t segment_index = 0; segment_index < transforms_header.num_segments; ++segment_index)
+					for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
 					{
 						uint32_t num_segment_frames;
 						const frame_tier_mapping* segment_frames = find_segment_frames(tier_mapping, tracks_index, segment_index, num_segment_frames);
@@ -1127,34 +1690,45 @@ namespace acl
 		inline compressed_database* build_compressed_database(const frame_assignment_context& context, const compression_database_settings& settings, const compressed_tracks* const* db_compressed_tracks_list)
 		{
 			// Find our chunk limits and calculate our database size
-			const uint32_t num_tracks = write_database_clip_metadata(db_compressed_tracks_list, context.num_compressed_tracks, nullptr);
+			const uint32_t num_tracks = write_database_clip_metadata(context, db_compressed_tracks_list, nullptr);
 			const uint32_t num_segments = calculate_num_segments(db_compressed_tracks_list, context.num_compressed_tracks);
-			const uint32_t num_medium_chunks = write_database_chunk_descriptions(context, settings, quality_tier::medium_importance, nullptr);
-			const uint32_t num_low_chunks = write_database_chunk_descriptions(context, settings, quality_tier::lowest_importance, nullptr);
-
-			// Pad medium tier bulk data to ensure alignment since the lowest tier follows
-			const uint32_t bulk_data_medium_size = write_database_bulk_data(context, settings, quality_tier::medium_importance, db_compressed_tracks_list, nullptr);
-			const uint32_t aligned_bulk_data_medium_size = align_to(bulk_data_medium_size, k_database_bulk_data_alignment);
-
-			// No need to pad lowest tier since it is last
-			const uint32_t bulk_data_low_size = write_database_bulk_data(context, settings, quality_tier::lowest_importance, db_compressed_tracks_list, nullptr);
+			uint32_t num_chunks[k_num_database_tiers];
+			uint32_t bulk_data_size[k_num_database_tiers];
+			uint32_t aligned_bulk_data_size[k_num_database_tiers];
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const quality_tier tier = quality_tier(tier_index + 1);
+				num_chunks[tier_index] = write_database_chunk_descriptions(context, settings, tier, nullptr);
+				bulk_data_size[tier_index] = write_database_bulk_data(context, settings, tier, db_compressed_tracks_list, nullptr);
+
+				// Pad the bulk data of every tier to ensure alignment since the next tier follows
+				// No need to pad lowest tier since it is last
+				const bool is_last_tier = tier_index == (k_num_database_tiers - 1);
+				aligned_bulk_data_size[tier_index] = is_last_tier ? bulk_data_size[tier_index] : align_to(bulk_data_size[tier_index], k_database_bulk_data_alignment);
+			}
 
 			uint32_t database_buffer_size = 0;
 			database_buffer_size += sizeof(raw_buffer_header);										// Header
 			database_buffer_size += sizeof(database_header);										// Header
 
-			database_buffer_size = align_to(database_buffer_size, 4);								// Align chunk descriptions
-			database_buffer_size += num_medium_chunks * sizeof(database_chunk_description);			// Chunk descriptions
-
-			database_buffer_size = align_to(database_buffer_size, 4);								// Align chunk descriptions
-			database_buffer_size += num_low_chunks * sizeof(database_chunk_description);			// Chunk descriptions
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				database_buffer_size = align_to(database_buffer_size, 4);							// Align chunk descriptions
+				database_buffer_size += num_chunks[tier_index] * sizeof(database_chunk_description);	// Chunk descriptions
+			}
 
 			database_buffer_size = align_to(database_buffer_size, 4);								// Align clip hashes
 			database_buffer_size += num_tracks * sizeof(database_clip_metadata);					// Clip metadata
+			database_buffer_size += num_tracks * sizeof(database_clip_chunk_range);					// Clip chunk ranges
+			database_buffer_size += get_clip_hash_index_num_slots(num_tracks) * sizeof(uint32_t);	// Clip hash index
+			database_buffer_size += num_segments * sizeof(database_segment_streaming_metadata);	// Segment streaming metadata
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				database_buffer_size += num_chunks[tier_index] * sizeof(uint32_t);					// Chunk hashes
 
 			database_buffer_size = align_to(database_buffer_size, k_database_bulk_data_alignment);	// Align bulk data
-			database_buffer_size += aligned_bulk_data_medium_size;									// Bulk data
-			database_buffer_size += bulk_data_low_size;												// Bulk data
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				database_buffer_size += aligned_bulk_data_size[tier_index];							// Bulk data
 
 			uint8_t* database_buffer = allocate_type_array_aligned<uint8_t>(context.allocator, database_buffer_size, alignof(compressed_database));
 			std::memset(database_buffer, 0, database_buffer_size);
@@ -1173,63 +1747,84 @@ namespace acl
 			// Write our header
 			db_header->tag = static_cast<uint32_t>(buffer_tag32::compressed_database);
 			db_header->version = compressed_tracks_version16::latest;
-			db_header->num_chunks[0] = num_medium_chunks;
-			db_header->num_chunks[1] = num_low_chunks;
 			db_header->max_chunk_size = settings.max_chunk_size;
 			db_header->num_clips = num_tracks;
 			db_header->num_segments = num_segments;
-			db_header->bulk_data_size[0] = aligned_bulk_data_medium_size;
-			db_header->bulk_data_size[1] = bulk_data_low_size;
-			db_header->set_is_bulk_data_inline(true);	// Data is always inline when compressing
 
-			database_buffer = align_to(database_buffer, 4);										// Align chunk descriptions
-			database_buffer += num_medium_chunks * sizeof(database_chunk_description);			// Chunk descriptions
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				db_header->num_chunks[tier_index] = num_chunks[tier_index];
+				db_header->bulk_data_size[tier_index] = aligned_bulk_data_size[tier_index];
+			}
 
-			database_buffer = align_to(database_buffer, 4);										// Align chunk descriptions
-			database_buffer += num_low_chunks * sizeof(database_chunk_description);				// Chunk descriptions
+			db_header->set_is_bulk_data_inline(true);	// Data is always inline when compressing
+			db_header->set_has_clip_chunk_ranges(true);
+			db_header->set_has_clip_hash_index(true);
+			db_header->set_has_segment_streaming_metadata(true);
+			db_header->set_has_chunk_hashes(true);
+			db_header->set_num_database_tiers(k_num_database_tiers);
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				database_buffer = align_to(database_buffer, 4);										// Align chunk descriptions
+				database_buffer += num_chunks[tier_index] * sizeof(database_chunk_description);		// Chunk descriptions
+			}
 
 			database_buffer = align_to(database_buffer, 4);										// Align clip hashes
 			db_header->clip_metadata_offset = uint32_t(database_buffer - db_header_start);		// Clip metadata
 			database_buffer += num_tracks * sizeof(database_clip_metadata);						// Clip metadata
+			database_buffer += num_tracks * sizeof(database_clip_chunk_range);					// Clip chunk ranges
+			database_buffer += get_clip_hash_index_num_slots(num_tracks) * sizeof(uint32_t);	// Clip hash index
+			database_buffer += num_segments * sizeof(database_segment_streaming_metadata);		// Segment streaming metadata
 
-			database_buffer = align_to(database_buffer, k_database_bulk_data_alignment);		// Align bulk data
-			if (aligned_bulk_data_medium_size != 0)
-				db_header->bulk_data_offset[0] = uint32_t(database_buffer - db_header_start);	// Bulk data
-			else
-				db_header->bulk_data_offset[0] = invalid_ptr_offset();
-			database_buffer += aligned_bulk_data_medium_size;									// Bulk data
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				database_buffer += num_chunks[tier_index] * sizeof(uint32_t);					// Chunk hashes
 
-			if (bulk_data_low_size != 0)
-				db_header->bulk_data_offset[1] = uint32_t(database_buffer - db_header_start);	// Bulk data
-			else
-				db_header->bulk_data_offset[1] = invalid_ptr_offset();
-			database_buffer += bulk_data_low_size;												// Bulk data
+			database_buffer = align_to(database_buffer, k_database_bulk_data_alignment);		// Align bulk data
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				if (aligned_bulk_data_size[tier_index] != 0)
+					db_header->bulk_data_offset[tier_index] = uint32_t(database_buffer - db_header_start);	// Bulk data
+				else
+					db_header->bulk_data_offset[tier_index] = invalid_ptr_offset();
+				database_buffer += aligned_bulk_data_size[tier_index];										// Bulk data
+			}
 
 			// Write our chunk descriptions
-			const uint32_t num_written_medium_chunks = write_database_chunk_descriptions(context, settings, quality_tier::medium_importance, db_header->get_chunk_descriptions_medium());
-			ACL_ASSERT(num_written_medium_chunks == num_medium_chunks, "Unexpected amount of data written"); (void)num_written_medium_chunks;
-
-			const uint32_t num_written_low_chunks = write_database_chunk_descriptions(context, settings, quality_tier::lowest_importance, db_header->get_chunk_descriptions_low());
-			ACL_ASSERT(num_written_low_chunks == num_low_chunks, "Unexpected amount of data written"); (void)num_written_low_chunks;
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const uint32_t num_written_chunks = write_database_chunk_descriptions(context, settings, quality_tier(tier_index + 1), db_header->get_chunk_descriptions(tier_index));
+				ACL_ASSERT(num_written_chunks == num_chunks[tier_index], "Unexpected amount of data written"); (void)num_written_chunks;
+			}
 
 			// Write our clip metadata
-			const uint32_t num_written_tracks = write_database_clip_metadata(db_compressed_tracks_list, context.num_compressed_tracks, db_header->get_clip_metadatas());
+			const uint32_t num_written_tracks = write_database_clip_metadata(context, db_compressed_tracks_list, db_header->get_clip_metadatas());
 			ACL_ASSERT(num_written_tracks == num_tracks, "Unexpected amount of data written"); (void)num_written_tracks;
 
+			// Write our clip hash index
+			write_database_clip_hash_index(db_header->get_clip_metadatas(), num_tracks, db_header->get_clip_hash_index());
+
+			// Write our clip chunk ranges
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				write_database_clip_chunk_ranges(context, settings, quality_tier(tier_index + 1), db_header->get_clip_chunk_ranges());
+
 			// Write our bulk data
-			const uint32_t written_bulk_data_medium_size = write_database_bulk_data(context, settings, quality_tier::medium_importance, db_compressed_tracks_list, db_header->get_bulk_data_medium());
-			ACL_ASSERT(written_bulk_data_medium_size == bulk_data_medium_size, "Unexpected amount of data written"); (void)written_bulk_data_medium_size;
-			db_header->bulk_data_hash[0] = hash32(db_header->get_bulk_data_medium(), aligned_bulk_data_medium_size);
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const uint32_t written_bulk_data_size = write_database_bulk_data(context, settings, quality_tier(tier_index + 1), db_compressed_tracks_list, db_header->get_bulk_data(tier_index));
+				ACL_ASSERT(written_bulk_data_size == bulk_data_size[tier_index], "Unexpected amount of data written"); (void)written_bulk_data_size;
+				db_header->bulk_data_hash[tier_index] = hash32(db_header->get_bulk_data(tier_index), aligned_bulk_data_size[tier_index]);
+			}
 
-			const uint32_t written_bulk_data_low_size = write_database_bulk_data(context, settings, quality_tier::lowest_importance, db_compressed_tracks_list, db_header->get_bulk_data_low());
-			ACL_ASSERT(written_bulk_data_low_size == bulk_data_low_size, "Unexpected amount of data written"); (void)written_bulk_data_low_size;
-			db_header->bulk_data_hash[1] = hash32(db_header->get_bulk_data_low(), bulk_data_low_size);
+			// Write our segment streaming metadata and chunk hashes now that our chunks are known
+			write_database_segment_streaming_metadata(*db_header);
+			write_database_chunk_hashes(*db_header);
 
 			ACL_ASSERT(uint32_t(database_buffer - database_buffer_start) == database_buffer_size, "Unexpected amount of data written"); (void)database_buffer_start;
 
 #if defined(ACL_HAS_ASSERT_CHECKS)
 			// Make sure nobody overwrote our padding (contained in last chunk if we have data)
-			if (bulk_data_low_size != 0)
+			if (bulk_data_size[k_num_database_tiers - 1] != 0)
 			{
 				for (const uint8_t* padding = database_buffer - 15; padding < database_buffer; ++padding)
 					ACL_ASSERT(*padding == 0, "Padding was overwritten");
@@ -1244,6 +1839,374 @@ namespace acl
 
 			return database;
 		}
+		inline error_result validate_database_input(const compression_database_settings& settings, const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks)
+		{
+			const error_result settings_result = settings.is_valid();
+			if (settings_result.any())
+				return error_result("Compression database settings are invalid");
+
+			if (compressed_tracks_list == nullptr || num_compressed_tracks == 0)
+				return error_result("No compressed track list provided");
+
+			for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
+			{
+				const compressed_tracks* tracks = compressed_tracks_list[list_index];
+				if (tracks == nullptr)
+					return error_result("Compressed track list contains a null entry");
+
+				const error_result tracks_result = tracks->is_valid(false);
+				if (tracks_result.any())
+					return error_result("Compressed track instance is invalid");
+
+				if (tracks->has_database())
+					return error_result("Compressed track instance is already bound to a database");
+
+				if (tracks->has_stripped_keyframes())
+					return error_result("Compressed track instance has keyframes stripped");
+
+				const tracks_header& header = get_tracks_header(*tracks);
+				if (!header.get_has_metadata())
+					return error_result("Compressed track instance does not contain any metadata");
+
+				const optional_metadata_header& metadata_header = get_optional_metadata_header(*tracks);
+				if (!metadata_header.contributing_error.is_valid())
+					return error_result("Compressed track instance does not contain contributing error metadata");
+
+				if (header.track_type != track_type8::qvvf)
+				{
+					// Scalar tracks must be split into segments small enough for their keyframes to be stripped
+					if (!header.get_has_scalar_segments())
+						return error_result("Compressed scalar track instance is not split into segments");
+
+					const scalar_segments_header& segments_header = *get_scalar_tracks_header(*tracks).get_segments_header();
+					if (segments_header.num_samples_per_segment > k_max_num_samples_per_scalar_database_segment)
+						return error_result("Compressed scalar track instance has segments too large to strip keyframes");
+				}
+			}
+
+			for (uint32_t edge_index = 0; edge_index < settings.num_clip_co_usage_edges; ++edge_index)
+			{
+				const database_clip_co_usage& edge = settings.clip_co_usage[edge_index];
+				if (edge.clip_index0 >= num_compressed_tracks || edge.clip_index1 >= num_compressed_tracks)
+					return error_result("Clip co-usage edge references an invalid clip index");
+			}
+
+			return error_result();
+		}
+
+		// Splits the provided clips between new compressed tracks instances and a new database
+		// The runtime headers of the new clips start at the provided offset
+		inline error_result build_database_impl(iallocator& allocator, const compression_database_settings& settings,
+			const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks, uint32_t first_clip_header_offset,
+			compressed_tracks** out_compressed_tracks, compressed_database*& out_database)
+		{
+			// Calculate how many frames are movable to the database
+			// A frame is movable if it isn't the first or last frame of a segment
+			const uint32_t num_frames = calculate_num_frames(compressed_tracks_list, num_compressed_tracks);
+			if (num_frames == 0)
+				return error_result("All compressed track lists are empty");
+
+			const uint32_t num_movable_frames = calculate_num_movable_frames(compressed_tracks_list, num_compressed_tracks);
+			ACL_ASSERT(num_movable_frames < num_frames, "Cannot move out more frames than we have");
+
+			// Calculate how many frames we'll move to every tier, starting with the lowest importance tier
+			uint32_t num_tier_frames[k_num_quality_tiers];
+			uint32_t num_database_frames = 0;
+			for (uint32_t tier_index = k_num_database_tiers; tier_index >= 1; --tier_index)
+			{
+				const float tier_proportion = settings.get_tier_proportion(quality_tier(tier_index));
+				num_tier_frames[tier_index] = std::min<uint32_t>(num_movable_frames - num_database_frames, uint32_t(tier_proportion * float(num_frames)));
+				num_database_frames += num_tier_frames[tier_index];
+			}
+
+			ACL_ASSERT(num_database_frames <= num_movable_frames, "Cannot move out more frames than we have");
+
+			// Non-movable frames end up being high importance and remain in the compressed clip
+			num_tier_frames[0] = num_frames - num_database_frames;
+
+			frame_assignment_context context(allocator, compressed_tracks_list, num_compressed_tracks, num_movable_frames, first_clip_header_offset);
+			for (uint32_t tier_index = 0; tier_index < k_num_quality_tiers; ++tier_index)
+				context.set_tier_num_frames(quality_tier(tier_index), num_tier_frames[tier_index]);
+
+			// Assign every frame to its tier
+			assign_frames_to_tiers(context);
+
+			// Order our clips to keep the ones used together in the same chunks
+			build_clip_layout_order(context, settings);
+
+			// Build our new compressed track instances with the high importance tier data
+			build_compressed_tracks(context, out_compressed_tracks);
+
+			// Build our database with the lower tier data
+			out_database = build_compressed_database(context, settings, out_compressed_tracks);
+
+			return error_result();
+		}
+
+		// Returns the size of the runtime clip and segment headers of a database, new clips append theirs at the end
+		inline uint32_t get_database_runtime_headers_size(const database_header& header)
+		{
+			return header.num_clips * uint32_t(sizeof(database_runtime_clip_header)) + header.num_segments * uint32_t(sizeof(database_runtime_segment_header));
+		}
+
+		// Returns the index of the clip bound to the provided compressed tracks instance or k_invalid_track_index if it isn't part of the database
+		inline uint32_t find_database_clip_index(const database_header& header, const compressed_tracks& tracks)
+		{
+			const tracks_database_header* tracks_db_header = get_tracks_database_header(tracks);
+			if (tracks_db_header == nullptr || !tracks_db_header->clip_header_offset.is_valid())
+				return k_invalid_track_index;
+
+			// Clip metadata is sorted by runtime header offset
+			const uint32_t clip_header_offset = tracks_db_header->clip_header_offset;
+			const database_clip_metadata* clip_metadatas = header.get_clip_metadatas();
+			const database_clip_metadata* clip_metadatas_end = clip_metadatas + header.num_clips;
+
+			auto search_predicate = [](const database_clip_metadata& clip_metadata, uint32_t offset) { return uint32_t(clip_metadata.clip_header_offset) < offset; };
+			const database_clip_metadata* clip_metadata = std::lower_bound(clip_metadatas, clip_metadatas_end, clip_header_offset, search_predicate);
+			if (clip_metadata == clip_metadatas_end || uint32_t(clip_metadata->clip_header_offset) != clip_header_offset || clip_metadata->clip_hash != tracks.get_hash())
+				return k_invalid_track_index;
+
+			return uint32_t(clip_metadata - clip_metadatas);
+		}
+
+		// Allocates a new database that duplicates the header of an existing one with new section sizes
+		// Its bulk data is inline if the existing one is inline
+		inline compressed_database* allocate_database(iallocator& allocator, const database_header& ref_header,
+			const uint32_t* num_chunks, uint32_t num_clips, uint32_t num_segments, bool has_removed_clips, const uint32_t* bulk_data_size)
+		{
+			const bool is_bulk_data_inline = ref_header.get_is_bulk_data_inline();
+			const uint32_t removed_clips_size = has_removed_clips ? (bitset_description::make_from_num_bits(num_clips).get_num_bytes()) : 0;
+
+			uint32_t database_buffer_size = 0;
+			database_buffer_size += sizeof(raw_buffer_header);										// Header
+			database_buffer_size += sizeof(database_header);										// Header
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				database_buffer_size = align_to(database_buffer_size, 4);							// Align chunk descriptions
+				database_buffer_size += num_chunks[tier_index] * sizeof(database_chunk_description);	// Chunk descriptions
+			}
+
+			database_buffer_size = align_to(database_buffer_size, 4);								// Align clip hashes
+			database_buffer_size += num_clips * sizeof(database_clip_metadata);						// Clip metadata
+
+			if (ref_header.get_has_clip_chunk_ranges())
+				database_buffer_size += num_clips * sizeof(database_clip_chunk_range);				// Clip chunk ranges
+
+			database_buffer_size += removed_clips_size;												// Removed clips
+			database_buffer_size += get_clip_hash_index_num_slots(num_clips) * sizeof(uint32_t);	// Clip hash index
+			database_buffer_size += num_segments * sizeof(database_segment_streaming_metadata);	// Segment streaming metadata
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				database_buffer_size += num_chunks[tier_index] * sizeof(uint32_t);					// Chunk hashes
+
+			database_buffer_size = align_to(database_buffer_size, k_database_bulk_data_alignment);	// Align bulk data
+			if (is_bulk_data_inline)
+			{
+				for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+					database_buffer_size += bulk_data_size[tier_index];								// Bulk data
+			}
+
+			uint8_t* database_buffer = allocate_type_array_aligned<uint8_t>(allocator, database_buffer_size, alignof(compressed_database));
+			std::memset(database_buffer, 0, database_buffer_size);
+
+			compressed_database* database = reinterpret_cast<compressed_database*>(database_buffer);
+
+			raw_buffer_header* database_buffer_header = safe_ptr_cast<raw_buffer_header>(database_buffer);
+			database_buffer += sizeof(raw_buffer_header);
+
+			const uint8_t* db_header_start = database_buffer;
+			database_header* db_header = safe_ptr_cast<database_header>(database_buffer);
+			database_buffer += sizeof(database_header);
+
+			// Copy our header
+			std::memcpy(db_header, &ref_header, sizeof(database_header));
+			db_header->num_clips = num_clips;
+			db_header->num_segments = num_segments;
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				db_header->num_chunks[tier_index] = num_chunks[tier_index];
+				db_header->bulk_data_size[tier_index] = bulk_data_size[tier_index];
+			}
+
+			db_header->set_has_removed_clips(has_removed_clips);
+			db_header->set_has_clip_hash_index(true);
+			db_header->set_has_segment_streaming_metadata(true);
+			db_header->set_has_chunk_hashes(true);
+			db_header->set_num_database_tiers(k_num_database_tiers);
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				database_buffer = align_to(database_buffer, 4);										// Align chunk descriptions
+				database_buffer += num_chunks[tier_index] * sizeof(database_chunk_description);		// Chunk descriptions
+			}
+
+			database_buffer = align_to(database_buffer, 4);										// Align clip hashes
+			db_header->clip_metadata_offset = uint32_t(database_buffer - db_header_start);		// Clip metadata
+			database_buffer += num_clips * sizeof(database_clip_metadata);						// Clip metadata
+
+			if (ref_header.get_has_clip_chunk_ranges())
+				database_buffer += num_clips * sizeof(database_clip_chunk_range);				// Clip chunk ranges
+
+			database_buffer += removed_clips_size;												// Removed clips
+			database_buffer += get_clip_hash_index_num_slots(num_clips) * sizeof(uint32_t);	// Clip hash index
+			database_buffer += num_segments * sizeof(database_segment_streaming_metadata);		// Segment streaming metadata
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				database_buffer += num_chunks[tier_index] * sizeof(uint32_t);					// Chunk hashes
+
+			database_buffer = align_to(database_buffer, k_database_bulk_data_alignment);		// Align bulk data
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				if (is_bulk_data_inline && bulk_data_size[tier_index] != 0)
+				{
+					db_header->bulk_data_offset[tier_index] = uint32_t(database_buffer - db_header_start);	// Bulk data
+					database_buffer += bulk_data_size[tier_index];											// Bulk data
+				}
+				else
+					db_header->bulk_data_offset[tier_index] = invalid_ptr_offset();
+			}
+
+			database_buffer_header->size = database_buffer_size;
+
+			return database;
+		}
+
+		// Writes the clip hash index, the segment streaming metadata, the chunk hashes, and updates the hashes of a database once its clip metadata and bulk data have been written
+		// Without inline bulk data, the segment streaming metadata and the chunk hashes must have been copied
+		inline void finalize_database(compressed_database& database)
+		{
+			database_header& header = get_database_header(database);
+
+			write_database_clip_hash_index(header.get_clip_metadatas(), header.num_clips, header.get_clip_hash_index());
+
+			if (header.get_is_bulk_data_inline())
+			{
+				// Finding the segments of every chunk requires the bulk data
+				write_database_segment_streaming_metadata(header);
+				write_database_chunk_hashes(header);
+
+				for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+					header.bulk_data_hash[tier_index] = hash32(header.get_bulk_data(tier_index), header.bulk_data_size[tier_index]);
+			}
+
+			raw_buffer_header& database_buffer_header = *reinterpret_cast<raw_buffer_header*>(&database);
+			database_buffer_header.hash = hash32(safe_ptr_cast<const uint8_t>(&header), database_buffer_header.size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+		}
+
+
+		// Copies a chunk to its new location and updates its index and the offsets of its segments
+		inline void relocate_chunk(const uint8_t* src_bulk_data, const database_chunk_description& src_chunk_description,
+			uint8_t* dst_bulk_data, const database_chunk_description& dst_chunk_description, uint32_t dst_chunk_index)
+		{
+			ACL_ASSERT(src_chunk_description.size == dst_chunk_description.size, "Chunk size mismatch");
+
+			const database_chunk_header* src_chunk_header = src_chunk_description.get_chunk_header(src_bulk_data);
+			database_chunk_header* dst_chunk_header = dst_chunk_description.get_chunk_header(dst_bulk_data);
+			std::memcpy(dst_chunk_header, src_chunk_header, src_chunk_description.size);
+
+			// Sample offsets are relative to the start of the bulk data
+			const uint32_t src_chunk_offset = src_chunk_description.offset;
+			const uint32_t dst_chunk_offset = dst_chunk_description.offset;
+
+			dst_chunk_header->index = dst_chunk_index;
+
+			database_chunk_segment_header* segment_headers = dst_chunk_header->get_segment_headers();
+			for (uint32_t segment_index = 0; segment_index < dst_chunk_header->num_segments; ++segment_index)
+			{
+				database_chunk_segment_header& segment_header = segment_headers[segment_index];
+				segment_header.samples_offset = uint32_t(segment_header.samples_offset) - src_chunk_offset + dst_chunk_offset;
+			}
+		}
+
+		// Appends a database built from new clips to an existing one, existing chunks remain identical
+		inline compressed_database* append_database(iallocator& allocator, const compressed_database& database, const compressed_database& appended_database)
+		{
+			const database_header& ref_header = get_database_header(database);
+			const database_header& appended_header = get_database_header(appended_database);
+
+			const uint32_t num_ref_clips = ref_header.num_clips;
+			const uint32_t num_appended_clips = appended_header.num_clips;
+			const uint32_t num_clips = num_ref_clips + num_appended_clips;
+			const uint32_t num_segments = ref_header.num_segments + appended_header.num_segments;
+
+			// New chunks follow the existing ones in each tier
+			uint32_t num_chunks[k_num_database_tiers];
+			uint32_t appended_bulk_data_offset[k_num_database_tiers];
+			uint32_t bulk_data_size[k_num_database_tiers];
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				num_chunks[tier_index] = ref_header.num_chunks[tier_index] + appended_header.num_chunks[tier_index];
+				appended_bulk_data_offset[tier_index] = appended_header.num_chunks[tier_index] != 0 ? align_to(ref_header.bulk_data_size[tier_index], k_database_bulk_data_alignment) : ref_header.bulk_data_size[tier_index];
+				bulk_data_size[tier_index] = appended_bulk_data_offset[tier_index] + appended_header.bulk_data_size[tier_index];
+			}
+
+#if defined(ACL_HAS_ASSERT_CHECKS)
+			// The bulk data of every tier is padded since the next tier follows
+			for (uint32_t tier_index = 0; tier_index + 1 < k_num_database_tiers; ++tier_index)
+				ACL_ASSERT(is_aligned_to(bulk_data_size[tier_index], k_database_bulk_data_alignment), "Tier bulk data must be padded");
+#endif
+
+			compressed_database* out_database = allocate_database(allocator, ref_header, num_chunks, num_clips, num_segments, ref_header.get_has_removed_clips(), bulk_data_size);
+			database_header& db_header = get_database_header(*out_database);
+			db_header.max_chunk_size = std::max<uint32_t>(ref_header.max_chunk_size, appended_header.max_chunk_size);
+
+			// Copy our clip metadata, the runtime header offsets of the new clips already follow the existing ones
+			database_clip_metadata* clip_metadatas = db_header.get_clip_metadatas();
+			std::memcpy(clip_metadatas, ref_header.get_clip_metadatas(), num_ref_clips * sizeof(database_clip_metadata));
+			std::memcpy(clip_metadatas + num_ref_clips, appended_header.get_clip_metadatas(), num_appended_clips * sizeof(database_clip_metadata));
+
+			// Copy our clip chunk ranges, new clips index the chunks that follow the existing ones
+			database_clip_chunk_range* clip_chunk_ranges = db_header.get_clip_chunk_ranges();
+			std::memcpy(clip_chunk_ranges, ref_header.get_clip_chunk_ranges(), num_ref_clips * sizeof(database_clip_chunk_range));
+			std::memcpy(clip_chunk_ranges + num_ref_clips, appended_header.get_clip_chunk_ranges(), num_appended_clips * sizeof(database_clip_chunk_range));
+
+			for (uint32_t clip_index = num_ref_clips; clip_index < num_clips; ++clip_index)
+			{
+				for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				{
+					if (clip_chunk_ranges[clip_index].num_chunks[tier_index] != 0)
+						clip_chunk_ranges[clip_index].first_chunk_index[tier_index] += ref_header.num_chunks[tier_index];
+				}
+			}
+
+			// Copy our removed clips, new clips are never removed and bits keep their position when the bit set grows
+			if (ref_header.get_has_removed_clips())
+				std::memcpy(db_header.get_removed_clips(), ref_header.get_removed_clips(), bitset_description::make_from_num_bits(num_ref_clips).get_num_bytes());
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const uint32_t num_ref_chunks = ref_header.num_chunks[tier_index];
+
+				// Existing chunks are copied as-is
+				database_chunk_description* chunk_descriptions = db_header.get_chunk_descriptions(tier_index);
+				std::memcpy(chunk_descriptions, ref_header.get_chunk_descriptions(tier_index), num_ref_chunks * sizeof(database_chunk_description));
+
+				uint8_t* bulk_data = db_header.get_bulk_data(tier_index);
+				if (ref_header.bulk_data_size[tier_index] != 0)
+					std::memcpy(bulk_data, ref_header.get_bulk_data(tier_index), ref_header.bulk_data_size[tier_index]);
+
+				// New chunks follow
+				const database_chunk_description* appended_chunk_descriptions = appended_header.get_chunk_descriptions(tier_index);
+				const uint8_t* appended_bulk_data = appended_header.get_bulk_data(tier_index);
+				for (uint32_t chunk_index = 0; chunk_index < appended_header.num_chunks[tier_index]; ++chunk_index)
+				{
+					const database_chunk_description& appended_chunk_description = appended_chunk_descriptions[chunk_index];
+
+					database_chunk_description& chunk_description = chunk_descriptions[num_ref_chunks + chunk_index];
+					chunk_description.size = appended_chunk_description.size;
+					chunk_description.offset = appended_bulk_data_offset[tier_index] + uint32_t(appended_chunk_description.offset);
+
+					relocate_chunk(appended_bulk_data, appended_chunk_description, bulk_data, chunk_description, num_ref_chunks + chunk_index);
+				}
+			}
+
+			finalize_database(*out_database);
+			ACL_ASSERT(out_database->is_valid(true).empty(), "Failed to append to database");
+
+			return out_database;
+		}
 	}
 
 	inline error_result build_database(iallocator& allocator, const compression_database_settings& settings,
@@ -1258,9 +2221,71 @@ namespace acl
 		out_database = nullptr;
 
 		// Validate everything and early out if something isn't right
-		const error_result settings_result = settings.is_valid();
-		if (settings_result.any())
-			return error_result("Compression database settings are invalid");
+		const error_result input_result = validate_database_input(settings, compressed_tracks_list, num_compressed_tracks);
+		if (input_result.any())
+			return input_result;
+
+		return build_database_impl(allocator, settings, compressed_tracks_list, num_compressed_tracks, 0, out_compressed_tracks, out_database);
+	}
+
+	inline error_result append_to_database(iallocator& allocator, const compression_database_settings& settings, const compressed_database& database,
+		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
+		compressed_tracks** out_compressed_tracks, compressed_database*& out_database)
+	{
+		using namespace acl_impl;
+
+		// Reset everything just to be safe
+		for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
+			out_compressed_tracks[list_index] = nullptr;
+		out_database = nullptr;
+
+		// Validate everything and early out if something isn't right
+		const error_result database_result = database.is_valid(true);
+		if (database_result.any())
+			return database_result;
+
+		if (database.get_version() != compressed_tracks_version16::latest)
+			return error_result("Database was built with an older version, it must be rebuilt");
+
+		if (!database.is_bulk_data_inline())
+			return error_result("Bulk data is not inline in source database");
+
+		const database_header& ref_header = get_database_header(database);
+		if (!ref_header.get_has_clip_chunk_ranges())
+			return error_result("Database does not contain the range of chunks of each clip, it must be rebuilt");
+
+		const error_result input_result = validate_database_input(settings, compressed_tracks_list, num_compressed_tracks);
+		if (input_result.any())
+			return input_result;
+
+		// Build a database with our new clips, their runtime headers follow the existing ones
+		compressed_database* appended_database = nullptr;
+		const error_result build_result = build_database_impl(allocator, settings, compressed_tracks_list, num_compressed_tracks, get_database_runtime_headers_size(ref_header), out_compressed_tracks, appended_database);
+		if (build_result.any())
+			return build_result;
+
+		out_database = append_database(allocator, database, *appended_database);
+
+		deallocate_type_array(allocator, reinterpret_cast<uint8_t*>(appended_database), appended_database->get_size());
+
+		return error_result();
+	}
+
+	inline error_result remove_from_database(iallocator& allocator, const compressed_database& database,
+		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
+		compressed_database*& out_database)
+	{
+		using namespace acl_impl;
+
+		out_database = nullptr;
+
+		const error_result database_result = database.is_valid(true);
+		if (database_result.any())
+			return database_result;
+
+		const database_header& ref_header = get_database_header(database);
+		if (!ref_header.get_has_clip_chunk_ranges())
+			return error_result("Database does not contain the range of chunks of each clip, it must be rebuilt");
 
 		if (compressed_tracks_list == nullptr || num_compressed_tracks == 0)
 			return error_result("No compressed track list provided");
@@ -1271,63 +2296,216 @@ namespace acl
 			if (tracks == nullptr)
 				return error_result("Compressed track list contains a null entry");
 
-			const error_result tracks_result = tracks->is_valid(false);
-			if (tracks_result.any())
-				return error_result("Compressed track instance is invalid");
+			if (find_database_clip_index(ref_header, *tracks) == k_invalid_track_index)
+				return error_result("Compressed track instance is not bound to this database");
+		}
 
-			if (tracks->has_database())
-				return error_result("Compressed track instance is already bound to a database");
+		const uint32_t num_clips = ref_header.num_clips;
+		compressed_database* removed_database = allocate_database(allocator, ref_header, ref_header.num_chunks, num_clips, ref_header.num_segments, true, ref_header.bulk_data_size);
+		database_header& db_header = get_database_header(*removed_database);
 
-			if (tracks->has_stripped_keyframes())
-				return error_result("Compressed track instance has keyframes stripped");
+		// Everything is copied as-is, the chunks of removed clips remain until the database is compacted
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			std::memcpy(db_header.get_chunk_descriptions(tier_index), ref_header.get_chunk_descriptions(tier_index), ref_header.num_chunks[tier_index] * sizeof(database_chunk_description));
+		std::memcpy(db_header.get_clip_metadatas(), ref_header.get_clip_metadatas(), num_clips * sizeof(database_clip_metadata));
+		std::memcpy(db_header.get_clip_chunk_ranges(), ref_header.get_clip_chunk_ranges(), num_clips * sizeof(database_clip_chunk_range));
 
-			const tracks_header& header = get_tracks_header(*tracks);
-			if (!header.get_has_metadata())
-				return error_result("Compressed track instance does not contain any metadata");
+		const bitset_description removed_clips_desc = bitset_description::make_from_num_bits(num_clips);
+		uint32_t* removed_clips = db_header.get_removed_clips();
+		if (ref_header.get_has_removed_clips())
+			std::memcpy(removed_clips, ref_header.get_removed_clips(), removed_clips_desc.get_num_bytes());
 
-			const optional_metadata_header& metadata_header = get_optional_metadata_header(*tracks);
-			if (!metadata_header.contributing_error.is_valid())
-				return error_result("Compressed track instance does not contain contributing error metadata");
+		if (ref_header.get_is_bulk_data_inline())
+		{
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				if (ref_header.bulk_data_size[tier_index] != 0)
+					std::memcpy(db_header.get_bulk_data(tier_index), ref_header.get_bulk_data(tier_index), ref_header.bulk_data_size[tier_index]);
+			}
+		}
+		else
+		{
+			// The chunks and segments do not change, copy what we cannot rebuild without the bulk data
+			if (ref_header.get_has_segment_streaming_metadata())
+				std::memcpy(db_header.get_segment_streaming_metadatas(), ref_header.get_segment_streaming_metadatas(), ref_header.num_segments * sizeof(database_segment_streaming_metadata));
+			else
+				db_header.set_has_segment_streaming_metadata(false);
+
+			if (ref_header.get_has_chunk_hashes())
+			{
+				for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+					std::memcpy(db_header.get_chunk_hashes(tier_index), ref_header.get_chunk_hashes(tier_index), ref_header.num_chunks[tier_index] * sizeof(uint32_t));
+			}
+			else
+				db_header.set_has_chunk_hashes(false);
 		}
 
-		// Calculate how many frames are movable to the database
-		// A frame is movable if it isn't the first or last frame of a segment
-		const uint32_t num_frames = calculate_num_frames(compressed_tracks_list, num_compressed_tracks);
-		if (num_frames == 0)
-			return error_result("All compressed track lists are empty");
+		// Tombstone our clips, their runtime headers remain to keep the offsets of the other clips stable
+		// They no longer reference any chunk and can no longer be streamed
+		for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
+		{
+			const uint32_t clip_index = find_database_clip_index(ref_header, *compressed_tracks_list[list_index]);
+			bitset_set(removed_clips, removed_clips_desc, clip_index, true);
+
+			database_clip_chunk_range& clip_chunk_range = db_header.get_clip_chunk_ranges()[clip_index];
+			clip_chunk_range = database_clip_chunk_range();
+		}
+
+		finalize_database(*removed_database);
+		ACL_ASSERT(removed_database->is_valid(true).empty(), "Failed to remove from database");
+
+		out_database = removed_database;
+		return error_result();
+	}
+
+	inline error_result compact_database(iallocator& allocator, const compressed_database& database, compressed_database*& out_database)
+	{
+		using namespace acl_impl;
+
+		out_database = nullptr;
+
+		const error_result database_result = database.is_valid(true);
+		if (database_result.any())
+			return database_result;
+
+		if (!database.is_bulk_data_inline())
+			return error_result("Bulk data is not inline in source database");
+
+		const database_header& ref_header = get_database_header(database);
+		if (!ref_header.get_has_clip_chunk_ranges())
+			return error_result("Database does not contain the range of chunks of each clip, it must be rebuilt");
 
-		const uint32_t num_movable_frames = calculate_num_movable_frames(compressed_tracks_list, num_compressed_tracks);
-		ACL_ASSERT(num_movable_frames < num_frames, "Cannot move out more frames than we have");
+		const uint32_t num_clips = ref_header.num_clips;
+		const database_clip_metadata* clip_metadatas = ref_header.get_clip_metadatas();
+		const uint32_t* ref_removed_clips = ref_header.get_removed_clips();
+		const bitset_description removed_clips_desc = bitset_description::make_from_num_bits(num_clips);
 
-		// Calculate how many frames we'll move to every tier
-		const uint32_t num_low_importance_frames = std::min<uint32_t>(num_movable_frames, uint32_t(settings.low_importance_tier_proportion * float(num_frames)));
-		const uint32_t num_medium_importance_frames = std::min<uint32_t>(num_movable_frames - num_low_importance_frames, uint32_t(settings.medium_importance_tier_proportion * float(num_frames)));
-		ACL_ASSERT(num_low_importance_frames + num_medium_importance_frames <= num_movable_frames, "Cannot move out more frames than we have");
+		// Returns whether a chunk contains a segment of a clip that hasn't been removed
+		auto is_chunk_used = [&](const database_chunk_header& chunk_header)
+		{
+			if (ref_removed_clips == nullptr)
+				return true;	// Nothing was removed
 
-		// Non-movable frames end up being high importance and remain in the compressed clip
-		const uint32_t num_high_importance_frames = num_frames - num_medium_importance_frames - num_low_importance_frames;
+			const database_chunk_segment_header* segment_headers = chunk_header.get_segment_headers();
+			for (uint32_t segment_index = 0; segment_index < chunk_header.num_segments; ++segment_index)
+			{
+				// Clip metadata is sorted by runtime header offset
+				const uint32_t clip_header_offset = segment_headers[segment_index].clip_header_offset;
+				auto search_predicate = [](const database_clip_metadata& clip_metadata, uint32_t offset) { return uint32_t(clip_metadata.clip_header_offset) < offset; };
+				const database_clip_metadata* clip_metadata = std::lower_bound(clip_metadatas, clip_metadatas + num_clips, clip_header_offset, search_predicate);
+				ACL_ASSERT(clip_metadata != clip_metadatas + num_clips && uint32_t(clip_metadata->clip_header_offset) == clip_header_offset, "Chunk segment references an unknown clip");
+
+				if (!bitset_test(ref_removed_clips, removed_clips_desc, uint32_t(clip_metadata - clip_metadatas)))
+					return true;
+			}
 
-		frame_assignment_context context(allocator, compressed_tracks_list, num_compressed_tracks, num_movable_frames);
-		context.set_tier_num_frames(quality_tier::highest_importance, num_high_importance_frames);
-		context.set_tier_num_frames(quality_tier::medium_importance, num_medium_importance_frames);
-		context.set_tier_num_frames(quality_tier::lowest_importance, num_low_importance_frames);
+			return false;
+		};
 
-		// Assign every frame to its tier
-		assign_frames_to_tiers(context);
+		// Chunks that only contain segments of removed clips are dropped, the ones that follow are moved down
+		// Chunks before the first dropped chunk remain identical
+		uint32_t* chunk_remaps[k_num_database_tiers] = { nullptr };
+		uint32_t num_chunks[k_num_database_tiers];
+		uint32_t bulk_data_size[k_num_database_tiers];
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			const uint32_t num_ref_chunks = ref_header.num_chunks[tier_index];
+			const database_chunk_description* ref_chunk_descriptions = ref_header.get_chunk_descriptions(tier_index);
+			const uint8_t* ref_bulk_data = ref_header.get_bulk_data(tier_index);
 
-		// Build our new compressed track instances with the high importance tier data
-		build_compressed_tracks(context, out_compressed_tracks);
+			chunk_remaps[tier_index] = allocate_type_array<uint32_t>(allocator, num_ref_chunks);
 
-		// Build our database with the lower tier data
-		out_database = build_compressed_database(context, settings, out_compressed_tracks);
+			uint32_t num_used_chunks = 0;
+			uint32_t used_bulk_data_size = 0;
+			for (uint32_t chunk_index = 0; chunk_index < num_ref_chunks; ++chunk_index)
+			{
+				const database_chunk_description& ref_chunk_description = ref_chunk_descriptions[chunk_index];
+				if (is_chunk_used(*ref_chunk_description.get_chunk_header(ref_bulk_data)))
+				{
+					chunk_remaps[tier_index][chunk_index] = num_used_chunks++;
+					used_bulk_data_size = align_to(used_bulk_data_size, k_database_bulk_data_alignment) + ref_chunk_description.size;
+				}
+				else
+					chunk_remaps[tier_index][chunk_index] = k_invalid_track_index;
+			}
 
+			num_chunks[tier_index] = num_used_chunks;
+			bulk_data_size[tier_index] = used_bulk_data_size;
+		}
+
+		// The bulk data of every tier is padded since the next tier follows
+		for (uint32_t tier_index = 0; tier_index + 1 < k_num_database_tiers; ++tier_index)
+			bulk_data_size[tier_index] = align_to(bulk_data_size[tier_index], k_database_bulk_data_alignment);
+
+		compressed_database* compacted_database = allocate_database(allocator, ref_header, num_chunks, num_clips, ref_header.num_segments, ref_header.get_has_removed_clips(), bulk_data_size);
+		database_header& db_header = get_database_header(*compacted_database);
+
+		std::memcpy(db_header.get_clip_metadatas(), clip_metadatas, num_clips * sizeof(database_clip_metadata));
+
+		if (ref_removed_clips != nullptr)
+			std::memcpy(db_header.get_removed_clips(), ref_removed_clips, removed_clips_desc.get_num_bytes());
+
+		// Our clips reference the same chunks at their new index, removed clips reference none
+		const database_clip_chunk_range* ref_clip_chunk_ranges = ref_header.get_clip_chunk_ranges();
+		database_clip_chunk_range* clip_chunk_ranges = db_header.get_clip_chunk_ranges();
+		for (uint32_t clip_index = 0; clip_index < num_clips; ++clip_index)
+		{
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const uint32_t num_clip_chunks = ref_clip_chunk_ranges[clip_index].num_chunks[tier_index];
+				const uint32_t first_chunk_index = num_clip_chunks != 0 ? chunk_remaps[tier_index][ref_clip_chunk_ranges[clip_index].first_chunk_index[tier_index]] : 0;
+				ACL_ASSERT(first_chunk_index != k_invalid_track_index, "A used chunk was dropped");
+
+				clip_chunk_ranges[clip_index].first_chunk_index[tier_index] = first_chunk_index;
+				clip_chunk_ranges[clip_index].num_chunks[tier_index] = num_clip_chunks;
+			}
+		}
+
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			const database_chunk_description* ref_chunk_descriptions = ref_header.get_chunk_descriptions(tier_index);
+			const uint8_t* ref_bulk_data = ref_header.get_bulk_data(tier_index);
+
+			database_chunk_description* chunk_descriptions = db_header.get_chunk_descriptions(tier_index);
+			uint8_t* bulk_data = db_header.get_bulk_data(tier_index);
+
+			uint32_t bulk_data_offset = 0;
+			for (uint32_t chunk_index = 0; chunk_index < ref_header.num_chunks[tier_index]; ++chunk_index)
+			{
+				const uint32_t new_chunk_index = chunk_remaps[tier_index][chunk_index];
+				if (new_chunk_index == k_invalid_track_index)
+					continue;	// Dropped
+
+				const database_chunk_description& ref_chunk_description = ref_chunk_descriptions[chunk_index];
+
+				bulk_data_offset = align_to(bulk_data_offset, k_database_bulk_data_alignment);
+
+				database_chunk_description& chunk_description = chunk_descriptions[new_chunk_index];
+				chunk_description.size = ref_chunk_description.size;
+				chunk_description.offset = bulk_data_offset;
+
+				relocate_chunk(ref_bulk_data, ref_chunk_description, bulk_data, chunk_description, new_chunk_index);
+
+				bulk_data_offset += ref_chunk_description.size;
+			}
+
+			deallocate_type_array(allocator, chunk_remaps[tier_index], ref_header.num_chunks[tier_index]);
+		}
+
+		finalize_database(*compacted_database);
+		ACL_ASSERT(compacted_database->is_valid(true).empty(), "Failed to compact database");
+
+		out_database = compacted_database;
 		return error_result();
 	}
 
-	inline error_result split_database_bulk_data(iallocator& allocator, const compressed_database& database, compressed_database*& out_split_database, uint8_t*& out_bulk_data_medium, uint8_t*& out_bulk_data_low)
+	inline error_result split_database_bulk_data(iallocator& allocator, const compressed_database& database, compressed_database*& out_split_database, uint8_t** out_tier_bulk_data, uint32_t num_tier_bulk_data)
 	{
 		using namespace acl_impl;
 
+		if (out_tier_bulk_data == nullptr || num_tier_bulk_data != k_num_database_tiers)
+			return error_result("Expected one bulk data output per database tier");
+
 		const error_result result = database.is_valid(true);
 		if (result.any())
 			return result;
@@ -1335,10 +2513,9 @@ namespace acl
 		if (!database.is_bulk_data_inline())
 			return error_result("Bulk data is not inline in source database");
 
-		const uint32_t total_size = database.get_total_size();
-		const uint32_t bulk_data_medium_size = database.get_bulk_data_size(quality_tier::medium_importance);
-		const uint32_t bulk_data_low_size = database.get_bulk_data_size(quality_tier::lowest_importance);
-		const uint32_t db_size = total_size - bulk_data_medium_size - bulk_data_low_size;
+		uint32_t db_size = database.get_total_size();
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			db_size -= database.get_bulk_data_size(quality_tier(tier_index + 1));
 
 		// Allocate and setup our new database
 		uint8_t* database_buffer = allocate_type_array_aligned<uint8_t>(allocator, db_size, alignof(compressed_database));
@@ -1352,8 +2529,9 @@ namespace acl
 		database_header* db_header = safe_ptr_cast<database_header>(database_buffer);
 		database_buffer += sizeof(database_header);
 
-		db_header->bulk_data_offset[0] = invalid_ptr_offset();
-		db_header->bulk_data_offset[1] = invalid_ptr_offset();
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			db_header->bulk_data_offset[tier_index] = invalid_ptr_offset();
+
 		db_header->set_is_bulk_data_inline(false);
 
 		database_buffer_header->size = db_size;
@@ -1361,22 +2539,122 @@ namespace acl
 		ACL_ASSERT(out_split_database->is_valid(true).empty(), "Failed to split database");
 
 		// Allocate and setup our new bulk data
-		uint8_t* bulk_data_medium_buffer = bulk_data_medium_size != 0 ? allocate_type_array_aligned<uint8_t>(allocator, bulk_data_medium_size, k_database_bulk_data_alignment) : nullptr;
-		out_bulk_data_medium = bulk_data_medium_buffer;
-
-		std::memcpy(bulk_data_medium_buffer, database.get_bulk_data(quality_tier::medium_importance), bulk_data_medium_size);
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			const quality_tier tier = quality_tier(tier_index + 1);
+			const uint32_t bulk_data_size = database.get_bulk_data_size(tier);
 
-		uint8_t* bulk_data_low_buffer = bulk_data_low_size != 0 ? allocate_type_array_aligned<uint8_t>(allocator, bulk_data_low_size, k_database_bulk_data_alignment) : nullptr;
-		out_bulk_data_low = bulk_data_low_buffer;
+			uint8_t* bulk_data_buffer = bulk_data_size != 0 ? allocate_type_array_aligned<uint8_t>(allocator, bulk_data_size, k_database_bulk_data_alignment) : nullptr;
+			out_tier_bulk_data[tier_index] = bulk_data_buffer;
 
-		std::memcpy(bulk_data_low_buffer, database.get_bulk_data(quality_tier::lowest_importance), bulk_data_low_size);
+			std::memcpy(bulk_data_buffer, database.get_bulk_data(tier), bulk_data_size);
 
 #if defined(ACL_HAS_ASSERT_CHECKS)
-		const uint32_t bulk_data_medium_hash = hash32(bulk_data_medium_buffer, bulk_data_medium_size);
-		ACL_ASSERT(bulk_data_medium_hash == database.get_bulk_data_hash(quality_tier::medium_importance), "Bulk data hash mismatch");
+			const uint32_t bulk_data_hash = hash32(bulk_data_buffer, bulk_data_size);
+			ACL_ASSERT(bulk_data_hash == database.get_bulk_data_hash(tier), "Bulk data hash mismatch");
+#endif
+		}
+
+		return error_result();
+	}
+
+#if ACL_NUM_DATABASE_TIERS == 2
+	inline error_result split_database_bulk_data(iallocator& allocator, const compressed_database& database, compressed_database*& out_split_database, uint8_t*& out_bulk_data_medium, uint8_t*& out_bulk_data_low)
+	{
+		uint8_t* tier_bulk_data[k_num_database_tiers] = { nullptr };
+		const error_result result = split_database_bulk_data(allocator, database, out_split_database, tier_bulk_data, k_num_database_tiers);
+
+		out_bulk_data_medium = tier_bulk_data[0];
+		out_bulk_data_low = tier_bulk_data[1];
+		return result;
+	}
+#endif
+
+	inline error_result compress_database_bulk_data(iallocator& allocator, const compressed_database& database, quality_tier tier, const uint8_t* bulk_data,
+		uint8_t*& out_compressed_bulk_data, uint32_t& out_compressed_bulk_data_size)
+	{
+		using namespace acl_impl;
+
+		const error_result result = database.is_valid(true);
+		if (result.any())
+			return result;
+
+		if (tier == quality_tier::highest_importance)
+			return error_result("The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+
+		if (uint32_t(tier) > k_num_database_tiers)
+			return error_result("Invalid quality tier");
+
+		const uint32_t bulk_data_size = database.get_bulk_data_size(tier);
+		if (bulk_data_size != 0 && bulk_data == nullptr)
+			return error_result("Bulk data cannot be null");
+
+		if (hash32(bulk_data, bulk_data_size) != database.get_bulk_data_hash(tier))
+			return error_result("Bulk data does not belong to this database tier");
+
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		const database_header& header = get_database_header(database);
+		const uint32_t num_chunks = header.num_chunks[tier_index];
+		const database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
+
+		const uint32_t chunk_table_size = uint32_t(sizeof(compressed_bulk_data_header)) + num_chunks * uint32_t(sizeof(compressed_bulk_data_chunk));
+
+		// In the worst case, every chunk is stored uncompressed
+		uint32_t max_compressed_bulk_data_size = chunk_table_size;
+		for (uint32_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index)
+			max_compressed_bulk_data_size += chunk_descriptions[chunk_index].size;
+
+		uint8_t* compressed_bulk_data = allocate_type_array_aligned<uint8_t>(allocator, max_compressed_bulk_data_size, k_database_bulk_data_alignment);
+		std::memset(compressed_bulk_data, 0, chunk_table_size);
+
+		compressed_bulk_data_header* compressed_header = safe_ptr_cast<compressed_bulk_data_header>(compressed_bulk_data);
+		compressed_bulk_data_chunk* compressed_chunks = safe_ptr_cast<compressed_bulk_data_chunk>(compressed_bulk_data + sizeof(compressed_bulk_data_header));
+
+		uint32_t compressed_offset = chunk_table_size;
+		for (uint32_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index)
+		{
+			const database_chunk_description& chunk_description = chunk_descriptions[chunk_index];
+			const uint8_t* chunk_data = bulk_data + chunk_description.offset;
+			uint8_t* compressed_chunk_data = compressed_bulk_data + compressed_offset;
+
+			// Only keep the compressed chunk if it is smaller
+			uint32_t compressed_size = chunk_description.size != 0 ? lz_compress(chunk_data, chunk_description.size, compressed_chunk_data, chunk_description.size - 1) : 0;
+			if (compressed_size == 0)
+			{
+				std::memcpy(compressed_chunk_data, chunk_data, chunk_description.size);
+				compressed_size = chunk_description.size;
+			}
 
-		const uint32_t bulk_data_low_hash = hash32(bulk_data_low_buffer, bulk_data_low_size);
-		ACL_ASSERT(bulk_data_low_hash == database.get_bulk_data_hash(quality_tier::lowest_importance), "Bulk data hash mismatch");
+			compressed_bulk_data_chunk& compressed_chunk = compressed_chunks[chunk_index];
+			compressed_chunk.bulk_data_offset = chunk_description.offset;
+			compressed_chunk.size = chunk_description.size;
+			compressed_chunk.compressed_offset = compressed_offset;
+			compressed_chunk.compressed_size = compressed_size;
+
+			compressed_offset += compressed_size;
+		}
+
+		compressed_header->tag = buffer_tag32::compressed_bulk_data;
+		compressed_header->num_chunks = num_chunks;
+		compressed_header->bulk_data_size = bulk_data_size;
+		compressed_header->compressed_bulk_data_size = compressed_offset;
+
+		// Shrink our buffer to its final size
+		out_compressed_bulk_data = allocate_type_array_aligned<uint8_t>(allocator, compressed_offset, k_database_bulk_data_alignment);
+		out_compressed_bulk_data_size = compressed_offset;
+		std::memcpy(out_compressed_bulk_data, compressed_bulk_data, compressed_offset);
+
+		deallocate_type_array(allocator, compressed_bulk_data, max_compressed_bulk_data_size);
+
+#if defined(ACL_HAS_ASSERT_CHECKS)
+		if (bulk_data_size != 0)
+		{
+			uint8_t* decompressed_bulk_data = allocate_type_array<uint8_t>(allocator, bulk_data_size);
+			const bool is_decompressed = decompress_database_bulk_data(out_compressed_bulk_data, out_compressed_bulk_data_size, decompressed_bulk_data, bulk_data_size);
+			ACL_ASSERT(is_decompressed && hash32(decompressed_bulk_data, bulk_data_size) == database.get_bulk_data_hash(tier), "Failed to compress the bulk data");
+			(void)is_decompressed;
+			deallocate_type_array(allocator, decompressed_bulk_data, bulk_data_size);
+		}
 #endif
 
 		return error_result();
@@ -1393,36 +2671,62 @@ namespace acl
 		if (tier == quality_tier::highest_importance)
 			return error_result("The database does not contain data for the high importance tier, it lives inside compressed_tracks");
 
+		if (uint32_t(tier) > k_num_database_tiers)
+			return error_result("Invalid quality tier");
+
 		if (!database.has_bulk_data(tier))
 			return error_result("Cannot strip an empty quality tier");
 
-		const uint32_t tier_index = uint32_t(tier) - 1;
+		const uint32_t stripped_tier_index = uint32_t(tier) - 1;
 		const bool is_bulk_data_inline = database.is_bulk_data_inline();
 		const database_header& ref_header = get_database_header(database);
-		const uint32_t num_medium_chunks = tier != quality_tier::medium_importance ? database.get_num_chunks(quality_tier::medium_importance) : 0;
-		const uint32_t num_low_chunks = tier != quality_tier::lowest_importance ? database.get_num_chunks(quality_tier::lowest_importance) : 0;
 		const uint32_t num_tracks = ref_header.num_clips;
 
 		// Bulk data sizes are already padded for alignment
-		const uint32_t bulk_data_medium_size = tier != quality_tier::medium_importance ? database.get_bulk_data_size(quality_tier::medium_importance) : 0;
-		const uint32_t bulk_data_low_size = tier != quality_tier::lowest_importance ? database.get_bulk_data_size(quality_tier::lowest_importance) : 0;
+		uint32_t num_chunks[k_num_database_tiers];
+		uint32_t bulk_data_size[k_num_database_tiers];
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			num_chunks[tier_index] = tier_index != stripped_tier_index ? ref_header.num_chunks[tier_index] : 0;
+			bulk_data_size[tier_index] = tier_index != stripped_tier_index ? ref_header.bulk_data_size[tier_index] : 0;
+		}
 
 		uint32_t database_buffer_size = 0;
 		database_buffer_size += sizeof(raw_buffer_header);										// Header
 		database_buffer_size += sizeof(database_header);										// Header
 
-		database_buffer_size = align_to(database_buffer_size, 4);								// Align chunk descriptions
-		database_buffer_size += num_medium_chunks * sizeof(database_chunk_description);			// Chunk descriptions
-
-		database_buffer_size = align_to(database_buffer_size, 4);								// Align chunk descriptions
-		database_buffer_size += num_low_chunks * sizeof(database_chunk_description);			// Chunk descriptions
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			database_buffer_size = align_to(database_buffer_size, 4);							// Align chunk descriptions
+			database_buffer_size += num_chunks[tier_index] * sizeof(database_chunk_description);	// Chunk descriptions
+		}
 
 		database_buffer_size = align_to(database_buffer_size, 4);								// Align clip hashes
 		database_buffer_size += num_tracks * sizeof(database_clip_metadata);					// Clip metadata
 
+		if (ref_header.get_has_clip_chunk_ranges())
+			database_buffer_size += num_tracks * sizeof(database_clip_chunk_range);				// Clip chunk ranges
+
+		const uint32_t removed_clips_size = ref_header.get_has_removed_clips() ? bitset_description::make_from_num_bits(num_tracks).get_num_bytes() : 0;
+		database_buffer_size += removed_clips_size;												// Removed clips
+
+		const uint32_t clip_hash_index_size = ref_header.get_has_clip_hash_index() ? get_clip_hash_index_num_slots(num_tracks) * uint32_t(sizeof(uint32_t)) : 0;
+		database_buffer_size += clip_hash_index_size;											// Clip hash index
+
+		const uint32_t segment_streaming_metadata_size = ref_header.get_has_segment_streaming_metadata() ? ref_header.num_segments * uint32_t(sizeof(database_segment_streaming_metadata)) : 0;
+		database_buffer_size += segment_streaming_metadata_size;								// Segment streaming metadata
+
+		uint32_t chunk_hashes_size = 0;
+		if (ref_header.get_has_chunk_hashes())
+		{
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				chunk_hashes_size += num_chunks[tier_index] * uint32_t(sizeof(uint32_t));
+		}
+		database_buffer_size += chunk_hashes_size;												// Chunk hashes
+
 		database_buffer_size = align_to(database_buffer_size, k_database_bulk_data_alignment);	// Align bulk data
-		database_buffer_size += bulk_data_medium_size;											// Bulk data
-		database_buffer_size += bulk_data_low_size;												// Bulk data
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			database_buffer_size += bulk_data_size[tier_index];									// Bulk data
 
 		// Allocate and setup our new database
 		uint8_t* database_buffer = allocate_type_array_aligned<uint8_t>(allocator, database_buffer_size, alignof(compressed_database));
@@ -1439,59 +2743,96 @@ namespace acl
 		// Copy our header
 		std::memcpy(db_header, &get_database_header(database), sizeof(database_header));
 
-		database_buffer = align_to(database_buffer, 4);										// Align chunk descriptions
-		database_buffer += num_medium_chunks * sizeof(database_chunk_description);			// Chunk descriptions
-
-		database_buffer = align_to(database_buffer, 4);										// Align chunk descriptions
-		database_buffer += num_low_chunks * sizeof(database_chunk_description);				// Chunk descriptions
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			database_buffer = align_to(database_buffer, 4);										// Align chunk descriptions
+			database_buffer += num_chunks[tier_index] * sizeof(database_chunk_description);		// Chunk descriptions
+		}
 
 		database_buffer = align_to(database_buffer, 4);										// Align clip hashes
 		db_header->clip_metadata_offset = uint32_t(database_buffer - db_header_start);		// Clip metadata
 		database_buffer += num_tracks * sizeof(database_clip_metadata);						// Clip metadata
 
-		database_buffer = align_to(database_buffer, k_database_bulk_data_alignment);		// Align bulk data
-		if (bulk_data_medium_size != 0)
-			db_header->bulk_data_offset[0] = uint32_t(database_buffer - db_header_start);	// Bulk data
-		else
-			db_header->bulk_data_offset[0] = invalid_ptr_offset();
-		database_buffer += bulk_data_medium_size;											// Bulk data
+		if (ref_header.get_has_clip_chunk_ranges())
+			database_buffer += num_tracks * sizeof(database_clip_chunk_range);				// Clip chunk ranges
 
-		if (bulk_data_low_size != 0)
-			db_header->bulk_data_offset[1] = uint32_t(database_buffer - db_header_start);	// Bulk data
-		else
-			db_header->bulk_data_offset[1] = invalid_ptr_offset();
-		database_buffer += bulk_data_low_size;												// Bulk data
+		database_buffer += removed_clips_size;												// Removed clips
+		database_buffer += clip_hash_index_size;											// Clip hash index
+		database_buffer += segment_streaming_metadata_size;									// Segment streaming metadata
+		database_buffer += chunk_hashes_size;												// Chunk hashes
+
+		database_buffer = align_to(database_buffer, k_database_bulk_data_alignment);		// Align bulk data
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			if (bulk_data_size[tier_index] != 0)
+				db_header->bulk_data_offset[tier_index] = uint32_t(database_buffer - db_header_start);	// Bulk data
+			else
+				db_header->bulk_data_offset[tier_index] = invalid_ptr_offset();
+			database_buffer += bulk_data_size[tier_index];												// Bulk data
+		}
 
 		// Zero out our stripped tier
-		db_header->num_chunks[tier_index] = 0;
-		db_header->bulk_data_size[tier_index] = 0;
-		db_header->bulk_data_offset[tier_index] = invalid_ptr_offset();
-		db_header->bulk_data_hash[tier_index] = hash32(nullptr, 0);
+		db_header->num_chunks[stripped_tier_index] = 0;
+		db_header->bulk_data_size[stripped_tier_index] = 0;
+		db_header->bulk_data_offset[stripped_tier_index] = invalid_ptr_offset();
+		db_header->bulk_data_hash[stripped_tier_index] = hash32(nullptr, 0);
 
 		// Copy our chunk descriptions
-		if (tier != quality_tier::medium_importance)
-			std::memcpy(db_header->get_chunk_descriptions_medium(), ref_header.get_chunk_descriptions_medium(), num_medium_chunks * sizeof(database_chunk_description));
-		else if (tier != quality_tier::lowest_importance)
-			std::memcpy(db_header->get_chunk_descriptions_low(), ref_header.get_chunk_descriptions_low(), num_low_chunks * sizeof(database_chunk_description));
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			std::memcpy(db_header->get_chunk_descriptions(tier_index), ref_header.get_chunk_descriptions(tier_index), num_chunks[tier_index] * sizeof(database_chunk_description));
 
 		// Copy our clip metadata
 		std::memcpy(db_header->get_clip_metadatas(), ref_header.get_clip_metadatas(), num_tracks * sizeof(database_clip_metadata));
 
-		// Copy our bulk data
-		if (is_bulk_data_inline)
+		// Copy our clip chunk ranges, the stripped tier no longer has chunks
+		if (ref_header.get_has_clip_chunk_ranges())
 		{
-			// Copy the remaining bulk data
-			if (tier != quality_tier::medium_importance)
+			database_clip_chunk_range* clip_chunk_ranges = db_header->get_clip_chunk_ranges();
+			std::memcpy(clip_chunk_ranges, ref_header.get_clip_chunk_ranges(), num_tracks * sizeof(database_clip_chunk_range));
+
+			for (uint32_t clip_index = 0; clip_index < num_tracks; ++clip_index)
 			{
-				const uint8_t* src_bulk_data = database.get_bulk_data(quality_tier::medium_importance);
-				uint8_t* dst_bulk_data = db_header->get_bulk_data_medium();
-				std::memcpy(dst_bulk_data, src_bulk_data, bulk_data_medium_size);
+				clip_chunk_ranges[clip_index].first_chunk_index[stripped_tier_index] = 0;
+				clip_chunk_ranges[clip_index].num_chunks[stripped_tier_index] = 0;
 			}
-			else if (tier != quality_tier::lowest_importance)
+		}
+
+		// Copy our removed clips
+		if (ref_header.get_has_removed_clips())
+			std::memcpy(db_header->get_removed_clips(), ref_header.get_removed_clips(), removed_clips_size);
+
+		// Copy our clip hash index, clip indices do not change
+		if (ref_header.get_has_clip_hash_index())
+			std::memcpy(db_header->get_clip_hash_index(), ref_header.get_clip_hash_index(), clip_hash_index_size);
+
+		// Copy our segment streaming metadata, the stripped tier no longer has chunks
+		if (ref_header.get_has_segment_streaming_metadata())
+		{
+			database_segment_streaming_metadata* segment_streaming_metadatas = db_header->get_segment_streaming_metadatas();
+			std::memcpy(segment_streaming_metadatas, ref_header.get_segment_streaming_metadatas(), segment_streaming_metadata_size);
+
+			for (uint32_t segment_index = 0; segment_index < ref_header.num_segments; ++segment_index)
 			{
-				const uint8_t* src_bulk_data = database.get_bulk_data(quality_tier::lowest_importance);
-				uint8_t* dst_bulk_data = db_header->get_bulk_data_low();
-				std::memcpy(dst_bulk_data, src_bulk_data, bulk_data_low_size);
+				segment_streaming_metadatas[segment_index].chunk_index[stripped_tier_index] = k_invalid_chunk_index;
+				segment_streaming_metadatas[segment_index].sample_indices[stripped_tier_index] = 0;
+				segment_streaming_metadatas[segment_index].samples_offset[stripped_tier_index] = 0;
+			}
+		}
+
+		// Copy our chunk hashes, the stripped tier no longer has chunks
+		if (ref_header.get_has_chunk_hashes())
+		{
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				std::memcpy(db_header->get_chunk_hashes(tier_index), ref_header.get_chunk_hashes(tier_index), num_chunks[tier_index] * sizeof(uint32_t));
+		}
+
+		// Copy the remaining bulk data
+		if (is_bulk_data_inline)
+		{
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				if (bulk_data_size[tier_index] != 0)
+					std::memcpy(db_header->get_bulk_data(tier_index), ref_header.get_bulk_data(tier_index), bulk_data_size[tier_index]);
 			}
 		}
 
@@ -1502,19 +2843,16 @@ namespace acl
 #if defined(ACL_HAS_ASSERT_CHECKS)
 		if (is_bulk_data_inline)
 		{
-			if (tier != quality_tier::medium_importance)
-			{
-				const uint32_t bulk_data_size = out_stripped_database->get_bulk_data_size(quality_tier::medium_importance);
-				const uint8_t* bulk_data = out_stripped_database->get_bulk_data(quality_tier::medium_importance);
-				const uint32_t bulk_data_hash = hash32(bulk_data, bulk_data_size);
-				ACL_ASSERT(bulk_data_hash == database.get_bulk_data_hash(quality_tier::medium_importance), "Bulk data hash mismatch");
-			}
-			else if (tier != quality_tier::lowest_importance)
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
 			{
-				const uint32_t bulk_data_size = out_stripped_database->get_bulk_data_size(quality_tier::lowest_importance);
-				const uint8_t* bulk_data = out_stripped_database->get_bulk_data(quality_tier::lowest_importance);
-				const uint32_t bulk_data_hash = hash32(bulk_data, bulk_data_size);
-				ACL_ASSERT(bulk_data_hash == database.get_bulk_data_hash(quality_tier::lowest_importance), "Bulk data hash mismatch");
+				if (tier_index == stripped_tier_index)
+					continue;
+
+				const quality_tier remaining_tier = quality_tier(tier_index + 1);
+				const uint32_t remaining_bulk_data_size = out_stripped_database->get_bulk_data_size(remaining_tier);
+				const uint8_t* bulk_data = out_stripped_database->get_bulk_data(remaining_tier);
+				const uint32_t bulk_data_hash = hash32(bulk_data, remaining_bulk_data_size);
+				ACL_ASSERT(bulk_data_hash == database.get_bulk_data_hash(remaining_tier), "Bulk data hash mismatch");
 			}
 		}
 #endif
@@ -42,6 +42,7 @@
 #include "acl/compression/impl/normalize_track_impl.h"
 #include "acl/compression/impl/optimize_looping.h"
 #include "acl/compression/impl/quantize_track_impl.h"
+#include "acl/compression/impl/scalar_segment_context.h"
 #include "acl/compression/impl/track_range_impl.h"
 #include "acl/compression/impl/write_compression_stats_impl.h"
 #include "acl/compression/impl/write_track_data_impl.h"
@@ -63,6 +64,9 @@ namespace acl
 		{
 			(void)out_stats;
 
+			if (settings.scalar_segment_num_samples != 0 && settings.scalar_segment_num_samples < 8)
+				return error_result("scalar_segment_num_samples must be 0 or greater or equal to 8");
+
 #if defined(ACL_USE_SJSON)
 			scope_profiler compression_time;
 #endif
@@ -80,6 +84,40 @@ namespace acl
 			// Compact and collapse the constant tracks
 			extract_constant_tracks(context);
 
+			// If we enable database support, include the metadata we need
+			const bool include_contributing_error = settings.enable_database_support || settings.metadata.include_contributing_error;
+
+			// The contributing error is calculated per segment and a database segment cannot hold more than 32 samples
+			uint32_t num_samples_per_segment = settings.scalar_segment_num_samples;
+			if (include_contributing_error && (num_samples_per_segment == 0 || num_samples_per_segment > k_max_num_samples_per_scalar_database_segment))
+				num_samples_per_segment = k_max_num_samples_per_scalar_database_segment;
+
+			// Split our samples into segments, each with their own ranges and bit rates
+			// This must be done before we normalize our samples
+			uint32_t num_segments = 0;
+			if (context.num_output_tracks != 0)
+			{
+				if (include_contributing_error)
+					num_segments = get_num_scalar_database_segments(context.num_samples, num_samples_per_segment);
+				else
+					num_segments = get_num_scalar_segments(context.num_samples, num_samples_per_segment);
+			}
+
+			scalar_segment_context* segments = nullptr;
+			if (num_segments != 0)
+			{
+				segments = allocate_type_array<scalar_segment_context>(allocator, num_segments);
+				initialize_scalar_segments(context, num_samples_per_segment, segments, num_segments);
+			}
+
+			// Find how much error each keyframe contributes if it is moved into a database
+			keyframe_stripping_metadata_t* contributing_error = nullptr;
+			if (include_contributing_error && num_segments != 0)
+			{
+				contributing_error = allocate_type_array<keyframe_stripping_metadata_t>(allocator, context.num_samples);
+				find_scalar_contributing_error(allocator, segments, num_segments, context.num_samples, contributing_error);
+			}
+
 			// Normalize our samples into the track wide ranges per track
 			normalize_tracks(context);
 
@@ -94,24 +132,77 @@ namespace acl
 			const uint32_t animated_values_size = (animated_num_bits + 7) / 8;		// Round up to nearest byte
 			const uint32_t num_bits_per_frame = context.num_samples != 0 ? (animated_num_bits / context.num_samples) : 0;
 
+			uint32_t segments_size = 0;
+			if (num_segments != 0)
+			{
+				segments_size += sizeof(scalar_segments_header);
+				segments_size += sizeof(scalar_segment_header) * num_segments;
+
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				{
+					scalar_segment_context& segment = segments[segment_index];
+					const uint32_t segment_animated_num_bits = write_track_animated_values(segment.context, nullptr);
+
+					segment.per_track_metadata_size = write_track_metadata(segment.context, nullptr);
+					segment.range_values_size = write_track_range_values(segment.context, nullptr);
+					segment.animated_values_size = (segment_animated_num_bits + 7) / 8;		// Round up to nearest byte
+					segment.num_bits_per_frame = segment_animated_num_bits / segment.context.num_samples;
+
+					segments_size += segment.per_track_metadata_size;
+					segments_size = align_to(segments_size, 4);
+					segments_size += segment.range_values_size;
+					segments_size += segment.animated_values_size;
+				}
+
+				// Segments are only retained when they lower our memory footprint unless they are required by the database
+				if (!include_contributing_error && segments_size >= (per_track_metadata_size + range_values_size + animated_values_size))
+				{
+					deallocate_type_array(allocator, segments, num_segments);
+					segments = nullptr;
+					num_segments = 0;
+				}
+			}
+
 			uint32_t buffer_size = 0;
 			buffer_size += sizeof(raw_buffer_header);								// Header
 			buffer_size += sizeof(tracks_header);									// Header
 			buffer_size += sizeof(scalar_tracks_header);							// Header
-			ACL_ASSERT(is_aligned_to(buffer_size, alignof(track_metadata)), "Invalid alignment");
-			buffer_size += per_track_metadata_size;									// Per track metadata
-			buffer_size = align_to(buffer_size, 4);									// Align constant values
-			buffer_size += constant_values_size;									// Constant values
-			ACL_ASSERT(is_aligned_to(buffer_size, 4), "Invalid alignment");
-			buffer_size += range_values_size;										// Range values
-			ACL_ASSERT(is_aligned_to(buffer_size, 4), "Invalid alignment");
-			buffer_size += animated_values_size;									// Animated values
+
+			if (num_segments != 0)
+			{
+				buffer_size += sizeof(scalar_segments_header);						// Segments header
+				buffer_size += sizeof(scalar_segment_header) * num_segments;		// Segment headers
+				ACL_ASSERT(is_aligned_to(buffer_size, 4), "Invalid alignment");
+				buffer_size += constant_values_size;								// Constant values
+
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				{
+					const scalar_segment_context& segment = segments[segment_index];
+					buffer_size += segment.per_track_metadata_size;					// Per track metadata
+					buffer_size = align_to(buffer_size, 4);							// Align range values
+					buffer_size += segment.range_values_size;						// Range values
+					buffer_size += segment.animated_values_size;					// Animated values
+				}
+			}
+			else
+			{
+				ACL_ASSERT(is_aligned_to(buffer_size, alignof(track_metadata)), "Invalid alignment");
+				buffer_size += per_track_metadata_size;								// Per track metadata
+				buffer_size = align_to(buffer_size, 4);								// Align constant values
+				buffer_size += constant_values_size;								// Constant values
+				ACL_ASSERT(is_aligned_to(buffer_size, 4), "Invalid alignment");
+				buffer_size += range_values_size;									// Range values
+				ACL_ASSERT(is_aligned_to(buffer_size, 4), "Invalid alignment");
+				buffer_size += animated_values_size;								// Animated values
+			}
 
 			// Optional metadata
+			const uint32_t num_contributing_errors = contributing_error != nullptr ? context.num_samples : 0;
 			const uint32_t metadata_start_offset = align_to(buffer_size, 4);
 			const uint32_t metadata_track_list_name_size = settings.metadata.include_track_list_name ? write_track_list_name(track_list, nullptr) : 0;
 			const uint32_t metadata_track_names_size = settings.metadata.include_track_names ? write_track_names(track_list, context.track_output_indices, context.num_output_tracks, nullptr) : 0;
 			const uint32_t metadata_track_descriptions_size = settings.metadata.include_track_descriptions ? write_track_descriptions(track_list, context.track_output_indices, context.num_output_tracks, nullptr) : 0;
+			const uint32_t metadata_contributing_error_size = include_contributing_error ? write_contributing_error(contributing_error, num_contributing_errors, nullptr) : 0;
 
 			uint32_t metadata_size = 0;
 			metadata_size += metadata_track_list_name_size;
@@ -119,6 +210,8 @@ namespace acl
 			metadata_size += metadata_track_names_size;
 			metadata_size = align_to(metadata_size, 4);
 			metadata_size += metadata_track_descriptions_size;
+			metadata_size = align_to(metadata_size, 4);
+			metadata_size += metadata_contributing_error_size;
 
 			if (metadata_size != 0)
 			{
@@ -153,23 +246,65 @@ namespace acl
 			header->sample_rate = context.num_output_tracks != 0 ? context.sample_rate : 0.0F;
 			header->set_is_wrap_optimized(context.looping_policy == sample_looping_policy::wrap);
 			header->set_has_metadata(metadata_size != 0);
+			header->set_has_scalar_segments(num_segments != 0);
 
 			// Write our scalar tracks header
 			scalar_tracks_header* scalars_header = safe_ptr_cast<scalar_tracks_header>(buffer);
 			buffer += sizeof(scalar_tracks_header);
 
-			scalars_header->num_bits_per_frame = num_bits_per_frame;
-
 			const uint8_t* packed_data_start_offset = buffer - sizeof(scalar_tracks_header);	// Relative to our header
-			scalars_header->metadata_per_track = uint32_t(buffer - packed_data_start_offset);
-			buffer += per_track_metadata_size;
-			buffer = align_to(buffer, 4);
-			scalars_header->track_constant_values = uint32_t(buffer - packed_data_start_offset);
-			buffer += constant_values_size;
-			scalars_header->track_range_values = uint32_t(buffer - packed_data_start_offset);
-			buffer += range_values_size;
-			scalars_header->track_animated_values = uint32_t(buffer - packed_data_start_offset);
-			buffer += animated_values_size;
+
+			if (num_segments != 0)
+			{
+				scalar_segments_header* segments_header = safe_ptr_cast<scalar_segments_header>(buffer);
+				buffer += sizeof(scalar_segments_header);
+
+				segments_header->num_segments = num_segments;
+				segments_header->num_samples_per_segment = num_samples_per_segment;
+				segments_header->database_header = invalid_ptr_offset();	// Set when the database is built
+
+				scalar_segment_header* segment_headers = safe_ptr_cast<scalar_segment_header>(buffer);
+				buffer += sizeof(scalar_segment_header) * num_segments;
+
+				scalars_header->track_constant_values = uint32_t(buffer - packed_data_start_offset);
+				buffer += constant_values_size;
+
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				{
+					const scalar_segment_context& segment = segments[segment_index];
+					scalar_segment_header& segment_header = segment_headers[segment_index];
+
+					segment_header.num_bits_per_frame = segment.num_bits_per_frame;
+					segment_header.sample_indices = get_scalar_segment_sample_indices(segment.context.num_samples);
+					segment_header.metadata_per_track = uint32_t(buffer - packed_data_start_offset);
+					buffer += segment.per_track_metadata_size;
+					buffer = align_to(buffer, 4);
+					segment_header.track_range_values = uint32_t(buffer - packed_data_start_offset);
+					buffer += segment.range_values_size;
+					segment_header.track_animated_values = uint32_t(buffer - packed_data_start_offset);
+					buffer += segment.animated_values_size;
+				}
+
+				// The clip wide offsets point to our first segment
+				scalars_header->num_bits_per_frame = segment_headers[0].num_bits_per_frame;
+				scalars_header->metadata_per_track = segment_headers[0].metadata_per_track;
+				scalars_header->track_range_values = segment_headers[0].track_range_values;
+				scalars_header->track_animated_values = segment_headers[0].track_animated_values;
+			}
+			else
+			{
+				scalars_header->num_bits_per_frame = num_bits_per_frame;
+
+				scalars_header->metadata_per_track = uint32_t(buffer - packed_data_start_offset);
+				buffer += per_track_metadata_size;
+				buffer = align_to(buffer, 4);
+				scalars_header->track_constant_values = uint32_t(buffer - packed_data_start_offset);
+				buffer += constant_values_size;
+				scalars_header->track_range_values = uint32_t(buffer - packed_data_start_offset);
+				buffer += range_values_size;
+				scalars_header->track_animated_values = uint32_t(buffer - packed_data_start_offset);
+				buffer += animated_values_size;
+			}
 
 			if (metadata_size != 0)
 			{
@@ -186,22 +321,42 @@ namespace acl
 			ACL_ASSERT((buffer_start + buffer_size) == buffer, "Buffer size and pointer mismatch");
 
 			// Write our compressed data
-			track_metadata* per_track_metadata = scalars_header->get_track_metadata();
-			write_track_metadata(context, per_track_metadata);
-
 			float* constant_values = scalars_header->get_track_constant_values();
 			write_track_constant_values(context, constant_values);
 
-			float* range_values = scalars_header->get_track_range_values();
-			write_track_range_values(context, range_values);
+			if (num_segments != 0)
+			{
+				const scalar_segment_header* segment_headers = scalars_header->get_segment_headers();
 
-			uint8_t* animated_values = scalars_header->get_track_animated_values();
-			write_track_animated_values(context, animated_values);
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				{
+					const track_list_context& segment_context = segments[segment_index].context;
+					const scalar_segment_header& segment_header = segment_headers[segment_index];
+
+					write_track_metadata(segment_context, segment_header.metadata_per_track.add_to(scalars_header));
+					write_track_range_values(segment_context, segment_header.track_range_values.add_to(scalars_header));
+					write_track_animated_values(segment_context, segment_header.track_animated_values.add_to(scalars_header));
+				}
+
+				deallocate_type_array(allocator, segments, num_segments);
+			}
+			else
+			{
+				track_metadata* per_track_metadata = scalars_header->get_track_metadata();
+				write_track_metadata(context, per_track_metadata);
+
+				float* range_values = scalars_header->get_track_range_values();
+				write_track_range_values(context, range_values);
+
+				uint8_t* animated_values = scalars_header->get_track_animated_values();
+				write_track_animated_values(context, animated_values);
+			}
 
 			// Optional metadata header is last
 			uint32_t writter_metadata_track_list_name_size = 0;
 			uint32_t written_metadata_track_names_size = 0;
 			uint32_t written_metadata_track_descriptions_size = 0;
+			uint32_t written_metadata_contributing_error_size = 0;
 			if (metadata_size != 0)
 			{
 				optional_metadata_header* metadada_header = reinterpret_cast<optional_metadata_header*>(buffer_start + buffer_size - sizeof(optional_metadata_header));
@@ -237,11 +392,24 @@ namespace acl
 				}
 				else
 					metadada_header->track_descriptions = invalid_ptr_offset();
+
+				if (include_contributing_error)
+				{
+					metadata_offset = align_to(metadata_offset, 4);
+					metadada_header->contributing_error = metadata_offset;
+					written_metadata_contributing_error_size = write_contributing_error(contributing_error, num_contributing_errors, metadada_header->get_contributing_error(*out_compressed_tracks));
+					metadata_offset += written_metadata_contributing_error_size;
+				}
+				else
+					metadada_header->contributing_error = invalid_ptr_offset();
 			}
 
+			deallocate_type_array(allocator, contributing_error, num_contributing_errors);
+
 			ACL_ASSERT(writter_metadata_track_list_name_size == metadata_track_list_name_size, "Wrote too little or too much data");
 			ACL_ASSERT(written_metadata_track_names_size == metadata_track_names_size, "Wrote too little or too much data");
 			ACL_ASSERT(written_metadata_track_descriptions_size == metadata_track_descriptions_size, "Wrote too little or too much data");
+			ACL_ASSERT(written_metadata_contributing_error_size == metadata_contributing_error_size, "Wrote too little or too much data");
 
 			// Finish the raw buffer header
 			buffer_header->size = buffer_size;
@@ -259,7 +427,7 @@ namespace acl
 			compression_time.stop();
 
 			if (out_stats.logging != stat_logging::none)
-				write_compression_stats(context, *out_compressed_tracks, compression_time, out_stats);
+				write_compression_stats(context, *out_compressed_tracks, num_segments, compression_time, out_stats);
 #endif
 
 			return error_result();
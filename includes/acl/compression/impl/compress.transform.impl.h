@@ -281,7 +281,13 @@ namespace acl
 			// For example, if we have 3 tracks made up of rotation/translation we'll have one entry for each with unused padding
 			// All rotation types come first, followed by all translation types, and with scale types at the end when present
 			const uint32_t num_sub_track_entries = ((num_output_bones + k_num_sub_tracks_per_packed_entry - 1) / k_num_sub_tracks_per_packed_entry) * num_sub_tracks_per_bone;
-			const uint32_t packed_sub_track_buffer_size = num_sub_track_entries * sizeof(packed_sub_track_types);
+			const uint32_t packed_sub_track_types_size = num_sub_track_entries * sizeof(packed_sub_track_types);
+
+			// When present, the prefix index has one entry for every packed sub-track types entry and it follows them
+			// The bit size prefixes of every segment follow it
+			const uint32_t segment_bit_size_prefixes_size = get_num_segment_bit_size_prefixes(num_animated_variable_sub_tracks_padded) * lossy_clip_context.num_segments * uint32_t(sizeof(uint32_t));
+			const uint32_t packed_sub_track_prefix_index_size = settings.include_sub_track_prefix_index ? (num_sub_track_entries * sizeof(packed_sub_track_prefix_counts) + segment_bit_size_prefixes_size) : 0;
+			const uint32_t packed_sub_track_buffer_size = packed_sub_track_types_size + packed_sub_track_prefix_index_size;
 
 			// Adding an extra index at the end to delimit things, the index is always invalid: 0xFFFFFFFF
 			const uint32_t segment_start_indices_size = lossy_clip_context.num_segments > 1 ? (uint32_t(sizeof(uint32_t)) * (lossy_clip_context.num_segments + 1)) : 0;
@@ -304,7 +310,7 @@ namespace acl
 
 			const uint32_t clip_segment_header_size = buffer_size - clip_header_size;
 
-			buffer_size += packed_sub_track_buffer_size;						// Packed sub-track types sorted by type
+			buffer_size += packed_sub_track_buffer_size;						// Packed sub-track types sorted by type and optional prefix index
 			buffer_size = align_to(buffer_size, 4);								// Align constant track data
 			buffer_size += constant_data_size;									// Constant track data
 			buffer_size = align_to(buffer_size, 4);								// Align range data
@@ -406,6 +412,7 @@ namespace acl
 			header->set_has_database(false);
 			header->set_has_trivial_default_values(has_trivial_defaults);
 			header->set_has_stripped_keyframes(lossy_clip_context.has_stripped_keyframes);
+			header->set_has_sub_track_prefix_index(settings.include_sub_track_prefix_index);
 			header->set_is_wrap_optimized(lossy_clip_context.looping_policy == sample_looping_policy::wrap);
 			header->set_has_metadata(metadata_size != 0);
 
@@ -436,6 +443,12 @@ namespace acl
 			uint32_t written_sub_track_buffer_size = 0;
 			written_sub_track_buffer_size += write_packed_sub_track_types(lossy_clip_context, transforms_header->get_sub_track_types(), output_bone_mapping, num_output_bones);
 
+			if (settings.include_sub_track_prefix_index)
+			{
+				const uint32_t num_entries_per_sub_track_type = num_sub_track_entries / num_sub_tracks_per_bone;
+				written_sub_track_buffer_size += write_packed_sub_track_prefix_counts(transforms_header->get_sub_track_types(), num_entries_per_sub_track_type, num_sub_tracks_per_bone, transforms_header->get_sub_track_prefix_counts(num_sub_track_entries));
+			}
+
 			uint32_t written_constant_data_size = 0;
 			if (constant_data_size != 0)
 				written_constant_data_size = write_constant_track_data(lossy_clip_context, settings.rotation_format, transforms_header->get_constant_track_data(), constant_data_size, output_bone_mapping, num_output_bones);
@@ -446,6 +459,10 @@ namespace acl
 
 			const uint32_t written_segment_data_size = write_segment_data(lossy_clip_context, settings, range_reduction, transforms_header->get_segment_headers(), *transforms_header, output_bone_mapping, num_output_bones);
 
+			// The segment bit size prefixes are built from the format per track data we just wrote
+			if (settings.include_sub_track_prefix_index)
+				written_sub_track_buffer_size += write_segment_bit_size_prefixes(lossy_clip_context, *transforms_header, transforms_header->get_segment_bit_size_prefixes(num_sub_track_entries));
+
 			// Optional metadata header is last
 			uint32_t writter_metadata_track_list_name_size = 0;
 			uint32_t written_metadata_track_names_size = 0;
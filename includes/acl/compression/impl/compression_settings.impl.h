@@ -37,17 +37,46 @@ namespace acl
 {
 	ACL_IMPL_VERSION_NAMESPACE_BEGIN
 
+	inline float compression_database_settings::get_tier_proportion(quality_tier tier) const
+	{
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The highest importance tier contains the remaining frames");
+
+		if (tier == quality_tier::medium_importance)
+			return medium_importance_tier_proportion;
+		else if (tier == quality_tier::lowest_importance)
+			return low_importance_tier_proportion;
+		else if (tier == quality_tier::highest_importance || uint32_t(tier) > k_num_database_tiers)
+			return 0.0F;
+		else
+			return intermediate_tier_proportions[uint32_t(tier) - 2];
+	}
+
 	inline uint32_t compression_database_settings::get_hash() const
 	{
 		uint32_t hash_value = 0;
 		hash_value = hash_combine(hash_value, hash32(max_chunk_size));
 		hash_value = hash_combine(hash_value, hash32(medium_importance_tier_proportion));
 		hash_value = hash_combine(hash_value, hash32(low_importance_tier_proportion));
+
+		for (uint32_t tier_index = 0; tier_index + 2 < k_num_database_tiers; ++tier_index)
+			hash_value = hash_combine(hash_value, hash32(intermediate_tier_proportions[tier_index]));
+
+		for (uint32_t edge_index = 0; edge_index < num_clip_co_usage_edges; ++edge_index)
+		{
+			const database_clip_co_usage& edge = clip_co_usage[edge_index];
+			hash_value = hash_combine(hash_value, hash32(edge.clip_index0));
+			hash_value = hash_combine(hash_value, hash32(edge.clip_index1));
+			hash_value = hash_combine(hash_value, hash32(edge.weight));
+		}
+
 		return hash_value;
 	}
 
 	inline error_result compression_database_settings::is_valid() const
 	{
+		if (num_clip_co_usage_edges != 0 && clip_co_usage == nullptr)
+			return error_result("clip_co_usage must be provided when num_clip_co_usage_edges is non-zero");
+
 		if (max_chunk_size < 4 * 1024)
 			return error_result("max_chunk_size must be greater or equal to 4 KB");
 
@@ -60,11 +89,20 @@ namespace acl
 		if (!rtm::scalar_is_finite(low_importance_tier_proportion) || low_importance_tier_proportion < 0.0F || low_importance_tier_proportion > 1.0F)
 			return error_result("low_importance_tier_proportion must be in the range [0.0, 1.0]");
 
+		float database_proportion = low_importance_tier_proportion + medium_importance_tier_proportion;
+		for (uint32_t tier_index = 0; tier_index + 2 < k_num_database_tiers; ++tier_index)
+		{
+			const float proportion = intermediate_tier_proportions[tier_index];
+			if (!rtm::scalar_is_finite(proportion) || proportion < 0.0F || proportion > 1.0F)
+				return error_result("intermediate_tier_proportions must be in the range [0.0, 1.0]");
+
+			database_proportion += proportion;
+		}
+
 		// Add an epsilon to account for arithmetic imprecision
-		const float database_proportion = low_importance_tier_proportion + medium_importance_tier_proportion;
 		const float epsilon = 1.0e-5F;
 		if (database_proportion < epsilon || database_proportion > (1.0F + epsilon))
-			return error_result("The sum of medium_importance_tier_proportion + low_importance_tier_proportion must be in the range [0.0, 1.0]");
+			return error_result("The sum of the database tier proportions must be in the range [0.0, 1.0]");
 
 		return error_result();
 	}
@@ -125,6 +163,8 @@ namespace acl
 
 		hash_value = hash_combine(hash_value, enable_database_support);
 		hash_value = hash_combine(hash_value, optimize_loops);
+		hash_value = hash_combine(hash_value, include_sub_track_prefix_index);
+		hash_value = hash_combine(hash_value, hash32(scalar_segment_num_samples));
 		hash_value = hash_combine(hash_value, keyframe_stripping.get_hash());
 		hash_value = hash_combine(hash_value, metadata.get_hash());
 
@@ -147,6 +187,9 @@ namespace acl
 		if (keyframe_stripping.is_enabled() && enable_database_support)
 			return error_result("Cannot enable keyframe stripping with database support");
 
+		if (scalar_segment_num_samples != 0 && scalar_segment_num_samples < 8)
+			return error_result("scalar_segment_num_samples must be 0 or greater or equal to 8");
+
 		return error_result();
 	}
 
@@ -164,6 +207,7 @@ namespace acl
 		settings.scale_format = vector_format8::vector3f_variable;
 		settings.optimize_loops = true;
 		settings.keyframe_stripping.strip_trivial = true;
+		settings.scalar_segment_num_samples = 64;
 		return settings;
 	}
 
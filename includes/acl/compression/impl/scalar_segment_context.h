@@ -0,0 +1,376 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/bitset.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/interpolation_utils.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+#include "acl/compression/track.h"
+#include "acl/compression/track_array.h"
+#include "acl/compression/impl/track_list_context.h"
+#include "acl/compression/impl/normalize_track_impl.h"
+#include "acl/compression/impl/quantize_track_impl.h"
+#include "acl/compression/impl/track_range_impl.h"
+
+#include <rtm/mask4f.h>
+#include <rtm/vector4f.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// A segment of a scalar track list.
+		// Each segment holds a slice of the samples of every track along with
+		// its own ranges and bit rates. Constant tracks are shared by the whole
+		// track list and remain constant within every segment.
+		//////////////////////////////////////////////////////////////////////////
+		struct scalar_segment_context
+		{
+			// The raw samples of this segment, used to measure our error
+			track_array reference_list;
+
+			// Our normalized and quantized samples along with their ranges and bit rates
+			track_list_context context;
+
+			uint32_t start_sample_index = 0;
+
+			// Our packed sizes, populated when the compressed tracks are written
+			uint32_t per_track_metadata_size = 0;
+			uint32_t range_values_size = 0;
+			uint32_t animated_values_size = 0;
+			uint32_t num_bits_per_frame = 0;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns how many segments a track list with the specified number of samples is split into.
+		// Every segment has the same number of samples except the last one which also
+		// holds the remaining samples. Returns 0 if the track list should not be segmented.
+		inline uint32_t get_num_scalar_segments(uint32_t num_samples, uint32_t num_samples_per_segment)
+		{
+			if (num_samples_per_segment == 0)
+				return 0;	// Segmenting is disabled
+
+			const uint32_t num_segments = num_samples / num_samples_per_segment;
+			return num_segments > 1 ? num_segments : 0;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// When the contributing error is included, the keyframes of every segment can later
+		// be moved into a database which cannot hold more than 32 samples per segment.
+		// Since the last segment also holds the remaining samples, we cannot use more than 16.
+		constexpr uint32_t k_max_num_samples_per_scalar_database_segment = 16;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns how many segments a track list is split into when its keyframes can later be
+		// moved into a database. Segments are always used unless the track list is empty.
+		inline uint32_t get_num_scalar_database_segments(uint32_t num_samples, uint32_t num_samples_per_segment)
+		{
+			if (num_samples == 0)
+				return 0;	// Empty track list
+
+			return std::max<uint32_t>(num_samples / num_samples_per_segment, 1);
+		}
+
+		template<track_type8 track_type>
+		inline track_typed<track_type> make_scalar_segment_track(iallocator& allocator, const track& ref_track, uint32_t start_sample_index, uint32_t num_samples)
+		{
+			const track_typed<track_type>& typed_ref_track = track_cast<const track_typed<track_type>>(ref_track);
+			return track_typed<track_type>::make_copy(typed_ref_track.get_description(), allocator, &typed_ref_track[start_sample_index], num_samples, typed_ref_track.get_sample_rate(), typed_ref_track.get_stride());
+		}
+
+		inline track_array make_scalar_segment_track_list(iallocator& allocator, const track_array& ref_track_list, uint32_t start_sample_index, uint32_t num_samples)
+		{
+			const uint32_t num_tracks = ref_track_list.get_num_tracks();
+
+			track_array out_track_list(allocator, num_tracks);
+
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			{
+				const track& ref_track = ref_track_list[track_index];
+				track& out_track = out_track_list[track_index];
+
+				switch (ref_track.get_type())
+				{
+				case track_type8::float1f:
+					out_track = make_scalar_segment_track<track_type8::float1f>(allocator, ref_track, start_sample_index, num_samples);
+					break;
+				case track_type8::float2f:
+					out_track = make_scalar_segment_track<track_type8::float2f>(allocator, ref_track, start_sample_index, num_samples);
+					break;
+				case track_type8::float3f:
+					out_track = make_scalar_segment_track<track_type8::float3f>(allocator, ref_track, start_sample_index, num_samples);
+					break;
+				case track_type8::float4f:
+					out_track = make_scalar_segment_track<track_type8::float4f>(allocator, ref_track, start_sample_index, num_samples);
+					break;
+				case track_type8::vector4f:
+					out_track = make_scalar_segment_track<track_type8::vector4f>(allocator, ref_track, start_sample_index, num_samples);
+					break;
+				default:
+					ACL_ASSERT(false, "Unexpected track type");
+					break;
+				}
+			}
+
+			return out_track_list;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Splits the samples of a track list into segments, then normalizes and quantizes
+		// every segment with its own ranges.
+		// The track list context must have its ranges and constant tracks extracted but it
+		// must not be normalized yet.
+		inline void initialize_scalar_segments(const track_list_context& context, uint32_t num_samples_per_segment, scalar_segment_context* segments, uint32_t num_segments)
+		{
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+			ACL_ASSERT(context.constant_tracks_bitset != nullptr, "Constant tracks must be extracted first");
+			ACL_ASSERT(num_segments != 0 && (num_segments - 1) * num_samples_per_segment < context.num_samples, "Invalid number of segments");
+
+			iallocator& allocator = *context.allocator;
+			const bitset_description bitset_desc = bitset_description::make_from_num_bits(context.num_tracks);
+
+			for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+			{
+				scalar_segment_context& segment = segments[segment_index];
+
+				const uint32_t start_sample_index = segment_index * num_samples_per_segment;
+				const bool is_last_segment = segment_index == (num_segments - 1);
+				const uint32_t num_samples = is_last_segment ? (context.num_samples - start_sample_index) : num_samples_per_segment;
+
+				segment.start_sample_index = start_sample_index;
+				segment.reference_list = make_scalar_segment_track_list(allocator, *context.reference_list, start_sample_index, num_samples);
+
+				track_list_context& segment_context = segment.context;
+				segment_context.allocator = &allocator;
+				segment_context.reference_list = &segment.reference_list;
+				segment_context.track_list = make_scalar_segment_track_list(allocator, context.track_list, start_sample_index, num_samples);
+				segment_context.num_tracks = context.num_tracks;
+				segment_context.num_output_tracks = context.num_output_tracks;
+				segment_context.num_samples = num_samples;
+				segment_context.sample_rate = context.sample_rate;
+				segment_context.duration = context.sample_rate > 0.0F ? float(num_samples - 1) / context.sample_rate : 0.0F;
+				segment_context.looping_policy = context.looping_policy;
+
+				segment_context.track_output_indices = allocate_type_array<uint32_t>(allocator, context.num_output_tracks);
+				std::memcpy(segment_context.track_output_indices, context.track_output_indices, sizeof(uint32_t) * context.num_output_tracks);
+
+				// Constant tracks are shared by every segment
+				segment_context.constant_tracks_bitset = allocate_type_array<uint32_t>(allocator, bitset_desc.get_size());
+				std::memcpy(segment_context.constant_tracks_bitset, context.constant_tracks_bitset, sizeof(uint32_t) * bitset_desc.get_size());
+
+				// Extract the ranges of our segment, normalize, and find how many bits we need per track
+				extract_track_ranges(segment_context);
+				normalize_tracks(segment_context);
+				quantize_tracks(segment_context);
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the bit set of the samples stored within a segment, the MSB is the first sample.
+		// Segments with more than 32 samples cannot have their keyframes stripped and return 0.
+		inline uint32_t get_scalar_segment_sample_indices(uint32_t num_segment_samples)
+		{
+			if (num_segment_samples == 0 || num_segment_samples > 32)
+				return 0;
+
+			return 0xFFFFFFFFU << (32 - num_segment_samples);
+		}
+
+		// Returns the lossy value of a sample as it will be seen at runtime
+		inline rtm::vector4f RTM_SIMD_CALL get_lossy_scalar_sample(const track_list_context& segment_context, uint32_t track_index, uint32_t sample_index)
+		{
+			const track_vector4f& mut_track = track_cast<track_vector4f>(segment_context.track_list[track_index]);
+			const rtm::vector4f sample = mut_track[sample_index];
+
+			const uint8_t bit_rate = segment_context.bit_rate_list[track_index].scalar.value;
+			if (is_raw_bit_rate(bit_rate))
+				return sample;	// Raw samples are retained as-is
+
+			const quantization_scales scales(get_num_bits_at_bit_rate(bit_rate));
+			const scalarf_range& range = segment_context.range_list[track_index].range.scalarf;
+			return rtm::vector_mul_add(rtm::vector_mul(sample, scales.inv_max_value), range.get_extent(), range.get_min());
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Finds the error contributed by every keyframe of a segment when it is removed and
+		// the samples are reconstructed by interpolating the retained neighbors.
+		// Keyframes are greedily removed, lowest error first, and the output is sorted in the
+		// order in which they should be stripped. Keyframe indices are relative to the segment.
+		// The first and last keyframes of a segment cannot be removed, see find_contributing_error(..)
+		inline void find_scalar_segment_contributing_error(const scalar_segment_context& segment, uint32_t segment_index, keyframe_stripping_metadata_t* out_contributing_error)
+		{
+			using namespace rtm;
+
+			const track_list_context& segment_context = segment.context;
+			const uint32_t num_frames = segment_context.num_samples;
+			ACL_ASSERT(num_frames != 0 && num_frames <= 32, "Expected no more than 32 samples per segment");
+
+			const bitset_description desc = bitset_description::make_from_num_bits<32>();
+			constexpr float infinity = std::numeric_limits<float>::infinity();
+
+			uint32_t frames_retained = ~0U;	// By default, every frame is present
+
+			out_contributing_error[0] = keyframe_stripping_metadata_t(0, segment_index, ~0U, infinity, false);
+			out_contributing_error[num_frames - 1] = keyframe_stripping_metadata_t(num_frames - 1, segment_index, ~0U, infinity, false);
+
+			const vector4f zero = vector_zero();
+			const mask4f all_true_mask = mask_set(true, true, true, true);
+
+			// We iterate until every frame but the first and last have been removed
+			for (uint32_t iteration_count = 1; iteration_count < num_frames - 1; ++iteration_count)
+			{
+				keyframe_stripping_metadata_t best_error(~0U, segment_index, ~0U, infinity, false);
+
+				for (uint32_t frame_index = 1; frame_index < num_frames - 1; ++frame_index)
+				{
+					if (!bitset_test(&frames_retained, desc, frame_index))
+						continue;	// This frame has already been removed, skip it
+
+					// Find the retained frames we'll interpolate between
+					uint32_t interp_start_frame_index = frame_index - 1;
+					while (!bitset_test(&frames_retained, desc, interp_start_frame_index))
+						interp_start_frame_index--;
+
+					uint32_t interp_end_frame_index = frame_index + 1;
+					while (!bitset_test(&frames_retained, desc, interp_end_frame_index))
+						interp_end_frame_index++;
+
+					// We'll retain the worst error of every removed frame in between as the current frame's contributing error
+					float max_contributing_error = 0.0F;
+					bool is_keyframe_trivial = true;
+
+					for (uint32_t output_index = 0; output_index < segment_context.num_output_tracks; ++output_index)
+					{
+						const uint32_t track_index = segment_context.track_output_indices[output_index];
+						if (segment_context.is_constant(track_index))
+							continue;	// Constant tracks do not change when keyframes are removed
+
+						const track& ref_track = segment.reference_list[track_index];
+						const uint32_t ref_element_size = ref_track.get_sample_size();
+						const vector4f precision = vector_load1(&track_cast<track_vector4f>(segment_context.track_list[track_index]).get_description().precision);
+
+						mask4f sample_mask = mask_set(false, false, false, false);
+						std::memcpy(&sample_mask, &all_true_mask, ref_element_size);
+
+						const vector4f lossy_start = get_lossy_scalar_sample(segment_context, track_index, interp_start_frame_index);
+						const vector4f lossy_end = get_lossy_scalar_sample(segment_context, track_index, interp_end_frame_index);
+
+						for (uint32_t interp_frame_index = interp_start_frame_index + 1; interp_frame_index < interp_end_frame_index; ++interp_frame_index)
+						{
+							const float interpolation_alpha = find_linear_interpolation_alpha(float(interp_frame_index), interp_start_frame_index, interp_end_frame_index, sample_rounding_policy::none, sample_looping_policy::clamp);
+
+							vector4f raw_sample = zero;
+							std::memcpy(&raw_sample, ref_track[interp_frame_index], ref_element_size);
+
+							const vector4f lossy_sample = vector_lerp(lossy_start, lossy_end, interpolation_alpha);
+							const vector4f delta = vector_select(sample_mask, vector_abs(vector_sub(raw_sample, lossy_sample)), zero);
+
+							const float error = vector_get_max_component(delta);
+							max_contributing_error = std::max(max_contributing_error, error);
+							is_keyframe_trivial &= vector_all_less_equal(delta, precision);
+						}
+					}
+
+					// If our current frame's contributing error is lowest, it is the best candidate for removal
+					if (max_contributing_error < best_error.stripping_error)
+						best_error = keyframe_stripping_metadata_t(frame_index, segment_index, iteration_count - 1, max_contributing_error, is_keyframe_trivial);
+				}
+
+				ACL_ASSERT(best_error.keyframe_index != ~0U, "Failed to find the best contributing error");
+
+				// We found the best frame to remove, remove it
+				out_contributing_error[best_error.keyframe_index] = best_error;
+				bitset_set(&frames_retained, desc, best_error.keyframe_index, false);
+			}
+
+			// Sort them by the order they should be stripped from this segment
+			auto sort_predicate = [](const keyframe_stripping_metadata_t& lhs, const keyframe_stripping_metadata_t& rhs) { return lhs.stripping_index < rhs.stripping_index; };
+			std::sort(out_contributing_error, out_contributing_error + num_frames, sort_predicate);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Finds the contributing error of every keyframe of a track list split into segments.
+		// The output contains one entry per sample, sorted in the order in which keyframes should
+		// be stripped from the whole track list, see sort_contributing_error(..)
+		inline void find_scalar_contributing_error(iallocator& allocator, const scalar_segment_context* segments, uint32_t num_segments, uint32_t num_samples, keyframe_stripping_metadata_t* out_contributing_error)
+		{
+			constexpr float infinity = std::numeric_limits<float>::infinity();
+
+			// Every segment has no more than 32 samples
+			keyframe_stripping_metadata_t* contributing_error_per_segment = allocate_type_array<keyframe_stripping_metadata_t>(allocator, size_t(num_segments) * 32);
+			uint32_t* num_stripped_in_segment = allocate_type_array<uint32_t>(allocator, num_segments);
+			std::fill(num_stripped_in_segment, num_stripped_in_segment + num_segments, 0);
+
+			for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				find_scalar_segment_contributing_error(segments[segment_index], segment_index, contributing_error_per_segment + (segment_index * 32));
+
+			// The stripping order is relative to each segment, we need it to be relative to the whole track list
+			for (uint32_t stripping_index = 0; stripping_index < num_samples; ++stripping_index)
+			{
+				keyframe_stripping_metadata_t best_error(~0U, 0, ~0U, infinity, false);
+
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				{
+					const uint32_t segment_strip_index = num_stripped_in_segment[segment_index];
+					if (segment_strip_index >= segments[segment_index].context.num_samples)
+						continue;	// We've stripped every keyframe from this segment
+
+					const keyframe_stripping_metadata_t& segment_error = contributing_error_per_segment[(segment_index * 32) + segment_strip_index];
+					if (segment_error.stripping_error <= best_error.stripping_error)
+						best_error = segment_error;
+				}
+
+				ACL_ASSERT(best_error.keyframe_index != ~0U, "Expected to find a valid keyframe to strip");
+
+				// Update our stripping and keyframe indices to make it relative to the track list
+				best_error.stripping_index = stripping_index;
+				best_error.keyframe_index += segments[best_error.segment_index].start_sample_index;
+
+				num_stripped_in_segment[best_error.segment_index]++;
+				out_contributing_error[stripping_index] = best_error;
+			}
+
+			deallocate_type_array(allocator, num_stripped_in_segment, num_segments);
+			deallocate_type_array(allocator, contributing_error_per_segment, size_t(num_segments) * 32);
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
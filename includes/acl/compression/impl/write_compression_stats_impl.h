@@ -45,7 +45,7 @@ namespace acl
 
 	namespace acl_impl
 	{
-		inline void write_compression_stats(const track_list_context& context, const compressed_tracks& tracks, const scope_profiler& compression_time, output_stats& stats)
+		inline void write_compression_stats(const track_list_context& context, const compressed_tracks& tracks, uint32_t num_segments, const scope_profiler& compression_time, output_stats& stats)
 		{
 			ACL_ASSERT(stats.writer != nullptr, "Attempted to log stats without a writer");
 			if (stats.writer == nullptr)
@@ -66,6 +66,7 @@ namespace acl
 			writer["duration"] = context.duration;
 			writer["num_samples"] = context.num_samples;
 			writer["num_tracks"] = context.num_tracks;
+			writer["num_segments"] = num_segments;
 			writer["looping"] = tracks.get_looping_policy() == sample_looping_policy::wrap;
 		}
 	}
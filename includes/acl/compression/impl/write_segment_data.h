@@ -176,6 +176,45 @@ namespace acl
 
 			return size_written;
 		}
+
+		inline uint32_t write_segment_bit_size_prefixes(const clip_context& clip, const transform_tracks_header& header, uint32_t* out_bit_size_prefixes)
+		{
+			ACL_ASSERT(out_bit_size_prefixes != nullptr, "'out_bit_size_prefixes' cannot be null!");
+
+			const uint32_t num_prefixes_per_segment = get_num_segment_bit_size_prefixes(header.num_animated_variable_sub_tracks);
+			const bool has_stripped_keyframes = clip.has_stripped_keyframes;
+
+			uint32_t size_written = 0;
+
+			const uint32_t num_segments = clip.num_segments;
+			for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+			{
+				const uint8_t* format_per_track_data;
+				const uint8_t* range_data;
+				const uint8_t* animated_data;
+
+				if (has_stripped_keyframes)
+					header.get_segment_data(header.get_stripped_segment_headers()[segment_index], format_per_track_data, range_data, animated_data);
+				else
+					header.get_segment_data(header.get_segment_headers()[segment_index], format_per_track_data, range_data, animated_data);
+
+				uint32_t bit_size_per_component = 0;
+				for (uint32_t prefix_index = 0; prefix_index < num_prefixes_per_segment; ++prefix_index)
+				{
+					for (uint32_t sub_track_index = 0; sub_track_index < k_num_sub_tracks_per_bit_size_prefix; ++sub_track_index)
+					{
+						// The raw bit rate uses 32 bits but it is stored as 31, see write_format_per_track_data(..)
+						const uint32_t num_bits = *format_per_track_data++;
+						bit_size_per_component += num_bits == 31 ? 32 : num_bits;
+					}
+
+					*out_bit_size_prefixes++ = bit_size_per_component;
+					size_written += sizeof(uint32_t);
+				}
+			}
+
+			return size_written;
+		}
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/bit_manip_utils.h"
 #include "acl/core/error.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/impl/compressed_headers.h"
@@ -161,6 +162,34 @@ namespace acl
 
 			return packed_entry_index * sizeof(packed_sub_track_types);
 		}
+
+		inline uint32_t write_packed_sub_track_prefix_counts(const packed_sub_track_types* packed_types, uint32_t num_entries_per_sub_track_type, uint32_t num_sub_tracks_per_bone, packed_sub_track_prefix_counts* out_prefix_counts)
+		{
+			ACL_ASSERT(packed_types != nullptr, "'packed_types' cannot be null!");
+			ACL_ASSERT(out_prefix_counts != nullptr, "'out_prefix_counts' cannot be null!");
+
+			uint32_t packed_entry_index = 0;
+
+			// Each sub-track type is counted independently, padding sub-tracks are default and do not contribute
+			for (uint32_t sub_track_type_index = 0; sub_track_type_index < num_sub_tracks_per_bone; ++sub_track_type_index)
+			{
+				uint32_t num_constant = 0;
+				uint32_t num_animated = 0;
+
+				for (uint32_t entry_index = 0; entry_index < num_entries_per_sub_track_type; ++entry_index)
+				{
+					out_prefix_counts[packed_entry_index] = packed_sub_track_prefix_counts{ num_constant, num_animated };
+
+					const uint32_t packed_entry = packed_types[packed_entry_index].types;
+					num_constant += count_set_bits(packed_entry & 0x55555555);
+					num_animated += count_set_bits(packed_entry & 0xAAAAAAAA);
+
+					packed_entry_index++;
+				}
+			}
+
+			return packed_entry_index * sizeof(packed_sub_track_prefix_counts);
+		}
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
@@ -192,18 +192,18 @@ namespace acl
 			return safe_static_cast<uint32_t>(output_buffer - output_buffer_start);
 		}
 
-		inline uint32_t write_contributing_error(const clip_context& clip, uint8_t* out_contributing_error)
+		inline uint32_t write_contributing_error(const keyframe_stripping_metadata_t* keyframe_metadata, uint32_t num_samples, uint8_t* out_contributing_error)
 		{
-			ACL_ASSERT(out_contributing_error == nullptr || clip.num_samples == 0 || out_contributing_error[0] == 0, "Buffer overrun detected");
+			ACL_ASSERT(out_contributing_error == nullptr || num_samples == 0 || out_contributing_error[0] == 0, "Buffer overrun detected");
 
 			const uint8_t* output_buffer = out_contributing_error;
 			const uint8_t* output_buffer_start = output_buffer;
 			keyframe_stripping_metadata_t* contributing_error = reinterpret_cast<keyframe_stripping_metadata_t*>(out_contributing_error);
 
-			for (uint32_t frame_index = 0; frame_index < clip.num_samples; ++frame_index)
+			for (uint32_t frame_index = 0; frame_index < num_samples; ++frame_index)
 			{
 				if (out_contributing_error != nullptr)
-					*contributing_error = clip.contributing_error[frame_index];
+					*contributing_error = keyframe_metadata[frame_index];
 
 				contributing_error++;
 				output_buffer += sizeof(keyframe_stripping_metadata_t);
@@ -211,6 +211,11 @@ namespace acl
 
 			return safe_static_cast<uint32_t>(output_buffer - output_buffer_start);
 		}
+
+		inline uint32_t write_contributing_error(const clip_context& clip, uint8_t* out_contributing_error)
+		{
+			return write_contributing_error(clip.contributing_error, clip.num_samples, out_contributing_error);
+		}
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
@@ -51,6 +51,10 @@ namespace acl
 		//////////////////////////////////////////////////////////////////////////
 		// Identifies a 'compressed_database' buffer.
 		compressed_database = 0xac11db01,
+
+		//////////////////////////////////////////////////////////////////////////
+		// Identifies a compressed database bulk data buffer.
+		compressed_bulk_data = 0xac11db02,
 	};
 
 	ACL_IMPL_VERSION_NAMESPACE_END
@@ -0,0 +1,328 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/buffer_tag.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <cstdint>
+#include <cstring>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		// Compressed bulk data layout, as output by compress_database_bulk_data(..):
+		//    [compressed_bulk_data_header]
+		//    [compressed_bulk_data_chunk] * num_chunks
+		//    [compressed chunk data] * num_chunks
+		//
+		// Each chunk is compressed on its own and can be decompressed in isolation
+		// which lets streamers read and decompress only the chunks they need.
+		////////////////////////////////////////////////////////////////////////////////
+		struct compressed_bulk_data_header
+		{
+			// Always buffer_tag32::compressed_bulk_data
+			buffer_tag32							tag;
+
+			// Number of chunks that follow the header
+			uint32_t								num_chunks;
+
+			// Size in bytes of the bulk data once decompressed
+			uint32_t								bulk_data_size;
+
+			// Size in bytes of the compressed bulk data, including this header
+			uint32_t								compressed_bulk_data_size;
+		};
+
+		struct compressed_bulk_data_chunk
+		{
+			// Offset and size in bytes of the chunk within the decompressed bulk data
+			uint32_t								bulk_data_offset;
+			uint32_t								size;
+
+			// Offset and size in bytes of the chunk within the compressed bulk data
+			// When both sizes are equal, the chunk is stored uncompressed
+			uint32_t								compressed_offset;
+			uint32_t								compressed_size;
+
+			bool is_compressed() const { return compressed_size != size; }
+		};
+
+		static_assert(sizeof(compressed_bulk_data_header) == 16, "Unexpected size");
+		static_assert(sizeof(compressed_bulk_data_chunk) == 16, "Unexpected size");
+
+		inline const compressed_bulk_data_chunk* get_compressed_bulk_data_chunks(const compressed_bulk_data_header& header)
+		{
+			return reinterpret_cast<const compressed_bulk_data_chunk*>(&header + 1);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		// A small LZ77 byte oriented codec, similar to LZ4 blocks.
+		//
+		// The input is split into sequences of literals followed by a match:
+		//    [token] [extra literal count bytes] [literals] [match offset (16 bits)] [extra match length bytes]
+		// The token holds the literal count in its high nibble and the match length (minus
+		// k_lz_min_match_length) in its low nibble. A nibble equal to 15 is followed by extra bytes
+		// that are added to it until a byte isn't 255. The last sequence only contains literals.
+		//
+		// Decompression is a simple loop of copies that runs at memory speed and validates
+		// every offset and length to safely reject corrupted data.
+		////////////////////////////////////////////////////////////////////////////////
+		constexpr uint32_t k_lz_min_match_length = 4;
+		constexpr uint32_t k_lz_max_match_offset = 0xFFFF;
+		constexpr uint32_t k_lz_hash_num_bits = 12;
+
+		inline uint32_t lz_hash(uint32_t value)
+		{
+			return (value * 2654435761U) >> (32 - k_lz_hash_num_bits);
+		}
+
+		inline void lz_write_length(uint8_t*& output, uint32_t length)
+		{
+			// The first 15 are stored in the token
+			length -= 15;
+			while (length >= 255)
+			{
+				*output++ = 255;
+				length -= 255;
+			}
+
+			*output++ = uint8_t(length);
+		}
+
+		inline bool lz_read_length(const uint8_t*& input, const uint8_t* input_end, uint32_t& length)
+		{
+			uint32_t value;
+			do
+			{
+				if (input == input_end)
+					return false;	// Truncated
+
+				value = *input++;
+				length += value;
+			} while (value == 255);
+
+			return true;
+		}
+
+		// Writes a sequence, a match length of 0 marks the last one
+		inline bool lz_write_sequence(uint8_t*& output, const uint8_t* output_end, const uint8_t* literals, uint32_t num_literals, uint32_t match_offset, uint32_t match_length)
+		{
+			// Worst case size of the sequence
+			const uint64_t max_sequence_size = 1 + (num_literals / 255) + 1 + uint64_t(num_literals) + 2 + (match_length / 255) + 1;
+			if (max_sequence_size > uint64_t(output_end - output))
+				return false;
+
+			const uint32_t encoded_match_length = match_length != 0 ? (match_length - k_lz_min_match_length) : 0;
+
+			uint8_t* token = output++;
+			*token = uint8_t(((num_literals >= 15 ? 15 : num_literals) << 4) | (encoded_match_length >= 15 ? 15 : encoded_match_length));
+
+			if (num_literals >= 15)
+				lz_write_length(output, num_literals);
+
+			std::memcpy(output, literals, num_literals);
+			output += num_literals;
+
+			if (match_length == 0)
+				return true;	// Last sequence
+
+			output[0] = uint8_t(match_offset & 0xFF);
+			output[1] = uint8_t(match_offset >> 8);
+			output += 2;
+
+			if (encoded_match_length >= 15)
+				lz_write_length(output, encoded_match_length);
+
+			return true;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Compresses the input buffer into the output buffer.
+		// Returns the compressed size in bytes or 0 if it doesn't fit in the output buffer.
+		inline uint32_t lz_compress(const uint8_t* input, uint32_t input_size, uint8_t* output, uint32_t output_size)
+		{
+			// Last position seen for every hashed 4 byte sequence
+			uint32_t positions[1 << k_lz_hash_num_bits];
+			std::memset(&positions[0], 0, sizeof(positions));
+
+			uint8_t* output_start = output;
+			const uint8_t* output_end = output + output_size;
+
+			uint32_t literals_offset = 0;
+			uint32_t offset = 0;
+			while (offset + k_lz_min_match_length <= input_size)
+			{
+				const uint32_t sequence = unaligned_load<uint32_t>(input + offset);
+				const uint32_t hash = lz_hash(sequence);
+				const uint32_t candidate_offset = positions[hash];
+				positions[hash] = offset;
+
+				if (candidate_offset >= offset || (offset - candidate_offset) > k_lz_max_match_offset || unaligned_load<uint32_t>(input + candidate_offset) != sequence)
+				{
+					offset++;
+					continue;
+				}
+
+				uint32_t match_length = k_lz_min_match_length;
+				while (offset + match_length < input_size && input[candidate_offset + match_length] == input[offset + match_length])
+					match_length++;
+
+				if (!lz_write_sequence(output, output_end, input + literals_offset, offset - literals_offset, offset - candidate_offset, match_length))
+					return 0;
+
+				offset += match_length;
+				literals_offset = offset;
+			}
+
+			if (!lz_write_sequence(output, output_end, input + literals_offset, input_size - literals_offset, 0, 0))
+				return 0;
+
+			return uint32_t(output - output_start);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Decompresses the input buffer into the output buffer.
+		// Returns true if the data is valid and decompresses into exactly 'output_size' bytes.
+		inline bool lz_decompress(const uint8_t* input, uint32_t input_size, uint8_t* output, uint32_t output_size)
+		{
+			const uint8_t* input_end = input + input_size;
+			uint8_t* output_start = output;
+			const uint8_t* output_end = output + output_size;
+
+			while (true)
+			{
+				if (input == input_end)
+					return false;	// Truncated, every stream ends with a sequence of literals
+
+				const uint32_t token = *input++;
+
+				uint32_t num_literals = token >> 4;
+				if (num_literals == 15 && !lz_read_length(input, input_end, num_literals))
+					return false;
+
+				if (num_literals > uint32_t(input_end - input) || num_literals > uint32_t(output_end - output))
+					return false;	// Corrupted
+
+				std::memcpy(output, input, num_literals);
+				input += num_literals;
+				output += num_literals;
+
+				if (input == input_end)
+					return output == output_end;	// Last sequence
+
+				if (input_end - input < 2)
+					return false;	// Truncated
+
+				const uint32_t match_offset = uint32_t(input[0]) | (uint32_t(input[1]) << 8);
+				input += 2;
+
+				uint32_t match_length = token & 0x0F;
+				if (match_length == 15 && !lz_read_length(input, input_end, match_length))
+					return false;
+
+				match_length += k_lz_min_match_length;
+
+				if (match_offset == 0 || match_offset > uint32_t(output - output_start) || match_length > uint32_t(output_end - output))
+					return false;	// Corrupted
+
+				// Matches can overlap with their output when they repeat a pattern
+				const uint8_t* match = output - match_offset;
+				for (uint32_t index = 0; index < match_length; ++index)
+					output[index] = match[index];
+
+				output += match_length;
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Decompresses a chunk into its location within the bulk data.
+		// The compressed data points to the start of the chunk data.
+		inline bool decompress_bulk_data_chunk(const compressed_bulk_data_chunk& chunk, const uint8_t* compressed_chunk_data, uint8_t* bulk_data)
+		{
+			if (!chunk.is_compressed())
+			{
+				std::memcpy(bulk_data + chunk.bulk_data_offset, compressed_chunk_data, chunk.size);
+				return true;
+			}
+
+			return lz_decompress(compressed_chunk_data, chunk.compressed_size, bulk_data + chunk.bulk_data_offset, chunk.size);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Decompresses every chunk of a bulk data buffer compressed with compress_database_bulk_data(..).
+	// The output matches the bulk data before it was compressed.
+	//
+	//    compressed_bulk_data:				The compressed bulk data.
+	//    compressed_bulk_data_size:		The size in bytes of the compressed bulk data.
+	//    out_bulk_data:					The output bulk data.
+	//    bulk_data_size:					The size in bytes of the output bulk data, see compressed_database::get_bulk_data_size(..).
+	//
+	// Returns true on success, false if the compressed bulk data is invalid or corrupted.
+	////////////////////////////////////////////////////////////////////////////////
+	inline bool decompress_database_bulk_data(const uint8_t* compressed_bulk_data, uint32_t compressed_bulk_data_size, uint8_t* out_bulk_data, uint32_t bulk_data_size)
+	{
+		using namespace acl_impl;
+
+		if (compressed_bulk_data == nullptr || compressed_bulk_data_size < sizeof(compressed_bulk_data_header))
+			return false;
+
+		const compressed_bulk_data_header& header = *reinterpret_cast<const compressed_bulk_data_header*>(compressed_bulk_data);
+		if (header.tag != buffer_tag32::compressed_bulk_data || header.bulk_data_size != bulk_data_size || header.compressed_bulk_data_size != compressed_bulk_data_size)
+			return false;
+
+		if (uint64_t(sizeof(compressed_bulk_data_header)) + uint64_t(header.num_chunks) * sizeof(compressed_bulk_data_chunk) > compressed_bulk_data_size)
+			return false;
+
+		// Bytes outside of the chunks are padding
+		std::memset(out_bulk_data, 0, bulk_data_size);
+
+		const compressed_bulk_data_chunk* chunks = get_compressed_bulk_data_chunks(header);
+		for (uint32_t chunk_index = 0; chunk_index < header.num_chunks; ++chunk_index)
+		{
+			const compressed_bulk_data_chunk& chunk = chunks[chunk_index];
+			if (uint64_t(chunk.bulk_data_offset) + chunk.size > bulk_data_size || uint64_t(chunk.compressed_offset) + chunk.compressed_size > compressed_bulk_data_size)
+				return false;
+
+			if (!decompress_bulk_data_chunk(chunk, compressed_bulk_data + chunk.compressed_offset, out_bulk_data))
+				return false;
+		}
+
+		return true;
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -63,7 +63,7 @@ namespace acl
 		uint32_t get_total_size() const;
 
 		//////////////////////////////////////////////////////////////////////////
-		// Returns the size in bytes of the bulk data for the specified tier (medium or low).
+		// Returns the size in bytes of the bulk data for the specified tier (any database tier).
 		uint32_t get_bulk_data_size(quality_tier tier) const;
 
 		//////////////////////////////////////////////////////////////////////////
@@ -76,7 +76,7 @@ namespace acl
 		uint32_t get_hash() const { return m_buffer_header.hash; }
 
 		//////////////////////////////////////////////////////////////////////////
-		// Returns the hash of the bulk data for the specified tier (medium or low).
+		// Returns the hash of the bulk data for the specified tier (any database tier).
 		// This is only used for sanity checking in case of memory corruption.
 		uint32_t get_bulk_data_hash(quality_tier tier) const;
 
@@ -90,7 +90,7 @@ namespace acl
 		compressed_tracks_version16 get_version() const;
 
 		//////////////////////////////////////////////////////////////////////////
-		// Returns the number of chunks contained in this database for the specified tier (medium or low).
+		// Returns the number of chunks contained in this database for the specified tier (any database tier).
 		uint32_t get_num_chunks(quality_tier tier) const;
 
 		//////////////////////////////////////////////////////////////////////////
@@ -110,7 +110,7 @@ namespace acl
 		bool is_bulk_data_inline() const;
 
 		//////////////////////////////////////////////////////////////////////////
-		// Returns a pointer to the bulk data for the specified tier (medium or low) when it is inline, nullptr otherwise.
+		// Returns a pointer to the bulk data for the specified tier (any database tier) when it is inline, nullptr otherwise.
 		const uint8_t* get_bulk_data(quality_tier tier) const;
 
 		//////////////////////////////////////////////////////////////////////////
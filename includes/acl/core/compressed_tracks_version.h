@@ -72,6 +72,7 @@ namespace acl
 		v02_01_99	= 8,			// ACL v2.1.0-wip
 		v02_01_99_1	= 9,			// ACL v2.1.0-wip (removed constant thresholds in track desc, increased bit rates, remapped raw num bits to 31 in compressed tracks)
 		v02_01_99_2 = 10,			// ACL v2.1.0-wip (converted error contribution metadata)
+		v02_01_99_3 = 11,			// ACL v2.1.0-wip (scalar track segments, sub-track prefix index and segment bit size prefixes, database clip chunk ranges, segment streaming metadata, tier count, and chunk hashes)
 
 		//////////////////////////////////////////////////////////////////////////
 		// First version marker, this is equal to the first version supported: ACL 2.0.0
@@ -81,7 +82,7 @@ namespace acl
 
 		//////////////////////////////////////////////////////////////////////////
 		// Always assigned to the latest version supported.
-		latest		= v02_01_99_2,
+		latest		= v02_01_99_3,
 	};
 
 	ACL_IMPL_VERSION_NAMESPACE_END
@@ -61,6 +61,7 @@ namespace acl
 	struct bitset_index_ref;
 
 	class compressed_database;
+	struct database_clip_co_usage;
 	class compressed_tracks;
 
 	class error_result;
@@ -135,6 +135,88 @@ namespace acl
 		return hash64(str, buffer_size);
 	}
 
+	namespace hash_impl
+	{
+		constexpr uint32_t k_fast_hash_prime1 = 0x9E3779B1U;
+		constexpr uint32_t k_fast_hash_prime2 = 0x85EBCA77U;
+		constexpr uint32_t k_fast_hash_prime3 = 0xC2B2AE3DU;
+		constexpr uint32_t k_fast_hash_prime4 = 0x27D4EB2FU;
+		constexpr uint32_t k_fast_hash_prime5 = 0x165667B1U;
+
+		inline uint32_t fast_hash_rotl(uint32_t value, uint32_t shift) { return (value << shift) | (value >> (32 - shift)); }
+
+		inline uint32_t fast_hash_load(const uint8_t* data)
+		{
+			uint32_t value;
+			std::memcpy(&value, data, sizeof(uint32_t));
+			return value;
+		}
+
+		inline uint32_t fast_hash_round(uint32_t acc, uint32_t value)
+		{
+			acc += value * k_fast_hash_prime2;
+			acc = fast_hash_rotl(acc, 13);
+			return acc * k_fast_hash_prime1;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Returns the 32 bit hash of the provided buffer and size in bytes.
+	// Unlike hash32(..), it consumes 16 bytes at a time with four independent lanes
+	// which makes it suitable to validate large buffers (e.g. database chunks).
+	// This is XXH32 with a seed of 0, values are loaded with the native endianness.
+	inline uint32_t fast_hash32(const void* buffer, size_t buffer_size)
+	{
+		using namespace hash_impl;
+
+		const uint8_t* data = static_cast<const uint8_t*>(buffer);
+		const uint8_t* data_end = data + buffer_size;
+
+		uint32_t hash;
+		if (buffer_size >= 16)
+		{
+			uint32_t acc0 = k_fast_hash_prime1 + k_fast_hash_prime2;
+			uint32_t acc1 = k_fast_hash_prime2;
+			uint32_t acc2 = 0;
+			uint32_t acc3 = 0U - k_fast_hash_prime1;
+
+			const uint8_t* blocks_end = data + (buffer_size & ~size_t(15));
+			for (; data < blocks_end; data += 16)
+			{
+				acc0 = fast_hash_round(acc0, fast_hash_load(data + 0));
+				acc1 = fast_hash_round(acc1, fast_hash_load(data + 4));
+				acc2 = fast_hash_round(acc2, fast_hash_load(data + 8));
+				acc3 = fast_hash_round(acc3, fast_hash_load(data + 12));
+			}
+
+			hash = fast_hash_rotl(acc0, 1) + fast_hash_rotl(acc1, 7) + fast_hash_rotl(acc2, 12) + fast_hash_rotl(acc3, 18);
+		}
+		else
+			hash = k_fast_hash_prime5;
+
+		hash += uint32_t(buffer_size);
+
+		for (; data + 4 <= data_end; data += 4)
+		{
+			hash += fast_hash_load(data) * k_fast_hash_prime3;
+			hash = fast_hash_rotl(hash, 17) * k_fast_hash_prime4;
+		}
+
+		for (; data < data_end; ++data)
+		{
+			hash += uint32_t(*data) * k_fast_hash_prime5;
+			hash = fast_hash_rotl(hash, 11) * k_fast_hash_prime1;
+		}
+
+		// Avalanche
+		hash ^= hash >> 15;
+		hash *= k_fast_hash_prime2;
+		hash ^= hash >> 13;
+		hash *= k_fast_hash_prime3;
+		hash ^= hash >> 16;
+		return hash;
+	}
+
 	////////////////////////////////////////////////////////////////////////////////
 	// Combines two hashes into a new one.
 	inline uint32_t hash_combine(uint32_t hash_a, uint32_t hash_b) { return (hash_a ^ hash_b) * 16777619U; }
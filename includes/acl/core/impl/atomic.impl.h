@@ -46,10 +46,19 @@ namespace acl
 
 	#if defined(__cplusplus) && __cplusplus >= 202002L
 		constexpr std::memory_order k_memory_order_relaxed = std::memory_order::relaxed;
+		constexpr std::memory_order k_memory_order_acquire = std::memory_order::acquire;
+		constexpr std::memory_order k_memory_order_release = std::memory_order::release;
+		constexpr std::memory_order k_memory_order_seq_cst = std::memory_order::seq_cst;
 	#elif defined(_MSVC_LANG) && _MSVC_LANG >= 202002L
 		constexpr std::memory_order k_memory_order_relaxed = std::memory_order::relaxed;
+		constexpr std::memory_order k_memory_order_acquire = std::memory_order::acquire;
+		constexpr std::memory_order k_memory_order_release = std::memory_order::release;
+		constexpr std::memory_order k_memory_order_seq_cst = std::memory_order::seq_cst;
 	#else
 		constexpr std::memory_order k_memory_order_relaxed = std::memory_order::memory_order_relaxed;
+		constexpr std::memory_order k_memory_order_acquire = std::memory_order::memory_order_acquire;
+		constexpr std::memory_order k_memory_order_release = std::memory_order::memory_order_release;
+		constexpr std::memory_order k_memory_order_seq_cst = std::memory_order::memory_order_seq_cst;
 	#endif
 	}
 
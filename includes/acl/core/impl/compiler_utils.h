@@ -120,3 +120,11 @@ namespace acl
 // Disabled by default, most clips have no measurable gain but some clips suffer greatly, needs to be investigated, possibly a bug somewhere
 // Note: Code has been removed in the pull request that closes: https://github.com/nfrechette/acl/issues/353
 //#define ACL_IMPL_ENABLE_WEIGHTED_AVERAGE_CONSTANT_SUB_TRACKS
+
+// This define enables the SIMD 8 wide AVX decompression code path for animated rotations, translations, and scales
+// It yields the same results as the regular SIMD 4 wide AVX code path but it isn't always faster
+// Measure with acl_decompressor on your target hardware before enabling it
+// Enable it by defining ACL_USE_AVX_8_WIDE_DECOMP, it is ignored if AVX isn't enabled
+#if defined(ACL_USE_AVX_8_WIDE_DECOMP) && !defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
+	#define ACL_IMPL_USE_AVX_8_WIDE_DECOMP
+#endif
@@ -39,6 +39,11 @@ namespace acl
 		{
 			return *reinterpret_cast<const database_header*>(reinterpret_cast<const uint8_t*>(&db) + sizeof(raw_buffer_header));
 		}
+
+		inline database_header& get_database_header(compressed_database& db)
+		{
+			return *reinterpret_cast<database_header*>(reinterpret_cast<uint8_t*>(&db) + sizeof(raw_buffer_header));
+		}
 	}
 
 	inline uint32_t compressed_database::get_total_size() const
@@ -124,11 +129,33 @@ namespace acl
 
 		const acl_impl::database_header& db_header = acl_impl::get_database_header(*this);
 		const acl_impl::database_clip_metadata* clips = db_header.get_clip_metadatas();
+		const uint32_t* removed_clips = db_header.get_removed_clips();
 		const uint32_t clip_hash = tracks.get_hash();
 		const uint32_t num_clips = db_header.num_clips;
+
+		// Removed clips are tombstoned, a clip with the same hash might remain
+		auto is_removed = [removed_clips](uint32_t clip_index) { return removed_clips != nullptr && (removed_clips[clip_index / 32] & (1U << (31 - (clip_index % 32)))) != 0; };
+
+		const uint32_t* clip_hash_index = db_header.get_clip_hash_index();
+		if (clip_hash_index != nullptr)
+		{
+			// Probe until we find an empty slot
+			const uint32_t slot_mask = acl_impl::get_clip_hash_index_num_slots(num_clips) - 1;
+			for (uint32_t slot_index = clip_hash & slot_mask; clip_hash_index[slot_index] != acl_impl::k_invalid_clip_hash_index_entry; slot_index = (slot_index + 1) & slot_mask)
+			{
+				const uint32_t clip_index = clip_hash_index[slot_index];
+				if (clips[clip_index].clip_hash == clip_hash && !is_removed(clip_index))
+					return true;	// Contained!
+			}
+
+			// We didn't find our clip
+			return false;
+		}
+
+		// Older databases do not have an index, search linearly
 		for (uint32_t clip_index = 0; clip_index < num_clips; ++clip_index)
 		{
-			if (clips[clip_index].clip_hash == clip_hash)
+			if (clips[clip_index].clip_hash == clip_hash && !is_removed(clip_index))
 				return true;	// Contained!
 		}
 
@@ -148,6 +175,9 @@ namespace acl
 		if (header.version < compressed_tracks_version16::first || header.version > compressed_tracks_version16::latest)
 			return error_result("Invalid database version");
 
+		if (header.get_num_database_tiers() != k_num_database_tiers)
+			return error_result("Database built with a different number of quality tiers, see ACL_NUM_DATABASE_TIERS");
+
 		if (check_hash)
 		{
 			const uint32_t hash = hash32(safe_ptr_cast<const uint8_t>(&m_padding[0]), m_buffer_header.size - sizeof(acl_impl::raw_buffer_header));
@@ -87,8 +87,15 @@ namespace acl
 			//////////////////////////////////////////////////////////////////////////
 			// Accessors for 'misc_packed'
 
+			// Scalar bit 0 and transform bit 11 were introduced with v02_01_99_3 and are ignored with older versions
+
 			// Scalar tracks use it like this (listed from LSB):
-			// Bits [0, 31): unused (31 bits)
+			// Bit 0: has segments?
+			// Bits [1, 8): unused (7 bits)
+			// Bit 8: has database?
+			// Bit 9: unused
+			// Bit 10: has stripped keyframes?
+			// Bits [11, 30): unused (19 bits)
 			// Bit 30: is wrap optimized? See sample_looping_policy for details.
 			// Bit 31: has metadata?
 
@@ -101,7 +108,8 @@ namespace acl
 			// Bit 8: has database?
 			// Bit 9: has trivial default values? Non-trivial default values indicate that extra data beyond the clip will be needed at decompression (e.g. bind pose)
 			// Bit 10: has stripped keyframes?
-			// Bits [11, 30): unused (19 bits)
+			// Bit 11: has sub-track prefix index?
+			// Bits [12, 30): unused (18 bits)
 			// Bit 30: is wrap optimized? See sample_looping_policy for details.
 			// Bit 31: has metadata?
 
@@ -116,26 +124,77 @@ namespace acl
 			void set_translation_format(vector_format8 format) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~(1 << 3)) | (static_cast<uint32_t>(format) << 3); }
 			rotation_format8 get_rotation_format() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return static_cast<rotation_format8>((misc_packed >> 4) & 15); }
 			void set_rotation_format(rotation_format8 format) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~(15 << 4)) | (static_cast<uint32_t>(format) << 4); }
-			bool get_has_database() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return (misc_packed & (1 << 8)) != 0; }
-			void set_has_database(bool has_database) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~(1 << 8)) | (static_cast<uint32_t>(has_database) << 8); }
 			bool get_has_trivial_default_values() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return (misc_packed & (1 << 9)) != 0; }
 			void set_has_trivial_default_values(bool has_trivial_default_values) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~(1 << 9)) | (static_cast<uint32_t>(has_trivial_default_values) << 9); }
-			bool get_has_stripped_keyframes() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return (misc_packed & (1 << 10)) != 0; }
-			void set_has_stripped_keyframes(bool has_stripped_keyframes) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~(1 << 10)) | (static_cast<uint32_t>(has_stripped_keyframes) << 10); }
+			bool get_has_sub_track_prefix_index() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return version >= compressed_tracks_version16::v02_01_99_3 && (misc_packed & (1 << 11)) != 0; }
+			void set_has_sub_track_prefix_index(bool has_sub_track_prefix_index) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~(1 << 11)) | (static_cast<uint32_t>(has_sub_track_prefix_index) << 11); }
+
+			// Scalar only
+			bool get_has_scalar_segments() const { ACL_ASSERT(track_type != track_type8::qvvf, "Scalar tracks only"); return version >= compressed_tracks_version16::v02_01_99_3 && (misc_packed & 1) != 0; }
+			void set_has_scalar_segments(bool has_segments) { ACL_ASSERT(track_type != track_type8::qvvf, "Scalar tracks only"); misc_packed = (misc_packed & ~1) | static_cast<uint32_t>(has_segments); }
 
 			// Common
+			bool get_has_database() const { return (misc_packed & (1 << 8)) != 0; }
+			void set_has_database(bool has_database) { misc_packed = (misc_packed & ~(1 << 8)) | (static_cast<uint32_t>(has_database) << 8); }
+			bool get_has_stripped_keyframes() const { return (misc_packed & (1 << 10)) != 0; }
+			void set_has_stripped_keyframes(bool has_stripped_keyframes) { misc_packed = (misc_packed & ~(1 << 10)) | (static_cast<uint32_t>(has_stripped_keyframes) << 10); }
 			bool get_is_wrap_optimized() const { return (misc_packed & (1 << 30)) != 0; }
 			void set_is_wrap_optimized(bool is_wrap_optimized) { misc_packed = (misc_packed & ~(1 << 30)) | (static_cast<uint32_t>(is_wrap_optimized) << 30); }
 			bool get_has_metadata() const { return (misc_packed >> 31) != 0; }
 			void set_has_metadata(bool has_metadata) { misc_packed = (misc_packed & ~(1 << 31)) | (static_cast<uint32_t>(has_metadata) << 31); }
 		};
 
+		struct database_runtime_clip_header;	// Forward declare
+
+		// Header for database related metadata in 'compressed_tracks'
+		struct tracks_database_header
+		{
+			// Offset of the runtime clip header to update when we stream in/out.
+			ptr_offset32<database_runtime_clip_header>		clip_header_offset;
+
+			//////////////////////////////////////////////////////////////////////////
+			// Utility functions that return pointers from their respective offsets.
+
+			database_runtime_clip_header*					get_clip_header(void* base) { return clip_header_offset.add_to(base); }
+			const database_runtime_clip_header*				get_clip_header(const void* base) const { return clip_header_offset.add_to(base); }
+		};
+
 		// Scalar track metadata
 		struct track_metadata
 		{
 			uint8_t			bit_rate;
 		};
 
+		// Header for scalar 'compressed_tracks' split into segments
+		// Follows the 'scalar_tracks_header' in memory and is followed by one 'scalar_segment_header' per segment
+		struct scalar_segments_header
+		{
+			uint32_t						num_segments;
+
+			// Every segment has this many samples except the last which also holds the remaining samples
+			uint32_t						num_samples_per_segment;
+
+			// Offset relative to the start of the 'scalar_tracks_header', only valid when bound to a database.
+			ptr_offset32<tracks_database_header>	database_header;
+		};
+
+		// Header for a segment of scalar 'compressed_tracks'
+		// Each segment has its own bit rate and range per track, constant values are shared by all segments
+		struct scalar_segment_header
+		{
+			// The number of bits used for a whole frame of data within this segment.
+			uint32_t						num_bits_per_frame;
+
+			// Various data offsets relative to the start of the 'scalar_tracks_header'.
+			ptr_offset32<track_metadata>	metadata_per_track;
+			ptr_offset32<float>				track_range_values;
+			ptr_offset32<uint8_t>			track_animated_values;
+
+			// Which samples are stored within this segment, the MSB is the first sample.
+			// Only valid when segments have no more than 32 samples, other samples live in the database when keyframes are stripped.
+			uint32_t						sample_indices;
+		};
+
 		// Header for scalar 'compressed_tracks'
 		struct scalar_tracks_header
 		{
@@ -162,6 +221,17 @@ namespace acl
 
 			uint8_t*						get_track_animated_values() { return track_animated_values.add_to(this); }
 			const uint8_t*					get_track_animated_values() const { return track_animated_values.add_to(this); }
+
+			// Only valid when the tracks are split into segments
+			scalar_segments_header*			get_segments_header() { return reinterpret_cast<scalar_segments_header*>(this + 1); }
+			const scalar_segments_header*	get_segments_header() const { return reinterpret_cast<const scalar_segments_header*>(this + 1); }
+
+			scalar_segment_header*			get_segment_headers() { return reinterpret_cast<scalar_segment_header*>(get_segments_header() + 1); }
+			const scalar_segment_header*	get_segment_headers() const { return reinterpret_cast<const scalar_segment_header*>(get_segments_header() + 1); }
+
+			// Only valid when the tracks are split into segments, returns nullptr if we aren't bound to a database
+			tracks_database_header*			get_database_header() { return get_segments_header()->database_header.safe_add_to(this); }
+			const tracks_database_header*	get_database_header() const { return get_segments_header()->database_header.safe_add_to(this); }
 		};
 
 		////////////////////////////////////////////////////////////////////////////////
@@ -196,21 +266,6 @@ namespace acl
 			uint32_t						sample_indices;
 		};
 
-		struct database_runtime_clip_header;	// Forward declare
-
-		// Header for database related metadata in 'compressed_tracks'
-		struct tracks_database_header
-		{
-			// Offset of the runtime clip header to update when we stream in/out.
-			ptr_offset32<database_runtime_clip_header>		clip_header_offset;
-
-			//////////////////////////////////////////////////////////////////////////
-			// Utility functions that return pointers from their respective offsets.
-
-			database_runtime_clip_header*					get_clip_header(void* base) { return clip_header_offset.add_to(base); }
-			const database_runtime_clip_header*				get_clip_header(const void* base) const { return clip_header_offset.add_to(base); }
-		};
-
 		//////////////////////////////////////////////////////////////////////////
 		// A 32 bit integer that contains packed sub-track types.
 		// Each sub-track type is packed on 2 bits starting with the MSB.
@@ -223,6 +278,29 @@ namespace acl
 
 		const uint32_t k_num_sub_tracks_per_packed_entry = 16;	// 2 bits each within a 32 bit entry
 
+		//////////////////////////////////////////////////////////////////////////
+		// The number of constant and animated sub-tracks that precede a packed
+		// sub-track types entry, counting only entries of the same sub-track type.
+		// When present, there is one per packed sub-track types entry and they
+		// immediately follow them, in the same order.
+		//////////////////////////////////////////////////////////////////////////
+		struct packed_sub_track_prefix_counts
+		{
+			uint32_t num_constant;
+			uint32_t num_animated;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// When a clip has a sub-track prefix index, every segment also stores the number of bits
+		// per component used by the animated variable sub-tracks that precede every 16th one
+		// (in the format per track data order). Entry 'i' covers the first 16 * (i + 1) sub-tracks.
+		// They follow the prefix counts, one array per segment, in segment order.
+		//////////////////////////////////////////////////////////////////////////
+		const uint32_t k_num_sub_tracks_per_bit_size_prefix = 16;
+
+		// Returns the number of bit size prefixes stored per segment
+		constexpr uint32_t get_num_segment_bit_size_prefixes(uint32_t num_animated_variable_sub_tracks) { return num_animated_variable_sub_tracks / k_num_sub_tracks_per_bit_size_prefix; }
+
 		// Header for transform 'compressed_tracks'
 		struct transform_tracks_header
 		{
@@ -281,6 +359,16 @@ namespace acl
 			packed_sub_track_types*			get_sub_track_types() { return sub_track_types_offset.add_to(this); }
 			const packed_sub_track_types*	get_sub_track_types() const { return sub_track_types_offset.add_to(this); }
 
+			// Optional, only present if the tracks header has a sub-track prefix index, see tracks_header.
+			// The prefix counts follow the packed sub-track types, the total number of entries must be provided.
+			packed_sub_track_prefix_counts*			get_sub_track_prefix_counts(uint32_t num_sub_track_entries) { return reinterpret_cast<packed_sub_track_prefix_counts*>(get_sub_track_types() + num_sub_track_entries); }
+			const packed_sub_track_prefix_counts*	get_sub_track_prefix_counts(uint32_t num_sub_track_entries) const { return reinterpret_cast<const packed_sub_track_prefix_counts*>(get_sub_track_types() + num_sub_track_entries); }
+
+			// Optional, only present if the tracks header has a sub-track prefix index, see k_num_sub_tracks_per_bit_size_prefix.
+			// The segment bit size prefixes follow the prefix counts, the total number of sub-track entries must be provided.
+			uint32_t*						get_segment_bit_size_prefixes(uint32_t num_sub_track_entries) { return reinterpret_cast<uint32_t*>(get_sub_track_prefix_counts(num_sub_track_entries) + num_sub_track_entries); }
+			const uint32_t*					get_segment_bit_size_prefixes(uint32_t num_sub_track_entries) const { return reinterpret_cast<const uint32_t*>(get_sub_track_prefix_counts(num_sub_track_entries) + num_sub_track_entries); }
+
 			uint8_t*						get_constant_track_data() { return constant_track_data_offset.add_to(this); }
 			const uint8_t*					get_constant_track_data() const { return constant_track_data_offset.add_to(this); }
 
@@ -401,8 +489,8 @@ namespace acl
 		// Header for runtime database segments
 		struct database_runtime_segment_header
 		{
-			// Each segment can be split into at most 3 tiers with tier 0 being in the compressed clip itself.
-			// As such, each segment can be split into at most 2 tiers within the database, each with it's own
+			// Each segment can be split into at most k_num_quality_tiers tiers with tier 0 being in the compressed clip itself.
+			// As such, each segment can be split into at most k_num_database_tiers tiers within the database, each with it's own
 			// chunk. Each segment contains at most 32 samples. Tiers are sorted in order from most important
 			// to least important and as such should stream in that order.
 
@@ -412,7 +500,7 @@ namespace acl
 			// Each tier value contains: (sample offset << 32) | sample indices
 			// Sample indices is a bit set of which sample indices are stored in our chunk
 			// Sample offset to the data. Zero if the data isn't used or streamed in. Relative to start of bulk data.
-			std::atomic<uint64_t>			tier_metadata[2];
+			std::atomic<uint64_t>			tier_metadata[k_num_database_tiers];
 		};
 
 		// Header for runtime database clips, 8 byte alignment to match database_runtime_segment_header
@@ -421,7 +509,8 @@ namespace acl
 			// Hash of the compressed clip stored in this entry
 			uint32_t						clip_hash;
 
-			uint32_t						padding;
+			// Index of the clip in the database clip metadata
+			uint32_t						clip_index;
 
 			// Segment headers follow in memory
 
@@ -432,6 +521,13 @@ namespace acl
 			const database_runtime_segment_header*		get_segment_headers() const { return add_offset_to_ptr<const database_runtime_segment_header>(this, sizeof(database_runtime_clip_header)); }
 		};
 
+		// Clips are laid out in clip index order in the runtime metadata, skipping the clip headers
+		// yields a flat list of every segment header in the database.
+		inline uint32_t get_database_runtime_segment_index(uint32_t clip_index, uint32_t segment_header_offset)
+		{
+			return (segment_header_offset - ((clip_index + 1) * uint32_t(sizeof(database_runtime_clip_header)))) / uint32_t(sizeof(database_runtime_segment_header));
+		}
+
 		//////////////////////////////////////////////////////////////////////////
 		// Chunk data has the following layout:
 		// [ database_chunk_header, database_chunk_segment_header+, sample data ... ]
@@ -528,9 +624,51 @@ namespace acl
 			const database_runtime_clip_header*				get_clip_header(const void* base) const { return clip_header_offset.add_to(base); }
 		};
 
+		// Range of chunks that contain the segments of a clip, for each tier
+		// Segments are written in clip order and as such, the chunks of a clip are contiguous.
+		// Chunks at the boundaries can be shared with the previous and next clips.
+		struct database_clip_chunk_range
+		{
+			// Index of the first chunk that contains a segment of this clip.
+			uint32_t						first_chunk_index[k_num_database_tiers];
+
+			// Number of chunks that contain segments of this clip (zero if the tier is empty).
+			uint32_t						num_chunks[k_num_database_tiers];
+		};
+
+		// Where the samples of a segment live for each tier, known when the database is built
+		// Entries are sorted by runtime segment index, see get_database_runtime_segment_index(..)
+		struct database_segment_streaming_metadata
+		{
+			// Index of the chunk that contains the segment samples (k_invalid_chunk_index if the tier is empty).
+			uint32_t						chunk_index[k_num_database_tiers];
+
+			// Bit set of which sample indices are stored in the chunk.
+			uint32_t						sample_indices[k_num_database_tiers];
+
+			// Offset to the segment sample data. Relative to start of bulk data.
+			uint32_t						samples_offset[k_num_database_tiers];
+		};
+
+		// Segments with no samples in a tier do not belong to any of its chunks
+		constexpr uint32_t k_invalid_chunk_index = 0xFFFFFFFFU;
+
+		// Number of slots in the clip hash index, a power of two at most half full
+		inline uint32_t get_clip_hash_index_num_slots(uint32_t num_clips)
+		{
+			uint32_t num_slots = 1;
+			while (num_slots < num_clips * 2)
+				num_slots *= 2;
+
+			return num_slots;
+		}
+
+		// Empty clip hash index slots contain this value
+		constexpr uint32_t k_invalid_clip_hash_index_entry = 0xFFFFFFFFU;
+
 		// Header for 'compressed_database'
 		// We use arrays so we can index with (tier - 1) as our index
-		// Index 0 = medium importance tier, index 1 = low importance
+		// Index 0 = medium importance tier, index k_num_database_tiers - 1 = lowest importance
 		struct database_header
 		{
 			// Serialization tag used to distinguish raw buffer types.
@@ -571,32 +709,117 @@ namespace acl
 			//////////////////////////////////////////////////////////////////////////
 			// Accessors for 'misc_packed'
 
+			// Bits [1, 9) were introduced with v02_01_99_3 and are ignored with older versions
 			// Listed from LSB:
 			// Bit 0: is bulk data inline?
-			// Bits [1, 16): unused (15 bits)
+			// Bit 1: has clip chunk ranges? They follow the clip metadata
+			// Bit 2: has removed clips? Their bit set follows the clip chunk ranges
+			// Bit 3: has clip hash index? It follows the removed clips
+			// Bit 4: has segment streaming metadata? It follows the clip hash index
+			// Bits [5, 8): number of database tiers (zero in older databases which always have 2 tiers)
+			// Bit 8: has chunk hashes? They follow the segment streaming metadata
+			// Bits [9, 16): unused (7 bits)
 
 			bool get_is_bulk_data_inline() const { return (misc_packed & (1 << 0)) != 0; }
 			void set_is_bulk_data_inline(bool is_inline) { misc_packed = (misc_packed & ~(1 << 0)) | (static_cast<uint16_t>(is_inline) << 0); }
+			bool get_has_clip_chunk_ranges() const { return version >= compressed_tracks_version16::v02_01_99_3 && (misc_packed & (1 << 1)) != 0; }
+			void set_has_clip_chunk_ranges(bool has_ranges) { misc_packed = (misc_packed & ~(1 << 1)) | (static_cast<uint16_t>(has_ranges) << 1); }
+			bool get_has_removed_clips() const { return version >= compressed_tracks_version16::v02_01_99_3 && (misc_packed & (1 << 2)) != 0; }
+			void set_has_removed_clips(bool has_removed_clips) { misc_packed = (misc_packed & ~(1 << 2)) | (static_cast<uint16_t>(has_removed_clips) << 2); }
+			bool get_has_clip_hash_index() const { return version >= compressed_tracks_version16::v02_01_99_3 && (misc_packed & (1 << 3)) != 0; }
+			void set_has_clip_hash_index(bool has_index) { misc_packed = (misc_packed & ~(1 << 3)) | (static_cast<uint16_t>(has_index) << 3); }
+			bool get_has_segment_streaming_metadata() const { return version >= compressed_tracks_version16::v02_01_99_3 && (misc_packed & (1 << 4)) != 0; }
+			void set_has_segment_streaming_metadata(bool has_metadata) { misc_packed = (misc_packed & ~(1 << 4)) | (static_cast<uint16_t>(has_metadata) << 4); }
+			uint32_t get_num_database_tiers() const { const uint32_t num_tiers = (misc_packed >> 5) & 0x7; return version >= compressed_tracks_version16::v02_01_99_3 && num_tiers != 0 ? num_tiers : 2; }
+			void set_num_database_tiers(uint32_t num_tiers) { misc_packed = (misc_packed & ~(0x7 << 5)) | (static_cast<uint16_t>(num_tiers & 0x7) << 5); }
+			bool get_has_chunk_hashes() const { return version >= compressed_tracks_version16::v02_01_99_3 && (misc_packed & (1 << 8)) != 0; }
+			void set_has_chunk_hashes(bool has_hashes) { misc_packed = (misc_packed & ~(1 << 8)) | (static_cast<uint16_t>(has_hashes) << 8); }
 
 			//////////////////////////////////////////////////////////////////////////
 			// Utility functions that return pointers from their respective offsets.
 
-			// Follows the header
-			database_chunk_description*				get_chunk_descriptions_medium() { return add_offset_to_ptr<database_chunk_description>(this, align_to(sizeof(database_header), 4)); }
-			const database_chunk_description*		get_chunk_descriptions_medium() const { return add_offset_to_ptr<const database_chunk_description>(this, align_to(sizeof(database_header), 4)); }
+			// Follows the header, the descriptions of each tier follow those of the previous tier
+			database_chunk_description*				get_chunk_descriptions(uint32_t tier_index) { return const_cast<database_chunk_description*>(const_cast<const database_header*>(this)->get_chunk_descriptions(tier_index)); }
+			const database_chunk_description*		get_chunk_descriptions(uint32_t tier_index) const
+			{
+				uint32_t offset = align_to(uint32_t(sizeof(database_header)), 4);
+				for (uint32_t prev_tier_index = 0; prev_tier_index < tier_index; ++prev_tier_index)
+					offset += num_chunks[prev_tier_index] * uint32_t(sizeof(database_chunk_description));
 
-			// Follows the medium descriptions
-			database_chunk_description*				get_chunk_descriptions_low() { return add_offset_to_ptr<database_chunk_description>(this, align_to(align_to(sizeof(database_header), 4) + num_chunks[0] * sizeof(database_chunk_description), 4)); }
-			const database_chunk_description*		get_chunk_descriptions_low() const { return add_offset_to_ptr<const database_chunk_description>(this, align_to(align_to(sizeof(database_header), 4) + num_chunks[0] * sizeof(database_chunk_description), 4)); }
+				return add_offset_to_ptr<const database_chunk_description>(this, offset);
+			}
 
 			database_clip_metadata*					get_clip_metadatas() { return clip_metadata_offset.add_to(this); }
 			const database_clip_metadata*			get_clip_metadatas() const { return clip_metadata_offset.add_to(this); }
 
-			uint8_t*								get_bulk_data_medium() { return bulk_data_offset[0].safe_add_to(this); }
-			const uint8_t*							get_bulk_data_medium() const { return bulk_data_offset[0].safe_add_to(this); }
+			// Follows the clip metadata, optional
+			database_clip_chunk_range*				get_clip_chunk_ranges() { return get_has_clip_chunk_ranges() ? reinterpret_cast<database_clip_chunk_range*>(get_clip_metadatas() + num_clips) : nullptr; }
+			const database_clip_chunk_range*		get_clip_chunk_ranges() const { return get_has_clip_chunk_ranges() ? reinterpret_cast<const database_clip_chunk_range*>(get_clip_metadatas() + num_clips) : nullptr; }
+
+			// Bit set of the clips removed with remove_from_database(..), follows the clip chunk ranges, optional
+			uint32_t*								get_removed_clips() { return get_has_removed_clips() ? reinterpret_cast<uint32_t*>(get_clip_chunk_ranges() + num_clips) : nullptr; }
+			const uint32_t*							get_removed_clips() const { return get_has_removed_clips() ? reinterpret_cast<const uint32_t*>(get_clip_chunk_ranges() + num_clips) : nullptr; }
+
+			// Open addressing hash table of clip indices keyed by clip hash, follows the removed clips, optional
+			uint32_t*								get_clip_hash_index() { return const_cast<uint32_t*>(const_cast<const database_header*>(this)->get_clip_hash_index()); }
+			const uint32_t*							get_clip_hash_index() const
+			{
+				if (!get_has_clip_hash_index())
+					return nullptr;
+
+				const uint8_t* index = reinterpret_cast<const uint8_t*>(get_clip_metadatas() + num_clips);
+				if (get_has_clip_chunk_ranges())
+					index += num_clips * sizeof(database_clip_chunk_range);
+				if (get_has_removed_clips())
+					index += ((num_clips + 31) / 32) * sizeof(uint32_t);
+
+				return reinterpret_cast<const uint32_t*>(index);
+			}
+
+			// Streaming metadata of every segment, follows the clip hash index, optional
+			database_segment_streaming_metadata*		get_segment_streaming_metadatas() { return const_cast<database_segment_streaming_metadata*>(const_cast<const database_header*>(this)->get_segment_streaming_metadatas()); }
+			const database_segment_streaming_metadata*	get_segment_streaming_metadatas() const
+			{
+				if (!get_has_segment_streaming_metadata())
+					return nullptr;
+
+				const uint8_t* metadatas = reinterpret_cast<const uint8_t*>(get_clip_metadatas() + num_clips);
+				if (get_has_clip_chunk_ranges())
+					metadatas += num_clips * sizeof(database_clip_chunk_range);
+				if (get_has_removed_clips())
+					metadatas += ((num_clips + 31) / 32) * sizeof(uint32_t);
+				if (get_has_clip_hash_index())
+					metadatas += get_clip_hash_index_num_slots(num_clips) * sizeof(uint32_t);
+
+				return reinterpret_cast<const database_segment_streaming_metadata*>(metadatas);
+			}
+
+			// Hash of every chunk (see fast_hash32), follows the segment streaming metadata, optional
+			// The hashes of each tier follow those of the previous tier
+			uint32_t*								get_chunk_hashes(uint32_t tier_index) { return const_cast<uint32_t*>(const_cast<const database_header*>(this)->get_chunk_hashes(tier_index)); }
+			const uint32_t*							get_chunk_hashes(uint32_t tier_index) const
+			{
+				if (!get_has_chunk_hashes())
+					return nullptr;
+
+				const uint8_t* hashes = reinterpret_cast<const uint8_t*>(get_clip_metadatas() + num_clips);
+				if (get_has_clip_chunk_ranges())
+					hashes += num_clips * sizeof(database_clip_chunk_range);
+				if (get_has_removed_clips())
+					hashes += ((num_clips + 31) / 32) * sizeof(uint32_t);
+				if (get_has_clip_hash_index())
+					hashes += get_clip_hash_index_num_slots(num_clips) * sizeof(uint32_t);
+				if (get_has_segment_streaming_metadata())
+					hashes += num_segments * sizeof(database_segment_streaming_metadata);
+
+				for (uint32_t prev_tier_index = 0; prev_tier_index < tier_index; ++prev_tier_index)
+					hashes += num_chunks[prev_tier_index] * sizeof(uint32_t);
+
+				return reinterpret_cast<const uint32_t*>(hashes);
+			}
 
-			uint8_t*								get_bulk_data_low() { return bulk_data_offset[1].safe_add_to(this); }
-			const uint8_t*							get_bulk_data_low() const { return bulk_data_offset[1].safe_add_to(this); }
+			uint8_t*								get_bulk_data(uint32_t tier_index) { return bulk_data_offset[tier_index].safe_add_to(this); }
+			const uint8_t*							get_bulk_data(uint32_t tier_index) const { return bulk_data_offset[tier_index].safe_add_to(this); }
 		};
 	}
 
@@ -60,6 +60,20 @@ namespace acl
 		{
 			return *reinterpret_cast<const optional_metadata_header*>(reinterpret_cast<const uint8_t*>(&tracks) + tracks.get_size() - sizeof(optional_metadata_header));
 		}
+
+		// Returns nullptr if the tracks aren't bound to a database
+		inline const tracks_database_header* get_tracks_database_header(const compressed_tracks& tracks)
+		{
+			const tracks_header& header = get_tracks_header(tracks);
+			if (!header.get_has_database())
+				return nullptr;
+
+			// Scalar tracks bound to a database are always split into segments
+			if (header.track_type == track_type8::qvvf)
+				return get_transform_tracks_header(tracks).get_database_header();
+			else
+				return get_scalar_tracks_header(tracks).get_database_header();
+		}
 	}
 
 	inline algorithm_type8 compressed_tracks::get_algorithm_type() const { return acl_impl::get_tracks_header(*this).algorithm_type; }
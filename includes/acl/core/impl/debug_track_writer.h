@@ -94,6 +94,10 @@ namespace acl
 				}
 			}
 
+			//////////////////////////////////////////////////////////////////////////
+			// Our float1f values are contiguous, allow the decoder to write multiple tracks at once.
+			float* get_float1_output_buffer() { return type == track_type8::float1f ? tracks_typed.float1f : nullptr; }
+
 			//////////////////////////////////////////////////////////////////////////
 			// Called by the decoder to write out a value for a specified track index.
 			void RTM_SIMD_CALL write_float1(uint32_t track_index, rtm::scalarf_arg0 value)
@@ -31,12 +31,31 @@
 
 ACL_IMPL_FILE_PRAGMA_PUSH
 
+#if defined(RTM_COMPILER_MSVC)
+	// The linker rejects objects built with a different number of database tiers, even without a versioned namespace
+	#pragma detect_mismatch("ACL_NUM_DATABASE_TIERS", ACL_IMPL_TIERS_STRINGIFY(ACL_NUM_DATABASE_TIERS))
+#endif
+
 namespace acl
 {
 	ACL_IMPL_VERSION_NAMESPACE_BEGIN
 
+	//////////////////////////////////////////////////////////////////////////
+	// The number of quality tiers stored in a database can be configured by defining
+	// ACL_NUM_DATABASE_TIERS to a value between 2 and 7 before including ACL.
+	// Each additional tier refines the key frames present in the tiers of higher importance
+	// which allows streaming to progressively improve the quality in finer steps.
+	// Databases can only be used by code built with the same number of tiers.
+	// It sizes the runtime types that seeking reads, all code sharing ACL types must use the same value.
+	// When it isn't the default, the tier count is part of the ACL namespace (see acl/version.h)
+	// and code built with different values doesn't share symbols.
+	// Defaults to 2 (medium and lowest importance), see acl/version.h
+	static_assert(ACL_NUM_DATABASE_TIERS >= 2 && ACL_NUM_DATABASE_TIERS <= 7, "ACL_NUM_DATABASE_TIERS must be in the range [2, 7]");
+
 	//////////////////////////////////////////////////////////////////////////
 	// What quality tier a key frame/sample belongs to
+	// Tiers are sorted from most important to least important. When more than two
+	// database tiers are used, the intermediate tiers are quality_tier(2), quality_tier(3), etc.
 	enum class quality_tier
 	{
 		// Highest importance frames remain in the compressed clip and can be used to interpolate even without the database present
@@ -50,14 +69,17 @@ namespace acl
 		//low_importance,	// RESERVED
 
 		// Lowest importance frames live in the compressed database and contribute the least to the quality
-		lowest_importance	= 2,
+		lowest_importance	= ACL_NUM_DATABASE_TIERS,
 	};
 
-	// We only support 3 tiers
-	constexpr uint32_t k_num_quality_tiers = 3;
+	// Database contains 2 tiers by default
+	constexpr uint32_t k_num_database_tiers = ACL_NUM_DATABASE_TIERS;
+
+	// Maximum number of tiers a database can contain
+	constexpr uint32_t k_num_database_tiers_max = 7;
 
-	// Database contains 2 tiers
-	constexpr uint32_t k_num_database_tiers = 2;
+	// The highest importance tier lives in the compressed clip, the others in the database
+	constexpr uint32_t k_num_quality_tiers = k_num_database_tiers + 1;
 
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
@@ -95,9 +95,29 @@ namespace acl
 		// This function cannot return the 'per_track' value. Doing so will assert at runtime.
 		constexpr sample_rounding_policy get_rounding_policy(sample_rounding_policy seek_policy, uint32_t /*track_index*/) const { return seek_policy; }
 
+		//////////////////////////////////////////////////////////////////////////
+		// Called when decompressing multiple sample times in a single call before the tracks
+		// of each sample time are written out. The index provided is the position of the
+		// sample time in the array provided by the caller. Sample times are not necessarily
+		// visited in the order provided.
+		void set_sample_time_index(uint32_t /*sample_time_index*/) {}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Called when decompressing a range of stored samples in a single call before the
+		// tracks of each sample are written out. The index provided is the clip relative sample index.
+		void set_sample_index(uint32_t /*sample_index*/) {}
+
 		//////////////////////////////////////////////////////////////////////////
 		// Scalar track writing
 
+		//////////////////////////////////////////////////////////////////////////
+		// If the host runtime writes float1f tracks into a contiguous float array indexed by
+		// track index, it can return it here. This allows the decoder to unpack multiple
+		// tracks at once and write them with a single SIMD store, bypassing write_float1(..).
+		// Tracks that cannot be unpacked together are still written with write_float1(..).
+		// Returning nullptr (the default) writes every track with write_float1(..).
+		float* get_float1_output_buffer() { return nullptr; }
+
 		//////////////////////////////////////////////////////////////////////////
 		// Called by the decoder to write out a value for a specified track index.
 		void RTM_SIMD_CALL write_float1(uint32_t track_index, rtm::scalarf_arg0 value)
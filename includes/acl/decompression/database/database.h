@@ -56,7 +56,8 @@ namespace acl
 		dispatched,
 
 		//////////////////////////////////////////////////////////////////////////
-		// The streaming request has been ignored because streaming is already in progress
+		// The streaming request has been ignored because the bulk data is being allocated
+		// or deallocated by a request in flight
 		streaming_in_progress,
 
 		//////////////////////////////////////////////////////////////////////////
@@ -70,6 +71,15 @@ namespace acl
 		//////////////////////////////////////////////////////////////////////////
 		// Ran out of streaming requests
 		no_free_streaming_requests,
+
+		//////////////////////////////////////////////////////////////////////////
+		// The compressed tracks instance isn't contained in the database
+		invalid_compressed_tracks,
+
+		//////////////////////////////////////////////////////////////////////////
+		// The database does not contain the range of chunks of each clip, it must be rebuilt
+		// to stream individual clips
+		clip_chunk_ranges_missing,
 	};
 
 	//////////////////////////////////////////////////////////////////////////
@@ -108,12 +118,23 @@ namespace acl
 		// Returns whether initialization was successful or not.
 		bool initialize(iallocator& allocator, const compressed_database& database);
 
+#if ACL_NUM_DATABASE_TIERS == 2
 		//////////////////////////////////////////////////////////////////////////
 		// Initializes the context instance to a particular compressed database instance.
 		// The streamer instances will be used to issue IO stream in/out requests.
 		// If a tier is stripped, the null_database_streamer can be used.
+		// Only available when the database contains 2 tiers, see ACL_NUM_DATABASE_TIERS.
 		// Returns whether initialization was successful or not.
 		bool initialize(iallocator& allocator, const compressed_database& database, database_streamer& medium_tier_streamer, database_streamer& low_tier_streamer);
+#endif
+
+		//////////////////////////////////////////////////////////////////////////
+		// Initializes the context instance to a particular compressed database instance.
+		// The streamer instances will be used to issue IO stream in/out requests, one per
+		// database tier sorted from most important to least important.
+		// If a tier is stripped, the null_database_streamer can be used.
+		// Returns whether initialization was successful or not.
+		bool initialize(iallocator& allocator, const compressed_database& database, database_streamer* const* tier_streamers, uint32_t num_tier_streamers);
 
 		//////////////////////////////////////////////////////////////////////////
 		// Returns true if this context instance is bound to a compressed database instance, false otherwise.
@@ -130,14 +151,22 @@ namespace acl
 		// Returns whether rebinding was successful or not.
 		bool relocated(const compressed_database& database);
 
+#if ACL_NUM_DATABASE_TIERS == 2
 		//////////////////////////////////////////////////////////////////////////
 		// If the bound compressed database instance has relocated elsewhere in memory, this function
 		// rebinds the context to it, avoiding the need to re-initialize it entirely.
 		// This can also be called if the streamers relocated, it will cause them to be rebound as well.
 		// Assumes that the streamers have retained the same bulk data state as well. If it is
 		// not the case, reset and re-initialize the context.
+		// Only available when the database contains 2 tiers, see ACL_NUM_DATABASE_TIERS.
 		// Returns whether rebinding was successful or not.
 		bool relocated(const compressed_database& database, database_streamer& medium_tier_streamer, database_streamer& low_tier_streamer);
+#endif
+
+		//////////////////////////////////////////////////////////////////////////
+		// Same as above with one streamer per database tier sorted from most important to least important.
+		// Returns whether rebinding was successful or not.
+		bool relocated(const compressed_database& database, database_streamer* const* tier_streamers, uint32_t num_tier_streamers);
 
 		//////////////////////////////////////////////////////////////////////////
 		// Returns true if this context instance is bound to the specified database instance, false otherwise.
@@ -148,38 +177,130 @@ namespace acl
 		bool contains(const compressed_tracks& tracks) const;
 
 		//////////////////////////////////////////////////////////////////////////
-		// Returns whether or not we have streamed in any of the database bulk data for the specified tier (medium or low).
+		// Returns whether or not we have streamed in any of the database bulk data for the specified tier (any database tier).
 		bool is_streamed_in(quality_tier tier) const;
 
 		//////////////////////////////////////////////////////////////////////////
-		// Returns whether or not a streaming request is in flight for the specified tier (medium or low).
+		// Returns whether or not any streaming request is in flight for the specified tier (any database tier).
 		bool is_streaming(quality_tier tier) const;
 
 		//////////////////////////////////////////////////////////////////////////
-		// Issues a stream in request and returns the current status for the specified tier (medium or low).
+		// Issues a stream in request and returns the current status for the specified tier (any database tier).
 		// By default, every chunk will be streamed in but they can be streamed progressively
-		// by providing a number of chunks.
+		// by providing a number of chunks. Requests can be issued while others are in flight,
+		// the next chunks that aren't loaded or streaming are then requested.
 		database_stream_request_result stream_in(quality_tier tier, uint32_t num_chunks_to_stream = ~0U);
 
 		//////////////////////////////////////////////////////////////////////////
-		// Issues a stream out request and returns the current status for the specified tier (medium or low).
+		// Issues a stream out request and returns the current status for the specified tier (any database tier).
 		// By default, every chunk will be streamed out but they can be streamed progressively
 		// by providing a number of chunks.
+		// Chunks referenced by clips requested with stream_in(tier, tracks) remain loaded and are
+		// not counted, stream those clips out with stream_out(tier, tracks) to release them.
 		database_stream_request_result stream_out(quality_tier tier, uint32_t num_chunks_to_stream = ~0U);
 
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether or not every chunk that contains data of the provided compressed tracks
+		// instance has been streamed in for the specified tier (any database tier).
+		bool is_streamed_in(quality_tier tier, const compressed_tracks& tracks) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Issues a stream in request for the chunks that contain data of the provided compressed tracks
+		// instance and returns the current status for the specified tier (any database tier).
+		// The chunks are referenced by the clip until it is streamed out, chunks shared with other
+		// requested clips remain loaded. Requesting a clip more than once only references its chunks once,
+		// if several instances play the same clip, you must track their number yourself.
+		database_stream_request_result stream_in(quality_tier tier, const compressed_tracks& tracks);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Releases the chunks referenced by the provided compressed tracks instance and issues a stream out
+		// request for those no longer referenced by any other requested clip. Returns the current
+		// status for the specified tier (any database tier).
+		database_stream_request_result stream_out(quality_tier tier, const compressed_tracks& tracks);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Stream out requests stop decompression from using their chunks right away but they are only
+		// dispatched to the streamer once every decompression scope that might still read them has ended,
+		// see database_decompression_scope. This dispatches the deferred requests that are now safe.
+		// Every stream in/out request calls it, call it periodically while none are issued.
+		// Returns the number of stream out requests that remain deferred.
+		uint32_t dispatch_deferred_stream_outs();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Advances the clock used to record when clips are used by decompression.
+		// Clips seeked afterwards are recorded with the new time. The budget manager
+		// advances the clock of the contexts registered with it on every update.
+		void advance_usage_clock();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the index of up to 'max_num_clips' clips seeked since the usage clock last advanced
+		// and returns how many were written. Clips are indexed in the order they were provided to build_database.
+		// Requires clip usage tracking, see database_settings::is_clip_usage_tracking_supported().
+		uint32_t get_recently_used_clips(uint32_t* out_clip_indices, uint32_t max_num_clips) const;
+
 	private:
+		// Returns the range of chunks of the provided compressed tracks instance or nullptr if unknown
+		const acl_impl::database_clip_chunk_range* get_clip_chunk_range(const compressed_tracks& tracks, uint32_t& out_clip_index) const;
+
+		// Updates the chunk references of a clip and streams its chunks, used by the budget manager as well
+		database_stream_request_result stream_in_clip(quality_tier tier, uint32_t clip_index);
+		database_stream_request_result stream_out_clip(quality_tier tier, uint32_t clip_index);
+
+		// Dispatches the streaming request of a range of chunks that aren't streaming
+		database_stream_request_result stream_in_chunks(quality_tier tier, uint32_t first_chunk_index, uint32_t num_chunks);
+		database_stream_request_result stream_out_chunks(quality_tier tier, uint32_t first_chunk_index, uint32_t num_chunks);
+
+		// Returns whether a deferred stream out request will deallocate the bulk data of a tier
+		bool is_bulk_data_deallocation_deferred(quality_tier tier) const;
+
+		// Returns the size of the chunks of a tier whose stream out is deferred, they remain resident until dispatched
+		uint32_t get_deferred_stream_out_size(quality_tier tier) const;
+
 		database_context(const database_context& other) = delete;
 		database_context& operator=(const database_context& other) = delete;
 
 		// Internal context data
 		acl_impl::database_context_v0 m_context;
 
+		template<class database_settings_type_> friend class database_budget_manager;
+		friend class database_decompression_scope;
+
 		static_assert(std::is_base_of<database_settings, settings_type>::value, "database_settings_type must derive from database_settings!");
 
 		// TODO: I'd like to assert here but we use a dummy pointer to init the decompression context which triggers this
 		//static_assert(settings_type::version_supported() != compressed_tracks_version16::none, "database_settings_type must support at least one version");
 	};
 
+	//////////////////////////////////////////////////////////////////////////
+	// A decompression scope keeps the chunks seen by decompression alive until it ends.
+	//
+	// Stream out requests issued while scopes are alive stop new seeks from using their chunks
+	// right away, they fall back to the higher importance tiers, but the streamer only releases them
+	// once every scope that started before has ended. Wrap a seek and the decompress calls that
+	// follow it in a scope to stream out while other threads decompress.
+	// Scopes are cheap and can be entered from any number of threads at the same time.
+	//////////////////////////////////////////////////////////////////////////
+	class database_decompression_scope
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Enters a decompression scope for the provided database context.
+		// Does nothing if the context isn't initialized.
+		template<class database_settings_type>
+		explicit database_decompression_scope(const database_context<database_settings_type>& context);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Leaves the decompression scope.
+		~database_decompression_scope();
+
+	private:
+		database_decompression_scope(const database_decompression_scope& other) = delete;
+		database_decompression_scope& operator=(const database_decompression_scope& other) = delete;
+
+		const acl_impl::database_context_v0* m_context;
+		uint32_t m_epoch;
+	};
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
 
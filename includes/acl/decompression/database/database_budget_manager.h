@@ -0,0 +1,182 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/database/database.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		struct database_budget_clip_entry;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Settings that control how the database budget manager streams.
+	//////////////////////////////////////////////////////////////////////////
+	struct database_budget_settings
+	{
+		// How many bytes of bulk data can be resident across every registered database, every tier included.
+		uint64_t budget_size = 64 * 1024 * 1024;
+
+		// Clips seeked within this many updates are streamed in when there is room for them.
+		uint32_t max_num_idle_updates = 30;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Counters accumulated by the database budget manager.
+	//////////////////////////////////////////////////////////////////////////
+	struct database_budget_stats
+	{
+		uint64_t resident_size = 0;				// Bytes of chunks resident, streaming in, or deferred streaming out at the end of the last update
+		uint64_t bulk_data_size = 0;			// Bytes of bulk data allocated or mapped by the streamers at the end of the last update
+		uint64_t num_updates = 0;
+		uint64_t num_over_budget_updates = 0;	// Updates that started with more bytes resident than the budget allows
+		uint64_t num_stream_in_requests = 0;	// Clip tiers streamed in
+		uint64_t num_stream_out_requests = 0;	// Clip tiers streamed out
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Keeps the bulk data resident across many databases within a global budget.
+	//
+	// Database contexts are registered with the manager which then drives their streaming
+	// one clip at a time with stream_in(tier, tracks) and stream_out(tier, tracks).
+	// When seeking, decompression records the last time each clip was used (see
+	// database_settings::is_clip_usage_tracking_supported()). Every update, when more bytes
+	// are resident than the budget allows, the least recently used clips are streamed out,
+	// starting with their lowest importance tier. When there is room, the most recently
+	// used clips are streamed in, starting with their medium importance tier.
+	// Quality degrades gracefully under memory pressure.
+	//
+	// The budget tracks the logical residency of the chunks: the size of those loaded or streaming in,
+	// tracked by each context as requests are issued. Chunks whose stream out is deferred until
+	// decompression no longer reads them still count until the request is dispatched, they are not
+	// evicted twice. Streamers allocate or map the bulk data of a whole tier at once and free it when
+	// its last chunks stream out, they can hold more memory than the budget, see
+	// database_budget_stats::bulk_data_size.
+	//
+	// The databases must contain the range of chunks of each clip, older databases must be
+	// rebuilt. Registered contexts should not be streamed manually. The manager must be updated from
+	// the thread that issues streaming requests.
+	//////////////////////////////////////////////////////////////////////////
+	template<class database_settings_type>
+	class database_budget_manager
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// An alias to the database settings type.
+		using settings_type = database_settings_type;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs an empty budget manager instance.
+		database_budget_manager();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Destructs a budget manager instance and releases its memory.
+		~database_budget_manager();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Initializes the budget manager to hold up to the specified number of databases.
+		// Returns whether initialization was successful or not.
+		bool initialize(iallocator& allocator, const database_budget_settings& settings, uint32_t max_num_databases = 64);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if the budget manager is initialized, false otherwise.
+		bool is_initialized() const { return m_allocator != nullptr; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Releases the memory and resets the manager to its default constructed state.
+		// Registered contexts retain their data.
+		void reset();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Registers an initialized database context, its streaming is then driven by the manager.
+		// Returns whether registration was successful or not.
+		bool register_database(database_context<database_settings_type>& context);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Unregisters a database context. Its chunks are left as they are.
+		void unregister_database(database_context<database_settings_type>& context);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of registered database contexts.
+		uint32_t get_num_databases() const { return m_num_databases; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of bytes that can be resident.
+		uint64_t get_budget_size() const { return m_settings.budget_size; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Changes the number of bytes that can be resident, takes effect on the next update.
+		void set_budget_size(uint64_t budget_size) { m_settings.budget_size = budget_size; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Advances the usage clock of every registered context and issues the stream in and stream out requests
+		// needed to remain within the budget. Typically called once per frame.
+		void update();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the statistics accumulated since initialization.
+		const database_budget_stats& get_stats() const { return m_stats; }
+
+	private:
+		database_budget_manager(const database_budget_manager& other) = delete;
+		database_budget_manager& operator=(const database_budget_manager& other) = delete;
+
+		// Streams out the least recently used clips until we fit within our budget
+		uint64_t evict_clips(uint32_t num_entries, uint64_t resident_size);
+
+		// Streams in the most recently used clips while they fit within our budget
+		uint64_t stream_in_clips(uint32_t num_entries, uint64_t resident_size);
+
+		iallocator*										m_allocator;
+		database_context<database_settings_type>**		m_databases;
+		acl_impl::database_budget_clip_entry*			m_clip_entries;
+
+		database_budget_settings						m_settings;
+		database_budget_stats							m_stats;
+
+		uint32_t										m_max_num_databases;
+		uint32_t										m_num_databases;
+		uint32_t										m_num_clip_entries;		// Capacity of m_clip_entries
+
+		static_assert(database_settings_type::is_clip_usage_tracking_supported(), "The budget manager requires clip usage tracking");
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/decompression/database/impl/database_budget_manager.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -53,6 +53,13 @@ namespace acl
 		// versions which yields optimal performance.
 		// Must be static constexpr!
 		static constexpr compressed_tracks_version16 version_supported() { return compressed_tracks_version16::any; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not decompression records when each clip was last seeked.
+		// This is required by the database_budget_manager to find the least recently used clips.
+		// Disabling it saves a store when seeking.
+		// Must be static constexpr!
+		static constexpr bool is_clip_usage_tracking_supported() { return true; }
 	};
 
 	//////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,7 @@
 
 #include "acl/version.h"
 #include "acl/core/quality_tiers.h"
+#include "acl/core/impl/atomic.impl.h"
 #include "acl/core/impl/compiler_utils.h"
 
 #include <cstdint>
@@ -52,17 +53,32 @@ namespace acl
 
 	//////////////////////////////////////////////////////////////////////////
 	// A streaming request
+	//
+	// Requests are built by the thread that issues streaming requests and completed by
+	// the streamer, possibly from another thread. A request is published once its fields
+	// are written and it is released once the streamer is done with it, the other fields
+	// must only be accessed while it is in flight.
 	//////////////////////////////////////////////////////////////////////////
 	struct streaming_request
 	{
 		streaming_action		action = streaming_action::stream_in;
-		quality_tier			tier = quality_tier::highest_importance;	// Marks the request as invalid since we never stream the highest tier
+		quality_tier			tier = quality_tier::highest_importance;
 		uint32_t				first_chunk_index = 0;
 		uint32_t				num_streaming_chunks = 0;
 		uint32_t				generation_id = 0;
 
-		bool is_valid() const { return tier != quality_tier::highest_importance; }
-		void reset() { tier = quality_tier::highest_importance; }
+		// Stream out requests are deferred until no decompression scope can read their chunks
+		uint32_t				offset = 0;
+		uint32_t				size = 0;
+		uint32_t				retire_epoch = 0;
+		bool					can_deallocate_bulk_data = false;
+		bool					is_deferred = false;
+
+		std::atomic<bool>		is_in_flight = { false };
+
+		bool is_valid() const { return is_in_flight.load(acl_impl::k_memory_order_acquire); }
+		void publish() { is_in_flight.store(true, acl_impl::k_memory_order_release); }
+		void reset() { is_in_flight.store(false, acl_impl::k_memory_order_release); }
 	};
 
 	//////////////////////////////////////////////////////////////////////////
@@ -85,8 +101,8 @@ namespace acl
 	// The base class for database streamers.
 	//
 	// Streamer implementations are responsible for allocating/freeing the bulk data as well as
-	// streaming the data in/out. Streaming in is safe from any thread but streaming out
-	// cannot happen while decompression is in progress otherwise the behavior is undefined.
+	// streaming the data in/out. Streaming in is safe from any thread. Stream out requests are
+	// only issued once no decompression scope can read their chunks, see database_decompression_scope.
 	// A single streamer instance can be shared between all quality tiers of a database.
 	// Streamers cannot be shared by multiple databases.
 	// A streamer implementation must also provide a list of streaming requests to use and
@@ -112,7 +128,9 @@ namespace acl
 
 		//////////////////////////////////////////////////////////////////////////
 		// Called when we request some data to be streamed in.
-		// Only one stream in/out request can be in flight at a time per quality tier.
+		// Multiple stream in/out requests can be in flight at a time per quality tier, one per
+		// streaming request provided, and they can complete in any order. The first stream in
+		// request of a tier completes before any other is issued.
 		// Streaming in animation data can be done while animations are decompressing (async).
 		//
 		// The offset into the bulk data and the size in bytes to stream in are provided as arguments.
@@ -124,9 +142,10 @@ namespace acl
 
 		//////////////////////////////////////////////////////////////////////////
 		// Called when we request some data to be streamed out.
-		// Only one stream in/out request can be in flight at a time per quality tier.
-		// Streaming out animation data cannot be done while animations are decompressing.
-		// Doing so will result in undefined behavior as the data could be in use while we stream it out.
+		// Multiple stream in/out requests can be in flight at a time per quality tier and they can complete in any order.
+		// When the bulk data can be deallocated, no other request is in flight for that tier.
+		// The chunks are no longer used by decompression scopes when this is called. Decompression
+		// outside of a scope while streaming out results in undefined behavior, see database_decompression_scope.
 		//
 		// The offset into the bulk data and the size in bytes to stream out are provided as arguments.
 		// On the last stream out request, the bulk data can be deallocated. It will be allocated again
@@ -146,6 +165,14 @@ namespace acl
 		// Signifies that the streamer will not complete this streaming request.
 		void cancel(streaming_request_id request_id);
 
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether the chunks of a stream in request match the hashes stored in the
+		// database when it was built. Hashing runs at memory speed, a few microseconds per chunk.
+		// It can be called from any thread once the data is in the bulk data and before calling
+		// complete(..). Cancel the request instead when the data is corrupted.
+		// Databases built with older versions do not contain chunk hashes, their chunks are always valid.
+		bool verify(streaming_request_id request_id) const;
+
 	protected:
 		//////////////////////////////////////////////////////////////////////////
 		// Constructs the database streamer.
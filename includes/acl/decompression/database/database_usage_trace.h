@@ -0,0 +1,137 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/database_clip_co_usage.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/database/database.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Records which clips of a database are used together by decompression.
+	//
+	// Once per frame, after seeking and before the usage clock of the context advances
+	// (see database_context::advance_usage_clock() and database_budget_manager::update()),
+	// record(context) samples the clips seeked during the frame. Every pair of clips
+	// sampled together increments the weight of their co-usage edge.
+	// The resulting graph can be provided to build_database through
+	// compression_database_settings::clip_co_usage to lay out clips used together
+	// within the same chunks.
+	//
+	// A trace only holds edges for a single database, clips are indexed in the order
+	// they were provided to build_database. When the trace is full, new edges are dropped.
+	// Recording is meant to be enabled during a profiling session, it isn't thread safe.
+	//////////////////////////////////////////////////////////////////////////
+	class database_usage_trace
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs an empty trace instance.
+		database_usage_trace();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Destructs a trace instance and releases its memory.
+		~database_usage_trace();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Initializes the trace to hold up to the specified number of edges.
+		// Samples are truncated to the specified number of clips.
+		// Returns whether initialization was successful or not.
+		bool initialize(iallocator& allocator, uint32_t max_num_edges = 16 * 1024, uint32_t max_num_clips_per_sample = 64);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if the trace is initialized, false otherwise.
+		bool is_initialized() const { return m_allocator != nullptr; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Releases the memory and resets the trace to its default constructed state.
+		void reset();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Removes every recorded edge and sample.
+		void clear();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Samples the clips seeked since the usage clock of the context last advanced.
+		// Requires clip usage tracking, see database_settings::is_clip_usage_tracking_supported().
+		template<class database_settings_type>
+		void record(const database_context<database_settings_type>& context);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Records a sample made of the provided clips, used together.
+		void record_clips(const uint32_t* clip_indices, uint32_t num_clips);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of samples recorded.
+		uint32_t get_num_samples() const { return m_num_samples; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of edges recorded.
+		uint32_t get_num_edges() const { return m_num_edges; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of pairs of clips dropped because the trace was full.
+		uint32_t get_num_dropped_edges() const { return m_num_dropped_edges; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes up to 'max_num_edges' edges, heaviest first, and returns how many were written.
+		uint32_t get_edges(database_clip_co_usage* out_edges, uint32_t max_num_edges) const;
+
+	private:
+		database_usage_trace(const database_usage_trace& other) = delete;
+		database_usage_trace& operator=(const database_usage_trace& other) = delete;
+
+		// Increments the weight of an edge, returns false if the trace is full
+		bool add_edge(uint32_t clip_index0, uint32_t clip_index1);
+
+		// Open addressing hash table of edges, empty slots have a weight of zero
+		database_clip_co_usage*		m_edges;
+		uint32_t*					m_sample_clip_indices;		// Scratch buffer used when recording a context
+		iallocator*					m_allocator;
+
+		uint32_t					m_num_slots;				// Power of two
+		uint32_t					m_max_num_edges;
+		uint32_t					m_max_num_clips_per_sample;
+
+		uint32_t					m_num_edges;
+		uint32_t					m_num_samples;
+		uint32_t					m_num_dropped_edges;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/decompression/database/impl/database_usage_trace.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
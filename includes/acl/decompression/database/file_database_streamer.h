@@ -0,0 +1,868 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/bulk_data_codec.h"
+#include "acl/core/compressed_database.h"
+#include "acl/core/error.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/database/database_streamer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#if !defined(_WIN32)
+	#include <cerrno>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Settings that control how the file database streamer reads its bulk data.
+	//////////////////////////////////////////////////////////////////////////
+	struct file_database_streamer_settings
+	{
+		// How many worker threads perform the reads.
+		uint32_t num_worker_threads = 2;
+
+		// How many reads can be queued or in flight at the same time, at most 64.
+		// Stream in requests beyond this are canceled.
+		uint32_t max_num_pending_reads = 8;
+
+		// How many bytes can be queued or in flight at the same time.
+		// Stream in requests beyond this are canceled unless nothing else is pending.
+		uint32_t max_num_pending_bytes = 32 * 1024 * 1024;
+
+		// Queued reads of adjacent ranges are merged into a single read up to this size.
+		uint32_t max_coalesced_read_size = 4 * 1024 * 1024;
+
+		// Whether or not to bypass the OS file cache (O_DIRECT on Linux, F_NOCACHE on Apple platforms).
+		// Reads and the bulk data are then padded to k_direct_io_alignment.
+		// Ignored where it isn't supported.
+		bool use_direct_io = false;
+
+		// Whether or not the bulk data file was compressed with compress_database_bulk_data(..).
+		// The compressed chunks of each request are read into a temporary buffer and decompressed
+		// on the worker thread before the request completes. Requests are then not coalesced
+		// and direct IO isn't used.
+		// The allocator is only used by the thread that issues streaming requests: the temporary
+		// buffers of completed reads are freed by the next stream_in(..) or stream_out(..) call,
+		// or when the streamer is destroyed. Up to one buffer per pending read can remain allocated.
+		bool is_bulk_data_compressed = false;
+
+		// Whether or not to verify the hash of every chunk once it has been read, see database_streamer::verify(..).
+		// Requests with corrupted chunks are canceled. Hashing runs on the worker threads.
+		bool verify_chunks = false;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Counters accumulated by the file database streamer.
+	//////////////////////////////////////////////////////////////////////////
+	struct file_database_streamer_stats
+	{
+		uint64_t num_requests = 0;				// Stream in requests queued
+		uint64_t num_rejected_requests = 0;		// Stream in requests canceled because too many reads were pending
+		uint64_t num_completed_requests = 0;	// Stream in requests whose read succeeded or failed
+		uint64_t num_failed_requests = 0;		// Stream in requests canceled because the read failed
+		uint64_t num_reads = 0;					// Reads performed, after coalescing adjacent requests
+		uint64_t num_bytes_read = 0;
+		uint64_t total_read_time_ns = 0;		// Sum of the time every read took
+		uint64_t total_latency_ns = 0;			// Sum of the time every request took from being queued to completing
+		uint64_t max_latency_ns = 0;
+		uint64_t total_decompression_time_ns = 0;	// Sum of the time spent decompressing chunks, when the bulk data is compressed
+		uint64_t num_corrupted_requests = 0;		// Stream in requests canceled because their chunks failed verification
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the average time in milliseconds a request took from being queued to completing.
+		double get_average_latency_ms() const { return num_completed_requests != 0 ? (double(total_latency_ns) / double(num_completed_requests)) * 1.0E-6 : 0.0; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the average read throughput of a single worker thread in MB/sec.
+		double get_read_throughput_mb_per_sec() const { return total_read_time_ns != 0 ? (double(num_bytes_read) / (1024.0 * 1024.0)) / (double(total_read_time_ns) * 1.0E-9) : 0.0; }
+	};
+
+	// Offsets, sizes, and buffers are aligned to this value when using direct IO
+	constexpr uint32_t k_direct_io_alignment = 4096;
+
+	namespace acl_impl
+	{
+		// Called from a worker thread once a read completes or fails
+		using async_read_callback = void (*)(void* user_context, uint64_t user_data, bool success);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Reads ranges of a file into memory with a pool of worker threads.
+		// Each read is written in place into the provided buffer at its file offset.
+		//////////////////////////////////////////////////////////////////////////
+		class async_file_reader
+		{
+		public:
+			static constexpr uint32_t k_max_num_pending_reads = 64;
+
+			async_file_reader(iallocator& allocator, const file_database_streamer_settings& settings, async_read_callback callback, void* user_context)
+				: m_allocator(allocator)
+				, m_settings(settings)
+				, m_callback(callback)
+				, m_user_context(user_context)
+				, m_threads(nullptr)
+				, m_num_threads(0)
+#if defined(_WIN32)
+				, m_files(nullptr)
+#else
+				, m_fd(-1)
+#endif
+				, m_num_pending_reads(0)
+				, m_num_in_flight_reads(0)
+				, m_num_pending_bytes(0)
+				, m_is_stopping(false)
+				, m_stats()
+			{
+				m_settings.num_worker_threads = std::max<uint32_t>(m_settings.num_worker_threads, 1);
+				m_settings.max_num_pending_reads = std::min<uint32_t>(std::max<uint32_t>(m_settings.max_num_pending_reads, 1), k_max_num_pending_reads);
+#if !defined(O_DIRECT) && !defined(__APPLE__)
+				m_settings.use_direct_io = false;	// Not supported
+#endif
+			}
+
+			~async_file_reader() { close(); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Opens the file and starts the worker threads.
+			// Returns true on success.
+			bool open(const char* filename)
+			{
+				ACL_ASSERT(!is_open(), "File already open");
+				ACL_ASSERT(filename != nullptr, "Filename cannot be null");
+				if (is_open() || filename == nullptr)
+					return false;
+
+				const uint32_t num_threads = m_settings.num_worker_threads;
+
+#if defined(_WIN32)
+				// Each worker uses its own file handle to seek independently
+				m_files = allocate_type_array<std::FILE*>(m_allocator, num_threads);
+				for (uint32_t thread_index = 0; thread_index < num_threads; ++thread_index)
+				{
+					std::FILE* file = nullptr;
+					fopen_s(&file, filename, "rb");
+					m_files[thread_index] = file;
+
+					if (file == nullptr)
+					{
+						close();
+						return false;
+					}
+				}
+#else
+				int flags = O_RDONLY | O_CLOEXEC;
+#if defined(O_DIRECT)
+				if (m_settings.use_direct_io)
+					flags |= O_DIRECT;
+#endif
+
+				m_fd = ::open(filename, flags);
+				if (m_fd < 0)
+					return false;
+
+#if defined(__APPLE__)
+				if (m_settings.use_direct_io)
+					(void)fcntl(m_fd, F_NOCACHE, 1);
+#endif
+#endif
+
+				m_is_stopping = false;
+				m_threads = allocate_type_array<std::thread>(m_allocator, num_threads);
+				m_num_threads = num_threads;
+				for (uint32_t thread_index = 0; thread_index < num_threads; ++thread_index)
+					m_threads[thread_index] = std::thread(&async_file_reader::worker_main, this, thread_index);
+
+				return true;
+			}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Waits for every pending read to complete, stops the worker threads, and closes the file.
+			void close()
+			{
+				if (m_threads != nullptr)
+				{
+					{
+						std::unique_lock<std::mutex> lock(m_mutex);
+						m_idle_cv.wait(lock, [this]() { return m_num_pending_reads == 0 && m_num_in_flight_reads == 0; });
+						m_is_stopping = true;
+					}
+
+					m_work_cv.notify_all();
+
+					for (uint32_t thread_index = 0; thread_index < m_num_threads; ++thread_index)
+						m_threads[thread_index].join();
+
+					deallocate_type_array(m_allocator, m_threads, m_num_threads);
+					m_threads = nullptr;
+					m_num_threads = 0;
+				}
+
+#if defined(_WIN32)
+				if (m_files != nullptr)
+				{
+					for (uint32_t thread_index = 0; thread_index < m_settings.num_worker_threads; ++thread_index)
+					{
+						if (m_files[thread_index] != nullptr)
+							std::fclose(m_files[thread_index]);
+					}
+
+					deallocate_type_array(m_allocator, m_files, m_settings.num_worker_threads);
+					m_files = nullptr;
+				}
+#else
+				if (m_fd >= 0)
+				{
+					::close(m_fd);
+					m_fd = -1;
+				}
+#endif
+			}
+
+			bool is_open() const { return m_threads != nullptr; }
+			bool uses_direct_io() const { return m_settings.use_direct_io; }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Queues a read of 'size' bytes at 'offset' in the file into 'buffer + offset - buffer_offset'.
+			// The buffer holds the file starting at 'buffer_offset' which must not be greater than the offset.
+			// The callback is called with the user data from a worker thread once it completes.
+			// Returns false if too many reads are pending, the callback is then never called.
+			// When using direct IO, the buffer must be aligned to k_direct_io_alignment and
+			// padded to contain the read rounded outward to it.
+			bool try_enqueue(uint8_t* buffer, uint32_t offset, uint32_t size, uint64_t user_data, uint32_t buffer_offset = 0)
+			{
+				ACL_ASSERT(is_open(), "File isn't open");
+				ACL_ASSERT(buffer != nullptr, "Buffer cannot be null");
+				ACL_ASSERT(buffer_offset <= offset, "Read starts before the buffer");
+				ACL_ASSERT(!m_settings.use_direct_io || buffer_offset == 0, "Direct IO reads into the whole file");
+				ACL_ASSERT(!m_settings.use_direct_io || is_aligned_to(buffer, k_direct_io_alignment), "Buffer must be aligned for direct IO");
+
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+
+					m_stats.num_requests++;
+
+					const uint32_t num_reads = m_num_pending_reads + m_num_in_flight_reads;
+					const bool has_too_many_reads = num_reads >= m_settings.max_num_pending_reads;
+					const bool has_too_many_bytes = num_reads != 0 && (uint64_t(m_num_pending_bytes) + size) > m_settings.max_num_pending_bytes;
+					if (!is_open() || has_too_many_reads || has_too_many_bytes)
+					{
+						m_stats.num_rejected_requests++;
+						return false;
+					}
+
+					pending_read& read = m_pending_reads[m_num_pending_reads++];
+					read.buffer = buffer;
+					read.buffer_offset = buffer_offset;
+					read.offset = offset;
+					read.size = size;
+					read.user_data = user_data;
+					read.queue_time = std::chrono::steady_clock::now();
+
+					m_num_pending_bytes += size;
+				}
+
+				m_work_cv.notify_one();
+				return true;
+			}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Blocks until every pending read has completed.
+			void wait_idle()
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_idle_cv.wait(lock, [this]() { return m_num_pending_reads == 0 && m_num_in_flight_reads == 0; });
+			}
+
+			file_database_streamer_stats get_stats() const
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				return m_stats;
+			}
+
+		private:
+			async_file_reader(const async_file_reader&) = delete;
+			async_file_reader& operator=(const async_file_reader&) = delete;
+
+			struct pending_read
+			{
+				uint8_t* buffer;
+				uint32_t buffer_offset;
+				uint32_t offset;
+				uint32_t size;
+				uint64_t user_data;
+				std::chrono::steady_clock::time_point queue_time;
+			};
+
+			// Removes the oldest pending read and merges every adjacent pending read into it
+			// Must be called with the lock held
+			uint32_t pop_coalesced_reads(pending_read* out_reads, uint32_t& out_offset, uint32_t& out_size)
+			{
+				out_reads[0] = m_pending_reads[0];
+				erase_pending_read(0);
+
+				uint8_t* buffer = out_reads[0].buffer;
+				uint32_t start_offset = out_reads[0].offset;
+				uint32_t end_offset = start_offset + out_reads[0].size;
+				uint32_t num_reads = 1;
+
+				bool found_adjacent_read;
+				do
+				{
+					found_adjacent_read = false;
+					for (uint32_t read_index = 0; read_index < m_num_pending_reads; ++read_index)
+					{
+						const pending_read& read = m_pending_reads[read_index];
+						if (read.buffer != buffer)
+							continue;	// Different tier or temporary buffer
+
+						if ((end_offset - start_offset) + read.size > m_settings.max_coalesced_read_size)
+							continue;	// Too large
+
+						const uint32_t read_end_offset = read.offset + read.size;
+						if (read.offset == end_offset)
+							end_offset = read_end_offset;
+						else if (read_end_offset == start_offset)
+							start_offset = read.offset;
+						else
+							continue;	// Not adjacent
+
+						out_reads[num_reads++] = read;
+						erase_pending_read(read_index);
+						found_adjacent_read = true;
+						break;
+					}
+				} while (found_adjacent_read);
+
+				out_offset = start_offset;
+				out_size = end_offset - start_offset;
+				return num_reads;
+			}
+
+			void erase_pending_read(uint32_t read_index)
+			{
+				m_num_pending_bytes -= m_pending_reads[read_index].size;
+
+				// Keep the queue in FIFO order
+				for (uint32_t index = read_index + 1; index < m_num_pending_reads; ++index)
+					m_pending_reads[index - 1] = m_pending_reads[index];
+
+				m_num_pending_reads--;
+			}
+
+			// Reads into 'buffer + offset - buffer_offset', succeeds once at least 'size' bytes are read
+			bool read_file(uint32_t thread_index, uint8_t* buffer, uint32_t buffer_offset, uint32_t offset, uint32_t size)
+			{
+				uint64_t read_offset = offset;
+				uint64_t read_end_offset = uint64_t(offset) + size;
+				if (m_settings.use_direct_io)
+				{
+					// Direct IO requires aligned offsets and sizes, the last read is short at the end of the file
+					read_offset &= ~uint64_t(k_direct_io_alignment - 1);
+					read_end_offset = align_to(read_end_offset, k_direct_io_alignment);
+				}
+
+				const uint64_t required_end_offset = uint64_t(offset) + size;
+
+#if defined(_WIN32)
+				std::FILE* file = m_files[thread_index];
+				if (_fseeki64(file, int64_t(read_offset), SEEK_SET) != 0)
+					return false;
+
+				const size_t num_bytes_read = std::fread(buffer + (read_offset - buffer_offset), 1, size_t(read_end_offset - read_offset), file);
+				return read_offset + num_bytes_read >= required_end_offset;
+#else
+				(void)thread_index;
+
+				while (read_offset < required_end_offset)
+				{
+					const ssize_t num_bytes_read = pread(m_fd, buffer + (read_offset - buffer_offset), size_t(read_end_offset - read_offset), off_t(read_offset));
+					if (num_bytes_read < 0 && errno == EINTR)
+						continue;
+
+					if (num_bytes_read <= 0)
+						return false;	// Failed or reached the end of the file early
+
+					read_offset += uint64_t(num_bytes_read);
+				}
+
+				return true;
+#endif
+			}
+
+			void worker_main(uint32_t thread_index)
+			{
+				pending_read reads[k_max_num_pending_reads];
+
+				while (true)
+				{
+					uint32_t num_reads;
+					uint32_t offset;
+					uint32_t size;
+
+					{
+						std::unique_lock<std::mutex> lock(m_mutex);
+						m_work_cv.wait(lock, [this]() { return m_is_stopping || m_num_pending_reads != 0; });
+
+						if (m_num_pending_reads == 0)
+							return;	// Stopping and nothing left to do
+
+						num_reads = pop_coalesced_reads(reads, offset, size);
+						m_num_in_flight_reads += num_reads;
+					}
+
+					const std::chrono::steady_clock::time_point read_start_time = std::chrono::steady_clock::now();
+					const bool success = read_file(thread_index, reads[0].buffer, reads[0].buffer_offset, offset, size);
+					const std::chrono::steady_clock::time_point read_end_time = std::chrono::steady_clock::now();
+
+					for (uint32_t read_index = 0; read_index < num_reads; ++read_index)
+						m_callback(m_user_context, reads[read_index].user_data, success);
+
+					const std::chrono::steady_clock::time_point complete_time = std::chrono::steady_clock::now();
+
+					{
+						std::unique_lock<std::mutex> lock(m_mutex);
+
+						m_stats.num_reads++;
+						m_stats.num_completed_requests += num_reads;
+						m_stats.total_read_time_ns += uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(read_end_time - read_start_time).count());
+
+						if (success)
+							m_stats.num_bytes_read += size;
+						else
+							m_stats.num_failed_requests += num_reads;
+
+						for (uint32_t read_index = 0; read_index < num_reads; ++read_index)
+						{
+							const uint64_t latency_ns = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(complete_time - reads[read_index].queue_time).count());
+							m_stats.total_latency_ns += latency_ns;
+							m_stats.max_latency_ns = std::max<uint64_t>(m_stats.max_latency_ns, latency_ns);
+						}
+
+						m_num_in_flight_reads -= num_reads;
+					}
+
+					m_idle_cv.notify_all();
+				}
+			}
+
+			iallocator&						m_allocator;
+			file_database_streamer_settings	m_settings;
+			async_read_callback				m_callback;
+			void*							m_user_context;
+
+			std::thread*					m_threads;
+			uint32_t						m_num_threads;
+
+#if defined(_WIN32)
+			std::FILE**						m_files;			// One per worker thread
+#else
+			int								m_fd;
+#endif
+
+			mutable std::mutex				m_mutex;
+			std::condition_variable			m_work_cv;			// Signaled when reads are queued or when stopping
+			std::condition_variable			m_idle_cv;			// Signaled when reads complete
+
+			pending_read					m_pending_reads[k_max_num_pending_reads];	// FIFO
+			uint32_t						m_num_pending_reads;
+			uint32_t						m_num_in_flight_reads;
+			uint32_t						m_num_pending_bytes;
+			bool							m_is_stopping;
+
+			file_database_streamer_stats	m_stats;
+		};
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Implements a streamer that reads the bulk data file of a quality tier, as output by
+	// split_database_bulk_data(..), asynchronously with a pool of worker threads.
+	// This is suitable where memory mapping isn't (see mmap_database_streamer).
+	//
+	// The bulk data of the whole tier is allocated on the first stream in request and chunks are
+	// read in place with 'pread'. Stream requests are completed from the worker threads. Adjacent requests
+	// that are pending at the same time are coalesced into a single read. When too many
+	// requests are pending, new stream in requests are canceled and can be retried later.
+	// Stream out requests do not perform IO and complete immediately, the bulk data is only
+	// freed once the last chunks of the tier stream out. A budget manager counts the chunks
+	// that are resident, not this allocation (see database_budget_stats::bulk_data_size).
+	//
+	// Direct IO can optionally be used to bypass the OS file cache. Chunk offsets are then
+	// expected to be aligned to k_direct_io_alignment which holds if the database max chunk
+	// size is a multiple of it (the default is 1 MB).
+	//
+	// The bulk data file can also be compressed with compress_database_bulk_data(..), see
+	// file_database_streamer_settings::is_bulk_data_compressed. Its chunk table is read when
+	// the streamer is constructed and the bulk data size remains the decompressed size.
+	// Chunks can optionally be verified against their hash before requests complete.
+	//
+	// It cannot be shared between tiers.
+	////////////////////////////////////////////////////////////////////////////////
+	class file_database_streamer final : public database_streamer
+	{
+	public:
+		file_database_streamer(iallocator& allocator, const char* bulk_data_filename, uint32_t bulk_data_size, const file_database_streamer_settings& settings = file_database_streamer_settings())
+			: database_streamer(m_requests, std::min<uint32_t>(std::max<uint32_t>(settings.max_num_pending_reads, 1), k_max_num_requests))
+			, m_allocator(allocator)
+			, m_reader(allocator, get_reader_settings(settings), &file_database_streamer::on_read_completed, this)
+			, m_streamed_bulk_data(nullptr)
+			, m_bulk_data_size(bulk_data_size)
+			, m_allocated_bulk_data_size(m_reader.uses_direct_io() ? align_to(bulk_data_size, k_direct_io_alignment) : bulk_data_size)
+			, m_compressed_chunks(nullptr)
+			, m_num_compressed_chunks(0)
+			, m_is_bulk_data_compressed(settings.is_bulk_data_compressed)
+			, m_verify_chunks(settings.verify_chunks)
+			, m_decompression_time_ns(0)
+			, m_num_corrupted_requests(0)
+			, m_compressed_reads()
+		{
+			if (bulk_data_size != 0)
+			{
+				const bool is_open = m_reader.open(bulk_data_filename);
+				ACL_ASSERT(is_open, "Failed to open the bulk data file");
+				(void)is_open;
+
+				if (m_is_bulk_data_compressed)
+				{
+					const bool is_chunk_table_read = read_compressed_chunk_table(bulk_data_filename);
+					ACL_ASSERT(is_chunk_table_read, "Failed to read the compressed bulk data chunk table");
+					(void)is_chunk_table_read;
+				}
+			}
+		}
+
+		virtual ~file_database_streamer() override
+		{
+			// Wait for every read in flight before we free the bulk data
+			m_reader.close();
+
+			release_compressed_reads();
+
+			deallocate_type_array(m_allocator, m_compressed_chunks, m_num_compressed_chunks);
+			deallocate_type_array(m_allocator, m_streamed_bulk_data, m_allocated_bulk_data_size);
+		}
+
+		virtual bool is_initialized() const override { return m_bulk_data_size == 0 || (m_reader.is_open() && (!m_is_bulk_data_compressed || m_compressed_chunks != nullptr)); }
+
+		virtual const uint8_t* get_bulk_data(quality_tier tier) const override
+		{
+			ACL_ASSERT(tier != quality_tier::highest_importance, "Cannot stream the highest importance tier");
+			(void)tier;
+			return m_streamed_bulk_data;
+		}
+
+		virtual void stream_in(uint32_t offset, uint32_t size, bool can_allocate_bulk_data, quality_tier tier, streaming_request_id request_id) override
+		{
+			ACL_ASSERT(offset < m_bulk_data_size, "Stream offset is outside of the bulk data range");
+			ACL_ASSERT(size <= m_bulk_data_size, "Stream size is larger than the bulk data size");
+			ACL_ASSERT(uint64_t(offset) + uint64_t(size) <= uint64_t(m_bulk_data_size), "Streaming request is outside of the bulk data range");
+			(void)tier;
+
+			// A canceled first request leaves the bulk data allocated, we can reuse it
+			if (can_allocate_bulk_data && m_streamed_bulk_data == nullptr)
+			{
+				const size_t alignment = m_reader.uses_direct_io() ? k_direct_io_alignment : k_database_bulk_data_alignment;
+				m_streamed_bulk_data = allocate_type_array_aligned<uint8_t>(m_allocator, m_allocated_bulk_data_size, alignment);
+			}
+
+			if (m_is_bulk_data_compressed)
+			{
+				stream_in_compressed(offset, size, request_id);
+				return;
+			}
+
+			if (!m_reader.try_enqueue(m_streamed_bulk_data, offset, size, request_id.value))
+				cancel(request_id);	// Too many pending reads, try again later
+		}
+
+		virtual void stream_out(uint32_t offset, uint32_t size, bool can_deallocate_bulk_data, quality_tier tier, streaming_request_id request_id) override
+		{
+			ACL_ASSERT(offset < m_bulk_data_size, "Stream offset is outside of the bulk data range");
+			ACL_ASSERT(size <= m_bulk_data_size, "Stream size is larger than the bulk data size");
+			ACL_ASSERT(uint64_t(offset) + uint64_t(size) <= uint64_t(m_bulk_data_size), "Streaming request is outside of the bulk data range");
+			(void)offset;
+			(void)size;
+			(void)tier;
+
+			if (can_deallocate_bulk_data)
+			{
+				ACL_ASSERT(m_streamed_bulk_data != nullptr, "Bulk data already deallocated");
+
+				// Make sure no read is still writing into our bulk data
+				m_reader.wait_idle();
+
+				deallocate_type_array(m_allocator, m_streamed_bulk_data, m_allocated_bulk_data_size);
+				m_streamed_bulk_data = nullptr;
+			}
+
+			release_compressed_reads();
+
+			complete(request_id);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a snapshot of the read counters.
+		file_database_streamer_stats get_stats() const
+		{
+			file_database_streamer_stats stats = m_reader.get_stats();
+			stats.total_decompression_time_ns = m_decompression_time_ns.load(std::memory_order_relaxed);
+			stats.num_corrupted_requests = m_num_corrupted_requests.load(std::memory_order_relaxed);
+			return stats;
+		}
+
+	private:
+		file_database_streamer(const file_database_streamer&) = delete;
+		file_database_streamer& operator=(const file_database_streamer&) = delete;
+
+		// A read of compressed chunks into a temporary buffer
+		// The temporary buffer is allocated and freed by the thread that issues stream requests
+		struct compressed_read
+		{
+			uint8_t* buffer = nullptr;
+			uint32_t buffer_size = 0;
+			uint32_t first_chunk_index = 0;
+			uint32_t num_chunks = 0;
+			streaming_request_id request_id = k_invalid_streamer_request_id;
+
+			bool is_used = false;						// Only accessed by the thread that issues stream requests
+			std::atomic<bool> is_done = { false };		// Set by the worker thread once the buffer is no longer needed
+		};
+
+		static file_database_streamer_settings get_reader_settings(const file_database_streamer_settings& settings)
+		{
+			file_database_streamer_settings reader_settings = settings;
+			if (settings.is_bulk_data_compressed)
+				reader_settings.use_direct_io = false;	// Compressed chunks aren't aligned
+			return reader_settings;
+		}
+
+		bool read_compressed_chunk_table(const char* bulk_data_filename)
+		{
+			std::FILE* file = nullptr;
+#if defined(_WIN32)
+			fopen_s(&file, bulk_data_filename, "rb");
+#else
+			file = std::fopen(bulk_data_filename, "rb");
+#endif
+			if (file == nullptr)
+				return false;
+
+			acl_impl::compressed_bulk_data_header header;
+			bool is_valid = std::fread(&header, sizeof(header), 1, file) == 1;
+			is_valid = is_valid && header.tag == buffer_tag32::compressed_bulk_data && header.bulk_data_size == m_bulk_data_size;
+
+			if (is_valid && header.num_chunks != 0)
+			{
+				acl_impl::compressed_bulk_data_chunk* chunks = allocate_type_array<acl_impl::compressed_bulk_data_chunk>(m_allocator, header.num_chunks);
+				is_valid = std::fread(chunks, sizeof(acl_impl::compressed_bulk_data_chunk), header.num_chunks, file) == header.num_chunks;
+
+				for (uint32_t chunk_index = 0; is_valid && chunk_index < header.num_chunks; ++chunk_index)
+				{
+					const acl_impl::compressed_bulk_data_chunk& chunk = chunks[chunk_index];
+					is_valid = uint64_t(chunk.bulk_data_offset) + chunk.size <= m_bulk_data_size
+						&& uint64_t(chunk.compressed_offset) + chunk.compressed_size <= header.compressed_bulk_data_size
+						&& (chunk_index == 0 || chunk.bulk_data_offset > chunks[chunk_index - 1].bulk_data_offset);
+				}
+
+				if (is_valid)
+				{
+					m_compressed_chunks = chunks;
+					m_num_compressed_chunks = header.num_chunks;
+				}
+				else
+					deallocate_type_array(m_allocator, chunks, header.num_chunks);
+			}
+
+			std::fclose(file);
+			return is_valid && m_compressed_chunks != nullptr;
+		}
+
+		void stream_in_compressed(uint32_t offset, uint32_t size, streaming_request_id request_id)
+		{
+			release_compressed_reads();
+
+			// Find the chunks that make up the request, they are sorted by their offset
+			const acl_impl::compressed_bulk_data_chunk* chunks = m_compressed_chunks;
+			const acl_impl::compressed_bulk_data_chunk* chunks_end = chunks + m_num_compressed_chunks;
+			const acl_impl::compressed_bulk_data_chunk* first_chunk = std::lower_bound(chunks, chunks_end, offset,
+				[](const acl_impl::compressed_bulk_data_chunk& chunk, uint32_t chunk_offset) { return chunk.bulk_data_offset < chunk_offset; });
+
+			const uint64_t end_offset = uint64_t(offset) + size;
+			const acl_impl::compressed_bulk_data_chunk* last_chunk = first_chunk;
+			while (last_chunk + 1 < chunks_end && last_chunk[1].bulk_data_offset < end_offset)
+				last_chunk++;
+
+			ACL_ASSERT(first_chunk != chunks_end && first_chunk->bulk_data_offset == offset, "Stream offset doesn't match a chunk");
+			if (first_chunk == chunks_end || first_chunk->bulk_data_offset != offset)
+			{
+				cancel(request_id);
+				return;
+			}
+
+			compressed_read* read = nullptr;
+			for (compressed_read& read_entry : m_compressed_reads)
+			{
+				if (!read_entry.is_used)
+				{
+					read = &read_entry;
+					break;
+				}
+			}
+
+			if (read == nullptr)
+			{
+				cancel(request_id);	// Too many pending reads, try again later
+				return;
+			}
+
+			// Chunks are compressed back to back
+			const uint32_t read_offset = first_chunk->compressed_offset;
+			const uint32_t read_size = (last_chunk->compressed_offset + last_chunk->compressed_size) - read_offset;
+
+			read->buffer = allocate_type_array<uint8_t>(m_allocator, read_size);
+			read->buffer_size = read_size;
+			read->first_chunk_index = uint32_t(first_chunk - chunks);
+			read->num_chunks = uint32_t(last_chunk - first_chunk) + 1;
+			read->request_id = request_id;
+			read->is_used = true;
+			read->is_done.store(false, std::memory_order_relaxed);
+
+			const uint64_t read_index = uint64_t(read - &m_compressed_reads[0]);
+			if (!m_reader.try_enqueue(read->buffer, read_offset, read_size, read_index, read_offset))
+			{
+				// Too many pending reads, try again later
+				deallocate_type_array(m_allocator, read->buffer, read->buffer_size);
+				read->buffer = nullptr;
+				read->is_used = false;
+
+				cancel(request_id);
+			}
+		}
+
+		// Frees the temporary buffers of the compressed reads that completed
+		// Worker threads don't free them since the allocator might not be thread safe
+		void release_compressed_reads()
+		{
+			for (compressed_read& read : m_compressed_reads)
+			{
+				if (read.is_used && read.is_done.load(std::memory_order_acquire))
+				{
+					deallocate_type_array(m_allocator, read.buffer, read.buffer_size);
+					read.buffer = nullptr;
+					read.is_used = false;
+				}
+			}
+		}
+
+		// Called from a worker thread
+		bool decompress_chunks(const compressed_read& read)
+		{
+			const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+			const acl_impl::compressed_bulk_data_chunk* chunks = m_compressed_chunks + read.first_chunk_index;
+			const uint32_t read_offset = chunks[0].compressed_offset;
+
+			bool is_valid = true;
+			for (uint32_t chunk_index = 0; is_valid && chunk_index < read.num_chunks; ++chunk_index)
+			{
+				const acl_impl::compressed_bulk_data_chunk& chunk = chunks[chunk_index];
+				is_valid = acl_impl::decompress_bulk_data_chunk(chunk, read.buffer + (chunk.compressed_offset - read_offset), m_streamed_bulk_data);
+			}
+
+			const std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
+			m_decompression_time_ns.fetch_add(uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count()), std::memory_order_relaxed);
+
+			return is_valid;
+		}
+
+		static void on_read_completed(void* user_context, uint64_t user_data, bool success)
+		{
+			file_database_streamer* streamer = static_cast<file_database_streamer*>(user_context);
+
+			streaming_request_id request_id = { user_data };
+			if (streamer->m_is_bulk_data_compressed)
+			{
+				compressed_read& read = streamer->m_compressed_reads[user_data];
+				request_id = read.request_id;
+
+				// Decompress before we complete, the bulk data must be ready to use
+				success = success && streamer->decompress_chunks(read);
+
+				// The read can be reused as soon as it is done, don't touch it after
+				read.is_done.store(true, std::memory_order_release);
+			}
+
+			if (success && streamer->m_verify_chunks && !streamer->verify(request_id))
+			{
+				streamer->m_num_corrupted_requests.fetch_add(1, std::memory_order_relaxed);
+				success = false;
+			}
+
+			if (success)
+				streamer->complete(request_id);
+			else
+				streamer->cancel(request_id);
+		}
+
+		static constexpr uint32_t k_max_num_requests = acl_impl::async_file_reader::k_max_num_pending_reads;
+
+		iallocator& m_allocator;
+		acl_impl::async_file_reader m_reader;
+		uint8_t* m_streamed_bulk_data;
+		uint32_t m_bulk_data_size;
+		uint32_t m_allocated_bulk_data_size;
+
+		acl_impl::compressed_bulk_data_chunk* m_compressed_chunks;	// Sorted by their bulk data offset
+		uint32_t m_num_compressed_chunks;
+		bool m_is_bulk_data_compressed;
+		bool m_verify_chunks;
+		std::atomic<uint64_t> m_decompression_time_ns;
+		std::atomic<uint64_t> m_num_corrupted_requests;
+
+		streaming_request m_requests[k_max_num_requests];
+		compressed_read m_compressed_reads[k_max_num_requests];
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
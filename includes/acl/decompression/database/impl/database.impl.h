@@ -45,28 +45,188 @@ namespace acl
 		{
 			const database_header& header = get_database_header(database);
 
-			const uint32_t num_medium_chunks = header.num_chunks[0];
-			const uint32_t num_low_chunks = header.num_chunks[1];
 			const uint32_t num_clips = header.num_clips;
 			const uint32_t num_segments = header.num_segments;
 
-			const bitset_description medium_desc = bitset_description::make_from_num_bits(num_medium_chunks);
-			const bitset_description low_desc = bitset_description::make_from_num_bits(num_low_chunks);
+			uint32_t runtime_data_size = 0;
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const uint32_t bitset_size = bitset_description::make_from_num_bits(header.num_chunks[tier_index]).get_num_bytes();
+
+				runtime_data_size += bitset_size;				// Loaded chunks
+				runtime_data_size += bitset_size;				// Streaming chunks
+			}
 
-			const uint32_t medium_bitset_size = medium_desc.get_num_bytes();
-			const uint32_t low_bitset_size = low_desc.get_num_bytes();
+			if (header.get_has_clip_chunk_ranges())
+			{
+				const uint32_t clip_bitset_size = bitset_description::make_from_num_bits(num_clips).get_num_bytes();
 
-			uint32_t runtime_data_size = 0;
-			runtime_data_size += medium_bitset_size;			// Loaded chunks
-			runtime_data_size += medium_bitset_size;			// Streaming chunks
-			runtime_data_size += low_bitset_size;				// Loaded chunks
-			runtime_data_size += low_bitset_size;				// Streaming chunks
+				for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				{
+					runtime_data_size += header.num_chunks[tier_index] * sizeof(uint32_t);	// Chunk reference counts
+					runtime_data_size += clip_bitset_size;									// Requested clips
+				}
+			}
+
+			runtime_data_size += num_clips * sizeof(uint32_t);	// Clip last use timestamps
 			runtime_data_size = align_to(runtime_data_size, 8);	// Align runtime headers
 			runtime_data_size += num_clips * sizeof(database_runtime_clip_header);
 			runtime_data_size += num_segments * sizeof(database_runtime_segment_header);
+			runtime_data_size = align_to(runtime_data_size, 64);	// Align epoch readers to a cache line
+			runtime_data_size += 2 * sizeof(database_epoch_readers);
 
 			return runtime_data_size;
 		}
+
+		// Sets up the loaded and streaming chunk bit sets of every tier at the start of the runtime data
+		// Returns the runtime data that follows them
+		inline uint8_t* setup_chunk_bitsets(database_context_v0& context, const database_header& header, uint8_t* runtime_data_buffer)
+		{
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const uint32_t bitset_size = bitset_description::make_from_num_bits(header.num_chunks[tier_index]).get_num_bytes();
+
+				context.loaded_chunks[tier_index] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
+				runtime_data_buffer += bitset_size;
+
+				context.streaming_chunks[tier_index] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
+				runtime_data_buffer += bitset_size;
+			}
+
+			return runtime_data_buffer;
+		}
+
+		// Sets up the per clip streaming data and the runtime clip headers that follow the chunk bit sets
+		inline void setup_clip_runtime_data(database_context_v0& context, const database_header& header, uint8_t* runtime_data_buffer)
+		{
+			const uint32_t num_clips = header.num_clips;
+
+			if (header.get_has_clip_chunk_ranges())
+			{
+				const uint32_t clip_bitset_size = bitset_description::make_from_num_bits(num_clips).get_num_bytes();
+
+				for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				{
+					context.chunk_ref_counts[tier_index] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
+					runtime_data_buffer += header.num_chunks[tier_index] * sizeof(uint32_t);
+
+					context.requested_clips[tier_index] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
+					runtime_data_buffer += clip_bitset_size;
+				}
+			}
+			else
+			{
+				// Older databases do not contain the chunks of each clip, we cannot stream per clip
+				for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				{
+					context.chunk_ref_counts[tier_index] = nullptr;
+					context.requested_clips[tier_index] = nullptr;
+				}
+			}
+
+			context.clip_last_use_timestamps = reinterpret_cast<uint32_t*>(runtime_data_buffer);
+			runtime_data_buffer += num_clips * sizeof(uint32_t);
+
+			context.usage_timestamp.store(1, k_memory_order_relaxed);	// Zero is reserved for clips that were never used
+
+			context.clip_segment_headers = align_to(runtime_data_buffer, 8);	// Align runtime headers
+
+			// Our epoch readers follow the runtime headers, we only need two since we wait for the
+			// readers of the previous epoch to leave before starting a new one
+			const uint32_t runtime_headers_size = (num_clips * sizeof(database_runtime_clip_header)) + (header.num_segments * sizeof(database_runtime_segment_header));
+			context.epoch_readers = reinterpret_cast<database_epoch_readers*>(align_to(context.clip_segment_headers + runtime_headers_size, 64));
+			context.epoch.store(0, k_memory_order_relaxed);
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				context.resident_sizes[tier_index].store(0, k_memory_order_relaxed);
+
+			// Copy our clip hashes to setup our headers
+			const database_clip_metadata* clip_metadatas = header.get_clip_metadatas();
+			for (uint32_t clip_index = 0; clip_index < num_clips; ++clip_index)
+			{
+				const database_clip_metadata& clip_metadata = clip_metadatas[clip_index];
+				database_runtime_clip_header* clip_header = clip_metadata.get_clip_header(context.clip_segment_headers);
+				clip_header->clip_hash = clip_metadata.clip_hash;
+				clip_header->clip_index = clip_index;
+			}
+
+			// Newer databases know where the samples of every segment live, our segment headers are initialized once
+			// and remain valid as chunks stream in and out, see load_segment_tier_metadata(..)
+			const database_segment_streaming_metadata* segment_streaming_metadatas = header.get_segment_streaming_metadatas();
+			context.segment_streaming_metadatas = segment_streaming_metadatas;
+
+			if (segment_streaming_metadatas != nullptr)
+			{
+				for (uint32_t clip_index = 0; clip_index < num_clips; ++clip_index)
+				{
+					const uint32_t clip_header_offset = clip_metadatas[clip_index].clip_header_offset;
+					const uint32_t first_segment_index = get_database_runtime_segment_index(clip_index, clip_header_offset + uint32_t(sizeof(database_runtime_clip_header)));
+					const uint32_t end_segment_index = (clip_index + 1) < num_clips ? get_database_runtime_segment_index(clip_index + 1, clip_metadatas[clip_index + 1].clip_header_offset + uint32_t(sizeof(database_runtime_clip_header))) : header.num_segments;
+
+					database_runtime_segment_header* segment_headers = clip_metadatas[clip_index].get_clip_header(context.clip_segment_headers)->get_segment_headers();
+					for (uint32_t segment_index = first_segment_index; segment_index < end_segment_index; ++segment_index)
+					{
+						const database_segment_streaming_metadata& segment_streaming_metadata = segment_streaming_metadatas[segment_index];
+						database_runtime_segment_header& segment_header = segment_headers[segment_index - first_segment_index];
+
+						for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+						{
+							const uint64_t tier_metadata = (uint64_t(segment_streaming_metadata.samples_offset[tier_index]) << 32) | segment_streaming_metadata.sample_indices[tier_index];
+							segment_header.tier_metadata[tier_index].store(tier_metadata, k_memory_order_relaxed);
+						}
+					}
+				}
+			}
+		}
+
+		// Returns the chunks of a word that are not streaming and either loaded or not loaded
+		inline uint32_t get_streamable_chunks(const uint32_t* loaded_chunks, const uint32_t* streaming_chunks, uint32_t offset, bool is_loaded)
+		{
+			const uint32_t loaded_chunks_ = chunk_bitset_load(loaded_chunks, offset);
+			const uint32_t streaming_chunks_ = chunk_bitset_load(streaming_chunks, offset);
+			return (is_loaded ? loaded_chunks_ : ~loaded_chunks_) & ~streaming_chunks_;
+		}
+
+		inline bool is_chunk_streamable(const uint32_t* loaded_chunks, const uint32_t* streaming_chunks, uint32_t chunk_index, bool is_loaded)
+		{
+			const uint32_t mask = 1U << (31 - (chunk_index % 32));
+			return (get_streamable_chunks(loaded_chunks, streaming_chunks, chunk_index / 32, is_loaded) & mask) != 0;
+		}
+
+		// Finds the first contiguous range of chunks that can be streamed in (not loaded) or out (loaded)
+		// and that aren't streaming. Requests in flight complete in any order which can leave gaps.
+		// Returns the number of chunks found, at most 'max_num_chunks'.
+		inline uint32_t find_streamable_chunk_range(const uint32_t* loaded_chunks, const uint32_t* streaming_chunks, uint32_t num_chunks, bool is_loaded, uint32_t max_num_chunks, uint32_t& out_first_chunk_index)
+		{
+			const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
+			const uint32_t num_entries = desc.get_size();
+
+			uint32_t first_chunk_index = ~0U;
+			for (uint32_t entry_index = 0; entry_index < num_entries; ++entry_index)
+			{
+				const uint32_t streamable_chunks = get_streamable_chunks(loaded_chunks, streaming_chunks, entry_index, is_loaded);
+				if (streamable_chunks != 0)
+				{
+					first_chunk_index = (entry_index * 32) + count_leading_zeros(streamable_chunks);
+					break;
+				}
+			}
+
+			if (first_chunk_index >= num_chunks)
+				return 0;	// Nothing to stream, the padding bits of the last entry might have matched
+
+			uint32_t num_streamable_chunks = 0;
+			for (uint32_t chunk_index = first_chunk_index; chunk_index < num_chunks && num_streamable_chunks < max_num_chunks; ++chunk_index)
+			{
+				if (!is_chunk_streamable(loaded_chunks, streaming_chunks, chunk_index, is_loaded))
+					break;	// End of our range
+
+				num_streamable_chunks++;
+			}
+
+			out_first_chunk_index = first_chunk_index;
+			return num_streamable_chunks;
+		}
 	}
 
 	template<class database_settings_type>
@@ -106,124 +266,97 @@ namespace acl
 		m_context.db = &database;
 		m_context.db_hash = database.get_hash();
 		m_context.allocator = &allocator;
-		m_context.bulk_data[0] = database.get_bulk_data(quality_tier::medium_importance);
-		m_context.bulk_data[1] = database.get_bulk_data(quality_tier::lowest_importance);
-		m_context.streamers[0] = m_context.streamers[1] = nullptr;
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			m_context.bulk_data[tier_index].store(database.get_bulk_data(quality_tier(tier_index + 1)), acl_impl::k_memory_order_relaxed);
+			m_context.streamers[tier_index] = nullptr;
+		}
 
 		const acl_impl::database_header& header = acl_impl::get_database_header(database);
 
-		const uint32_t num_medium_chunks = header.num_chunks[0];
-		const uint32_t num_low_chunks = header.num_chunks[1];
-
-		const bitset_description medium_desc = bitset_description::make_from_num_bits(num_medium_chunks);
-		const bitset_description low_desc = bitset_description::make_from_num_bits(num_low_chunks);
-
-		const uint32_t medium_bitset_size = medium_desc.get_num_bytes();
-		const uint32_t low_bitset_size = low_desc.get_num_bytes();
-
 		// Allocate a single buffer for everything we need. This is faster to allocate and it ensures better virtual
 		// memory locality which should help reduce the cost of TLB misses.
 		const uint32_t runtime_data_size = acl_impl::calculate_runtime_data_size(database);
-		uint8_t* runtime_data_buffer = allocate_type_array_aligned<uint8_t>(allocator, runtime_data_size, 16);
+		uint8_t* runtime_data_buffer = allocate_type_array_aligned<uint8_t>(allocator, runtime_data_size, 64);
 
 		// Initialize everything to 0
 		std::memset(runtime_data_buffer, 0, runtime_data_size);
 
-		m_context.loaded_chunks[0] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
-		runtime_data_buffer += medium_bitset_size;
-
-		m_context.streaming_chunks[0] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
-		runtime_data_buffer += medium_bitset_size;
+		runtime_data_buffer = acl_impl::setup_chunk_bitsets(m_context, header, runtime_data_buffer);
+		acl_impl::setup_clip_runtime_data(m_context, header, runtime_data_buffer);
 
-		m_context.loaded_chunks[1] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
-		runtime_data_buffer += low_bitset_size;
-
-		m_context.streaming_chunks[1] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
-		runtime_data_buffer += low_bitset_size;
-
-		m_context.clip_segment_headers = align_to(runtime_data_buffer, 8);	// Align runtime headers
-
-		// Copy our clip hashes to setup our headers
-		const uint32_t num_clips = header.num_clips;
-		const acl_impl::database_clip_metadata* clip_metadatas = header.get_clip_metadatas();
-		for (uint32_t clip_index = 0; clip_index < num_clips; ++clip_index)
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
 		{
-			const acl_impl::database_clip_metadata& clip_metadata = clip_metadatas[clip_index];
-			acl_impl::database_runtime_clip_header* clip_header = clip_metadata.get_clip_header(m_context.clip_segment_headers);
-			clip_header->clip_hash = clip_metadata.clip_hash;
-		}
+			const uint32_t num_chunks = header.num_chunks[tier_index];
+			const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
 
-		// Bulk data is inline so stream everything in right away
-		const acl_impl::database_chunk_description* chunk_descriptions = header.get_chunk_descriptions_medium();
-		for (uint32_t chunk_index = 0; chunk_index < num_medium_chunks; ++chunk_index)
-		{
-			const acl_impl::database_chunk_description& chunk_description = chunk_descriptions[chunk_index];
-			const acl_impl::database_chunk_header* chunk_header = chunk_description.get_chunk_header(m_context.bulk_data[0]);
-			ACL_ASSERT(chunk_header->index == chunk_index, "Unexpected chunk index");
+			m_context.resident_sizes[tier_index].store(acl_impl::calculate_chunk_range_size(m_context, tier_index, 0, num_chunks), acl_impl::k_memory_order_relaxed);
 
-			const acl_impl::database_chunk_segment_header* chunk_segment_headers = chunk_header->get_segment_headers();
-			const uint32_t num_segments = chunk_header->num_segments;
-			for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+			if (m_context.segment_streaming_metadatas != nullptr)
 			{
-				const acl_impl::database_chunk_segment_header& chunk_segment_header = chunk_segment_headers[segment_index];
-
-#if defined(ACL_HAS_ASSERT_CHECKS)
-				const acl_impl::database_runtime_clip_header* clip_header = chunk_segment_header.get_clip_header(m_context.clip_segment_headers);
-				ACL_ASSERT(clip_header->clip_hash == chunk_segment_header.clip_hash, "Unexpected clip hash");
-#endif
-
-				acl_impl::database_runtime_segment_header* segment_header = chunk_segment_header.get_segment_header(m_context.clip_segment_headers);
-				ACL_ASSERT(segment_header->tier_metadata[0].load(acl_impl::k_memory_order_relaxed) == 0, "Tier metadata should not be initialized");
-				segment_header->tier_metadata[0].store((uint64_t(chunk_segment_header.samples_offset) << 32) | chunk_segment_header.sample_indices, acl_impl::k_memory_order_relaxed);
+				// Bulk data is inline and our segment headers are initialized, mark everything as loaded
+				acl_impl::chunk_bitset_set_range(m_context.loaded_chunks[tier_index], desc, 0, num_chunks, true);
+				continue;
 			}
 
-			bitset_set(m_context.loaded_chunks[0], medium_desc, chunk_index, true);
-		}
-
-		chunk_descriptions = header.get_chunk_descriptions_low();
-		for (uint32_t chunk_index = 0; chunk_index < num_low_chunks; ++chunk_index)
-		{
-			const acl_impl::database_chunk_description& chunk_description = chunk_descriptions[chunk_index];
-			const acl_impl::database_chunk_header* chunk_header = chunk_description.get_chunk_header(m_context.bulk_data[1]);
-			ACL_ASSERT(chunk_header->index == chunk_index, "Unexpected chunk index");
-
-			const acl_impl::database_chunk_segment_header* chunk_segment_headers = chunk_header->get_segment_headers();
-			const uint32_t num_segments = chunk_header->num_segments;
-			for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+			// Bulk data is inline so stream everything in right away
+			const acl_impl::database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
+			for (uint32_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index)
 			{
-				const acl_impl::database_chunk_segment_header& chunk_segment_header = chunk_segment_headers[segment_index];
+				const acl_impl::database_chunk_description& chunk_description = chunk_descriptions[chunk_index];
+				const acl_impl::database_chunk_header* chunk_header = chunk_description.get_chunk_header(m_context.bulk_data[tier_index].load(acl_impl::k_memory_order_relaxed));
+				ACL_ASSERT(chunk_header->index == chunk_index, "Unexpected chunk index");
+
+				const acl_impl::database_chunk_segment_header* chunk_segment_headers = chunk_header->get_segment_headers();
+				const uint32_t num_segments = chunk_header->num_segments;
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				{
+					const acl_impl::database_chunk_segment_header& chunk_segment_header = chunk_segment_headers[segment_index];
 
 #if defined(ACL_HAS_ASSERT_CHECKS)
-				const acl_impl::database_runtime_clip_header* clip_header = chunk_segment_header.get_clip_header(m_context.clip_segment_headers);
-				ACL_ASSERT(clip_header->clip_hash == chunk_segment_header.clip_hash, "Unexpected clip hash");
+					const acl_impl::database_runtime_clip_header* clip_header = chunk_segment_header.get_clip_header(m_context.clip_segment_headers);
+					ACL_ASSERT(clip_header->clip_hash == chunk_segment_header.clip_hash, "Unexpected clip hash");
 #endif
 
-				acl_impl::database_runtime_segment_header* segment_header = chunk_segment_header.get_segment_header(m_context.clip_segment_headers);
-				ACL_ASSERT(segment_header->tier_metadata[1].load(acl_impl::k_memory_order_relaxed) == 0, "Tier metadata should not be initialized");
-				segment_header->tier_metadata[1].store((uint64_t(chunk_segment_header.samples_offset) << 32) | chunk_segment_header.sample_indices, acl_impl::k_memory_order_relaxed);
-			}
+					acl_impl::database_runtime_segment_header* segment_header = chunk_segment_header.get_segment_header(m_context.clip_segment_headers);
+					ACL_ASSERT(segment_header->tier_metadata[tier_index].load(acl_impl::k_memory_order_relaxed) == 0, "Tier metadata should not be initialized");
+					segment_header->tier_metadata[tier_index].store((uint64_t(chunk_segment_header.samples_offset) << 32) | chunk_segment_header.sample_indices, acl_impl::k_memory_order_relaxed);
+				}
 
-			bitset_set(m_context.loaded_chunks[1], low_desc, chunk_index, true);
+				bitset_set(m_context.loaded_chunks[tier_index], desc, chunk_index, true);
+			}
 		}
 
 		return true;
 	}
 
+#if ACL_NUM_DATABASE_TIERS == 2
 	template<class database_settings_type>
 	inline bool database_context<database_settings_type>::initialize(iallocator& allocator, const compressed_database& database, database_streamer& medium_tier_streamer, database_streamer& low_tier_streamer)
+	{
+		database_streamer* tier_streamers[2] = { &medium_tier_streamer, &low_tier_streamer };
+		return initialize(allocator, database, tier_streamers, 2);
+	}
+#endif
+
+	template<class database_settings_type>
+	inline bool database_context<database_settings_type>::initialize(iallocator& allocator, const compressed_database& database, database_streamer* const* tier_streamers, uint32_t num_tier_streamers)
 	{
 		const bool is_valid = database.is_valid(false).empty();
 		ACL_ASSERT(is_valid, "Invalid compressed database instance");
 		if (!is_valid)
 			return false;
 
-		ACL_ASSERT(medium_tier_streamer.is_initialized(), "Medium importance tier streamer must be initialized");
-		if (!medium_tier_streamer.is_initialized())
+		ACL_ASSERT(num_tier_streamers == k_num_database_tiers, "Expected one streamer per database tier: %u != %u", num_tier_streamers, k_num_database_tiers);
+		if (num_tier_streamers != k_num_database_tiers)
 			return false;
 
-		ACL_ASSERT(low_tier_streamer.is_initialized(), "Low importance tier streamer must be initialized");
-		if (!low_tier_streamer.is_initialized())
-			return false;
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			ACL_ASSERT(tier_streamers[tier_index] != nullptr && tier_streamers[tier_index]->is_initialized(), "Tier streamer must be initialized");
+			if (tier_streamers[tier_index] == nullptr || !tier_streamers[tier_index]->is_initialized())
+				return false;
+		}
 
 		ACL_ASSERT(!is_initialized(), "Cannot initialize database twice");
 		if (is_initialized())
@@ -232,55 +365,26 @@ namespace acl
 		m_context.db = &database;
 		m_context.db_hash = database.get_hash();
 		m_context.allocator = &allocator;
-		m_context.bulk_data[0] = m_context.bulk_data[1] = nullptr;	// Will be set during the first stream in request
-		m_context.streamers[0] = &medium_tier_streamer;
-		m_context.streamers[1] = &low_tier_streamer;
 
-		medium_tier_streamer.bind(m_context);
-		low_tier_streamer.bind(m_context);
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			m_context.bulk_data[tier_index].store(nullptr, acl_impl::k_memory_order_relaxed);	// Will be set during the first stream in request
+			m_context.streamers[tier_index] = tier_streamers[tier_index];
+			tier_streamers[tier_index]->bind(m_context);
+		}
 
 		const acl_impl::database_header& header = acl_impl::get_database_header(database);
 
-		const uint32_t num_medium_chunks = header.num_chunks[0];
-		const uint32_t num_low_chunks = header.num_chunks[1];
-
-		const bitset_description medium_desc = bitset_description::make_from_num_bits(num_medium_chunks);
-		const bitset_description low_desc = bitset_description::make_from_num_bits(num_low_chunks);
-
-		const uint32_t medium_bitset_size = medium_desc.get_num_bytes();
-		const uint32_t low_bitset_size = low_desc.get_num_bytes();
-
 		// Allocate a single buffer for everything we need. This is faster to allocate and it ensures better virtual
 		// memory locality which should help reduce the cost of TLB misses.
 		const uint32_t runtime_data_size = acl_impl::calculate_runtime_data_size(database);
-		uint8_t* runtime_data_buffer = allocate_type_array_aligned<uint8_t>(allocator, runtime_data_size, 16);
+		uint8_t* runtime_data_buffer = allocate_type_array_aligned<uint8_t>(allocator, runtime_data_size, 64);
 
 		// Initialize everything to 0
 		std::memset(runtime_data_buffer, 0, runtime_data_size);
 
-		m_context.loaded_chunks[0] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
-		runtime_data_buffer += medium_bitset_size;
-
-		m_context.streaming_chunks[0] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
-		runtime_data_buffer += medium_bitset_size;
-
-		m_context.loaded_chunks[1] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
-		runtime_data_buffer += low_bitset_size;
-
-		m_context.streaming_chunks[1] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
-		runtime_data_buffer += low_bitset_size;
-
-		m_context.clip_segment_headers = align_to(runtime_data_buffer, 8);	// Align runtime headers
-
-		// Copy our clip hashes to setup our headers
-		const uint32_t num_clips = header.num_clips;
-		const acl_impl::database_clip_metadata* clip_metadatas = header.get_clip_metadatas();
-		for (uint32_t clip_index = 0; clip_index < num_clips; ++clip_index)
-		{
-			const acl_impl::database_clip_metadata& clip_metadata = clip_metadatas[clip_index];
-			acl_impl::database_runtime_clip_header* clip_header = clip_metadata.get_clip_header(m_context.clip_segment_headers);
-			clip_header->clip_hash = clip_metadata.clip_hash;
-		}
+		runtime_data_buffer = acl_impl::setup_chunk_bitsets(m_context, header, runtime_data_buffer);
+		acl_impl::setup_clip_runtime_data(m_context, header, runtime_data_buffer);
 
 		return true;
 	}
@@ -294,8 +398,10 @@ namespace acl
 		if (!is_initialized())
 			return;	// Nothing to do
 
-		ACL_ASSERT(!is_streaming(quality_tier::medium_importance), "Behavior is undefined if context is reset while streaming is in progress");
-		ACL_ASSERT(!is_streaming(quality_tier::lowest_importance), "Behavior is undefined if context is reset while streaming is in progress");
+#if defined(ACL_HAS_ASSERT_CHECKS)
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			ACL_ASSERT(!is_streaming(quality_tier(tier_index + 1)), "Behavior is undefined if context is reset while streaming is in progress");
+#endif
 
 		const uint32_t runtime_data_size = acl_impl::calculate_runtime_data_size(*m_context.db);
 		deallocate_type_array(*m_context.allocator, reinterpret_cast<uint8_t*>(m_context.loaded_chunks[0]), runtime_data_size);
@@ -320,15 +426,30 @@ namespace acl
 
 		// The instances are identical and might have relocated, update our metadata
 		m_context.db = &database;
-		m_context.bulk_data[0] = database.get_bulk_data(quality_tier::medium_importance);
-		m_context.bulk_data[1] = database.get_bulk_data(quality_tier::lowest_importance);
+		m_context.segment_streaming_metadatas = acl_impl::get_database_header(database).get_segment_streaming_metadatas();
+
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			m_context.bulk_data[tier_index].store(database.get_bulk_data(quality_tier(tier_index + 1)), acl_impl::k_memory_order_relaxed);
 
 		return true;
 	}
 
+#if ACL_NUM_DATABASE_TIERS == 2
 	template<class database_settings_type>
 	inline bool database_context<database_settings_type>::relocated(const compressed_database& database, database_streamer& medium_tier_streamer, database_streamer& low_tier_streamer)
 	{
+		database_streamer* tier_streamers[2] = { &medium_tier_streamer, &low_tier_streamer };
+		return relocated(database, tier_streamers, 2);
+	}
+#endif
+
+	template<class database_settings_type>
+	inline bool database_context<database_settings_type>::relocated(const compressed_database& database, database_streamer* const* tier_streamers, uint32_t num_tier_streamers)
+	{
+		ACL_ASSERT(num_tier_streamers == k_num_database_tiers, "Expected one streamer per database tier: %u != %u", num_tier_streamers, k_num_database_tiers);
+		if (num_tier_streamers != k_num_database_tiers)
+			return false;
+
 		if (!m_context.is_initialized())
 			return false;	// Not initialized, cannot be relocated
 
@@ -342,11 +463,13 @@ namespace acl
 
 		// The instances are identical and might have relocated, update our metadata
 		m_context.db = &database;
-		m_context.streamers[0] = &medium_tier_streamer;
-		m_context.streamers[1] = &low_tier_streamer;
+		m_context.segment_streaming_metadatas = acl_impl::get_database_header(database).get_segment_streaming_metadatas();
 
-		medium_tier_streamer.bind(m_context);
-		low_tier_streamer.bind(m_context);
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			m_context.streamers[tier_index] = tier_streamers[tier_index];
+			tier_streamers[tier_index]->bind(m_context);
+		}
 
 		return true;
 	}
@@ -374,8 +497,7 @@ namespace acl
 		if (!tracks.has_database())
 			return false;	// Clip not bound to anything
 
-		const acl_impl::transform_tracks_header& transform_header = acl_impl::get_transform_tracks_header(tracks);
-		const acl_impl::tracks_database_header* tracks_db_header = transform_header.get_database_header();
+		const acl_impl::tracks_database_header* tracks_db_header = acl_impl::get_tracks_database_header(tracks);
 		ACL_ASSERT(tracks_db_header != nullptr, "Expected a 'tracks_database_header'");
 
 		if (!tracks_db_header->clip_header_offset.is_valid())
@@ -398,6 +520,10 @@ namespace acl
 		if (db_clip_header->clip_hash != tracks.get_hash())
 			return false;	// Clip not bound to this database instance
 
+		const uint32_t* removed_clips = acl_impl::get_database_header(*m_context.db).get_removed_clips();
+		if (removed_clips != nullptr && bitset_test(removed_clips, bitset_description::make_from_num_bits(num_clips), db_clip_header->clip_index))
+			return false;	// Clip was removed from this database instance
+
 		// All good
 		return true;
 	}
@@ -415,7 +541,7 @@ namespace acl
 		const uint32_t tier_index = uint32_t(tier) - 1;
 
 		const uint32_t* loaded_chunks = m_context.loaded_chunks[tier_index];
-		const uint32_t num_loaded_chunks = bitset_count_set_bits(loaded_chunks, desc);
+		const uint32_t num_loaded_chunks = acl_impl::chunk_bitset_count_set_bits(loaded_chunks, desc);
 
 		return num_loaded_chunks == num_chunks;
 	}
@@ -433,11 +559,39 @@ namespace acl
 		const uint32_t tier_index = uint32_t(tier) - 1;
 
 		const uint32_t* streaming_chunks = m_context.streaming_chunks[tier_index];
-		const uint32_t num_streaming_chunks = bitset_count_set_bits(streaming_chunks, desc);
+		const uint32_t num_streaming_chunks = acl_impl::chunk_bitset_count_set_bits(streaming_chunks, desc);
 
 		return num_streaming_chunks != 0;
 	}
 
+	template<class database_settings_type>
+	inline bool database_context<database_settings_type>::is_streamed_in(quality_tier tier, const compressed_tracks& tracks) const
+	{
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		ACL_ASSERT(is_initialized(), "Database isn't initialized");
+		if (!is_initialized() || tier == quality_tier::highest_importance)
+			return false;
+
+		uint32_t clip_index;
+		const acl_impl::database_clip_chunk_range* clip_chunk_range = get_clip_chunk_range(tracks, clip_index);
+		if (clip_chunk_range == nullptr)
+			return false;
+
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		const uint32_t first_chunk_index = clip_chunk_range->first_chunk_index[tier_index];
+		const uint32_t end_chunk_index = first_chunk_index + clip_chunk_range->num_chunks[tier_index];
+
+		const uint32_t* loaded_chunks = m_context.loaded_chunks[tier_index];
+		for (uint32_t chunk_index = first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
+		{
+			const uint32_t mask = 1U << (31 - (chunk_index % 32));
+			if ((acl_impl::chunk_bitset_load(loaded_chunks, chunk_index / 32) & mask) == 0)
+				return false;
+		}
+
+		return true;
+	}
+
 	template<class database_settings_type>
 	inline database_stream_request_result database_context<database_settings_type>::stream_in(quality_tier tier, uint32_t num_chunks_to_stream)
 	{
@@ -446,138 +600,324 @@ namespace acl
 			return database_stream_request_result::context_not_initialized;
 
 		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
-		if (tier == quality_tier::highest_importance)
+		ACL_ASSERT(uint32_t(tier) <= k_num_database_tiers, "Invalid database tier");
+		if (tier == quality_tier::highest_importance || uint32_t(tier) > k_num_database_tiers)
 			return database_stream_request_result::invalid_database_tier;
 
-		if (is_streaming(tier))
-			return database_stream_request_result::streaming_in_progress;	// Can't stream while we are streaming
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		const uint32_t num_chunks = m_context.db->get_num_chunks(tier);
 
-		const acl_impl::database_header& header = acl_impl::get_database_header(*m_context.db);
-		const acl_impl::database_chunk_description* chunk_descriptions = tier == quality_tier::medium_importance ? header.get_chunk_descriptions_medium() : header.get_chunk_descriptions_low();
+		// Stream out requests deferred until now might be safe to release
+		dispatch_deferred_stream_outs();
+
+		// The bulk data is allocated by the first stream in request and deallocated by the last stream out request,
+		// wait for them to complete before we stream anything else
+		if ((m_context.bulk_data[tier_index].load(acl_impl::k_memory_order_acquire) == nullptr || is_bulk_data_deallocation_deferred(tier)) && is_streaming(tier))
+			return database_stream_request_result::streaming_in_progress;
+
+		// Look for chunks that aren't loaded yet and aren't streaming yet
+		uint32_t first_chunk_index = ~0U;
+		const uint32_t num_streaming_chunks = acl_impl::find_streamable_chunk_range(m_context.loaded_chunks[tier_index], m_context.streaming_chunks[tier_index], num_chunks, false, num_chunks_to_stream, first_chunk_index);
+
+		if (num_streaming_chunks == 0)
+			return database_stream_request_result::done;	// Everything is streamed in or streaming, nothing to do
+
+		return stream_in_chunks(tier, first_chunk_index, num_streaming_chunks);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::stream_in(quality_tier tier, const compressed_tracks& tracks)
+	{
+		ACL_ASSERT(is_initialized(), "Database isn't initialized");
+		if (!is_initialized())
+			return database_stream_request_result::context_not_initialized;
+
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		ACL_ASSERT(uint32_t(tier) <= k_num_database_tiers, "Invalid database tier");
+		if (tier == quality_tier::highest_importance || uint32_t(tier) > k_num_database_tiers)
+			return database_stream_request_result::invalid_database_tier;
 
 		const uint32_t tier_index = uint32_t(tier) - 1;
 
-		const uint32_t num_chunks = header.num_chunks[tier_index];
-		const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
-		const uint32_t max_chunk_size = header.max_chunk_size;
+		if (m_context.chunk_ref_counts[tier_index] == nullptr)
+			return database_stream_request_result::clip_chunk_ranges_missing;
 
-		uint32_t first_chunk_index = ~0U;
+		uint32_t clip_index;
+		const acl_impl::database_clip_chunk_range* clip_chunk_range = get_clip_chunk_range(tracks, clip_index);
+		ACL_ASSERT(clip_chunk_range != nullptr, "Compressed tracks instance isn't part of this database");
+		if (clip_chunk_range == nullptr)
+			return database_stream_request_result::invalid_compressed_tracks;
 
-		// Clamp the total number of chunks we can stream
-		num_chunks_to_stream = std::min<uint32_t>(num_chunks_to_stream, num_chunks);
+		return stream_in_clip(tier, clip_index);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::stream_out(quality_tier tier, uint32_t num_chunks_to_stream)
+	{
+		ACL_ASSERT(is_initialized(), "Database isn't initialized");
+		if (!is_initialized())
+			return database_stream_request_result::context_not_initialized;
+
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		ACL_ASSERT(uint32_t(tier) <= k_num_database_tiers, "Invalid database tier");
+		if (tier == quality_tier::highest_importance || uint32_t(tier) > k_num_database_tiers)
+			return database_stream_request_result::invalid_database_tier;
+
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		const uint32_t num_chunks = m_context.db->get_num_chunks(tier);
 
-		// Look for chunks that aren't loaded yet and aren't streaming yet
-		const uint32_t num_entries = desc.get_size();
 		const uint32_t* loaded_chunks = m_context.loaded_chunks[tier_index];
-		for (uint32_t entry_index = 0; entry_index < num_entries; ++entry_index)
+		const uint32_t* streaming_chunks = m_context.streaming_chunks[tier_index];
+		const uint32_t* chunk_ref_counts = m_context.chunk_ref_counts[tier_index];
+
+		if (chunk_ref_counts == nullptr)
 		{
-			const uint32_t maybe_loaded = loaded_chunks[entry_index];
-			const uint32_t num_pending_chunks = count_trailing_zeros(maybe_loaded);
-			if (num_pending_chunks != 0)
+			// Older databases cannot stream per clip, look for chunks that are loaded and aren't streaming
+			uint32_t first_chunk_index = ~0U;
+			const uint32_t num_streaming_chunks = acl_impl::find_streamable_chunk_range(loaded_chunks, streaming_chunks, num_chunks, true, num_chunks_to_stream, first_chunk_index);
+
+			if (num_streaming_chunks == 0)
+				return database_stream_request_result::done;	// Everything is streamed out or streaming, nothing to do
+
+			return stream_out_chunks(tier, first_chunk_index, num_streaming_chunks);
+		}
+
+		// Stream out every range of chunks that are loaded, aren't streaming, and that no requested clip references
+		auto is_chunk_releasable = [chunk_ref_counts, loaded_chunks, streaming_chunks](uint32_t chunk_index) { return chunk_ref_counts[chunk_index] == 0 && acl_impl::is_chunk_streamable(loaded_chunks, streaming_chunks, chunk_index, true); };
+
+		database_stream_request_result result = database_stream_request_result::done;
+		uint32_t num_chunks_left = num_chunks_to_stream;
+		uint32_t chunk_index = 0;
+		while (chunk_index < num_chunks && num_chunks_left != 0)
+		{
+			if (!is_chunk_releasable(chunk_index))
 			{
-				first_chunk_index = (entry_index * 32) + (32 - num_pending_chunks);
-				break;
+				chunk_index++;
+				continue;	// Still referenced, already streamed out, or streaming
 			}
-		}
 
-		if (first_chunk_index == ~0U)
-			return database_stream_request_result::done;	// Everything is streamed in or streaming, nothing to do
+			const uint32_t range_first_chunk_index = chunk_index;
+			while (chunk_index < num_chunks && (chunk_index - range_first_chunk_index) < num_chunks_left && is_chunk_releasable(chunk_index))
+				chunk_index++;
 
-		// Calculate and clamp our last chunk index (and handle wrapping for safety)
-		const uint64_t last_chunk_index64 = uint64_t(first_chunk_index) + uint64_t(num_chunks_to_stream) - 1;
-		const uint32_t last_chunk_index = last_chunk_index64 >= uint64_t(num_chunks) ? (num_chunks - 1) : uint32_t(last_chunk_index64);
+			const uint32_t num_range_chunks = chunk_index - range_first_chunk_index;
+			const database_stream_request_result range_result = stream_out_chunks(tier, range_first_chunk_index, num_range_chunks);
+			if (range_result != database_stream_request_result::dispatched)
+				return result == database_stream_request_result::dispatched ? result : range_result;
 
-		// Calculate our stream size and account for the fact that the last chunk doesn't have the same size
-		const uint32_t num_streaming_chunks = last_chunk_index - first_chunk_index + 1;
+			result = range_result;
+			num_chunks_left -= num_range_chunks;
+		}
 
-		if (num_streaming_chunks == 0)
-			return database_stream_request_result::done;	// Nothing more to stream
+		return result;
+	}
 
-		database_streamer* streamer = m_context.streamers[tier_index];
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::stream_out(quality_tier tier, const compressed_tracks& tracks)
+	{
+		ACL_ASSERT(is_initialized(), "Database isn't initialized");
+		if (!is_initialized())
+			return database_stream_request_result::context_not_initialized;
 
-		const streaming_request_id request_id = streamer->build_request(streaming_action::stream_in, tier, first_chunk_index, num_streaming_chunks);
-		if (!request_id.is_valid())
-			return database_stream_request_result::no_free_streaming_requests;
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		ACL_ASSERT(uint32_t(tier) <= k_num_database_tiers, "Invalid database tier");
+		if (tier == quality_tier::highest_importance || uint32_t(tier) > k_num_database_tiers)
+			return database_stream_request_result::invalid_database_tier;
 
-		// Find the stream start offset from our first chunk's offset
-		const acl_impl::database_chunk_description& first_chunk_description = chunk_descriptions[first_chunk_index];
-		const uint32_t stream_start_offset = first_chunk_description.offset;
+		const uint32_t tier_index = uint32_t(tier) - 1;
 
-		const acl_impl::database_chunk_description& last_chunk_description = chunk_descriptions[last_chunk_index];
-		const uint32_t stream_size = ((num_streaming_chunks - 1) * max_chunk_size) + last_chunk_description.size;
+		if (m_context.chunk_ref_counts[tier_index] == nullptr)
+			return database_stream_request_result::clip_chunk_ranges_missing;
 
-		// We can allocate our bulk data if we haven't already
-		const uint8_t* bulk_data = m_context.bulk_data[tier_index];
-		const bool can_allocate_bulk_data = bulk_data == nullptr;
+		uint32_t clip_index;
+		const acl_impl::database_clip_chunk_range* clip_chunk_range = get_clip_chunk_range(tracks, clip_index);
+		ACL_ASSERT(clip_chunk_range != nullptr, "Compressed tracks instance isn't part of this database");
+		if (clip_chunk_range == nullptr)
+			return database_stream_request_result::invalid_compressed_tracks;
 
-		// Mark chunks as in-streaming
-		uint32_t* streaming_chunks = m_context.streaming_chunks[tier_index];
-		bitset_set_range(streaming_chunks, desc, first_chunk_index, num_streaming_chunks, true);
+		return stream_out_clip(tier, clip_index);
+	}
 
-		// Fire the stream in request and let the streamer handle it (sync/async)
-		streamer->stream_in(stream_start_offset, stream_size, can_allocate_bulk_data, tier, request_id);
+	template<class database_settings_type>
+	inline void database_context<database_settings_type>::advance_usage_clock()
+	{
+		ACL_ASSERT(is_initialized(), "Database isn't initialized");
+		if (!is_initialized())
+			return;
 
-		return database_stream_request_result::dispatched;
+		acl_impl::advance_usage_timestamp(m_context);
 	}
 
 	template<class database_settings_type>
-	inline database_stream_request_result database_context<database_settings_type>::stream_out(quality_tier tier, uint32_t num_chunks_to_stream)
+	inline uint32_t database_context<database_settings_type>::get_recently_used_clips(uint32_t* out_clip_indices, uint32_t max_num_clips) const
 	{
+		static_assert(database_settings_type::is_clip_usage_tracking_supported(), "Clip usage tracking must be supported");
+
 		ACL_ASSERT(is_initialized(), "Database isn't initialized");
 		if (!is_initialized())
-			return database_stream_request_result::context_not_initialized;
+			return 0;
 
-		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
-		if (tier == quality_tier::highest_importance)
-			return database_stream_request_result::invalid_database_tier;
+		ACL_ASSERT(out_clip_indices != nullptr || max_num_clips == 0, "Cannot write clip indices to a null buffer");
+		if (out_clip_indices == nullptr)
+			return 0;
 
-		if (is_streaming(tier))
-			return database_stream_request_result::streaming_in_progress;	// Can't stream while we are streaming
+		const uint32_t timestamp = m_context.usage_timestamp.load(acl_impl::k_memory_order_relaxed);
+		const uint32_t num_clips = m_context.db->get_num_clips();
+		const std::atomic<uint32_t>* clip_last_use_timestamps = reinterpret_cast<const std::atomic<uint32_t>*>(m_context.clip_last_use_timestamps);
 
-		const acl_impl::database_header& header = acl_impl::get_database_header(*m_context.db);
-		const acl_impl::database_chunk_description* chunk_descriptions = tier == quality_tier::medium_importance ? header.get_chunk_descriptions_medium() : header.get_chunk_descriptions_low();
+		uint32_t num_used_clips = 0;
+		for (uint32_t clip_index = 0; clip_index < num_clips && num_used_clips < max_num_clips; ++clip_index)
+		{
+			if (clip_last_use_timestamps[clip_index].load(acl_impl::k_memory_order_relaxed) == timestamp)
+				out_clip_indices[num_used_clips++] = clip_index;
+		}
+
+		return num_used_clips;
+	}
+
+	template<class database_settings_type>
+	inline const acl_impl::database_clip_chunk_range* database_context<database_settings_type>::get_clip_chunk_range(const compressed_tracks& tracks, uint32_t& out_clip_index) const
+	{
+		if (!contains(tracks))
+			return nullptr;
+
+		const acl_impl::database_clip_chunk_range* clip_chunk_ranges = acl_impl::get_database_header(*m_context.db).get_clip_chunk_ranges();
+		if (clip_chunk_ranges == nullptr)
+			return nullptr;	// Older database, the chunks of each clip aren't known
+
+		const acl_impl::tracks_database_header* tracks_db_header = acl_impl::get_tracks_database_header(tracks);
+		const acl_impl::database_runtime_clip_header* db_clip_header = tracks_db_header->get_clip_header(m_context.clip_segment_headers);
+
+		out_clip_index = db_clip_header->clip_index;
+		return clip_chunk_ranges + db_clip_header->clip_index;
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::stream_in_clip(quality_tier tier, uint32_t clip_index)
+	{
+		const acl_impl::database_clip_chunk_range& clip_chunk_range = acl_impl::get_database_header(*m_context.db).get_clip_chunk_ranges()[clip_index];
 
 		const uint32_t tier_index = uint32_t(tier) - 1;
+		const uint32_t first_chunk_index = clip_chunk_range.first_chunk_index[tier_index];
+		const uint32_t end_chunk_index = first_chunk_index + clip_chunk_range.num_chunks[tier_index];
 
-		const uint32_t num_chunks = header.num_chunks[tier_index];
-		const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
-		const uint32_t max_chunk_size = header.max_chunk_size;
+		// Reference our chunks the first time the clip is requested, requesting it again does nothing
+		const bitset_description clip_desc = bitset_description::make_from_num_bits(m_context.db->get_num_clips());
+		uint32_t* requested_clips = m_context.requested_clips[tier_index];
+		if (!bitset_test(requested_clips, clip_desc, clip_index))
+		{
+			bitset_set(requested_clips, clip_desc, clip_index, true);
 
-		// Clamp the total number of chunks we can stream
-		num_chunks_to_stream = std::min<uint32_t>(num_chunks_to_stream, num_chunks);
+			uint32_t* chunk_ref_counts = m_context.chunk_ref_counts[tier_index];
+			for (uint32_t chunk_index = first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
+				chunk_ref_counts[chunk_index]++;
+		}
 
-		uint32_t first_chunk_index = ~0U;
+		// Stream out requests deferred until now might be safe to release
+		dispatch_deferred_stream_outs();
+
+		// The bulk data is allocated by the first stream in request and deallocated by the last stream out request,
+		// wait for them to complete before we stream anything else
+		if ((m_context.bulk_data[tier_index].load(acl_impl::k_memory_order_acquire) == nullptr || is_bulk_data_deallocation_deferred(tier)) && is_streaming(tier))
+			return database_stream_request_result::streaming_in_progress;
 
-		// Look for chunks that aren't unloaded yet and aren't streaming yet
-		const uint32_t num_entries = desc.get_size();
 		const uint32_t* loaded_chunks = m_context.loaded_chunks[tier_index];
-		for (uint32_t entry_index = 0; entry_index < num_entries; ++entry_index)
+		const uint32_t* streaming_chunks = m_context.streaming_chunks[tier_index];
+
+		// Stream in every range of chunks of our clip that aren't loaded and aren't streaming
+		database_stream_request_result result = database_stream_request_result::done;
+		uint32_t chunk_index = first_chunk_index;
+		while (chunk_index < end_chunk_index)
 		{
-			const uint32_t maybe_loaded = loaded_chunks[entry_index];
-			const uint32_t num_pending_chunks = count_leading_zeros(maybe_loaded);
-			if (num_pending_chunks != 32)
+			if (!acl_impl::is_chunk_streamable(loaded_chunks, streaming_chunks, chunk_index, false))
 			{
-				first_chunk_index = (entry_index * 32) + num_pending_chunks;
-				break;
+				chunk_index++;
+				continue;	// Already loaded or streaming
 			}
+
+			const uint32_t range_first_chunk_index = chunk_index;
+			while (chunk_index < end_chunk_index && acl_impl::is_chunk_streamable(loaded_chunks, streaming_chunks, chunk_index, false))
+				chunk_index++;
+
+			const database_stream_request_result range_result = stream_in_chunks(tier, range_first_chunk_index, chunk_index - range_first_chunk_index);
+			if (range_result != database_stream_request_result::dispatched)
+				return result == database_stream_request_result::dispatched ? result : range_result;
+
+			result = range_result;
+
+			if (m_context.bulk_data[tier_index].load(acl_impl::k_memory_order_acquire) == nullptr)
+				break;	// Our request is allocating the bulk data, wait for it to complete before streaming the rest
 		}
 
-		if (first_chunk_index == ~0U)
-			return database_stream_request_result::done;	// Everything is streamed out or streaming, nothing to do
+		return result;
+	}
 
-		// Calculate and clamp our last chunk index (and handle wrapping for safety)
-		const uint64_t last_chunk_index64 = uint64_t(first_chunk_index) + uint64_t(num_chunks_to_stream) - 1;
-		const uint32_t last_chunk_index = last_chunk_index64 >= uint64_t(num_chunks) ? (num_chunks - 1) : uint32_t(last_chunk_index64);
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::stream_out_clip(quality_tier tier, uint32_t clip_index)
+	{
+		const acl_impl::database_clip_chunk_range& clip_chunk_range = acl_impl::get_database_header(*m_context.db).get_clip_chunk_ranges()[clip_index];
 
-		// Calculate our stream size and account for the fact that the last chunk doesn't have the same size
-		const uint32_t num_streaming_chunks = last_chunk_index - first_chunk_index + 1;
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		const uint32_t first_chunk_index = clip_chunk_range.first_chunk_index[tier_index];
+		const uint32_t end_chunk_index = first_chunk_index + clip_chunk_range.num_chunks[tier_index];
+
+		// Release our chunks if the clip was requested, releasing it again does nothing
+		const bitset_description clip_desc = bitset_description::make_from_num_bits(m_context.db->get_num_clips());
+		uint32_t* requested_clips = m_context.requested_clips[tier_index];
+		uint32_t* chunk_ref_counts = m_context.chunk_ref_counts[tier_index];
+		if (bitset_test(requested_clips, clip_desc, clip_index))
+		{
+			bitset_set(requested_clips, clip_desc, clip_index, false);
 
-		if (num_streaming_chunks == 0)
-			return database_stream_request_result::done;	// Nothing more to stream
+			for (uint32_t chunk_index = first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
+			{
+				ACL_ASSERT(chunk_ref_counts[chunk_index] != 0, "Chunk reference count underflow");
+				chunk_ref_counts[chunk_index]--;
+			}
+		}
+
+		const uint32_t* loaded_chunks = m_context.loaded_chunks[tier_index];
+		const uint32_t* streaming_chunks = m_context.streaming_chunks[tier_index];
+
+		// Stream out every range of chunks of our clip that are loaded, aren't streaming, and that no other clip references
+		database_stream_request_result result = database_stream_request_result::done;
+		uint32_t chunk_index = first_chunk_index;
+		while (chunk_index < end_chunk_index)
+		{
+			if (chunk_ref_counts[chunk_index] != 0 || !acl_impl::is_chunk_streamable(loaded_chunks, streaming_chunks, chunk_index, true))
+			{
+				chunk_index++;
+				continue;	// Still referenced, already streamed out, or streaming
+			}
+
+			const uint32_t range_first_chunk_index = chunk_index;
+			while (chunk_index < end_chunk_index && chunk_ref_counts[chunk_index] == 0 && acl_impl::is_chunk_streamable(loaded_chunks, streaming_chunks, chunk_index, true))
+				chunk_index++;
+
+			const database_stream_request_result range_result = stream_out_chunks(tier, range_first_chunk_index, chunk_index - range_first_chunk_index);
+			if (range_result != database_stream_request_result::dispatched)
+				return result == database_stream_request_result::dispatched ? result : range_result;
+
+			result = range_result;
+		}
+
+		return result;
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::stream_in_chunks(quality_tier tier, uint32_t first_chunk_index, uint32_t num_chunks)
+	{
+		const acl_impl::database_header& header = acl_impl::get_database_header(*m_context.db);
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		const acl_impl::database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
+
+		const bitset_description desc = bitset_description::make_from_num_bits(header.num_chunks[tier_index]);
+		const uint32_t max_chunk_size = header.max_chunk_size;
+		const uint32_t last_chunk_index = first_chunk_index + num_chunks - 1;
 
 		database_streamer* streamer = m_context.streamers[tier_index];
 
-		const streaming_request_id request_id = streamer->build_request(streaming_action::stream_out, tier, first_chunk_index, num_streaming_chunks);
+		const streaming_request_id request_id = streamer->build_request(streaming_action::stream_in, tier, first_chunk_index, num_chunks);
 		if (!request_id.is_valid())
 			return database_stream_request_result::no_free_streaming_requests;
 
@@ -586,53 +926,247 @@ namespace acl
 		const uint32_t stream_start_offset = first_chunk_description.offset;
 
 		const acl_impl::database_chunk_description& last_chunk_description = chunk_descriptions[last_chunk_index];
-		const uint32_t stream_size = ((num_streaming_chunks - 1) * max_chunk_size) + last_chunk_description.size;
+		const uint32_t stream_size = ((num_chunks - 1) * max_chunk_size) + last_chunk_description.size;
+
+		// We can allocate our bulk data if we haven't already
+		const bool can_allocate_bulk_data = m_context.bulk_data[tier_index].load(acl_impl::k_memory_order_acquire) == nullptr;
+
+		// Mark chunks as in-streaming, they hold memory until they stream out or the request is canceled
+		acl_impl::chunk_bitset_set_range(m_context.streaming_chunks[tier_index], desc, first_chunk_index, num_chunks, true);
+		m_context.resident_sizes[tier_index].fetch_add(acl_impl::calculate_chunk_range_size(m_context, tier_index, first_chunk_index, num_chunks), acl_impl::k_memory_order_relaxed);
+
+		// Fire the stream in request and let the streamer handle it (sync/async)
+		streamer->stream_in(stream_start_offset, stream_size, can_allocate_bulk_data, tier, request_id);
+
+		return database_stream_request_result::dispatched;
+	}
 
-		// Mark chunks as in-streaming
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::stream_out_chunks(quality_tier tier, uint32_t first_chunk_index, uint32_t num_chunks)
+	{
+		const acl_impl::database_header& header = acl_impl::get_database_header(*m_context.db);
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		const acl_impl::database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
+
+		const bitset_description desc = bitset_description::make_from_num_bits(header.num_chunks[tier_index]);
+		const uint32_t max_chunk_size = header.max_chunk_size;
+		const uint32_t last_chunk_index = first_chunk_index + num_chunks - 1;
+
+		uint32_t* loaded_chunks = m_context.loaded_chunks[tier_index];
 		uint32_t* streaming_chunks = m_context.streaming_chunks[tier_index];
-		bitset_set_range(streaming_chunks, desc, first_chunk_index, num_streaming_chunks, true);
 
-		const uint8_t*& bulk_data_ref = m_context.bulk_data[tier_index];
-		const uint8_t* bulk_data = bulk_data_ref;
-		ACL_ASSERT(bulk_data != nullptr, "Bulk data should be allocated when we stream out");
+		database_streamer* streamer = m_context.streamers[tier_index];
 
-		// We can deallocate our bulk data if we are streaming out the last chunks
-		const uint32_t num_loaded_chunks = bitset_count_set_bits(loaded_chunks, desc);
-		const bool can_deallocate_bulk_data = num_streaming_chunks == num_loaded_chunks;
-		if (can_deallocate_bulk_data)
-			bulk_data_ref = nullptr;
+		const streaming_request_id request_id = streamer->build_request(streaming_action::stream_out, tier, first_chunk_index, num_chunks);
+		if (!request_id.is_valid())
+			return database_stream_request_result::no_free_streaming_requests;
 
-		// Unregister our chunks
-		const uint32_t end_chunk_index = first_chunk_index + num_streaming_chunks;
-		for (uint32_t chunk_index = first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
-		{
-			const acl_impl::database_chunk_description& chunk_description = chunk_descriptions[chunk_index];
-			const acl_impl::database_chunk_header* chunk_header = chunk_description.get_chunk_header(bulk_data);
-			ACL_ASSERT(chunk_header->index == chunk_index, "Unexpected chunk index");
+		// Find the stream start offset from our first chunk's offset
+		const acl_impl::database_chunk_description& first_chunk_description = chunk_descriptions[first_chunk_index];
+		const uint32_t stream_start_offset = first_chunk_description.offset;
+
+		const acl_impl::database_chunk_description& last_chunk_description = chunk_descriptions[last_chunk_index];
+		const uint32_t stream_size = ((num_chunks - 1) * max_chunk_size) + last_chunk_description.size;
+
+		// We can deallocate our bulk data if we are streaming out the last chunks and no other request is in flight
+		const uint32_t num_loaded_chunks = acl_impl::chunk_bitset_count_set_bits(loaded_chunks, desc);
+		const bool can_deallocate_bulk_data = num_chunks == num_loaded_chunks && !is_streaming(tier);
+
+		// Mark chunks as in-streaming, they still count as resident until the stream out is dispatched
+		acl_impl::chunk_bitset_set_range(streaming_chunks, desc, first_chunk_index, num_chunks, true);
+
+		const uint8_t* bulk_data = m_context.bulk_data[tier_index].load(acl_impl::k_memory_order_acquire);
+		ACL_ASSERT(bulk_data != nullptr, "Bulk data should be allocated when we stream out");
 
-			const acl_impl::database_chunk_segment_header* chunk_segment_headers = chunk_header->get_segment_headers();
-			const uint32_t num_segments = chunk_header->num_segments;
-			for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+		if (m_context.segment_streaming_metadatas != nullptr)
+		{
+			// Our segment headers remain valid, decompression stops using our chunks once they are no longer loaded
+			acl_impl::chunk_bitset_set_range(loaded_chunks, desc, first_chunk_index, num_chunks, false);
+		}
+		else
+		{
+			// Unregister our chunks
+			const uint32_t end_chunk_index = first_chunk_index + num_chunks;
+			for (uint32_t chunk_index = first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
 			{
-				const acl_impl::database_chunk_segment_header& chunk_segment_header = chunk_segment_headers[segment_index];
+				const acl_impl::database_chunk_description& chunk_description = chunk_descriptions[chunk_index];
+				const acl_impl::database_chunk_header* chunk_header = chunk_description.get_chunk_header(bulk_data);
+				ACL_ASSERT(chunk_header->index == chunk_index, "Unexpected chunk index");
+
+				const acl_impl::database_chunk_segment_header* chunk_segment_headers = chunk_header->get_segment_headers();
+				const uint32_t num_segments = chunk_header->num_segments;
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				{
+					const acl_impl::database_chunk_segment_header& chunk_segment_header = chunk_segment_headers[segment_index];
 
 #if defined(ACL_HAS_ASSERT_CHECKS)
-				const acl_impl::database_runtime_clip_header* clip_header = chunk_segment_header.get_clip_header(m_context.clip_segment_headers);
-				ACL_ASSERT(clip_header->clip_hash == chunk_segment_header.clip_hash, "Unexpected clip hash");
+					const acl_impl::database_runtime_clip_header* clip_header = chunk_segment_header.get_clip_header(m_context.clip_segment_headers);
+					ACL_ASSERT(clip_header->clip_hash == chunk_segment_header.clip_hash, "Unexpected clip hash");
 #endif
 
-				acl_impl::database_runtime_segment_header* segment_header = chunk_segment_header.get_segment_header(m_context.clip_segment_headers);
-				const uint64_t tier_metadata = (uint64_t(chunk_segment_header.samples_offset) << 32) | chunk_segment_header.sample_indices;
-				ACL_ASSERT(segment_header->tier_metadata[tier_index].load(acl_impl::k_memory_order_relaxed) == tier_metadata, "Database tier metadata should have been initialized"); (void)tier_metadata;
-				segment_header->tier_metadata[tier_index].store(0, acl_impl::k_memory_order_relaxed);
+					acl_impl::database_runtime_segment_header* segment_header = chunk_segment_header.get_segment_header(m_context.clip_segment_headers);
+					const uint64_t tier_metadata = (uint64_t(chunk_segment_header.samples_offset) << 32) | chunk_segment_header.sample_indices;
+					ACL_ASSERT(segment_header->tier_metadata[tier_index].load(acl_impl::k_memory_order_relaxed) == tier_metadata, "Database tier metadata should have been initialized"); (void)tier_metadata;
+					segment_header->tier_metadata[tier_index].store(0, acl_impl::k_memory_order_relaxed);
+				}
 			}
 		}
 
-		// Fire the stream out request and let the streamer handle it (sync/async)
-		streamer->stream_out(stream_start_offset, stream_size, can_deallocate_bulk_data, tier, request_id);
+		// New decompression scopes no longer see our chunks but older ones might still read them, defer
+		// the stream out request until they end
+		streaming_request& request = streamer->m_requests[acl_impl::get_request_index(request_id)];
+		request.offset = stream_start_offset;
+		request.size = stream_size;
+		request.retire_epoch = m_context.epoch.load(acl_impl::k_memory_order_relaxed);
+		request.can_deallocate_bulk_data = can_deallocate_bulk_data;
+		request.is_deferred = true;
+
+		// Fire the stream out request right away if no decompression scope is in flight
+		dispatch_deferred_stream_outs();
 
 		return database_stream_request_result::dispatched;
 	}
 
+	template<class database_settings_type>
+	inline uint32_t database_context<database_settings_type>::dispatch_deferred_stream_outs()
+	{
+		if (!is_initialized())
+			return 0;
+
+		database_streamer* streamers[k_num_database_tiers];
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			streamers[tier_index] = m_context.streamers[tier_index];
+			for (uint32_t prev_tier_index = 0; prev_tier_index < tier_index; ++prev_tier_index)
+			{
+				if (streamers[tier_index] == m_context.streamers[prev_tier_index])
+					streamers[tier_index] = nullptr;	// Shared by multiple tiers, only visit its requests once
+			}
+		}
+
+		// Epochs only advance once every scope of the previous epoch has ended, requests retired before
+		// the current epoch are safe to dispatch once that happens. Those retired in the current epoch
+		// need a new epoch first, if no scope is in flight they can be dispatched right after.
+		for (uint32_t pass = 0; pass < 2; ++pass)
+		{
+			// Either we see the scopes in flight or they see the chunks we unpublished
+			std::atomic_thread_fence(acl_impl::k_memory_order_seq_cst);
+
+			const uint32_t epoch = m_context.epoch.load(acl_impl::k_memory_order_relaxed);
+			if (m_context.epoch_readers[(epoch - 1) % 2].count.load(acl_impl::k_memory_order_acquire) != 0)
+				break;	// Scopes of the previous epoch are still in flight
+
+			bool has_current_epoch_requests = false;
+			for (database_streamer* streamer : streamers)
+			{
+				if (streamer == nullptr)
+					continue;
+
+				for (uint32_t request_index = 0; request_index < streamer->m_num_requests; ++request_index)
+				{
+					streaming_request& request = streamer->m_requests[request_index];
+					if (!request.is_valid() || !request.is_deferred)
+						continue;
+
+					if (request.retire_epoch == epoch)
+					{
+						has_current_epoch_requests = true;
+						continue;
+					}
+
+					// No scope can read our chunks anymore, we can release them
+					const quality_tier tier = request.tier;
+					const uint32_t tier_index = uint32_t(tier) - 1;
+					const uint32_t offset = request.offset;
+					const uint32_t size = request.size;
+					const bool can_deallocate_bulk_data = request.can_deallocate_bulk_data;
+					const streaming_request_id request_id = acl_impl::make_request_id(request_index, request.generation_id);
+
+					request.is_deferred = false;
+
+					// Our chunks no longer count as resident once their stream out is dispatched
+					m_context.resident_sizes[tier_index].fetch_sub(acl_impl::calculate_chunk_range_size(m_context, tier_index, request.first_chunk_index, request.num_streaming_chunks), acl_impl::k_memory_order_relaxed);
+
+					if (can_deallocate_bulk_data)
+						m_context.bulk_data[tier_index].store(nullptr, acl_impl::k_memory_order_relaxed);
+
+					// Fire the stream out request and let the streamer handle it (sync/async)
+					streamer->stream_out(offset, size, can_deallocate_bulk_data, tier, request_id);
+				}
+			}
+
+			if (!has_current_epoch_requests)
+				break;
+
+			// New scopes enter the next epoch, the current one ends once its scopes have all ended
+			m_context.epoch.store(epoch + 1, acl_impl::k_memory_order_relaxed);
+		}
+
+		uint32_t num_deferred_requests = 0;
+		for (database_streamer* streamer : streamers)
+		{
+			if (streamer == nullptr)
+				continue;
+
+			for (uint32_t request_index = 0; request_index < streamer->m_num_requests; ++request_index)
+			{
+				const streaming_request& request = streamer->m_requests[request_index];
+				if (request.is_valid() && request.is_deferred)
+					num_deferred_requests++;
+			}
+		}
+
+		return num_deferred_requests;
+	}
+
+	template<class database_settings_type>
+	inline bool database_context<database_settings_type>::is_bulk_data_deallocation_deferred(quality_tier tier) const
+	{
+		const database_streamer* streamer = m_context.streamers[uint32_t(tier) - 1];
+		if (streamer == nullptr)
+			return false;	// Bulk data is inline
+
+		for (uint32_t request_index = 0; request_index < streamer->m_num_requests; ++request_index)
+		{
+			const streaming_request& request = streamer->m_requests[request_index];
+			if (request.is_valid() && request.is_deferred && request.tier == tier && request.can_deallocate_bulk_data)
+				return true;
+		}
+
+		return false;
+	}
+
+	template<class database_settings_type>
+	inline uint32_t database_context<database_settings_type>::get_deferred_stream_out_size(quality_tier tier) const
+	{
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		const database_streamer* streamer = m_context.streamers[tier_index];
+		if (streamer == nullptr)
+			return 0;	// Bulk data is inline
+
+		uint32_t deferred_size = 0;
+		for (uint32_t request_index = 0; request_index < streamer->m_num_requests; ++request_index)
+		{
+			const streaming_request& request = streamer->m_requests[request_index];
+			if (request.is_valid() && request.is_deferred && request.tier == tier)
+				deferred_size += acl_impl::calculate_chunk_range_size(m_context, tier_index, request.first_chunk_index, request.num_streaming_chunks);
+		}
+
+		return deferred_size;
+	}
+
+	template<class database_settings_type>
+	inline database_decompression_scope::database_decompression_scope(const database_context<database_settings_type>& context)
+		: m_context(context.is_initialized() ? &context.m_context : nullptr)
+		, m_epoch(m_context != nullptr ? acl_impl::enter_database_epoch(*m_context) : 0)
+	{
+	}
+
+	inline database_decompression_scope::~database_decompression_scope()
+	{
+		if (m_context != nullptr)
+			acl_impl::leave_database_epoch(*m_context, m_epoch);
+	}
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
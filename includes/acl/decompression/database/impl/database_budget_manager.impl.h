@@ -0,0 +1,394 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from database_budget_manager.h
+
+#include "acl/version.h"
+#include "acl/core/bitset.h"
+#include "acl/core/compressed_database.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/atomic.impl.h"
+#include "acl/core/impl/compressed_headers.h"
+#include "acl/decompression/database/impl/database_context.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		struct database_budget_clip_entry
+		{
+			uint32_t age;				// Number of updates since the clip was last used, ~0 if never used
+			uint32_t database_index;
+			uint32_t clip_index;
+		};
+
+		// A chunk holds memory when it is loaded and not streaming out, or when it is streaming in
+		inline bool is_chunk_resident(const database_context_v0& context, uint32_t tier_index, uint32_t chunk_index)
+		{
+			const uint32_t offset = chunk_index / 32;
+			const uint32_t mask = 1U << (31 - (chunk_index % 32));
+			const uint32_t loaded_chunks = chunk_bitset_load(context.loaded_chunks[tier_index], offset);
+			const uint32_t streaming_chunks = chunk_bitset_load(context.streaming_chunks[tier_index], offset);
+			return ((loaded_chunks ^ streaming_chunks) & mask) != 0;
+		}
+
+		// Returns the size of the chunks of a clip that aren't resident yet
+		inline uint64_t calculate_clip_stream_in_size(const database_context_v0& context, uint32_t tier_index, uint32_t clip_index)
+		{
+			const database_header& header = get_database_header(*context.db);
+			const database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
+			const database_clip_chunk_range& clip_chunk_range = header.get_clip_chunk_ranges()[clip_index];
+
+			const uint32_t first_chunk_index = clip_chunk_range.first_chunk_index[tier_index];
+			const uint32_t end_chunk_index = first_chunk_index + clip_chunk_range.num_chunks[tier_index];
+
+			uint64_t stream_in_size = 0;
+			for (uint32_t chunk_index = first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
+			{
+				if (!is_chunk_resident(context, tier_index, chunk_index))
+					stream_in_size += chunk_descriptions[chunk_index].size;
+			}
+
+			return stream_in_size;
+		}
+
+		// Returns the size of the loaded chunks that only the clip references, they will stream out once it is released
+		inline uint64_t calculate_clip_stream_out_size(const database_context_v0& context, uint32_t tier_index, uint32_t clip_index)
+		{
+			const database_header& header = get_database_header(*context.db);
+			const database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
+			const database_clip_chunk_range& clip_chunk_range = header.get_clip_chunk_ranges()[clip_index];
+
+			const uint32_t first_chunk_index = clip_chunk_range.first_chunk_index[tier_index];
+			const uint32_t end_chunk_index = first_chunk_index + clip_chunk_range.num_chunks[tier_index];
+
+			// If the clip was released but its chunks couldn't stream out, they are no longer referenced
+			const bitset_description clip_desc = bitset_description::make_from_num_bits(header.num_clips);
+			const uint32_t num_clip_references = bitset_test(context.requested_clips[tier_index], clip_desc, clip_index) ? 1 : 0;
+
+			const uint32_t* loaded_chunks = context.loaded_chunks[tier_index];
+			const uint32_t* streaming_chunks = context.streaming_chunks[tier_index];
+			const uint32_t* chunk_ref_counts = context.chunk_ref_counts[tier_index];
+
+			uint64_t stream_out_size = 0;
+			for (uint32_t chunk_index = first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
+			{
+				if (chunk_ref_counts[chunk_index] == num_clip_references && is_chunk_streamable(loaded_chunks, streaming_chunks, chunk_index, true))
+					stream_out_size += chunk_descriptions[chunk_index].size;
+			}
+
+			return stream_out_size;
+		}
+	}
+
+	template<class database_settings_type>
+	inline database_budget_manager<database_settings_type>::database_budget_manager()
+		: m_allocator(nullptr)
+		, m_databases(nullptr)
+		, m_clip_entries(nullptr)
+		, m_settings()
+		, m_stats()
+		, m_max_num_databases(0)
+		, m_num_databases(0)
+		, m_num_clip_entries(0)
+	{
+	}
+
+	template<class database_settings_type>
+	inline database_budget_manager<database_settings_type>::~database_budget_manager()
+	{
+		reset();
+	}
+
+	template<class database_settings_type>
+	inline bool database_budget_manager<database_settings_type>::initialize(iallocator& allocator, const database_budget_settings& settings, uint32_t max_num_databases)
+	{
+		ACL_ASSERT(!is_initialized(), "Cannot initialize the budget manager twice");
+		if (is_initialized())
+			return false;
+
+		ACL_ASSERT(max_num_databases != 0, "Must hold at least one database");
+		if (max_num_databases == 0)
+			return false;
+
+		m_allocator = &allocator;
+		m_databases = allocate_type_array<database_context<database_settings_type>*>(allocator, max_num_databases);
+		m_clip_entries = nullptr;
+		m_settings = settings;
+		m_stats = database_budget_stats();
+		m_max_num_databases = max_num_databases;
+		m_num_databases = 0;
+		m_num_clip_entries = 0;
+
+		return true;
+	}
+
+	template<class database_settings_type>
+	inline void database_budget_manager<database_settings_type>::reset()
+	{
+		if (!is_initialized())
+			return;	// Nothing to do
+
+		deallocate_type_array(*m_allocator, m_databases, m_max_num_databases);
+		deallocate_type_array(*m_allocator, m_clip_entries, m_num_clip_entries);
+
+		m_allocator = nullptr;
+		m_databases = nullptr;
+		m_clip_entries = nullptr;
+		m_max_num_databases = 0;
+		m_num_databases = 0;
+		m_num_clip_entries = 0;
+	}
+
+	template<class database_settings_type>
+	inline bool database_budget_manager<database_settings_type>::register_database(database_context<database_settings_type>& context)
+	{
+		ACL_ASSERT(is_initialized(), "Budget manager isn't initialized");
+		if (!is_initialized())
+			return false;
+
+		ACL_ASSERT(context.is_initialized(), "Database context isn't initialized");
+		if (!context.is_initialized())
+			return false;
+
+		ACL_ASSERT(context.m_context.chunk_ref_counts[0] != nullptr, "Database does not contain the range of chunks of each clip, it must be rebuilt");
+		if (context.m_context.chunk_ref_counts[0] == nullptr)
+			return false;
+
+		ACL_ASSERT(m_num_databases < m_max_num_databases, "Too many databases registered");
+		if (m_num_databases >= m_max_num_databases)
+			return false;
+
+		uint32_t num_clips = context.get_compressed_database()->get_num_clips();
+		for (uint32_t database_index = 0; database_index < m_num_databases; ++database_index)
+		{
+			ACL_ASSERT(m_databases[database_index] != &context, "Database context already registered");
+			if (m_databases[database_index] == &context)
+				return false;
+
+			num_clips += m_databases[database_index]->get_compressed_database()->get_num_clips();
+		}
+
+		// Grow our clip entries to hold every clip we manage
+		if (num_clips > m_num_clip_entries)
+		{
+			deallocate_type_array(*m_allocator, m_clip_entries, m_num_clip_entries);
+			m_clip_entries = allocate_type_array<acl_impl::database_budget_clip_entry>(*m_allocator, num_clips);
+			m_num_clip_entries = num_clips;
+		}
+
+		m_databases[m_num_databases++] = &context;
+		return true;
+	}
+
+	template<class database_settings_type>
+	inline void database_budget_manager<database_settings_type>::unregister_database(database_context<database_settings_type>& context)
+	{
+		for (uint32_t database_index = 0; database_index < m_num_databases; ++database_index)
+		{
+			if (m_databases[database_index] == &context)
+			{
+				// Swap with the last entry, the order doesn't matter
+				m_databases[database_index] = m_databases[--m_num_databases];
+				return;
+			}
+		}
+	}
+
+	template<class database_settings_type>
+	inline void database_budget_manager<database_settings_type>::update()
+	{
+		ACL_ASSERT(is_initialized(), "Budget manager isn't initialized");
+		if (!is_initialized())
+			return;
+
+		m_stats.num_updates++;
+
+		// Gather how much memory we use and when every clip was last used
+		uint64_t resident_size = 0;
+		uint64_t deferred_size = 0;
+		uint32_t num_entries = 0;
+		for (uint32_t database_index = 0; database_index < m_num_databases; ++database_index)
+		{
+			acl_impl::database_context_v0& context = m_databases[database_index]->m_context;
+			ACL_ASSERT(context.is_initialized(), "Database context was reset while registered");
+
+			// Release the chunks of earlier stream out requests once decompression no longer uses them
+			m_databases[database_index]->dispatch_deferred_stream_outs();
+
+			// The context tracks its resident size as chunks stream in and out, chunks whose stream out
+			// is still deferred remain resident but they will be released without our help
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				resident_size += context.resident_sizes[tier_index].load(acl_impl::k_memory_order_relaxed);
+				deferred_size += m_databases[database_index]->get_deferred_stream_out_size(quality_tier(tier_index + 1));
+			}
+
+			// Ages are relative to the usage clock of each context
+			const uint32_t timestamp = context.usage_timestamp.load(acl_impl::k_memory_order_relaxed);
+			const uint32_t num_clips = context.db->get_num_clips();
+			const std::atomic<uint32_t>* clip_last_use_timestamps = reinterpret_cast<const std::atomic<uint32_t>*>(context.clip_last_use_timestamps);
+			for (uint32_t clip_index = 0; clip_index < num_clips; ++clip_index)
+			{
+				const uint32_t last_use_timestamp = clip_last_use_timestamps[clip_index].load(acl_impl::k_memory_order_relaxed);
+
+				acl_impl::database_budget_clip_entry& entry = m_clip_entries[num_entries++];
+				entry.age = last_use_timestamp != 0 ? (timestamp - last_use_timestamp) : ~0U;
+				entry.database_index = database_index;
+				entry.clip_index = clip_index;
+			}
+
+			// Advance the clock, decompression will now record the new time
+			acl_impl::advance_usage_timestamp(context);
+		}
+
+		if (resident_size > m_settings.budget_size)
+		{
+			m_stats.num_over_budget_updates++;
+
+			// Only evict what the deferred stream outs won't release once decompression no longer uses them
+			const uint64_t releasable_size = resident_size - std::min(deferred_size, resident_size);
+			if (releasable_size > m_settings.budget_size)
+				evict_clips(num_entries, releasable_size);
+		}
+		else
+			stream_in_clips(num_entries, resident_size);
+
+		// Our estimates don't account for failed requests and deferred stream outs, read back what is actually resident
+		uint64_t final_resident_size = 0;
+		uint64_t bulk_data_size = 0;
+		for (uint32_t database_index = 0; database_index < m_num_databases; ++database_index)
+		{
+			const acl_impl::database_context_v0& context = m_databases[database_index]->m_context;
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				final_resident_size += context.resident_sizes[tier_index].load(acl_impl::k_memory_order_relaxed);
+
+				// Streamers allocate or map the bulk data of a whole tier at once
+				if (context.streamers[tier_index] != nullptr && context.bulk_data[tier_index].load(acl_impl::k_memory_order_acquire) != nullptr)
+					bulk_data_size += context.db->get_bulk_data_size(quality_tier(tier_index + 1));
+			}
+		}
+
+		m_stats.resident_size = final_resident_size;
+		m_stats.bulk_data_size = bulk_data_size;
+	}
+
+	template<class database_settings_type>
+	inline uint64_t database_budget_manager<database_settings_type>::evict_clips(uint32_t num_entries, uint64_t resident_size)
+	{
+		// Oldest first, we usually only need a few clips to fit within our budget and we sort them in batches as we go
+		constexpr uint32_t k_num_entries_per_batch = 64;
+		auto sort_predicate = [](const acl_impl::database_budget_clip_entry& lhs, const acl_impl::database_budget_clip_entry& rhs) { return lhs.age > rhs.age; };
+		uint32_t num_sorted_entries = 0;
+
+		// We release the lowest importance tier of every clip before the medium importance tier
+		for (uint32_t tier_index = k_num_database_tiers; tier_index-- > 0 && resident_size > m_settings.budget_size;)
+		{
+			const quality_tier tier = quality_tier(tier_index + 1);
+
+			for (uint32_t entry_index = 0; entry_index < num_entries && resident_size > m_settings.budget_size; ++entry_index)
+			{
+				if (entry_index == num_sorted_entries)
+				{
+					// Move the oldest of the remaining entries into the next batch
+					num_sorted_entries = std::min<uint32_t>(num_sorted_entries + k_num_entries_per_batch, num_entries);
+					std::partial_sort(m_clip_entries + entry_index, m_clip_entries + num_sorted_entries, m_clip_entries + num_entries, sort_predicate);
+				}
+
+				const acl_impl::database_budget_clip_entry& entry = m_clip_entries[entry_index];
+				database_context<database_settings_type>& database = *m_databases[entry.database_index];
+
+				const uint64_t stream_out_size = acl_impl::calculate_clip_stream_out_size(database.m_context, tier_index, entry.clip_index);
+				if (stream_out_size == 0)
+					continue;	// Nothing would be released
+
+				const database_stream_request_result result = database.stream_out_clip(tier, entry.clip_index);
+				if (result == database_stream_request_result::dispatched)
+				{
+					resident_size -= std::min<uint64_t>(stream_out_size, resident_size);
+					m_stats.num_stream_out_requests++;
+				}
+			}
+		}
+
+		return resident_size;
+	}
+
+	template<class database_settings_type>
+	inline uint64_t database_budget_manager<database_settings_type>::stream_in_clips(uint32_t num_entries, uint64_t resident_size)
+	{
+		// Only the clips used recently are streamed in, most recent first
+		const uint32_t max_num_idle_updates = m_settings.max_num_idle_updates;
+		auto is_recent_predicate = [max_num_idle_updates](const acl_impl::database_budget_clip_entry& entry) { return entry.age <= max_num_idle_updates; };
+		acl_impl::database_budget_clip_entry* recent_entries_end = std::partition(m_clip_entries, m_clip_entries + num_entries, is_recent_predicate);
+
+		auto sort_predicate = [](const acl_impl::database_budget_clip_entry& lhs, const acl_impl::database_budget_clip_entry& rhs) { return lhs.age < rhs.age; };
+		std::sort(m_clip_entries, recent_entries_end, sort_predicate);
+
+		const uint32_t num_recent_entries = uint32_t(recent_entries_end - m_clip_entries);
+
+		// We stream in the medium importance tier of every clip before the lowest importance tier
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			const quality_tier tier = quality_tier(tier_index + 1);
+
+			for (uint32_t entry_index = 0; entry_index < num_recent_entries; ++entry_index)
+			{
+				const acl_impl::database_budget_clip_entry& entry = m_clip_entries[entry_index];
+				database_context<database_settings_type>& database = *m_databases[entry.database_index];
+
+				// Clips whose chunks are resident because they are shared with other clips are requested as well
+				// to keep them resident
+				const bitset_description clip_desc = bitset_description::make_from_num_bits(database.m_context.db->get_num_clips());
+				const bool is_requested = bitset_test(database.m_context.requested_clips[tier_index], clip_desc, entry.clip_index);
+
+				const uint64_t stream_in_size = acl_impl::calculate_clip_stream_in_size(database.m_context, tier_index, entry.clip_index);
+				if (stream_in_size == 0 && is_requested)
+					continue;	// Already resident
+
+				if (resident_size + stream_in_size > m_settings.budget_size)
+					continue;	// Doesn't fit, a smaller clip might
+
+				const database_stream_request_result result = database.stream_in_clip(tier, entry.clip_index);
+				if (result == database_stream_request_result::dispatched)
+				{
+					resident_size += stream_in_size;
+					m_stats.num_stream_in_requests++;
+				}
+			}
+		}
+
+		return resident_size;
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
@@ -25,8 +25,14 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/bitset.h"
+#include "acl/core/compressed_database.h"
+#include "acl/core/compressed_tracks_version.h"
+#include "acl/core/impl/compressed_headers.h"
+#include "acl/core/impl/atomic.impl.h"
 #include "acl/core/impl/compiler_utils.h"
 
+#include <algorithm>
 #include <cstdint>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
@@ -39,6 +45,19 @@ namespace acl
 
 	namespace acl_impl
 	{
+		// Number of decompression scopes in flight that started in an epoch, on its own cache line to avoid false sharing
+		struct database_epoch_readers
+		{
+			std::atomic<uint32_t>	count;
+			uint8_t					padding[60];
+		};
+
+		static_assert(sizeof(database_epoch_readers) == 64, "Unexpected size");
+
+		// Size in bytes of the members of database_context_v0, 18 pointers and 5 integers with 2 tiers and 6 pointers
+		// and 1 integer more for every additional tier
+		constexpr uint32_t k_database_context_v0_members_size = uint32_t((6 + 6 * k_num_database_tiers) * sizeof(void*) + (3 + k_num_database_tiers) * sizeof(uint32_t));
+
 		// TODO: If we need to make the context smaller, we can use offsets for the bitsets instead of pointers
 		// from the clip_segment_headers base pointer. The bitsets also follow linearly in memory, we could store only
 		// one offset for the base, and index with the tier * desc.size
@@ -49,12 +68,14 @@ namespace acl
 			const compressed_database* db;							//   0 |   0
 
 			// We use arrays so we can index with (tier - 1) as our index
-			// Index 0 = medium importance tier, index 1 = low importance
+			// Index 0 = medium importance tier, index k_num_database_tiers - 1 = lowest importance
+			// Offsets below assume 2 database tiers
 
 			// Runtime related data, commonly accessed
 			uint8_t* clip_segment_headers;							//   4 |   8
 
-			const uint8_t* bulk_data[k_num_database_tiers];			//   8 |  16
+			// Set by the first stream in request from the thread that completes it, published with release semantics
+			std::atomic<const uint8_t*> bulk_data[k_num_database_tiers];	//   8 |  16
 
 			// Streaming related data not commonly accessed
 			database_streamer* streamers[k_num_database_tiers];		//  16 |  32
@@ -67,9 +88,31 @@ namespace acl
 			// Cached hash of the bound database instance
 			uint32_t db_hash;										//  44 |  88
 
-			uint8_t padding1[sizeof(void*) == 4 ? 16 : 36];			//  48 |  92
+			// Usage clock written by decompression in the clip last use timestamps, see advance_usage_clock()
+			std::atomic<uint32_t> usage_timestamp;					//  48 |  92
+
+			// Per clip streaming, only present if the database has clip chunk ranges
+			uint32_t* chunk_ref_counts[k_num_database_tiers];		//  52 |  96
+			uint32_t* requested_clips[k_num_database_tiers];		//  60 | 112
+
+			// Last usage timestamp of every clip, written when seeking
+			uint32_t* clip_last_use_timestamps;						//  68 | 128
+
+			// Where the samples of every segment live, only present if the database has segment streaming metadata
+			// When present, the runtime segment headers never change and chunk residency is checked when seeking
+			const database_segment_streaming_metadata* segment_streaming_metadatas;	//  72 | 136
 
-			//											Total size:	    64 | 128
+			// Deferred stream out requests are dispatched once the decompression scopes of the epoch they
+			// were issued in have ended, see database_decompression_scope
+			database_epoch_readers* epoch_readers;					//  76 | 144
+			std::atomic<uint32_t> epoch;							//  80 | 152
+
+			// Size in bytes of the chunks loaded or streaming in, chunks streaming out are excluded
+			std::atomic<uint32_t> resident_sizes[k_num_database_tiers];	//  84 | 156
+
+			uint8_t padding1[((k_database_context_v0_members_size + 63) & ~63U) - k_database_context_v0_members_size];	//  92 | 164
+
+			//											Total size:	   128 | 192
 
 			//////////////////////////////////////////////////////////////////////////
 
@@ -80,7 +123,175 @@ namespace acl
 		};
 
 		static_assert((sizeof(database_context_v0) % 64) == 0, "Unexpected size");
+		static_assert(sizeof(std::atomic<const uint8_t*>) == sizeof(const uint8_t*), "Atomic pointers must not change our layout");
 		static_assert(offsetof(database_context_v0, db) == 0, "db pointer needs to be the first member, see initialize_v0");
+
+		//////////////////////////////////////////////////////////////////////////
+		// The loaded and streaming chunk bit sets are updated by streamers when requests
+		// complete, from any thread and in any order. Their words are accessed atomically.
+
+		static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Chunk bit sets must be accessible atomically");
+
+		inline uint32_t chunk_bitset_load(const uint32_t* bitset, uint32_t offset)
+		{
+			return reinterpret_cast<const std::atomic<uint32_t>*>(bitset)[offset].load(k_memory_order_acquire);
+		}
+
+		inline void chunk_bitset_set_range(uint32_t* bitset, bitset_description desc, uint32_t start_bit_index, uint32_t num_bits, bool value)
+		{
+			ACL_ASSERT(num_bits == 0 || desc.is_bit_index_valid(start_bit_index), "Invalid start bit index: %d", start_bit_index);
+			ACL_ASSERT(start_bit_index + num_bits <= desc.get_num_bits(), "Invalid num bits: %d > %d", start_bit_index + num_bits, desc.get_num_bits());
+			(void)desc;
+
+			std::atomic<uint32_t>* atomic_bitset = reinterpret_cast<std::atomic<uint32_t>*>(bitset);
+
+			const uint32_t end_bit_index = start_bit_index + num_bits;
+			uint32_t bit_index = start_bit_index;
+			while (bit_index < end_bit_index)
+			{
+				// Build the mask of every bit within this word, the most significant bit is the first
+				const uint32_t offset = bit_index / 32;
+				const uint32_t first_bit = bit_index % 32;
+				const uint32_t num_word_bits = std::min<uint32_t>(32 - first_bit, end_bit_index - bit_index);
+				const uint32_t mask = (num_word_bits == 32 ? ~0U : (((1U << num_word_bits) - 1) << (32 - first_bit - num_word_bits)));
+
+				if (value)
+					atomic_bitset[offset].fetch_or(mask, k_memory_order_release);
+				else
+					atomic_bitset[offset].fetch_and(~mask, k_memory_order_release);
+
+				bit_index += num_word_bits;
+			}
+		}
+
+		inline uint32_t chunk_bitset_count_set_bits(const uint32_t* bitset, bitset_description desc)
+		{
+			const uint32_t size = desc.get_size();
+
+			uint32_t num_set_bits = 0;
+			for (uint32_t offset = 0; offset < size; ++offset)
+				num_set_bits += count_set_bits(chunk_bitset_load(bitset, offset));
+
+			return num_set_bits;
+		}
+
+		// Starts a decompression scope, returns the epoch to provide when it ends
+		inline uint32_t enter_database_epoch(const database_context_v0& context)
+		{
+			const uint32_t epoch = context.epoch.load(k_memory_order_relaxed);
+			context.epoch_readers[epoch % 2].count.fetch_add(1, k_memory_order_relaxed);
+
+			// Either stream out sees our scope or we see the chunks it unpublished
+			std::atomic_thread_fence(k_memory_order_seq_cst);
+			return epoch;
+		}
+
+		inline void leave_database_epoch(const database_context_v0& context, uint32_t epoch)
+		{
+			context.epoch_readers[epoch % 2].count.fetch_sub(1, k_memory_order_release);
+		}
+
+		// Advances the usage clock of a context, zero is reserved for clips that were never used
+		inline uint32_t advance_usage_timestamp(database_context_v0& context)
+		{
+			uint32_t timestamp = context.usage_timestamp.load(k_memory_order_relaxed) + 1;
+			if (timestamp == 0)
+				timestamp = 1;
+
+			context.usage_timestamp.store(timestamp, k_memory_order_relaxed);
+			return timestamp;
+		}
+
+		// Records that a clip is used by decompression, written with the current usage clock of the context
+		inline void record_clip_usage(const database_context_v0& context, const database_runtime_clip_header& clip_header)
+		{
+			const uint32_t timestamp = context.usage_timestamp.load(k_memory_order_relaxed);
+			std::atomic<uint32_t>& clip_last_use_timestamp = reinterpret_cast<std::atomic<uint32_t>*>(context.clip_last_use_timestamps)[clip_header.clip_index];
+
+			// Clips are seeked many times per update, only the first seek writes to avoid dirtying the cache line
+			if (clip_last_use_timestamp.load(k_memory_order_relaxed) != timestamp)
+				clip_last_use_timestamp.store(timestamp, k_memory_order_relaxed);
+		}
+
+		// Returns the size in bytes of a range of chunks
+		inline uint32_t calculate_chunk_range_size(const database_context_v0& context, uint32_t tier_index, uint32_t first_chunk_index, uint32_t num_chunks)
+		{
+			const database_header& header = get_database_header(*context.db);
+			const database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
+
+			uint32_t size = 0;
+			for (uint32_t chunk_index = first_chunk_index; chunk_index < first_chunk_index + num_chunks; ++chunk_index)
+				size += chunk_descriptions[chunk_index].size;
+
+			return size;
+		}
+
+		inline bool is_chunk_loaded(const uint32_t* loaded_chunks, uint32_t chunk_index)
+		{
+			const uint32_t mask = 1U << (31 - (chunk_index % 32));
+			return (chunk_bitset_load(loaded_chunks, chunk_index / 32) & mask) != 0;
+		}
+
+		// Atomically loads the tier metadata of a runtime segment header, zero if its samples are not streamed in
+		// Older databases patch the runtime segment headers when chunks stream in and out while newer databases
+		// initialize them once and we check here if the chunk that contains the samples is loaded instead.
+		inline uint64_t load_segment_tier_metadata(const database_context_v0& context, const database_runtime_clip_header& clip_header, const database_runtime_segment_header& segment_header, uint32_t tier_index)
+		{
+			const uint64_t tier_metadata = segment_header.tier_metadata[tier_index].load(k_memory_order_relaxed);
+
+			const database_segment_streaming_metadata* segment_streaming_metadatas = context.segment_streaming_metadatas;
+			if (tier_metadata == 0 || segment_streaming_metadatas == nullptr)
+				return tier_metadata;
+
+			const uint32_t segment_header_offset = uint32_t(reinterpret_cast<const uint8_t*>(&segment_header) - context.clip_segment_headers);
+			const uint32_t segment_index = get_database_runtime_segment_index(clip_header.clip_index, segment_header_offset);
+			const uint32_t chunk_index = segment_streaming_metadatas[segment_index].chunk_index[tier_index];
+
+			// The loaded bit is read with acquire semantics, the chunk data and the bulk data pointer are visible if set
+			return is_chunk_loaded(context.loaded_chunks[tier_index], chunk_index) ? tier_metadata : 0;
+		}
+
+		// Atomically loads the tier metadata of every database tier of a runtime segment header
+		// Returns the bit set of the sample indices stored in the database that are streamed in
+		inline uint32_t load_segment_tiers_metadata(const database_context_v0& context, const database_runtime_clip_header& clip_header, const database_runtime_segment_header& segment_header, uint64_t (&out_tier_metadata)[k_num_database_tiers])
+		{
+			uint32_t sample_indices = 0;
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				out_tier_metadata[tier_index] = load_segment_tier_metadata(context, clip_header, segment_header, tier_index);
+				sample_indices |= uint32_t(out_tier_metadata[tier_index]);
+			}
+
+			return sample_indices;
+		}
+
+		// Finds the most important database tier that contains a sample and returns where the segment samples begin
+		// Returns nullptr if the sample lives in the compressed clip, the sample indices are left untouched
+		inline const uint8_t* find_segment_tier_samples(const database_context_v0& context, const uint64_t (&tier_metadata)[k_num_database_tiers], uint64_t sample_index, uint32_t& out_sample_indices)
+		{
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				if ((tier_metadata[tier_index] & sample_index) != 0)
+				{
+					out_sample_indices = uint32_t(tier_metadata[tier_index]);
+					return context.bulk_data[tier_index].load(k_memory_order_acquire) + uint32_t(tier_metadata[tier_index] >> 32);	// Bulk data is set once streamed in
+				}
+			}
+
+			return nullptr;
+		}
+
+		template<class decompression_settings_type>
+		constexpr bool is_database_supported_impl()
+		{
+			return decompression_settings_type::database_settings_type::version_supported() != compressed_tracks_version16::none;
+		}
+
+		template<class decompression_settings_type>
+		constexpr bool is_clip_usage_tracking_supported_impl()
+		{
+			return is_database_supported_impl<decompression_settings_type>() && decompression_settings_type::database_settings_type::is_clip_usage_tracking_supported();
+		}
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
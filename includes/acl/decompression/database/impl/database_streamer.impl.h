@@ -28,6 +28,7 @@
 
 #include "acl/version.h"
 #include "acl/core/bitset.h"
+#include "acl/core/hash.h"
 #include "acl/core/impl/atomic.impl.h"
 #include "acl/core/impl/compressed_headers.h"
 #include "acl/decompression/database/impl/database_context.h"
@@ -70,53 +71,63 @@ namespace acl
 				// Streaming in
 				if (success)
 				{
-					const uint8_t*& bulk_data_ref = context.bulk_data[tier_index_];
-					const uint8_t* bulk_data_ = bulk_data_ref;
+					std::atomic<const uint8_t*>& bulk_data_ref = context.bulk_data[tier_index_];
+					const uint8_t* bulk_data_ = bulk_data_ref.load(k_memory_order_acquire);
 					if (bulk_data_ == nullptr)
 					{
 						// This is the first stream in request, our bulk data should be allocated now, query and cache it
+						// We might be running on a worker thread, the issuing thread acquires the pointer we publish
 						const database_streamer* streamer_ = context.streamers[tier_index_];
 						bulk_data_ = streamer_->get_bulk_data(tier);
 						ACL_ASSERT(bulk_data_ != nullptr, "Bulk data should be allocated when we stream in");
 
-						bulk_data_ref = bulk_data_;
+						bulk_data_ref.store(bulk_data_, k_memory_order_release);
 					}
 
-					// Register our new chunks
-					const database_header& header_ = get_database_header(*context.db);
-					const database_chunk_description* chunk_descriptions_ = tier == quality_tier::medium_importance ? header_.get_chunk_descriptions_medium() : header_.get_chunk_descriptions_low();
-					const uint32_t end_chunk_index = first_chunk_index + num_streaming_chunks;
-					for (uint32_t chunk_index = first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
+					// Newer databases initialize the runtime segment headers once, marking our chunks as loaded is enough
+					if (context.segment_streaming_metadatas == nullptr)
 					{
-						const database_chunk_description& chunk_description = chunk_descriptions_[chunk_index];
-						const database_chunk_header* chunk_header = chunk_description.get_chunk_header(bulk_data_);
-						ACL_ASSERT(chunk_header->index == chunk_index, "Unexpected chunk index");
-
-						const database_chunk_segment_header* chunk_segment_headers = chunk_header->get_segment_headers();
-						const uint32_t num_segments = chunk_header->num_segments;
-						for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+						// Register our new chunks
+						const database_header& header_ = get_database_header(*context.db);
+						const database_chunk_description* chunk_descriptions_ = header_.get_chunk_descriptions(tier_index_);
+						const uint32_t end_chunk_index = first_chunk_index + num_streaming_chunks;
+						for (uint32_t chunk_index = first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
 						{
-							const database_chunk_segment_header& chunk_segment_header = chunk_segment_headers[segment_index];
+							const database_chunk_description& chunk_description = chunk_descriptions_[chunk_index];
+							const database_chunk_header* chunk_header = chunk_description.get_chunk_header(bulk_data_);
+							ACL_ASSERT(chunk_header->index == chunk_index, "Unexpected chunk index");
+
+							const database_chunk_segment_header* chunk_segment_headers = chunk_header->get_segment_headers();
+							const uint32_t num_segments = chunk_header->num_segments;
+							for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+							{
+								const database_chunk_segment_header& chunk_segment_header = chunk_segment_headers[segment_index];
 
 #if defined(ACL_HAS_ASSERT_CHECKS)
-							const database_runtime_clip_header* clip_header = chunk_segment_header.get_clip_header(context.clip_segment_headers);
-							ACL_ASSERT(clip_header->clip_hash == chunk_segment_header.clip_hash, "Unexpected clip hash");
+								const database_runtime_clip_header* clip_header = chunk_segment_header.get_clip_header(context.clip_segment_headers);
+								ACL_ASSERT(clip_header->clip_hash == chunk_segment_header.clip_hash, "Unexpected clip hash");
 #endif
 
-							database_runtime_segment_header* segment_header = chunk_segment_header.get_segment_header(context.clip_segment_headers);
-							ACL_ASSERT(segment_header->tier_metadata[tier_index_].load(k_memory_order_relaxed) == 0, "Tier metadata should not be initialized");
-							segment_header->tier_metadata[tier_index_].store((uint64_t(chunk_segment_header.samples_offset) << 32) | chunk_segment_header.sample_indices, k_memory_order_relaxed);
+								database_runtime_segment_header* segment_header = chunk_segment_header.get_segment_header(context.clip_segment_headers);
+								ACL_ASSERT(segment_header->tier_metadata[tier_index_].load(k_memory_order_relaxed) == 0, "Tier metadata should not be initialized");
+								segment_header->tier_metadata[tier_index_].store((uint64_t(chunk_segment_header.samples_offset) << 32) | chunk_segment_header.sample_indices, k_memory_order_relaxed);
+							}
 						}
 					}
 
 					// Mark chunks as done streaming
 					uint32_t* loaded_chunks_ = context.loaded_chunks[tier_index_];
-					bitset_set_range(loaded_chunks_, desc_, first_chunk_index, num_streaming_chunks, true);
+					chunk_bitset_set_range(loaded_chunks_, desc_, first_chunk_index, num_streaming_chunks, true);
+				}
+				else
+				{
+					// Our chunks never made it in
+					context.resident_sizes[tier_index_].fetch_sub(calculate_chunk_range_size(context, tier_index_, first_chunk_index, num_streaming_chunks), k_memory_order_relaxed);
 				}
 
 				// Mark chunks as no longer streaming
 				uint32_t* streaming_chunks_ = context.streaming_chunks[tier_index_];
-				bitset_set_range(streaming_chunks_, desc_, first_chunk_index, num_streaming_chunks, false);
+				chunk_bitset_set_range(streaming_chunks_, desc_, first_chunk_index, num_streaming_chunks, false);
 			}
 			else
 			{
@@ -125,11 +136,11 @@ namespace acl
 
 				// Mark chunks as done streaming out
 				uint32_t* loaded_chunks_ = context.loaded_chunks[tier_index_];
-				bitset_set_range(loaded_chunks_, desc_, first_chunk_index, num_streaming_chunks, false);
+				chunk_bitset_set_range(loaded_chunks_, desc_, first_chunk_index, num_streaming_chunks, false);
 
 				// Mark chunks as no longer streaming
 				uint32_t* streaming_chunks_ = context.streaming_chunks[tier_index_];
-				bitset_set_range(streaming_chunks_, desc_, first_chunk_index, num_streaming_chunks, false);
+				chunk_bitset_set_range(streaming_chunks_, desc_, first_chunk_index, num_streaming_chunks, false);
 			}
 		}
 	}
@@ -193,6 +204,42 @@ namespace acl
 		request.reset();
 	}
 
+	inline bool database_streamer::verify(streaming_request_id request_id) const
+	{
+		const uint32_t request_index = acl_impl::get_request_index(request_id);
+		ACL_ASSERT(request_index < m_num_requests, "Invalid request index");
+		if (request_index >= m_num_requests)
+			return false;
+
+		const streaming_request& request = m_requests[request_index];
+		ACL_ASSERT(request.is_valid() && request.generation_id == acl_impl::get_generation_id(request_id), "Request is invalid");
+		ACL_ASSERT(request.action == streaming_action::stream_in, "Only stream in requests can be verified");
+		if (!request.is_valid() || request.generation_id != acl_impl::get_generation_id(request_id) || request.action != streaming_action::stream_in)
+			return false;
+
+		const acl_impl::database_header& header = acl_impl::get_database_header(*m_context->db);
+		if (!header.get_has_chunk_hashes())
+			return true;	// Nothing to verify against
+
+		const uint8_t* bulk_data = get_bulk_data(request.tier);
+		if (bulk_data == nullptr)
+			return false;
+
+		const uint32_t tier_index = uint32_t(request.tier) - 1;
+		const acl_impl::database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
+		const uint32_t* chunk_hashes = header.get_chunk_hashes(tier_index);
+
+		const uint32_t end_chunk_index = request.first_chunk_index + request.num_streaming_chunks;
+		for (uint32_t chunk_index = request.first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
+		{
+			const acl_impl::database_chunk_description& chunk_description = chunk_descriptions[chunk_index];
+			if (fast_hash32(chunk_description.get_chunk_header(bulk_data), chunk_description.size) != chunk_hashes[chunk_index])
+				return false;
+		}
+
+		return true;
+	}
+
 	inline void database_streamer::bind(acl_impl::database_context_v0& context)
 	{
 		ACL_ASSERT(m_context == nullptr || m_context == &context, "Streamer cannot be bound to two different database contexts");
@@ -201,14 +248,20 @@ namespace acl
 
 	inline streaming_request_id database_streamer::build_request(streaming_action action, quality_tier tier, uint32_t first_chunk_index, uint32_t num_streaming_chunks)
 	{
-		const uint32_t request_index = m_next_request_index;
-		streaming_request& request = m_requests[request_index];
-		ACL_ASSERT(request.tier == quality_tier::highest_importance, "Ran out of free requests");
-		if (request.tier != quality_tier::highest_importance)
-			return k_invalid_streamer_request_id;
+		// Requests can complete in any order, look for the next free one
+		uint32_t request_index = m_next_request_index;
+		uint32_t num_requests_searched = 0;
+		while (m_requests[request_index].is_valid())
+		{
+			if (++num_requests_searched == m_num_requests)
+				return k_invalid_streamer_request_id;	// Every request is in flight
+
+			request_index = (request_index + 1) % m_num_requests;
+		}
 
-		// This request entry is valid, we'll use it
-		m_next_request_index = (m_next_request_index + 1) % m_num_requests;
+		// This request entry is free, we'll use it
+		streaming_request& request = m_requests[request_index];
+		m_next_request_index = (request_index + 1) % m_num_requests;
 
 		// Get our generation id
 		const uint32_t generation_id = m_generation_id++;
@@ -218,6 +271,10 @@ namespace acl
 		request.first_chunk_index = first_chunk_index;
 		request.num_streaming_chunks = num_streaming_chunks;
 		request.generation_id = generation_id;
+		request.is_deferred = false;
+
+		// Our fields are written, the request can be completed from any thread
+		request.publish();
 
 		return acl_impl::make_request_id(request_index, generation_id);
 	}
@@ -0,0 +1,207 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from database_usage_trace.h
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/hash.h"
+#include "acl/core/memory_utils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	inline database_usage_trace::database_usage_trace()
+		: m_edges(nullptr)
+		, m_sample_clip_indices(nullptr)
+		, m_allocator(nullptr)
+		, m_num_slots(0)
+		, m_max_num_edges(0)
+		, m_max_num_clips_per_sample(0)
+		, m_num_edges(0)
+		, m_num_samples(0)
+		, m_num_dropped_edges(0)
+	{
+	}
+
+	inline database_usage_trace::~database_usage_trace()
+	{
+		reset();
+	}
+
+	inline bool database_usage_trace::initialize(iallocator& allocator, uint32_t max_num_edges, uint32_t max_num_clips_per_sample)
+	{
+		ACL_ASSERT(!is_initialized(), "Cannot initialize the trace twice");
+		if (is_initialized())
+			return false;
+
+		ACL_ASSERT(max_num_edges != 0 && max_num_edges <= (1U << 30), "Invalid number of edges: %u", max_num_edges);
+		if (max_num_edges == 0 || max_num_edges > (1U << 30))
+			return false;
+
+		ACL_ASSERT(max_num_clips_per_sample >= 2, "A sample must hold at least two clips");
+		if (max_num_clips_per_sample < 2)
+			return false;
+
+		// Keep the table at most half full to keep probing short
+		uint32_t num_slots = 1;
+		while (num_slots < max_num_edges * 2)
+			num_slots *= 2;
+
+		m_allocator = &allocator;
+		m_edges = allocate_type_array<database_clip_co_usage>(allocator, num_slots);
+		m_sample_clip_indices = allocate_type_array<uint32_t>(allocator, max_num_clips_per_sample);
+		m_num_slots = num_slots;
+		m_max_num_edges = max_num_edges;
+		m_max_num_clips_per_sample = max_num_clips_per_sample;
+
+		clear();
+
+		return true;
+	}
+
+	inline void database_usage_trace::reset()
+	{
+		if (!is_initialized())
+			return;	// Nothing to do
+
+		deallocate_type_array(*m_allocator, m_edges, m_num_slots);
+		deallocate_type_array(*m_allocator, m_sample_clip_indices, m_max_num_clips_per_sample);
+
+		m_edges = nullptr;
+		m_sample_clip_indices = nullptr;
+		m_allocator = nullptr;
+		m_num_slots = 0;
+		m_max_num_edges = 0;
+		m_max_num_clips_per_sample = 0;
+		m_num_edges = 0;
+		m_num_samples = 0;
+		m_num_dropped_edges = 0;
+	}
+
+	inline void database_usage_trace::clear()
+	{
+		std::fill(m_edges, m_edges + m_num_slots, database_clip_co_usage());
+
+		m_num_edges = 0;
+		m_num_samples = 0;
+		m_num_dropped_edges = 0;
+	}
+
+	template<class database_settings_type>
+	inline void database_usage_trace::record(const database_context<database_settings_type>& context)
+	{
+		ACL_ASSERT(is_initialized(), "Trace isn't initialized");
+		if (!is_initialized())
+			return;
+
+		const uint32_t num_clips = context.get_recently_used_clips(m_sample_clip_indices, m_max_num_clips_per_sample);
+		record_clips(m_sample_clip_indices, num_clips);
+	}
+
+	inline void database_usage_trace::record_clips(const uint32_t* clip_indices, uint32_t num_clips)
+	{
+		ACL_ASSERT(is_initialized(), "Trace isn't initialized");
+		if (!is_initialized())
+			return;
+
+		ACL_ASSERT(clip_indices != nullptr || num_clips == 0, "Cannot record clips from a null buffer");
+		if (clip_indices == nullptr)
+			return;
+
+		m_num_samples++;
+
+		num_clips = std::min(num_clips, m_max_num_clips_per_sample);
+		for (uint32_t index0 = 0; index0 < num_clips; ++index0)
+		{
+			for (uint32_t index1 = index0 + 1; index1 < num_clips; ++index1)
+			{
+				if (clip_indices[index0] == clip_indices[index1])
+					continue;	// A clip used twice isn't an edge
+
+				if (!add_edge(clip_indices[index0], clip_indices[index1]))
+					m_num_dropped_edges++;
+			}
+		}
+	}
+
+	inline uint32_t database_usage_trace::get_edges(database_clip_co_usage* out_edges, uint32_t max_num_edges) const
+	{
+		ACL_ASSERT(out_edges != nullptr || max_num_edges == 0, "Cannot write edges to a null buffer");
+		if (out_edges == nullptr)
+			return 0;
+
+		// Empty slots have a weight of zero and sort last, we never copy them
+		const uint32_t num_edges = std::min(max_num_edges, m_num_edges);
+		auto sort_predicate = [](const database_clip_co_usage& lhs, const database_clip_co_usage& rhs) { return lhs.weight > rhs.weight; };
+		std::partial_sort_copy(m_edges, m_edges + m_num_slots, out_edges, out_edges + num_edges, sort_predicate);
+
+		return num_edges;
+	}
+
+	inline bool database_usage_trace::add_edge(uint32_t clip_index0, uint32_t clip_index1)
+	{
+		// Edges are undirected, the smallest clip index comes first
+		if (clip_index0 > clip_index1)
+			std::swap(clip_index0, clip_index1);
+
+		const uint32_t slot_mask = m_num_slots - 1;
+		uint32_t slot_index = hash_combine(hash32(clip_index0), hash32(clip_index1)) & slot_mask;
+		while (true)
+		{
+			database_clip_co_usage& edge = m_edges[slot_index];
+			if (edge.weight == 0)
+			{
+				// New edge
+				if (m_num_edges >= m_max_num_edges)
+					return false;
+
+				edge.clip_index0 = clip_index0;
+				edge.clip_index1 = clip_index1;
+				edge.weight = 1;
+				m_num_edges++;
+				return true;
+			}
+
+			if (edge.clip_index0 == clip_index0 && edge.clip_index1 == clip_index1)
+			{
+				// Saturate rather than wrap, the heaviest edges matter most
+				if (edge.weight != ~0U)
+					edge.weight++;
+				return true;
+			}
+
+			slot_index = (slot_index + 1) & slot_mask;
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
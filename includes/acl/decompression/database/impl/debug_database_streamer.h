@@ -42,6 +42,7 @@ namespace acl
 	////////////////////////////////////////////////////////////////////////////////
 	// Implements a debug streamer where we duplicate the bulk data in memory and use
 	// memcpy to stream in the data. Streamed out data is explicitly set to 0xCD with memset.
+	// Streamed in chunks are verified against their hash.
 	// It cannot be shared between tiers.
 	////////////////////////////////////////////////////////////////////////////////
 	class debug_database_streamer final : public database_streamer
@@ -87,6 +88,7 @@ namespace acl
 			}
 
 			std::memcpy(m_streamed_bulk_data + offset, m_src_bulk_data + offset, size);
+			ACL_ASSERT(verify(request_id), "Streamed chunks do not match their hash");
 			complete(request_id);
 		}
 
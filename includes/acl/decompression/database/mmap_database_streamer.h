@@ -0,0 +1,183 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/database/database_streamer.h"
+
+#include <cstdint>
+
+#if defined(__linux__)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+#if defined(__linux__)
+	////////////////////////////////////////////////////////////////////////////////
+	// Implements a streamer where the bulk data file of a quality tier, as output by
+	// split_database_bulk_data(..), is memory mapped. The bulk data is read straight from
+	// the mapping without any copy and the kernel pages it in and out.
+	// Streaming in hints that the chunks will soon be needed with MADV_WILLNEED and
+	// streaming out releases their pages with MADV_DONTNEED. The mapping is read-only
+	// and released pages are read back from the file if they are ever touched again.
+	// Transparent huge pages can optionally be requested for the mapping, the kernel
+	// only honors this if it supports them for file backed memory.
+	// Everything is synchronous and as such, it cannot be shared between tiers.
+	// Up to 16 stream out requests can be deferred by decompression scopes at once.
+	////////////////////////////////////////////////////////////////////////////////
+	class mmap_database_streamer final : public database_streamer
+	{
+	public:
+		mmap_database_streamer(const char* bulk_data_filename, uint32_t bulk_data_size, bool use_transparent_huge_pages = false)
+			: database_streamer(m_requests, k_max_num_requests)
+			, m_bulk_data(nullptr)
+			, m_bulk_data_size(bulk_data_size)
+			, m_page_size(uint32_t(sysconf(_SC_PAGESIZE)))
+		{
+			ACL_ASSERT(bulk_data_filename != nullptr, "Bulk data filename cannot be null");
+			if (bulk_data_size == 0 || bulk_data_filename == nullptr)
+				return;	// Nothing to map
+
+			const int fd = open(bulk_data_filename, O_RDONLY | O_CLOEXEC);
+			ACL_ASSERT(fd >= 0, "Failed to open the bulk data file");
+			if (fd < 0)
+				return;
+
+			struct stat file_stats;
+			const bool is_large_enough = fstat(fd, &file_stats) == 0 && uint64_t(file_stats.st_size) >= uint64_t(bulk_data_size);
+			ACL_ASSERT(is_large_enough, "Bulk data file is smaller than the bulk data size");
+
+			void* mapping = is_large_enough ? mmap(nullptr, bulk_data_size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+			ACL_ASSERT(mapping != MAP_FAILED, "Failed to memory map the bulk data file");
+
+			// The mapping retains its own reference to the file
+			close(fd);
+
+			if (mapping == MAP_FAILED)
+				return;
+
+#if defined(MADV_HUGEPAGE)
+			// This is only a hint, if it isn't supported we use regular pages
+			if (use_transparent_huge_pages)
+				(void)madvise(mapping, bulk_data_size, MADV_HUGEPAGE);
+#else
+			(void)use_transparent_huge_pages;
+#endif
+
+			m_bulk_data = static_cast<const uint8_t*>(mapping);
+		}
+
+		virtual ~mmap_database_streamer() override
+		{
+			if (m_bulk_data != nullptr)
+				munmap(const_cast<uint8_t*>(m_bulk_data), m_bulk_data_size);
+		}
+
+		virtual bool is_initialized() const override { return m_bulk_data_size == 0 || m_bulk_data != nullptr; }
+
+		virtual const uint8_t* get_bulk_data(quality_tier tier) const override
+		{
+			ACL_ASSERT(tier != quality_tier::highest_importance, "Cannot stream the highest importance tier");
+			(void)tier;
+			return m_bulk_data;
+		}
+
+		virtual void stream_in(uint32_t offset, uint32_t size, bool can_allocate_bulk_data, quality_tier tier, streaming_request_id request_id) override
+		{
+			ACL_ASSERT(offset < m_bulk_data_size, "Stream offset is outside of the bulk data range");
+			ACL_ASSERT(size <= m_bulk_data_size, "Stream size is larger than the bulk data size");
+			ACL_ASSERT(uint64_t(offset) + uint64_t(size) <= uint64_t(m_bulk_data_size), "Streaming request is outside of the bulk data range");
+			(void)can_allocate_bulk_data;
+			(void)tier;
+
+			// Every page that touches our chunks is needed, round outwards
+			const uint64_t start_offset = uint64_t(offset) & ~uint64_t(m_page_size - 1);
+			const uint64_t end_offset = uint64_t(offset) + uint64_t(size);
+
+			// Read ahead is only a hint, the data is paged in on demand if it fails
+			if (end_offset > start_offset)
+				(void)madvise(const_cast<uint8_t*>(m_bulk_data) + start_offset, size_t(end_offset - start_offset), MADV_WILLNEED);
+
+			complete(request_id);
+		}
+
+		virtual void stream_out(uint32_t offset, uint32_t size, bool can_deallocate_bulk_data, quality_tier tier, streaming_request_id request_id) override
+		{
+			ACL_ASSERT(offset < m_bulk_data_size, "Stream offset is outside of the bulk data range");
+			ACL_ASSERT(size <= m_bulk_data_size, "Stream size is larger than the bulk data size");
+			ACL_ASSERT(uint64_t(offset) + uint64_t(size) <= uint64_t(m_bulk_data_size), "Streaming request is outside of the bulk data range");
+			(void)tier;
+
+			// Neighboring chunks might still be streamed in, only release the pages fully contained in our chunks
+			// unless everything is streamed out
+			uint64_t start_offset;
+			uint64_t end_offset;
+			if (can_deallocate_bulk_data)
+			{
+				start_offset = 0;
+				end_offset = m_bulk_data_size;
+			}
+			else
+			{
+				const uint64_t page_mask = uint64_t(m_page_size - 1);
+				start_offset = (uint64_t(offset) + page_mask) & ~page_mask;
+				end_offset = (uint64_t(offset) + uint64_t(size)) & ~page_mask;
+			}
+
+			if (end_offset > start_offset)
+				(void)madvise(const_cast<uint8_t*>(m_bulk_data) + start_offset, size_t(end_offset - start_offset), MADV_DONTNEED);
+
+			complete(request_id);
+		}
+
+	private:
+		mmap_database_streamer(const mmap_database_streamer&) = delete;
+		mmap_database_streamer& operator=(const mmap_database_streamer&) = delete;
+
+		const uint8_t* m_bulk_data;
+		uint32_t m_bulk_data_size;
+		uint32_t m_page_size;
+
+		// Stream in and out requests complete right away, but deferred stream out requests hold theirs
+		// until the decompression scopes that might read their chunks end
+		static constexpr uint32_t k_max_num_requests = 16;
+		streaming_request m_requests[k_max_num_requests];
+	};
+#endif
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/bitset.h"
 #include "acl/core/compressed_database.h"
 #include "acl/core/compressed_tracks.h"
 #include "acl/core/compressed_tracks_version.h"
@@ -153,6 +154,24 @@ namespace acl
 		// If wrapping is not disabled, this is the policy from the compressed data by default.
 		sample_looping_policy get_looping_policy() const;
 
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the size in bytes of the decoded key frame cache required for the bound compressed tracks instance.
+		// Returns 0 if the bound tracks do not support it (e.g. scalar tracks).
+		uint32_t get_keyframe_cache_size() const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Binds the provided buffer to be used as our decoded key frame cache.
+		// When consecutive seeks land between the same two key frames, the unpacked key frames
+		// are re-used and only the interpolation is performed when decompressing every track.
+		// Requires 'decompression_settings::is_keyframe_cache_supported()' to be enabled.
+		// The buffer must be 16 bytes aligned, contain at least 'get_keyframe_cache_size()' bytes, and
+		// must remain valid while bound. Binding a null buffer unbinds the current cache.
+		// The cache is unbound when the context is initialized again.
+		// Decompressing every track writes into the cache when it misses: a context with a bound
+		// cache must not be used by more than one thread at a time, even to decompress.
+		// Returns whether binding was successful or not.
+		bool set_keyframe_cache(void* buffer, uint32_t buffer_size);
+
 		//////////////////////////////////////////////////////////////////////////
 		// Seeks within the compressed tracks to a particular point in time with the
 		// desired rounding policy.
@@ -165,6 +184,56 @@ namespace acl
 		template<class track_writer_type>
 		void decompress_tracks(track_writer_type& writer);
 
+		//////////////////////////////////////////////////////////////////////////
+		// Decompress a subset of the tracks at the current sample time.
+		// Only tracks whose bit is set in the provided bit set are decompressed and
+		// written out. Sub-tracks are unpacked in groups of 4 like when every track is decompressed and
+		// the groups that contain no requested track are skipped without being unpacked.
+		// The bit set must contain at least as many bits as there are tracks.
+		// The cost scales with the number of tracks requested instead of the number of tracks present.
+		// The track_writer_type allows complete control over how the tracks are written out.
+		template<class track_writer_type>
+		void decompress_tracks(const uint32_t* track_subset, bitset_description track_subset_desc, track_writer_type& writer);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decompress a contiguous range of tracks at the current sample time.
+		// Tracks within [first_track_index, first_track_index + num_tracks) are decompressed and written out,
+		// the groups of 4 sub-tracks that precede the range are skipped without being unpacked.
+		// Once seeked, disjoint ranges can be decompressed concurrently from multiple threads with the same
+		// context as long as nothing else modifies it (e.g. seek, initialize). The writer of each thread
+		// must only write to the slots of its own range.
+		// The track_writer_type allows complete control over how the tracks are written out.
+		template<class track_writer_type>
+		void decompress_track_range(uint32_t first_track_index, uint32_t num_tracks, track_writer_type& writer);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decompress tracks at multiple sample times in a single call (e.g. root motion or feature extraction).
+		// Each sample time uses the provided rounding policy and 'track_writer::set_sample_time_index(..)'
+		// is called before its tracks are written out. The result is identical to calling seek(..) and
+		// decompress_tracks(..) for every sample time. Sample times are visited sorted in small batches,
+		// those that fall between the same two key frames only seek once and then update the interpolation alpha.
+		// When the decoded key frame cache is bound and every track is decompressed, the key frames they share are
+		// unpacked once and only interpolated for the other sample times (see 'set_keyframe_cache(..)').
+		// If the track subset is null, every track is decompressed, otherwise only the tracks set in the bit set are.
+		// The context is left seeked at the last sample time visited.
+		// The track_writer_type allows complete control over how the tracks are written out.
+		template<class track_writer_type>
+		void decompress_tracks_at(const float* sample_times, uint32_t num_sample_times, sample_rounding_policy rounding_policy,
+			const uint32_t* track_subset, bitset_description track_subset_desc, track_writer_type& writer);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decompress every track at every stored sample within [start_sample_index, end_sample_index)
+		// with the provided sample stride (e.g. when baking or exporting a clip).
+		// Samples are visited in order and land exactly on a stored sample, no blending between samples occurs.
+		// The segments are walked sequentially and each stored sample is unpacked once and written out as-is.
+		// Clips with stripped key frames or with samples moved into a database seek to each sample instead.
+		// 'track_writer::set_sample_index(..)' is called before the tracks of each sample are written out.
+		// The end sample index is clamped to the number of samples per track.
+		// The context is left seeked at the last sample visited.
+		// The track_writer_type allows complete control over how the tracks are written out.
+		template<class track_writer_type>
+		void decompress_samples(uint32_t start_sample_index, uint32_t end_sample_index, uint32_t sample_stride, track_writer_type& writer);
+
 		//////////////////////////////////////////////////////////////////////////
 		// Decompress a single track at the current sample time.
 		// The track_writer_type allows complete control over how the track is written out.
@@ -159,6 +159,18 @@ namespace acl
 		// Must be static constexpr!
 		static constexpr bool is_per_track_rounding_supported() { return true; }
 
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to enable support for the decoded key frame cache.
+		// When enabled and a cache buffer is provided to the decompression context,
+		// the two key frames we interpolate between are retained once unpacked.
+		// When consecutive seeks land between the same two key frames (e.g. playback
+		// at a higher rate than the sample rate), only the interpolation is performed.
+		// See 'decompression_context::set_keyframe_cache(..)' for details.
+		// Only transform tracks support it.
+		// Disabled by default.
+		// Must be static constexpr!
+		static constexpr bool is_keyframe_cache_supported() { return false; }
+
 		//////////////////////////////////////////////////////////////////////////
 		// The database settings to use when decompressing.
 		// By default, the database isn't supported.
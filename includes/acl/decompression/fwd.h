@@ -53,11 +53,23 @@ namespace acl
     struct streaming_request_id;
     class database_streamer;
     class null_database_streamer;
+    class mmap_database_streamer;
+    class file_database_streamer;
+    struct file_database_streamer_settings;
+    struct file_database_streamer_stats;
 
     enum class database_stream_request_result;
     template<class database_settings_type> class database_context;
+    struct database_budget_settings;
+    struct database_budget_stats;
+    template<class database_settings_type> class database_budget_manager;
+    class database_usage_trace;
 
     template<class decompression_settings_type> class decompression_context;
 
+    struct pose_cache_key;
+    struct pose_cache_stats;
+    class pose_cache;
+
     ACL_IMPL_VERSION_NAMESPACE_END
 }
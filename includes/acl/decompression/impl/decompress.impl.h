@@ -28,6 +28,7 @@
 
 #include "acl/version.h"
 
+#include <algorithm>
 #include <type_traits>
 
 namespace acl
@@ -202,6 +203,29 @@ namespace acl
 		return m_context.get_looping_policy();
 	}
 
+	template<class decompression_settings_type>
+	inline uint32_t decompression_context<decompression_settings_type>::get_keyframe_cache_size() const
+	{
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+
+		if (!m_context.is_initialized())
+			return 0;	// Context is not initialized
+
+		return version_impl_type::template get_keyframe_cache_size(m_context);
+	}
+
+	template<class decompression_settings_type>
+	inline bool decompression_context<decompression_settings_type>::set_keyframe_cache(void* buffer, uint32_t buffer_size)
+	{
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+		ACL_ASSERT(decompression_settings_type::is_keyframe_cache_supported(), "Key frame cache must be enabled");
+
+		if (!m_context.is_initialized())
+			return false;	// Context is not initialized
+
+		return version_impl_type::template set_keyframe_cache<decompression_settings_type>(m_context, buffer, buffer_size);
+	}
+
 	template<class decompression_settings_type>
 	inline void decompression_context<decompression_settings_type>::seek(float sample_time, sample_rounding_policy rounding_policy)
 	{
@@ -228,6 +252,121 @@ namespace acl
 		version_impl_type::template decompress_tracks<decompression_settings_type>(m_context, writer);
 	}
 
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline void decompression_context<decompression_settings_type>::decompress_tracks(const uint32_t* track_subset, bitset_description track_subset_desc, track_writer_type& writer)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+		ACL_ASSERT(track_subset != nullptr, "Track subset cannot be null");
+
+		if (!m_context.is_initialized())
+			return;	// Context is not initialized
+
+		if (track_subset == nullptr)
+			return;	// No tracks to decompress
+
+		version_impl_type::template decompress_tracks<decompression_settings_type>(m_context, track_subset, track_subset_desc, writer);
+	}
+
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline void decompression_context<decompression_settings_type>::decompress_track_range(uint32_t first_track_index, uint32_t num_tracks, track_writer_type& writer)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+
+		if (!m_context.is_initialized())
+			return;	// Context is not initialized
+
+		version_impl_type::template decompress_track_range<decompression_settings_type>(m_context, first_track_index, num_tracks, writer);
+	}
+
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline void decompression_context<decompression_settings_type>::decompress_tracks_at(const float* sample_times, uint32_t num_sample_times, sample_rounding_policy rounding_policy,
+		const uint32_t* track_subset, bitset_description track_subset_desc, track_writer_type& writer)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+		ACL_ASSERT(sample_times != nullptr || num_sample_times == 0, "Sample times cannot be null");
+		ACL_ASSERT(rounding_policy != sample_rounding_policy::per_track || decompression_settings_type::is_per_track_rounding_supported(), "Per track rounding must be enabled");
+
+		if (!m_context.is_initialized())
+			return;	// Context is not initialized
+
+		if (sample_times == nullptr)
+			return;	// No sample times to decompress
+
+		// We visit our sample times in batches sorted in ascending order, sample times that share a segment
+		// and the same two key frames end up next to each other. The first of them is seeked which sets up
+		// the segment data and key frame offsets, the others only update the interpolation alpha.
+		// When the decoded key frame cache is bound and every track is decompressed, the key frames shared
+		// by these sample times are unpacked once and every other sample time only interpolates them.
+		// The result is identical to calling seek(..) and decompress_tracks(..) for each sample time.
+		constexpr uint32_t k_batch_size = 64;
+		uint32_t sorted_indices[k_batch_size];
+
+		for (uint32_t batch_start = 0; batch_start < num_sample_times; batch_start += k_batch_size)
+		{
+			const uint32_t batch_size = std::min<uint32_t>(num_sample_times - batch_start, k_batch_size);
+
+			// Insertion sort, our batches are small and usually already sorted
+			for (uint32_t batch_index = 0; batch_index < batch_size; ++batch_index)
+			{
+				const uint32_t sample_time_index = batch_start + batch_index;
+				const float sample_time = sample_times[sample_time_index];
+
+				uint32_t insert_index = batch_index;
+				while (insert_index > 0 && sample_times[sorted_indices[insert_index - 1]] > sample_time)
+				{
+					sorted_indices[insert_index] = sorted_indices[insert_index - 1];
+					insert_index--;
+				}
+
+				sorted_indices[insert_index] = sample_time_index;
+			}
+
+			for (uint32_t batch_index = 0; batch_index < batch_size; ++batch_index)
+			{
+				const uint32_t sample_time_index = sorted_indices[batch_index];
+
+				const float sample_time = sample_times[sample_time_index];
+				ACL_ASSERT(rtm::scalar_is_finite(sample_time), "Invalid sample time");
+
+				if (!version_impl_type::template seek_within_key_frames<decompression_settings_type>(m_context, sample_time, rounding_policy))
+					version_impl_type::template seek<decompression_settings_type>(m_context, sample_time, rounding_policy);
+
+				writer.set_sample_time_index(sample_time_index);
+
+				if (track_subset != nullptr)
+					version_impl_type::template decompress_tracks<decompression_settings_type>(m_context, track_subset, track_subset_desc, writer);
+				else
+					version_impl_type::template decompress_tracks<decompression_settings_type>(m_context, writer);
+			}
+		}
+	}
+
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline void decompression_context<decompression_settings_type>::decompress_samples(uint32_t start_sample_index, uint32_t end_sample_index, uint32_t sample_stride, track_writer_type& writer)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+		ACL_ASSERT(sample_stride != 0, "Sample stride must be at least 1");
+
+		if (!m_context.is_initialized())
+			return;	// Context is not initialized
+
+		if (sample_stride == 0)
+			return;	// Invalid stride
+
+		const uint32_t num_samples = m_context.get_compressed_tracks()->get_num_samples_per_track();
+		end_sample_index = std::min<uint32_t>(end_sample_index, num_samples);
+
+		version_impl_type::template decompress_samples<decompression_settings_type>(m_context, start_sample_index, end_sample_index, sample_stride, writer);
+	}
+
 	template<class decompression_settings_type>
 	template<class track_writer_type>
 	inline void decompression_context<decompression_settings_type>::decompress_track(uint32_t track_index, track_writer_type& writer)
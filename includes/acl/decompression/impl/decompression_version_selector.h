@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/bitset.h"
 #include "acl/core/compressed_tracks.h"
 #include "acl/core/compressed_tracks_version.h"
 #include "acl/core/error.h"
@@ -75,12 +76,30 @@ namespace acl
 			template<class decompression_settings_type, class context_type>
 			RTM_FORCE_INLINE static void set_looping_policy(context_type& context, sample_looping_policy policy) { acl_impl::set_looping_policy_v0<decompression_settings_type>(context, policy); }
 
+			template<class context_type>
+			RTM_FORCE_INLINE static uint32_t get_keyframe_cache_size(const context_type& context) { return acl_impl::get_keyframe_cache_size_v0(context); }
+
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static bool set_keyframe_cache(context_type& context, void* buffer, uint32_t buffer_size) { return acl_impl::set_keyframe_cache_v0<decompression_settings_type>(context, buffer, buffer_size); }
+
 			template<class decompression_settings_type, class context_type>
 			RTM_FORCE_INLINE static void seek(context_type& context, float sample_time, sample_rounding_policy rounding_policy) { acl_impl::seek_v0<decompression_settings_type>(context, sample_time, rounding_policy); }
 
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static bool seek_within_key_frames(context_type& context, float sample_time, sample_rounding_policy rounding_policy) { return acl_impl::seek_within_key_frames_v0<decompression_settings_type>(context, sample_time, rounding_policy); }
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, writer); }
 
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, const uint32_t* track_subset, bitset_description track_subset_desc, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, track_subset, track_subset_desc, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track_range(context_type& context, uint32_t first_track_index, uint32_t num_tracks, track_writer_type& writer) { acl_impl::decompress_track_range_v0<decompression_settings_type>(context, first_track_index, num_tracks, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_samples(context_type& context, uint32_t start_sample_index, uint32_t end_sample_index, uint32_t sample_stride, track_writer_type& writer) { acl_impl::decompress_samples_v0<decompression_settings_type>(context, start_sample_index, end_sample_index, sample_stride, writer); }
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			RTM_FORCE_INLINE static void decompress_track(context_type& context, uint32_t track_index, track_writer_type& writer) { acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, writer); }
 		};
@@ -108,12 +127,30 @@ namespace acl
 			template<class decompression_settings_type, class context_type>
 			RTM_FORCE_INLINE static void set_looping_policy(context_type& context, sample_looping_policy policy) { acl_impl::set_looping_policy_v0<decompression_settings_type>(context, policy); }
 
+			template<class context_type>
+			RTM_FORCE_INLINE static uint32_t get_keyframe_cache_size(const context_type& context) { return acl_impl::get_keyframe_cache_size_v0(context); }
+
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static bool set_keyframe_cache(context_type& context, void* buffer, uint32_t buffer_size) { return acl_impl::set_keyframe_cache_v0<decompression_settings_type>(context, buffer, buffer_size); }
+
 			template<class decompression_settings_type, class context_type>
 			RTM_FORCE_INLINE static void seek(context_type& context, float sample_time, sample_rounding_policy rounding_policy) { acl_impl::seek_v0<decompression_settings_type>(context, sample_time, rounding_policy); }
 
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static bool seek_within_key_frames(context_type& context, float sample_time, sample_rounding_policy rounding_policy) { return acl_impl::seek_within_key_frames_v0<decompression_settings_type>(context, sample_time, rounding_policy); }
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, writer); }
 
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, const uint32_t* track_subset, bitset_description track_subset_desc, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, track_subset, track_subset_desc, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track_range(context_type& context, uint32_t first_track_index, uint32_t num_tracks, track_writer_type& writer) { acl_impl::decompress_track_range_v0<decompression_settings_type>(context, first_track_index, num_tracks, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_samples(context_type& context, uint32_t start_sample_index, uint32_t end_sample_index, uint32_t sample_stride, track_writer_type& writer) { acl_impl::decompress_samples_v0<decompression_settings_type>(context, start_sample_index, end_sample_index, sample_stride, writer); }
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			RTM_FORCE_INLINE static void decompress_track(context_type& context, uint32_t track_index, track_writer_type& writer) { acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, writer); }
 		};
@@ -138,12 +175,30 @@ namespace acl
 			template<class decompression_settings_type, class context_type>
 			RTM_FORCE_INLINE static void set_looping_policy(context_type& context, sample_looping_policy policy) { acl_impl::set_looping_policy_v0<decompression_settings_type>(context, policy); }
 
+			template<class context_type>
+			RTM_FORCE_INLINE static uint32_t get_keyframe_cache_size(const context_type& context) { return acl_impl::get_keyframe_cache_size_v0(context); }
+
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static bool set_keyframe_cache(context_type& context, void* buffer, uint32_t buffer_size) { return acl_impl::set_keyframe_cache_v0<decompression_settings_type>(context, buffer, buffer_size); }
+
 			template<class decompression_settings_type, class context_type>
 			RTM_FORCE_INLINE static void seek(context_type& context, float sample_time, sample_rounding_policy rounding_policy) { acl_impl::seek_v0<decompression_settings_type>(context, sample_time, rounding_policy); }
 
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static bool seek_within_key_frames(context_type& context, float sample_time, sample_rounding_policy rounding_policy) { return acl_impl::seek_within_key_frames_v0<decompression_settings_type>(context, sample_time, rounding_policy); }
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, writer); }
 
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, const uint32_t* track_subset, bitset_description track_subset_desc, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, track_subset, track_subset_desc, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track_range(context_type& context, uint32_t first_track_index, uint32_t num_tracks, track_writer_type& writer) { acl_impl::decompress_track_range_v0<decompression_settings_type>(context, first_track_index, num_tracks, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_samples(context_type& context, uint32_t start_sample_index, uint32_t end_sample_index, uint32_t sample_stride, track_writer_type& writer) { acl_impl::decompress_samples_v0<decompression_settings_type>(context, start_sample_index, end_sample_index, sample_stride, writer); }
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			RTM_FORCE_INLINE static void decompress_track(context_type& context, uint32_t track_index, track_writer_type& writer) { acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, writer); }
 		};
@@ -168,12 +223,78 @@ namespace acl
 			template<class decompression_settings_type, class context_type>
 			RTM_FORCE_INLINE static void set_looping_policy(context_type& context, sample_looping_policy policy) { acl_impl::set_looping_policy_v0<decompression_settings_type>(context, policy); }
 
+			template<class context_type>
+			RTM_FORCE_INLINE static uint32_t get_keyframe_cache_size(const context_type& context) { return acl_impl::get_keyframe_cache_size_v0(context); }
+
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static bool set_keyframe_cache(context_type& context, void* buffer, uint32_t buffer_size) { return acl_impl::set_keyframe_cache_v0<decompression_settings_type>(context, buffer, buffer_size); }
+
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static void seek(context_type& context, float sample_time, sample_rounding_policy rounding_policy) { acl_impl::seek_v0<decompression_settings_type>(context, sample_time, rounding_policy); }
+
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static bool seek_within_key_frames(context_type& context, float sample_time, sample_rounding_policy rounding_policy) { return acl_impl::seek_within_key_frames_v0<decompression_settings_type>(context, sample_time, rounding_policy); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, const uint32_t* track_subset, bitset_description track_subset_desc, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, track_subset, track_subset_desc, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track_range(context_type& context, uint32_t first_track_index, uint32_t num_tracks, track_writer_type& writer) { acl_impl::decompress_track_range_v0<decompression_settings_type>(context, first_track_index, num_tracks, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_samples(context_type& context, uint32_t start_sample_index, uint32_t end_sample_index, uint32_t sample_stride, track_writer_type& writer) { acl_impl::decompress_samples_v0<decompression_settings_type>(context, start_sample_index, end_sample_index, sample_stride, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track(context_type& context, uint32_t track_index, track_writer_type& writer) { acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, writer); }
+		};
+
+		template<>
+		struct decompression_version_selector<compressed_tracks_version16::v02_01_99_3>
+		{
+			static constexpr bool is_version_supported(compressed_tracks_version16 version) { return version == compressed_tracks_version16::v02_01_99_3; }
+
+			template<class decompression_settings_type, class context_type, class database_settings_type>
+			RTM_FORCE_INLINE static bool initialize(context_type& context, const compressed_tracks& tracks, const database_context<database_settings_type>* database) { return acl_impl::initialize_v0<decompression_settings_type>(context, tracks, database); }
+
+			template<class decompression_settings_type, class context_type, class database_settings_type>
+			RTM_FORCE_INLINE static bool relocated(context_type& context, const compressed_tracks& tracks, const database_context<database_settings_type>* database) { return acl_impl::relocated_v0<decompression_settings_type>(context, tracks, database); }
+
+			template<class context_type>
+			RTM_FORCE_INLINE static bool is_bound_to(const context_type& context, const compressed_tracks& tracks) { return acl_impl::is_bound_to_v0(context, tracks); }
+
+			template<class context_type>
+			RTM_FORCE_INLINE static bool is_bound_to(const context_type& context, const compressed_database& database) { return acl_impl::is_bound_to_v0(context, database); }
+
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static void set_looping_policy(context_type& context, sample_looping_policy policy) { acl_impl::set_looping_policy_v0<decompression_settings_type>(context, policy); }
+
+			template<class context_type>
+			RTM_FORCE_INLINE static uint32_t get_keyframe_cache_size(const context_type& context) { return acl_impl::get_keyframe_cache_size_v0(context); }
+
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static bool set_keyframe_cache(context_type& context, void* buffer, uint32_t buffer_size) { return acl_impl::set_keyframe_cache_v0<decompression_settings_type>(context, buffer, buffer_size); }
+
 			template<class decompression_settings_type, class context_type>
 			RTM_FORCE_INLINE static void seek(context_type& context, float sample_time, sample_rounding_policy rounding_policy) { acl_impl::seek_v0<decompression_settings_type>(context, sample_time, rounding_policy); }
 
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static bool seek_within_key_frames(context_type& context, float sample_time, sample_rounding_policy rounding_policy) { return acl_impl::seek_within_key_frames_v0<decompression_settings_type>(context, sample_time, rounding_policy); }
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, writer); }
 
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, const uint32_t* track_subset, bitset_description track_subset_desc, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, track_subset, track_subset_desc, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track_range(context_type& context, uint32_t first_track_index, uint32_t num_tracks, track_writer_type& writer) { acl_impl::decompress_track_range_v0<decompression_settings_type>(context, first_track_index, num_tracks, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_samples(context_type& context, uint32_t start_sample_index, uint32_t end_sample_index, uint32_t sample_stride, track_writer_type& writer) { acl_impl::decompress_samples_v0<decompression_settings_type>(context, start_sample_index, end_sample_index, sample_stride, writer); }
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			RTM_FORCE_INLINE static void decompress_track(context_type& context, uint32_t track_index, track_writer_type& writer) { acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, writer); }
 		};
@@ -200,6 +321,7 @@ namespace acl
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
 				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
 					return acl_impl::initialize_v0<decompression_settings_type>(context, tracks, database);
 				default:
 					ACL_ASSERT(false, "Unsupported version");
@@ -217,6 +339,7 @@ namespace acl
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
 				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
 					return acl_impl::relocated_v0<decompression_settings_type>(context, tracks, database);
 				default:
 					ACL_ASSERT(false, "Unsupported version");
@@ -234,6 +357,7 @@ namespace acl
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
 				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
 					return acl_impl::is_bound_to_v0(context, tracks);
 				default:
 					ACL_ASSERT(false, "Unsupported version");
@@ -251,6 +375,7 @@ namespace acl
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
 				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
 					return acl_impl::is_bound_to_v0(context, database);
 				default:
 					ACL_ASSERT(false, "Unsupported version");
@@ -268,6 +393,7 @@ namespace acl
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
 				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
 					acl_impl::set_looping_policy_v0<decompression_settings_type>(context, policy);
 					break;
 				default:
@@ -276,6 +402,42 @@ namespace acl
 				}
 			}
 
+			template<class context_type>
+			static uint32_t get_keyframe_cache_size(const context_type& context)
+			{
+				const compressed_tracks_version16 version = context.get_version();
+				switch (version)
+				{
+				case compressed_tracks_version16::v02_00_00:
+				case compressed_tracks_version16::v02_01_99:
+				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
+					return acl_impl::get_keyframe_cache_size_v0(context);
+				default:
+					ACL_ASSERT(false, "Unsupported version");
+					return 0;
+				}
+			}
+
+			template<class decompression_settings_type, class context_type>
+			static bool set_keyframe_cache(context_type& context, void* buffer, uint32_t buffer_size)
+			{
+				const compressed_tracks_version16 version = context.get_version();
+				switch (version)
+				{
+				case compressed_tracks_version16::v02_00_00:
+				case compressed_tracks_version16::v02_01_99:
+				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
+					return acl_impl::set_keyframe_cache_v0<decompression_settings_type>(context, buffer, buffer_size);
+				default:
+					ACL_ASSERT(false, "Unsupported version");
+					return false;
+				}
+			}
+
 			template<class decompression_settings_type, class context_type>
 			static void seek(context_type& context, float sample_time, sample_rounding_policy rounding_policy)
 			{
@@ -286,6 +448,7 @@ namespace acl
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
 				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
 					acl_impl::seek_v0<decompression_settings_type>(context, sample_time, rounding_policy);
 					break;
 				default:
@@ -294,6 +457,24 @@ namespace acl
 				}
 			}
 
+			template<class decompression_settings_type, class context_type>
+			static bool seek_within_key_frames(context_type& context, float sample_time, sample_rounding_policy rounding_policy)
+			{
+				const compressed_tracks_version16 version = context.get_version();
+				switch (version)
+				{
+				case compressed_tracks_version16::v02_00_00:
+				case compressed_tracks_version16::v02_01_99:
+				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
+					return acl_impl::seek_within_key_frames_v0<decompression_settings_type>(context, sample_time, rounding_policy);
+				default:
+					ACL_ASSERT(false, "Unsupported version");
+					return false;
+				}
+			}
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			static void decompress_tracks(context_type& context, track_writer_type& writer)
 			{
@@ -304,6 +485,7 @@ namespace acl
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
 				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
 					acl_impl::decompress_tracks_v0<decompression_settings_type>(context, writer);
 					break;
 				default:
@@ -312,6 +494,63 @@ namespace acl
 				}
 			}
 
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			static void decompress_tracks(context_type& context, const uint32_t* track_subset, bitset_description track_subset_desc, track_writer_type& writer)
+			{
+				const compressed_tracks_version16 version = context.get_version();
+				switch (version)
+				{
+				case compressed_tracks_version16::v02_00_00:
+				case compressed_tracks_version16::v02_01_99:
+				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
+					acl_impl::decompress_tracks_v0<decompression_settings_type>(context, track_subset, track_subset_desc, writer);
+					break;
+				default:
+					ACL_ASSERT(false, "Unsupported version");
+					break;
+				}
+			}
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			static void decompress_samples(context_type& context, uint32_t start_sample_index, uint32_t end_sample_index, uint32_t sample_stride, track_writer_type& writer)
+			{
+				const compressed_tracks_version16 version = context.get_version();
+				switch (version)
+				{
+				case compressed_tracks_version16::v02_00_00:
+				case compressed_tracks_version16::v02_01_99:
+				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
+					acl_impl::decompress_samples_v0<decompression_settings_type>(context, start_sample_index, end_sample_index, sample_stride, writer);
+					break;
+				default:
+					ACL_ASSERT(false, "Unsupported version");
+					break;
+				}
+			}
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			static void decompress_track_range(context_type& context, uint32_t first_track_index, uint32_t num_tracks, track_writer_type& writer)
+			{
+				const compressed_tracks_version16 version = context.get_version();
+				switch (version)
+				{
+				case compressed_tracks_version16::v02_00_00:
+				case compressed_tracks_version16::v02_01_99:
+				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
+					acl_impl::decompress_track_range_v0<decompression_settings_type>(context, first_track_index, num_tracks, writer);
+					break;
+				default:
+					ACL_ASSERT(false, "Unsupported version");
+					break;
+				}
+			}
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			static void decompress_track(context_type& context, uint32_t track_index, track_writer_type& writer)
 			{
@@ -322,6 +561,7 @@ namespace acl
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
 				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
 					acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, writer);
 					break;
 				default:
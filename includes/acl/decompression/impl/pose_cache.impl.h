@@ -0,0 +1,347 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from pose_cache.h
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/hash.h"
+#include "acl/core/memory_utils.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// A pose cache slot. Its pose is written under a sequence lock: the sequence
+		// is odd while a writer owns the slot and readers validate that it hasn't changed
+		// once they are done copying the pose out.
+		//////////////////////////////////////////////////////////////////////////
+		struct pose_cache_entry_v0
+		{
+			std::atomic<uint32_t>	sequence;		// Zero when the slot is empty, odd while it is being written
+			std::atomic<uint32_t>	last_access;	// Access clock value of the last hit or insertion
+			std::atomic<uint64_t>	key0;			// Tracks hash and quantized sample time
+			std::atomic<uint64_t>	key1;			// Rounding policy and writer layout
+		};
+
+		inline void pack_pose_cache_key(const pose_cache_key& key, uint64_t& out_key0, uint64_t& out_key1)
+		{
+			out_key0 = (uint64_t(key.tracks_hash) << 32) | key.quantized_sample_time;
+			out_key1 = (uint64_t(key.rounding_policy) << 32) | key.writer_layout_id;
+		}
+
+		// Copies a pose out of the cache one word at a time, a writer can modify it concurrently
+		inline void load_pose_cache_pose(const std::atomic<uint64_t>* pose_words, uint8_t* out_pose, uint32_t pose_size)
+		{
+			const uint32_t num_whole_words = pose_size / sizeof(uint64_t);
+			for (uint32_t word_index = 0; word_index < num_whole_words; ++word_index)
+			{
+				const uint64_t word = pose_words[word_index].load(k_memory_order_relaxed);
+				std::memcpy(out_pose + word_index * sizeof(uint64_t), &word, sizeof(uint64_t));
+			}
+
+			const uint32_t num_remaining_bytes = pose_size % sizeof(uint64_t);
+			if (num_remaining_bytes != 0)
+			{
+				const uint64_t word = pose_words[num_whole_words].load(k_memory_order_relaxed);
+				std::memcpy(out_pose + num_whole_words * sizeof(uint64_t), &word, num_remaining_bytes);
+			}
+		}
+
+		// Copies a pose into the cache one word at a time, readers can copy it out concurrently
+		inline void store_pose_cache_pose(std::atomic<uint64_t>* pose_words, const uint8_t* pose, uint32_t pose_size)
+		{
+			const uint32_t num_whole_words = pose_size / sizeof(uint64_t);
+			for (uint32_t word_index = 0; word_index < num_whole_words; ++word_index)
+			{
+				uint64_t word;
+				std::memcpy(&word, pose + word_index * sizeof(uint64_t), sizeof(uint64_t));
+				pose_words[word_index].store(word, k_memory_order_relaxed);
+			}
+
+			const uint32_t num_remaining_bytes = pose_size % sizeof(uint64_t);
+			if (num_remaining_bytes != 0)
+			{
+				uint64_t word = 0;
+				std::memcpy(&word, pose + num_whole_words * sizeof(uint64_t), num_remaining_bytes);
+				pose_words[num_whole_words].store(word, k_memory_order_relaxed);
+			}
+		}
+
+		inline uint32_t get_pose_cache_set_index(uint64_t key0, uint64_t key1, uint32_t num_sets)
+		{
+			const uint64_t keys[2] = { key0, key1 };
+			return hash32(&keys[0], sizeof(keys)) & (num_sets - 1);
+		}
+	}
+
+	inline pose_cache_key make_pose_cache_key(const compressed_tracks& tracks, float sample_time, sample_rounding_policy rounding_policy, uint32_t writer_layout_id, float sample_time_quantum)
+	{
+		pose_cache_key key;
+		key.tracks_hash = tracks.get_hash();
+		key.rounding_policy = rounding_policy;
+		key.writer_layout_id = writer_layout_id;
+
+		if (sample_time_quantum > 0.0F)
+		{
+			// Round to the nearest quantum, negative sample times are clamped when seeking
+			const float quantized_sample_time = sample_time > 0.0F ? (sample_time / sample_time_quantum) + 0.5F : 0.0F;
+			key.quantized_sample_time = uint32_t(quantized_sample_time);
+		}
+		else
+			std::memcpy(&key.quantized_sample_time, &sample_time, sizeof(float));
+
+		return key;
+	}
+
+	inline float pose_cache_stats::get_hit_rate() const
+	{
+		const uint64_t num_lookups = num_hits + num_misses;
+		return num_lookups != 0 ? float(double(num_hits) / double(num_lookups)) : 0.0F;
+	}
+
+	inline pose_cache::pose_cache()
+		: m_entries(nullptr)
+		, m_poses(nullptr)
+		, m_allocator(nullptr)
+		, m_num_sets(0)
+		, m_pose_size(0)
+		, m_pose_stride(0)
+		, m_access_clock(0)
+		, m_num_hits(0)
+		, m_num_misses(0)
+		, m_num_insertions(0)
+		, m_num_evictions(0)
+	{
+	}
+
+	inline pose_cache::~pose_cache()
+	{
+		reset();
+	}
+
+	inline bool pose_cache::initialize(iallocator& allocator, uint32_t max_num_poses, uint32_t pose_size)
+	{
+		ACL_ASSERT(!is_initialized(), "Pose cache already initialized");
+		ACL_ASSERT(max_num_poses != 0, "Pose cache must hold at least one pose");
+		ACL_ASSERT(pose_size != 0, "Pose size must be non-zero");
+
+		if (is_initialized())
+			return false;	// Already initialized
+
+		if (max_num_poses == 0 || pose_size == 0)
+			return false;	// Invalid arguments
+
+		// The number of sets must be a power of two
+		const uint32_t min_num_sets = (max_num_poses + k_num_ways - 1) / k_num_ways;
+		uint32_t num_sets = 1;
+		while (num_sets < min_num_sets)
+			num_sets *= 2;
+
+		const uint32_t num_entries = num_sets * k_num_ways;
+
+		m_allocator = &allocator;
+		m_num_sets = num_sets;
+		m_pose_size = pose_size;
+		m_pose_stride = align_to(pose_size, 16) / uint32_t(sizeof(uint64_t));
+
+		m_entries = allocate_type_array<acl_impl::pose_cache_entry_v0>(allocator, num_entries);
+		m_poses = allocate_type_array_aligned<std::atomic<uint64_t>>(allocator, size_t(num_entries) * m_pose_stride, 64);
+
+		clear();
+		reset_stats();
+
+		return true;
+	}
+
+	inline void pose_cache::reset()
+	{
+		if (!is_initialized())
+			return;	// Nothing to do
+
+		const uint32_t num_entries = get_num_poses();
+
+		deallocate_type_array(*m_allocator, m_entries, num_entries);
+		deallocate_type_array(*m_allocator, m_poses, size_t(num_entries) * m_pose_stride);
+
+		m_entries = nullptr;
+		m_poses = nullptr;
+		m_allocator = nullptr;
+		m_num_sets = 0;
+		m_pose_size = 0;
+		m_pose_stride = 0;
+	}
+
+	inline bool pose_cache::find(const pose_cache_key& key, void* out_pose, uint32_t out_pose_size)
+	{
+		ACL_ASSERT(is_initialized(), "Pose cache is not initialized");
+		ACL_ASSERT(out_pose != nullptr && out_pose_size >= m_pose_size, "Pose buffer is too small");
+
+		if (!is_initialized() || out_pose == nullptr || out_pose_size < m_pose_size)
+			return false;	// Cannot hold the pose
+
+		uint64_t key0;
+		uint64_t key1;
+		acl_impl::pack_pose_cache_key(key, key0, key1);
+
+		const uint32_t first_entry_index = acl_impl::get_pose_cache_set_index(key0, key1, m_num_sets) * k_num_ways;
+
+		for (uint32_t way_index = 0; way_index < k_num_ways; ++way_index)
+		{
+			const uint32_t entry_index = first_entry_index + way_index;
+			acl_impl::pose_cache_entry_v0& entry = m_entries[entry_index];
+
+			const uint32_t sequence = entry.sequence.load(acl_impl::k_memory_order_acquire);
+			if (sequence == 0 || (sequence & 1) != 0)
+				continue;	// Empty or being written
+
+			if (entry.key0.load(acl_impl::k_memory_order_relaxed) != key0 || entry.key1.load(acl_impl::k_memory_order_relaxed) != key1)
+				continue;	// Some other pose
+
+			acl_impl::load_pose_cache_pose(m_poses + size_t(entry_index) * m_pose_stride, static_cast<uint8_t*>(out_pose), m_pose_size);
+
+			// Make sure our copy completes before we validate that no writer touched the slot
+			std::atomic_thread_fence(acl_impl::k_memory_order_acquire);
+
+			if (entry.sequence.load(acl_impl::k_memory_order_relaxed) != sequence)
+				break;	// A writer replaced the pose while we copied it, treat it as a miss
+
+			entry.last_access.store(m_access_clock.fetch_add(1, acl_impl::k_memory_order_relaxed) + 1, acl_impl::k_memory_order_relaxed);
+			m_num_hits.fetch_add(1, acl_impl::k_memory_order_relaxed);
+			return true;
+		}
+
+		m_num_misses.fetch_add(1, acl_impl::k_memory_order_relaxed);
+		return false;
+	}
+
+	inline void pose_cache::insert(const pose_cache_key& key, const void* pose, uint32_t pose_size)
+	{
+		ACL_ASSERT(is_initialized(), "Pose cache is not initialized");
+		ACL_ASSERT(pose != nullptr && pose_size == m_pose_size, "Unexpected pose size");
+
+		if (!is_initialized() || pose == nullptr || pose_size != m_pose_size)
+			return;	// Invalid pose
+
+		uint64_t key0;
+		uint64_t key1;
+		acl_impl::pack_pose_cache_key(key, key0, key1);
+
+		const uint32_t first_entry_index = acl_impl::get_pose_cache_set_index(key0, key1, m_num_sets) * k_num_ways;
+
+		// Find our pose if it is already present, otherwise the least recently used slot
+		uint32_t victim_entry_index = first_entry_index;
+		uint32_t victim_last_access = ~0U;
+		for (uint32_t way_index = 0; way_index < k_num_ways; ++way_index)
+		{
+			const uint32_t entry_index = first_entry_index + way_index;
+			const acl_impl::pose_cache_entry_v0& entry = m_entries[entry_index];
+
+			const uint32_t sequence = entry.sequence.load(acl_impl::k_memory_order_relaxed);
+			if (sequence != 0 && entry.key0.load(acl_impl::k_memory_order_relaxed) == key0 && entry.key1.load(acl_impl::k_memory_order_relaxed) == key1)
+			{
+				victim_entry_index = entry_index;
+				break;
+			}
+
+			// Empty slots have never been accessed
+			const uint32_t last_access = sequence != 0 ? entry.last_access.load(acl_impl::k_memory_order_relaxed) : 0;
+			if (last_access < victim_last_access)
+			{
+				victim_entry_index = entry_index;
+				victim_last_access = last_access;
+			}
+		}
+
+		acl_impl::pose_cache_entry_v0& victim = m_entries[victim_entry_index];
+
+		// Acquire the slot, if another thread is writing to it, we drop our pose
+		uint32_t sequence = victim.sequence.load(acl_impl::k_memory_order_relaxed);
+		if ((sequence & 1) != 0 || !victim.sequence.compare_exchange_strong(sequence, sequence + 1, acl_impl::k_memory_order_acquire, acl_impl::k_memory_order_relaxed))
+			return;
+
+		// Make sure readers cannot observe our key and pose writes without also observing the odd sequence
+		std::atomic_thread_fence(acl_impl::k_memory_order_release);
+
+		const bool is_eviction = sequence != 0 && (victim.key0.load(acl_impl::k_memory_order_relaxed) != key0 || victim.key1.load(acl_impl::k_memory_order_relaxed) != key1);
+
+		victim.key0.store(key0, acl_impl::k_memory_order_relaxed);
+		victim.key1.store(key1, acl_impl::k_memory_order_relaxed);
+		acl_impl::store_pose_cache_pose(m_poses + size_t(victim_entry_index) * m_pose_stride, static_cast<const uint8_t*>(pose), m_pose_size);
+		victim.last_access.store(m_access_clock.fetch_add(1, acl_impl::k_memory_order_relaxed) + 1, acl_impl::k_memory_order_relaxed);
+
+		// Release the slot, skipping zero which marks empty slots
+		uint32_t next_sequence = sequence + 2;
+		if (next_sequence == 0)
+			next_sequence = 2;
+		victim.sequence.store(next_sequence, acl_impl::k_memory_order_release);
+
+		m_num_insertions.fetch_add(1, acl_impl::k_memory_order_relaxed);
+		if (is_eviction)
+			m_num_evictions.fetch_add(1, acl_impl::k_memory_order_relaxed);
+	}
+
+	inline void pose_cache::clear()
+	{
+		const uint32_t num_entries = get_num_poses();
+		for (uint32_t entry_index = 0; entry_index < num_entries; ++entry_index)
+		{
+			acl_impl::pose_cache_entry_v0& entry = m_entries[entry_index];
+			entry.sequence.store(0, acl_impl::k_memory_order_relaxed);
+			entry.last_access.store(0, acl_impl::k_memory_order_relaxed);
+			entry.key0.store(0, acl_impl::k_memory_order_relaxed);
+			entry.key1.store(0, acl_impl::k_memory_order_relaxed);
+		}
+
+		m_access_clock.store(0, acl_impl::k_memory_order_relaxed);
+	}
+
+	inline pose_cache_stats pose_cache::get_stats() const
+	{
+		pose_cache_stats stats;
+		stats.num_hits = m_num_hits.load(acl_impl::k_memory_order_relaxed);
+		stats.num_misses = m_num_misses.load(acl_impl::k_memory_order_relaxed);
+		stats.num_insertions = m_num_insertions.load(acl_impl::k_memory_order_relaxed);
+		stats.num_evictions = m_num_evictions.load(acl_impl::k_memory_order_relaxed);
+		return stats;
+	}
+
+	inline void pose_cache::reset_stats()
+	{
+		m_num_hits.store(0, acl_impl::k_memory_order_relaxed);
+		m_num_misses.store(0, acl_impl::k_memory_order_relaxed);
+		m_num_insertions.store(0, acl_impl::k_memory_order_relaxed);
+		m_num_evictions.store(0, acl_impl::k_memory_order_relaxed);
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
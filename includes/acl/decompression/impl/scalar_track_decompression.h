@@ -25,10 +25,13 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/bit_manip_utils.h"
+#include "acl/core/bitset.h"
 #include "acl/core/compressed_tracks.h"
 #include "acl/core/compressed_tracks_version.h"
 #include "acl/core/interpolation_utils.h"
 #include "acl/core/track_writer.h"
+#include "acl/core/impl/atomic.impl.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/impl/variable_bit_rates.h"
 #include "acl/decompression/database/database.h"
@@ -38,6 +41,7 @@
 #include <rtm/scalarf.h>
 #include <rtm/vector4f.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <type_traits>
 
@@ -61,23 +65,32 @@ namespace acl
 			// Clip related data									//   offsets
 			// Only member used to detect if we are initialized, must be first
 			const compressed_tracks* tracks;						//   0 |   0
+			const database_context_v0* db;							//   4 |   8
+
+			// Seeking related data
+			const uint8_t* animated_values[2];						//   8 |  16	// Either in the segment or in the database
 
 			// Cached hash of the bound compressed track instance
-			uint32_t tracks_hash;									//   4 |   8
+			uint32_t tracks_hash;									//  16 |  32
+
+			// Cached hash of the bound database instance, if any
+			uint32_t db_hash;										//  20 |  36
 
 			// Only used when the wrap loop policy isn't supported
-			float duration;											//   8 |  12
+			float duration;											//  24 |  40
 
-			// Seeking related data
-			float interpolation_alpha;								//  12 |  16
-			float sample_time;										//  16 |  20
+			float interpolation_alpha;								//  28 |  44
+			float sample_time;										//  32 |  48
+
+			uint32_t key_frame_bit_offsets[2];						//  36 |  52	// Variable quantization, relative to their animated values
+			uint32_t segment_indices[2];							//  44 |  60
 
-			uint32_t key_frame_bit_offsets[2];						//  20 |  24	// Variable quantization
+			uint8_t looping_policy;									//  52 |  68
+			uint8_t rounding_policy;								//  53 |  69
 
-			uint8_t looping_policy;									//  28 |  32
-			uint8_t rounding_policy;								//  29 |  33
+			uint8_t padding_tail[sizeof(void*) == 4 ? 74 : 58];		//  54 |  70
 
-			uint8_t padding_tail[sizeof(void*) == 4 ? 34 : 30];		//  30 |  34
+			//											Total size:	   128 | 128
 
 			//////////////////////////////////////////////////////////////////////////
 
@@ -93,7 +106,7 @@ namespace acl
 			}
 		};
 
-		static_assert(sizeof(persistent_scalar_decompression_context_v0) == 64, "Unexpected size");
+		static_assert(sizeof(persistent_scalar_decompression_context_v0) == 128, "Unexpected size");
 		static_assert(offsetof(persistent_scalar_decompression_context_v0, tracks) == 0, "tracks pointer needs to be the first member");
 
 		template<class decompression_settings_type, class database_settings_type>
@@ -101,11 +114,13 @@ namespace acl
 		{
 			ACL_ASSERT(tracks.get_algorithm_type() == algorithm_type8::uniformly_sampled, "Invalid algorithm type [%s], expected [%s]", get_algorithm_name(tracks.get_algorithm_type()), get_algorithm_name(algorithm_type8::uniformly_sampled));
 
-			if (database != nullptr)
-				return false;	// Database decompression is not supported for scalar tracks
+			// Context is always the first member and versions should always match
+			const database_context_v0* db = reinterpret_cast<const database_context_v0*>(database);
 
 			context.tracks = &tracks;
+			context.db = db;
 			context.tracks_hash = tracks.get_hash();
+			context.db_hash = db != nullptr ? db->db_hash : 0;
 			context.sample_time = -1.0F;
 
 			if (decompression_settings_type::is_wrapping_supported())
@@ -128,13 +143,20 @@ namespace acl
 			if (context.tracks_hash != tracks.get_hash())
 				return false;	// Hash is different, this instance did not relocate, it is different
 
-			if (database != nullptr)
-				return false;	// Database decompression is not supported for scalar tracks
+			// Context is always the first member and versions should always match
+			const database_context_v0* db = reinterpret_cast<const database_context_v0*>(database);
+			const uint32_t db_hash = db != nullptr ? db->db_hash : 0;
+
+			if (context.db_hash != db_hash)
+				return false;	// Hash is different, this instance did not relocate, it is different
 
 			// The instances are identical and might have relocated, update our metadata
 			context.tracks = &tracks;
+			context.db = db;
 
 			// Reset the sample time to force seek() to be called again.
+			// The context otherwise contains pointers within the tracks and database instances
+			// that are populated during seek.
 			context.sample_time = -1.0F;
 
 			return true;
@@ -154,10 +176,17 @@ namespace acl
 
 		inline bool is_bound_to_v0(const persistent_scalar_decompression_context_v0& context, const compressed_database& database)
 		{
-			// Database decompression is not supported for scalar tracks
-			(void)context;
-			(void)database;
-			return false;
+			if (context.db == nullptr)
+				return false;	// Not bound to any database
+
+			if (context.db->db != &database)
+				return false;	// Different pointer, no guarantees
+
+			if (context.db_hash != database.get_hash())
+				return false;	// Different hash
+
+			// Must be bound to it!
+			return true;
 		}
 
 		template<class decompression_settings_type>
@@ -178,6 +207,19 @@ namespace acl
 			}
 		}
 
+		inline uint32_t get_keyframe_cache_size_v0(const persistent_scalar_decompression_context_v0& /*context*/)
+		{
+			// Not supported with scalar tracks
+			return 0;
+		}
+
+		template<class decompression_settings_type>
+		inline bool set_keyframe_cache_v0(persistent_scalar_decompression_context_v0& /*context*/, void* /*buffer*/, uint32_t /*buffer_size*/)
+		{
+			// Not supported with scalar tracks
+			return false;
+		}
+
 		template<class decompression_settings_type>
 		inline void seek_v0(persistent_scalar_decompression_context_v0& context, float sample_time, sample_rounding_policy rounding_policy)
 		{
@@ -189,7 +231,10 @@ namespace acl
 			if (decompression_settings_type::clamp_sample_time())
 				sample_time = rtm::scalar_clamp(sample_time, 0.0F, context.duration);
 
-			if (context.sample_time == sample_time && context.get_rounding_policy() == rounding_policy)
+			// Seeking resolves which database chunks are resident, they can stream out as soon as the decompression scope
+			// that seeked ends. We always seek again to avoid reading samples that are no longer resident.
+			const bool has_resident_database_samples = is_database_supported_impl<decompression_settings_type>() && header.get_has_database() && context.db != nullptr;
+			if (!has_resident_database_samples && context.sample_time == sample_time && context.get_rounding_policy() == rounding_policy)
 				return;
 
 			context.sample_time = sample_time;
@@ -205,18 +250,265 @@ namespace acl
 
 			const acl_impl::scalar_tracks_header& scalars_header = acl_impl::get_scalar_tracks_header(*context.tracks);
 
-			context.key_frame_bit_offsets[0] = key_frame0 * scalars_header.num_bits_per_frame;
-			context.key_frame_bit_offsets[1] = key_frame1 * scalars_header.num_bits_per_frame;
+			if (header.get_has_scalar_segments())
+			{
+				// Every segment has the same number of samples except the last which also holds the remaining samples
+				const acl_impl::scalar_segments_header& segments_header = *scalars_header.get_segments_header();
+				const acl_impl::scalar_segment_header* segment_headers = scalars_header.get_segment_headers();
+				const uint32_t num_samples_per_segment = segments_header.num_samples_per_segment;
+				const uint32_t last_segment_index = segments_header.num_segments - 1;
+
+				const uint32_t segment_index0 = std::min<uint32_t>(key_frame0 / num_samples_per_segment, last_segment_index);
+				const uint32_t segment_index1 = std::min<uint32_t>(key_frame1 / num_samples_per_segment, last_segment_index);
+
+				const acl_impl::scalar_segment_header& segment_header0 = segment_headers[segment_index0];
+				const acl_impl::scalar_segment_header& segment_header1 = segment_headers[segment_index1];
+
+				uint32_t segment_key_frame0 = key_frame0 - (segment_index0 * num_samples_per_segment);
+				uint32_t segment_key_frame1 = key_frame1 - (segment_index1 * num_samples_per_segment);
+
+				const uint8_t* animated_values0 = segment_header0.track_animated_values.add_to(&scalars_header);
+				const uint8_t* animated_values1 = segment_header1.track_animated_values.add_to(&scalars_header);
+
+				constexpr bool is_database_supported = is_database_supported_impl<decompression_settings_type>();
+				ACL_ASSERT(is_database_supported || !header.get_has_database(), "Cannot have a database when it isn't supported");
+
+				const bool has_database = is_database_supported && header.get_has_database();
+				const database_context_v0* db = context.db;
+
+				if (has_database || header.get_has_stripped_keyframes())
+				{
+					// Segments have no more than 32 samples when their keyframes can be stripped, see transform tracks for details
+					uint32_t sample_indices0 = segment_header0.sample_indices;
+					uint32_t sample_indices1 = segment_header1.sample_indices;
+
+					// Calculate our clip relative sample index, we'll remap it later relative to the samples we'll use
+					const float sample_index = context.interpolation_alpha + float(key_frame0);
+
+					// When we load our sample indices and offsets from the database, there can be another thread writing
+					// to those memory locations at the same time (e.g. streaming in/out).
+					// To ensure thread safety, we atomically load the offset and sample indices.
+					uint64_t tier_metadata0[k_num_database_tiers] = { 0 };
+					uint64_t tier_metadata1[k_num_database_tiers] = { 0 };
+
+					// Combine all our loaded samples into a single bit set to find which samples we need to interpolate
+					if (is_database_supported && db != nullptr)
+					{
+						const tracks_database_header* tracks_db_header = scalars_header.get_database_header();
+						const database_runtime_clip_header* db_clip_header = tracks_db_header->get_clip_header(db->clip_segment_headers);
+						const database_runtime_segment_header* db_segment_headers = db_clip_header->get_segment_headers();
+
+						if (is_clip_usage_tracking_supported_impl<decompression_settings_type>())
+							record_clip_usage(*db, *db_clip_header);
+
+						const database_runtime_segment_header* db_segment_header0 = db_segment_headers + segment_index0;
+						sample_indices0 |= load_segment_tiers_metadata(*db, *db_clip_header, *db_segment_header0, tier_metadata0);
+
+						const database_runtime_segment_header* db_segment_header1 = db_segment_headers + segment_index1;
+						sample_indices1 |= load_segment_tiers_metadata(*db, *db_clip_header, *db_segment_header1, tier_metadata1);
+					}
+
+					// Find the closest loaded samples
+					// Mask all trailing samples to find the first sample by counting trailing zeros
+					const uint32_t candidate_indices0 = sample_indices0 & (0xFFFFFFFFU << (31 - segment_key_frame0));
+					segment_key_frame0 = 31 - count_trailing_zeros(candidate_indices0);
+
+					// Mask all leading samples to find the second sample by counting leading zeros
+					const uint32_t candidate_indices1 = sample_indices1 & (0xFFFFFFFFU >> segment_key_frame1);
+					segment_key_frame1 = count_leading_zeros(candidate_indices1);
+
+					// Calculate our clip relative sample indices
+					const uint32_t clip_key_frame0 = (segment_index0 * num_samples_per_segment) + segment_key_frame0;
+					const uint32_t clip_key_frame1 = (segment_index1 * num_samples_per_segment) + segment_key_frame1;
+
+					// Calculate our new interpolation alpha
+					// We used the rounding policy above to snap to the correct key frame earlier but we might need to interpolate now
+					// if key frames have been removed
+					context.interpolation_alpha = find_linear_interpolation_alpha(sample_index, clip_key_frame0, clip_key_frame1, sample_rounding_policy::none, looping_policy_);
+
+					// Find where our data lives (segment or database tier X)
+					sample_indices0 = segment_header0.sample_indices;
+					sample_indices1 = segment_header1.sample_indices;
+
+					if (is_database_supported && db != nullptr)
+					{
+						const uint64_t sample_index0 = uint64_t(1) << (31 - segment_key_frame0);
+						const uint64_t sample_index1 = uint64_t(1) << (31 - segment_key_frame1);
+
+						// Samples that live in the segment keep its animated values
+						const uint8_t* db_animated_values0 = find_segment_tier_samples(*db, tier_metadata0, sample_index0, sample_indices0);
+						if (db_animated_values0 != nullptr)
+							animated_values0 = db_animated_values0;
+
+						const uint8_t* db_animated_values1 = find_segment_tier_samples(*db, tier_metadata1, sample_index1, sample_indices1);
+						if (db_animated_values1 != nullptr)
+							animated_values1 = db_animated_values1;
+					}
+
+					// Remap our sample indices within the ones actually stored (e.g. index 3 might be the second frame stored)
+					segment_key_frame0 = count_set_bits(and_not(0xFFFFFFFFU >> segment_key_frame0, sample_indices0));
+					segment_key_frame1 = count_set_bits(and_not(0xFFFFFFFFU >> segment_key_frame1, sample_indices1));
+				}
+
+				context.segment_indices[0] = segment_index0;
+				context.segment_indices[1] = segment_index1;
+				context.animated_values[0] = animated_values0;
+				context.animated_values[1] = animated_values1;
+				context.key_frame_bit_offsets[0] = segment_key_frame0 * segment_header0.num_bits_per_frame;
+				context.key_frame_bit_offsets[1] = segment_key_frame1 * segment_header1.num_bits_per_frame;
+			}
+			else
+			{
+				context.segment_indices[0] = 0;
+				context.segment_indices[1] = 0;
+				context.animated_values[0] = scalars_header.get_track_animated_values();
+				context.animated_values[1] = scalars_header.get_track_animated_values();
+				context.key_frame_bit_offsets[0] = key_frame0 * scalars_header.num_bits_per_frame;
+				context.key_frame_bit_offsets[1] = key_frame1 * scalars_header.num_bits_per_frame;
+			}
+		}
+
+		// Seeks to a sample time that lies between the two key frames we are already seeked to, only our interpolation alpha changes
+		// Returns false if other key frames are needed, or if we cannot tell, in which case a regular seek is required
+		template<class decompression_settings_type>
+		inline bool seek_within_key_frames_v0(persistent_scalar_decompression_context_v0& context, float sample_time, sample_rounding_policy rounding_policy)
+		{
+			const acl_impl::tracks_header& header = acl_impl::get_tracks_header(*context.tracks);
+			if (header.num_samples == 0)
+				return false;	// Empty track list
+
+			if (context.sample_time < 0.0F || context.get_rounding_policy() != rounding_policy)
+				return false;	// We didn't seek yet or we seeked with another rounding policy
+
+			// Stripped key frames and database samples change which key frames we interpolate between
+			// and seeking must always resolve which database chunks are resident
+			const bool has_database = is_database_supported_impl<decompression_settings_type>() && header.get_has_database();
+			if (has_database || header.get_has_stripped_keyframes())
+				return false;
+
+			// Clamp for safety, the caller should normally handle this but in practice, it often isn't the case
+			if (decompression_settings_type::clamp_sample_time())
+				sample_time = rtm::scalar_clamp(sample_time, 0.0F, context.duration);
+
+			// If the wrap looping policy isn't supported, use our statically known value
+			const sample_looping_policy looping_policy_ = decompression_settings_type::is_wrapping_supported() ? static_cast<sample_looping_policy>(context.looping_policy) : sample_looping_policy::clamp;
+
+			uint32_t seeked_key_frame0;
+			uint32_t seeked_key_frame1;
+			float seeked_interpolation_alpha;
+			find_linear_interpolation_samples_with_sample_rate(header.num_samples, header.sample_rate, context.sample_time, rounding_policy, looping_policy_, seeked_key_frame0, seeked_key_frame1, seeked_interpolation_alpha);
+
+			uint32_t key_frame0;
+			uint32_t key_frame1;
+			float interpolation_alpha;
+			find_linear_interpolation_samples_with_sample_rate(header.num_samples, header.sample_rate, sample_time, rounding_policy, looping_policy_, key_frame0, key_frame1, interpolation_alpha);
+
+			if (key_frame0 != seeked_key_frame0 || key_frame1 != seeked_key_frame1)
+				return false;	// Different key frames
+
+			context.sample_time = sample_time;
+			context.interpolation_alpha = interpolation_alpha;
+			return true;
 		}
 
+		// The packed data of the segment that contains one of our key frames
+		// Animated values can live in the database and are found when we seek, see persistent_scalar_decompression_context_v0
+		struct scalar_segment_data_v0
+		{
+			const track_metadata* per_track_metadata;
+			const float* range_values;
+		};
+
+		// When the tracks aren't split into segments, they behave as if they had a single segment
+		inline scalar_segment_data_v0 get_scalar_segment_data_v0(const tracks_header& header, const scalar_tracks_header& scalars_header, uint32_t segment_index)
+		{
+			if (header.get_has_scalar_segments())
+			{
+				const scalar_segment_header& segment_header = scalars_header.get_segment_headers()[segment_index];
+				return scalar_segment_data_v0{ segment_header.metadata_per_track.add_to(&scalars_header), segment_header.track_range_values.add_to(&scalars_header) };
+			}
+
+			return scalar_segment_data_v0{ scalars_header.get_track_metadata(), scalars_header.get_track_range_values() };
+		}
+
+		// Unpacks a single sample and undoes its range reduction unless it is raw
+		inline rtm::scalarf RTM_SIMD_CALL unpack_float1_sample_v0(uint32_t num_bits_per_component, const uint8_t* animated_values, uint32_t bit_offset, const float* range_values)
+		{
+			if (num_bits_per_component == 32)	// Raw bit rate
+				return unpack_scalarf_32_unsafe(animated_values, bit_offset);
+
+			const rtm::scalarf value = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values, bit_offset);
+			const rtm::scalarf range_min = rtm::scalar_load(range_values);
+			const rtm::scalarf range_extent = rtm::scalar_load(range_values + 1);
+			return rtm::scalar_mul_add(value, range_extent, range_min);
+		}
+
+		inline rtm::vector4f RTM_SIMD_CALL unpack_float2_sample_v0(uint32_t num_bits_per_component, const uint8_t* animated_values, uint32_t bit_offset, const float* range_values)
+		{
+			if (num_bits_per_component == 32)	// Raw bit rate
+				return unpack_vector2_64_unsafe(animated_values, bit_offset);
+
+			const rtm::vector4f value = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values, bit_offset);
+			const rtm::vector4f range_min = rtm::vector_load(range_values);
+			const rtm::vector4f range_extent = rtm::vector_load(range_values + 2);
+			return rtm::vector_mul_add(value, range_extent, range_min);
+		}
+
+		inline rtm::vector4f RTM_SIMD_CALL unpack_float3_sample_v0(uint32_t num_bits_per_component, const uint8_t* animated_values, uint32_t bit_offset, const float* range_values)
+		{
+			if (num_bits_per_component == 32)	// Raw bit rate
+				return unpack_vector3_96_unsafe(animated_values, bit_offset);
+
+			const rtm::vector4f value = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, bit_offset);
+			const rtm::vector4f range_min = rtm::vector_load(range_values);
+			const rtm::vector4f range_extent = rtm::vector_load(range_values + 3);
+			return rtm::vector_mul_add(value, range_extent, range_min);
+		}
+
+		inline rtm::vector4f RTM_SIMD_CALL unpack_float4_sample_v0(uint32_t num_bits_per_component, const uint8_t* animated_values, uint32_t bit_offset, const float* range_values)
+		{
+			if (num_bits_per_component == 32)	// Raw bit rate
+				return unpack_vector4_128_unsafe(animated_values, bit_offset);
+
+			const rtm::vector4f value = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, bit_offset);
+			const rtm::vector4f range_min = rtm::vector_load(range_values);
+			const rtm::vector4f range_extent = rtm::vector_load(range_values + 4);
+			return rtm::vector_mul_add(value, range_extent, range_min);
+		}
+
+		// Unpacks 4 consecutive float1f tracks that share the same bit rate
+		inline rtm::vector4f RTM_SIMD_CALL unpack_float1x4_sample_v0(uint32_t num_bits_per_component, const uint8_t* animated_values, uint32_t bit_offset, const float* range_values)
+		{
+			if (num_bits_per_component == 32)	// Raw bit rate
+				return unpack_vector4_128_unsafe(animated_values, bit_offset);
+
+			const rtm::vector4f value = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, bit_offset);
+
+			// Our range values are interleaved per track: min0, extent0, min1, extent1, ...
+			const rtm::vector4f range01 = rtm::vector_load(range_values);
+			const rtm::vector4f range23 = rtm::vector_load(range_values + 4);
+			const rtm::vector4f range_min = rtm::vector_mix<rtm::mix4::x, rtm::mix4::z, rtm::mix4::a, rtm::mix4::c>(range01, range23);
+			const rtm::vector4f range_extent = rtm::vector_mix<rtm::mix4::y, rtm::mix4::w, rtm::mix4::b, rtm::mix4::d>(range01, range23);
+			return rtm::vector_mul_add(value, range_extent, range_min);
+		}
+
+		// Only the tracks within [first_track_index, end_track_index) are unpacked and written out
+		// When a track subset is provided, only the tracks whose bit is set are, otherwise, if it is null, every track in the range is
+		// The context is only read from which allows disjoint ranges to be decompressed concurrently
+		// Both key frames can live in different segments, each with its own bit rates and ranges, and as such their data is read separately
 		template<class decompression_settings_type, class track_writer_type>
-		inline void decompress_tracks_v0(const persistent_scalar_decompression_context_v0& context, track_writer_type& writer)
+		inline void decompress_track_selection_v0(const persistent_scalar_decompression_context_v0& context, const uint32_t* track_subset, bitset_description track_subset_desc, uint32_t first_track_index, uint32_t end_track_index, track_writer_type& writer)
 		{
 			const acl_impl::tracks_header& header = acl_impl::get_tracks_header(*context.tracks);
 			const uint32_t num_tracks = header.num_tracks;
 			if (num_tracks == 0)
 				return;	// Empty track list
 
+			ACL_ASSERT(track_subset == nullptr || track_subset_desc.get_num_bits() >= num_tracks, "Track subset is too small: %u < %u", track_subset_desc.get_num_bits(), num_tracks);
+			(void)track_subset_desc;
+
+			ACL_ASSERT(end_track_index <= num_tracks, "Invalid track range end: %u > %u", end_track_index, num_tracks);
+
 			ACL_ASSERT(context.sample_time >= 0.0f, "Context not set to a valid sample time");
 			if (context.sample_time < 0.0F)
 				return;	// Invalid sample time, we didn't seek yet
@@ -246,15 +538,25 @@ namespace acl
 				interpolation_alpha_per_policy[static_cast<int>(sample_rounding_policy::per_track)] = no_rounding_alpha;
 			}
 
-			const acl_impl::track_metadata* per_track_metadata = scalars_header.get_track_metadata();
+			const scalar_segment_data_v0 segment_data0 = get_scalar_segment_data_v0(header, scalars_header, context.segment_indices[0]);
+			const scalar_segment_data_v0 segment_data1 = get_scalar_segment_data_v0(header, scalars_header, context.segment_indices[1]);
+
+			const acl_impl::track_metadata* per_track_metadata0 = segment_data0.per_track_metadata;
+			const acl_impl::track_metadata* per_track_metadata1 = segment_data1.per_track_metadata;
 			const float* constant_values = scalars_header.get_track_constant_values();
-			const float* range_values = scalars_header.get_track_range_values();
-			const uint8_t* animated_values = scalars_header.get_track_animated_values();
+			const float* range_values0 = segment_data0.range_values;
+			const float* range_values1 = segment_data1.range_values;
+			const uint8_t* animated_values0 = context.animated_values[0];
+			const uint8_t* animated_values1 = context.animated_values[1];
 
 			uint32_t track_bit_offset0 = context.key_frame_bit_offsets[0];
 			uint32_t track_bit_offset1 = context.key_frame_bit_offsets[1];
 
+			// When both key frames are the same stored sample (e.g. when walking the stored samples), we only unpack it once
+			const bool is_single_key_frame = context.segment_indices[0] == context.segment_indices[1] && animated_values0 == animated_values1 && track_bit_offset0 == track_bit_offset1;
+
 			const track_type8 track_type = header.track_type;
+			const uint32_t num_element_components = get_track_num_sample_elements(track_type);
 
 			const compressed_tracks_version16 version = context.get_version();
 			const uint8_t* num_bits_at_bit_rate = version == compressed_tracks_version16::v02_00_00 ? k_bit_rate_num_bits_v0 : k_bit_rate_num_bits;
@@ -263,211 +565,203 @@ namespace acl
 			const uint32_t max_bit_rate = version == compressed_tracks_version16::v02_00_00 ? sizeof(k_bit_rate_num_bits_v0) : sizeof(k_bit_rate_num_bits);
 #endif
 
-			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			// When the writer outputs float1f tracks into a contiguous array, groups of 4 tracks that share
+			// the same bit rate have their samples stored contiguously and we can unpack them together
+			// Per track rounding requires the tracks to be unpacked individually
+			float* float1_output_buffer = nullptr;
+			if (track_type == track_type8::float1f && decompression_settings_type::is_track_type_supported(track_type8::float1f) && track_subset == nullptr)
 			{
-				const acl_impl::track_metadata& metadata = per_track_metadata[track_index];
-				const uint32_t bit_rate = metadata.bit_rate;
-				ACL_ASSERT(bit_rate < max_bit_rate, "Invalid bit rate: %u", bit_rate);
-				const uint32_t num_bits_per_component = num_bits_at_bit_rate[bit_rate];
-
-				rtm::scalarf alpha = interpolation_alpha;
-				if (decompression_settings_type::is_per_track_rounding_supported())
-				{
-					const sample_rounding_policy rounding_policy_ = writer.get_rounding_policy(rounding_policy, track_index);
-					ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+				if (!decompression_settings_type::is_per_track_rounding_supported() || rounding_policy != sample_rounding_policy::per_track)
+					float1_output_buffer = writer.get_float1_output_buffer();
+			}
 
-					alpha = rtm::scalar_set(interpolation_alpha_per_policy[static_cast<int>(rounding_policy_)]);
-				}
+			const rtm::vector4f interpolation_alpha_v = rtm::vector_set(context.interpolation_alpha);
 
-				if (track_type == track_type8::float1f && decompression_settings_type::is_track_type_supported(track_type8::float1f))
+			// The data of the tracks that precede our range must be skipped, only the metadata is read to do so
+			for (uint32_t track_index = 0; track_index < end_track_index; ++track_index)
+			{
+				if (float1_output_buffer != nullptr && track_index >= first_track_index && (track_index + 4) <= end_track_index)
 				{
-					rtm::scalarf value;
-					if (num_bits_per_component == 0)	// Constant bit rate
+					const uint32_t bit_rate0 = per_track_metadata0[track_index].bit_rate;
+					const uint32_t bit_rate1 = per_track_metadata1[track_index].bit_rate;
+					const bool is_group_uniform0 = per_track_metadata0[track_index + 1].bit_rate == bit_rate0 && per_track_metadata0[track_index + 2].bit_rate == bit_rate0 && per_track_metadata0[track_index + 3].bit_rate == bit_rate0;
+					const bool is_group_uniform1 = per_track_metadata1[track_index + 1].bit_rate == bit_rate1 && per_track_metadata1[track_index + 2].bit_rate == bit_rate1 && per_track_metadata1[track_index + 3].bit_rate == bit_rate1;
+					if (is_group_uniform0 && is_group_uniform1)
 					{
-						value = rtm::scalar_load(constant_values);
-						constant_values += 1;
-					}
-					else
-					{
-						rtm::scalarf value0;
-						rtm::scalarf value1;
-						if (num_bits_per_component == 32)	// Raw bit rate
+						ACL_ASSERT(bit_rate0 < max_bit_rate, "Invalid bit rate: %u", bit_rate0);
+						ACL_ASSERT(bit_rate1 < max_bit_rate, "Invalid bit rate: %u", bit_rate1);
+						const uint32_t num_bits_per_component0 = num_bits_at_bit_rate[bit_rate0];
+						const uint32_t num_bits_per_component1 = num_bits_at_bit_rate[bit_rate1];
+
+						rtm::vector4f value;
+						if (num_bits_per_component0 == 0)	// Constant bit rate
 						{
-							value0 = unpack_scalarf_32_unsafe(animated_values, track_bit_offset0);
-							value1 = unpack_scalarf_32_unsafe(animated_values, track_bit_offset1);
+							value = rtm::vector_load(constant_values);
+							constant_values += 4;
 						}
 						else
 						{
-							value0 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
-							value1 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
-
-							const rtm::scalarf range_min = rtm::scalar_load(range_values);
-							const rtm::scalarf range_extent = rtm::scalar_load(range_values + 1);
-							value0 = rtm::scalar_mul_add(value0, range_extent, range_min);
-							value1 = rtm::scalar_mul_add(value1, range_extent, range_min);
-							range_values += 2;
+							const rtm::vector4f value0 = unpack_float1x4_sample_v0(num_bits_per_component0, animated_values0, track_bit_offset0, range_values0);
+							if (is_single_key_frame)
+								value = value0;	// Both key frames are the same sample, nothing to interpolate
+							else
+							{
+								const rtm::vector4f value1 = unpack_float1x4_sample_v0(num_bits_per_component1, animated_values1, track_bit_offset1, range_values1);
+								value = rtm::vector_lerp(value0, value1, interpolation_alpha_v);
+							}
+
+							track_bit_offset0 += num_bits_per_component0 * 4;
+							track_bit_offset1 += num_bits_per_component1 * 4;
+
+							if (num_bits_per_component0 != 32)	// Not raw bit rate
+								range_values0 += 8;
+
+							if (num_bits_per_component1 != 32)	// Not raw bit rate
+								range_values1 += 8;
 						}
 
-						value = rtm::scalar_lerp(value0, value1, alpha);
+						rtm::vector_store(value, float1_output_buffer + track_index);
 
-						const uint32_t num_sample_bits = num_bits_per_component;
-						track_bit_offset0 += num_sample_bits;
-						track_bit_offset1 += num_sample_bits;
+						track_index += 3;	// The loop increments past our last track
+						continue;
 					}
-
-					writer.write_float1(track_index, value);
 				}
-				else if (track_type == track_type8::float2f && decompression_settings_type::is_track_type_supported(track_type8::float2f))
+
+				const uint32_t bit_rate0 = per_track_metadata0[track_index].bit_rate;
+				const uint32_t bit_rate1 = per_track_metadata1[track_index].bit_rate;
+				ACL_ASSERT(bit_rate0 < max_bit_rate, "Invalid bit rate: %u", bit_rate0);
+				ACL_ASSERT(bit_rate1 < max_bit_rate, "Invalid bit rate: %u", bit_rate1);
+				const uint32_t num_bits_per_component0 = num_bits_at_bit_rate[bit_rate0];
+				const uint32_t num_bits_per_component1 = num_bits_at_bit_rate[bit_rate1];
+
+				// Constant tracks are constant in every segment
+				const bool is_constant = num_bits_per_component0 == 0;
+				ACL_ASSERT(is_constant == (num_bits_per_component1 == 0), "Constant tracks must be constant in every segment");
+
+				// Tracks we don't need have their data skipped without being unpacked
+				const bool is_track_needed = track_index >= first_track_index && (track_subset == nullptr || bitset_test(track_subset, track_subset_desc, track_index));
+
+				if (is_track_needed)
 				{
-					rtm::vector4f value;
-					if (num_bits_per_component == 0)	// Constant bit rate
+					rtm::scalarf alpha = interpolation_alpha;
+					if (decompression_settings_type::is_per_track_rounding_supported())
 					{
-						value = rtm::vector_load(constant_values);
-						constant_values += 2;
+						const sample_rounding_policy rounding_policy_ = writer.get_rounding_policy(rounding_policy, track_index);
+						ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+
+						alpha = rtm::scalar_set(interpolation_alpha_per_policy[static_cast<int>(rounding_policy_)]);
 					}
-					else
+
+					if (track_type == track_type8::float1f && decompression_settings_type::is_track_type_supported(track_type8::float1f))
 					{
-						rtm::vector4f value0;
-						rtm::vector4f value1;
-						if (num_bits_per_component == 32)	// Raw bit rate
-						{
-							value0 = unpack_vector2_64_unsafe(animated_values, track_bit_offset0);
-							value1 = unpack_vector2_64_unsafe(animated_values, track_bit_offset1);
-						}
+						rtm::scalarf value;
+						if (is_constant)
+							value = rtm::scalar_load(constant_values);
 						else
 						{
-							value0 = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
-							value1 = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
-
-							const rtm::vector4f range_min = rtm::vector_load(range_values);
-							const rtm::vector4f range_extent = rtm::vector_load(range_values + 2);
-							value0 = rtm::vector_mul_add(value0, range_extent, range_min);
-							value1 = rtm::vector_mul_add(value1, range_extent, range_min);
-							range_values += 4;
+							const rtm::scalarf value0 = unpack_float1_sample_v0(num_bits_per_component0, animated_values0, track_bit_offset0, range_values0);
+							if (is_single_key_frame)
+								value = value0;	// Both key frames are the same sample, nothing to interpolate
+							else
+							{
+								const rtm::scalarf value1 = unpack_float1_sample_v0(num_bits_per_component1, animated_values1, track_bit_offset1, range_values1);
+								value = rtm::scalar_lerp(value0, value1, alpha);
+							}
 						}
 
-						value = rtm::vector_lerp(value0, value1, alpha);
-
-						const uint32_t num_sample_bits = num_bits_per_component * 2;
-						track_bit_offset0 += num_sample_bits;
-						track_bit_offset1 += num_sample_bits;
+						writer.write_float1(track_index, value);
 					}
-
-					writer.write_float2(track_index, value);
-				}
-				else if (track_type == track_type8::float3f && decompression_settings_type::is_track_type_supported(track_type8::float3f))
-				{
-					rtm::vector4f value;
-					if (num_bits_per_component == 0)	// Constant bit rate
+					else if (track_type == track_type8::float2f && decompression_settings_type::is_track_type_supported(track_type8::float2f))
 					{
-						value = rtm::vector_load(constant_values);
-						constant_values += 3;
-					}
-					else
-					{
-						rtm::vector4f value0;
-						rtm::vector4f value1;
-						if (num_bits_per_component == 32)	// Raw bit rate
-						{
-							value0 = unpack_vector3_96_unsafe(animated_values, track_bit_offset0);
-							value1 = unpack_vector3_96_unsafe(animated_values, track_bit_offset1);
-						}
+						rtm::vector4f value;
+						if (is_constant)
+							value = rtm::vector_load(constant_values);
 						else
 						{
-							value0 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
-							value1 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
-
-							const rtm::vector4f range_min = rtm::vector_load(range_values);
-							const rtm::vector4f range_extent = rtm::vector_load(range_values + 3);
-							value0 = rtm::vector_mul_add(value0, range_extent, range_min);
-							value1 = rtm::vector_mul_add(value1, range_extent, range_min);
-							range_values += 6;
+							const rtm::vector4f value0 = unpack_float2_sample_v0(num_bits_per_component0, animated_values0, track_bit_offset0, range_values0);
+							if (is_single_key_frame)
+								value = value0;	// Both key frames are the same sample, nothing to interpolate
+							else
+							{
+								const rtm::vector4f value1 = unpack_float2_sample_v0(num_bits_per_component1, animated_values1, track_bit_offset1, range_values1);
+								value = rtm::vector_lerp(value0, value1, alpha);
+							}
 						}
 
-						value = rtm::vector_lerp(value0, value1, alpha);
-
-						const uint32_t num_sample_bits = num_bits_per_component * 3;
-						track_bit_offset0 += num_sample_bits;
-						track_bit_offset1 += num_sample_bits;
+						writer.write_float2(track_index, value);
 					}
-
-					writer.write_float3(track_index, value);
-				}
-				else if (track_type == track_type8::float4f && decompression_settings_type::is_track_type_supported(track_type8::float4f))
-				{
-					rtm::vector4f value;
-					if (num_bits_per_component == 0)	// Constant bit rate
+					else if (track_type == track_type8::float3f && decompression_settings_type::is_track_type_supported(track_type8::float3f))
 					{
-						value = rtm::vector_load(constant_values);
-						constant_values += 4;
-					}
-					else
-					{
-						rtm::vector4f value0;
-						rtm::vector4f value1;
-						if (num_bits_per_component == 32)	// Raw bit rate
-						{
-							value0 = unpack_vector4_128_unsafe(animated_values, track_bit_offset0);
-							value1 = unpack_vector4_128_unsafe(animated_values, track_bit_offset1);
-						}
+						rtm::vector4f value;
+						if (is_constant)
+							value = rtm::vector_load(constant_values);
 						else
 						{
-							value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
-							value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
-
-							const rtm::vector4f range_min = rtm::vector_load(range_values);
-							const rtm::vector4f range_extent = rtm::vector_load(range_values + 4);
-							value0 = rtm::vector_mul_add(value0, range_extent, range_min);
-							value1 = rtm::vector_mul_add(value1, range_extent, range_min);
-							range_values += 8;
+							const rtm::vector4f value0 = unpack_float3_sample_v0(num_bits_per_component0, animated_values0, track_bit_offset0, range_values0);
+							if (is_single_key_frame)
+								value = value0;	// Both key frames are the same sample, nothing to interpolate
+							else
+							{
+								const rtm::vector4f value1 = unpack_float3_sample_v0(num_bits_per_component1, animated_values1, track_bit_offset1, range_values1);
+								value = rtm::vector_lerp(value0, value1, alpha);
+							}
 						}
 
-						value = rtm::vector_lerp(value0, value1, alpha);
-
-						const uint32_t num_sample_bits = num_bits_per_component * 4;
-						track_bit_offset0 += num_sample_bits;
-						track_bit_offset1 += num_sample_bits;
-					}
-
-					writer.write_float4(track_index, value);
-				}
-				else if (track_type == track_type8::vector4f && decompression_settings_type::is_track_type_supported(track_type8::vector4f))
-				{
-					rtm::vector4f value;
-					if (num_bits_per_component == 0)	// Constant bit rate
-					{
-						value = rtm::vector_load(constant_values);
-						constant_values += 4;
+						writer.write_float3(track_index, value);
 					}
-					else
+					else if (track_type == track_type8::float4f && decompression_settings_type::is_track_type_supported(track_type8::float4f))
 					{
-						rtm::vector4f value0;
-						rtm::vector4f value1;
-						if (num_bits_per_component == 32)	// Raw bit rate
+						rtm::vector4f value;
+						if (is_constant)
+							value = rtm::vector_load(constant_values);
+						else
 						{
-							value0 = unpack_vector4_128_unsafe(animated_values, track_bit_offset0);
-							value1 = unpack_vector4_128_unsafe(animated_values, track_bit_offset1);
+							const rtm::vector4f value0 = unpack_float4_sample_v0(num_bits_per_component0, animated_values0, track_bit_offset0, range_values0);
+							if (is_single_key_frame)
+								value = value0;	// Both key frames are the same sample, nothing to interpolate
+							else
+							{
+								const rtm::vector4f value1 = unpack_float4_sample_v0(num_bits_per_component1, animated_values1, track_bit_offset1, range_values1);
+								value = rtm::vector_lerp(value0, value1, alpha);
+							}
 						}
+
+						writer.write_float4(track_index, value);
+					}
+					else if (track_type == track_type8::vector4f && decompression_settings_type::is_track_type_supported(track_type8::vector4f))
+					{
+						rtm::vector4f value;
+						if (is_constant)
+							value = rtm::vector_load(constant_values);
 						else
 						{
-							value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
-							value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
-
-							const rtm::vector4f range_min = rtm::vector_load(range_values);
-							const rtm::vector4f range_extent = rtm::vector_load(range_values + 4);
-							value0 = rtm::vector_mul_add(value0, range_extent, range_min);
-							value1 = rtm::vector_mul_add(value1, range_extent, range_min);
-							range_values += 8;
+							const rtm::vector4f value0 = unpack_float4_sample_v0(num_bits_per_component0, animated_values0, track_bit_offset0, range_values0);
+							if (is_single_key_frame)
+								value = value0;	// Both key frames are the same sample, nothing to interpolate
+							else
+							{
+								const rtm::vector4f value1 = unpack_float4_sample_v0(num_bits_per_component1, animated_values1, track_bit_offset1, range_values1);
+								value = rtm::vector_lerp(value0, value1, alpha);
+							}
 						}
 
-						value = rtm::vector_lerp(value0, value1, alpha);
-
-						const uint32_t num_sample_bits = num_bits_per_component * 4;
-						track_bit_offset0 += num_sample_bits;
-						track_bit_offset1 += num_sample_bits;
+						writer.write_vector4(track_index, value);
 					}
+				}
 
-					writer.write_vector4(track_index, value);
+				// Move on to the data of the next track
+				if (is_constant)
+					constant_values += num_element_components;
+				else
+				{
+					track_bit_offset0 += num_bits_per_component0 * num_element_components;
+					track_bit_offset1 += num_bits_per_component1 * num_element_components;
+
+					if (num_bits_per_component0 != 32)	// Not raw bit rate
+						range_values0 += num_element_components * 2;
+
+					if (num_bits_per_component1 != 32)	// Not raw bit rate
+						range_values1 += num_element_components * 2;
 				}
 			}
 
@@ -475,6 +769,117 @@ namespace acl
 				restore_fp_exceptions(fp_env);
 		}
 
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_tracks_v0(const persistent_scalar_decompression_context_v0& context, const uint32_t* track_subset, bitset_description track_subset_desc, track_writer_type& writer)
+		{
+			const uint32_t num_tracks = get_tracks_header(*context.tracks).num_tracks;
+			decompress_track_selection_v0<decompression_settings_type>(context, track_subset, track_subset_desc, 0, num_tracks, writer);
+		}
+
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_tracks_v0(const persistent_scalar_decompression_context_v0& context, track_writer_type& writer)
+		{
+			decompress_tracks_v0<decompression_settings_type>(context, nullptr, bitset_description(), writer);
+		}
+
+		// Walks the stored samples within [start_sample_index, end_sample_index) in order and decompresses every track
+		// Both key frames point to the stored sample, it is unpacked once and written out as-is
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_samples_v0(persistent_scalar_decompression_context_v0& context, uint32_t start_sample_index, uint32_t end_sample_index, uint32_t sample_stride, track_writer_type& writer)
+		{
+			const acl_impl::tracks_header& header = acl_impl::get_tracks_header(*context.tracks);
+			if (header.num_samples == 0)
+				return;	// Empty track list
+
+			const float sample_rate = header.sample_rate;
+
+			ACL_ASSERT(end_sample_index <= header.num_samples, "End sample index out of bounds: %u > %u", end_sample_index, header.num_samples);
+
+			// Stripped key frames and database samples might not be stored where we expect them, seek to each sample instead
+			const bool has_database = is_database_supported_impl<decompression_settings_type>() && header.get_has_database();
+			if (has_database || header.get_has_stripped_keyframes())
+			{
+				for (uint32_t sample_index = start_sample_index; sample_index < end_sample_index; sample_index += sample_stride)
+				{
+					const float sample_time = rtm::scalar_min(float(sample_index) / sample_rate, context.duration);
+
+					seek_v0<decompression_settings_type>(context, sample_time, sample_rounding_policy::nearest);
+					writer.set_sample_index(sample_index);
+
+					decompress_tracks_v0<decompression_settings_type>(context, writer);
+				}
+
+				return;
+			}
+
+			const acl_impl::scalar_tracks_header& scalars_header = acl_impl::get_scalar_tracks_header(*context.tracks);
+			const bool has_scalar_segments = header.get_has_scalar_segments();
+
+			// When the tracks aren't split into segments, they behave as if they had a single segment
+			const acl_impl::scalar_segment_header* segment_headers = has_scalar_segments ? scalars_header.get_segment_headers() : nullptr;
+			const uint32_t num_samples_per_segment = has_scalar_segments ? scalars_header.get_segments_header()->num_samples_per_segment : header.num_samples;
+			const uint32_t last_segment_index = has_scalar_segments ? (scalars_header.get_segments_header()->num_segments - 1) : 0;
+
+			const uint8_t* animated_values = scalars_header.get_track_animated_values();
+			uint32_t num_bits_per_frame = scalars_header.num_bits_per_frame;
+			uint32_t segment_index = ~0U;	// Forces us to look up our first segment
+
+			// We land directly on our samples, our interpolation alpha is zero as if we had rounded to the nearest sample
+			context.interpolation_alpha = 0.0F;
+			context.rounding_policy = static_cast<uint8_t>(sample_rounding_policy::nearest);
+
+			for (uint32_t sample_index = start_sample_index; sample_index < end_sample_index; sample_index += sample_stride)
+			{
+				// Every segment has the same number of samples except the last which also holds the remaining samples
+				const uint32_t sample_segment_index = std::min<uint32_t>(sample_index / num_samples_per_segment, last_segment_index);
+				if (sample_segment_index != segment_index)
+				{
+					segment_index = sample_segment_index;
+
+					if (has_scalar_segments)
+					{
+						const acl_impl::scalar_segment_header& segment_header = segment_headers[segment_index];
+						animated_values = segment_header.track_animated_values.add_to(&scalars_header);
+						num_bits_per_frame = segment_header.num_bits_per_frame;
+					}
+
+					context.segment_indices[0] = segment_index;
+					context.segment_indices[1] = segment_index;
+					context.animated_values[0] = animated_values;
+					context.animated_values[1] = animated_values;
+				}
+
+				const uint32_t key_frame_bit_offset = (sample_index - (segment_index * num_samples_per_segment)) * num_bits_per_frame;
+				context.key_frame_bit_offsets[0] = key_frame_bit_offset;
+				context.key_frame_bit_offsets[1] = key_frame_bit_offset;
+
+				context.sample_time = rtm::scalar_min(float(sample_index) / sample_rate, context.duration);
+
+				writer.set_sample_index(sample_index);
+
+				decompress_tracks_v0<decompression_settings_type>(context, writer);
+			}
+
+			// Our sample time might not map back exactly onto the last sample visited, seek to it to leave the context
+			// in the same state as a regular seek would
+			if (start_sample_index < end_sample_index)
+				seek_v0<decompression_settings_type>(context, context.sample_time, sample_rounding_policy::nearest);
+		}
+
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_track_range_v0(const persistent_scalar_decompression_context_v0& context, uint32_t first_track_index, uint32_t num_tracks_in_range, track_writer_type& writer)
+		{
+			const uint32_t num_tracks = get_tracks_header(*context.tracks).num_tracks;
+
+			ACL_ASSERT(first_track_index <= num_tracks && num_tracks_in_range <= num_tracks - first_track_index, "Invalid track range");
+			if (first_track_index >= num_tracks || num_tracks_in_range == 0)
+				return;	// Empty range
+
+			const uint32_t end_track_index = std::min<uint32_t>(first_track_index + num_tracks_in_range, num_tracks);
+
+			decompress_track_selection_v0<decompression_settings_type>(context, nullptr, bitset_description(), first_track_index, end_track_index, writer);
+		}
+
 		template<class decompression_settings_type, class track_writer_type>
 		inline void decompress_track_v0(const persistent_scalar_decompression_context_v0& context, uint32_t track_index, track_writer_type& writer)
 		{
@@ -515,60 +920,63 @@ namespace acl
 			const uint32_t max_bit_rate = version == compressed_tracks_version16::v02_00_00 ? sizeof(k_bit_rate_num_bits_v0) : sizeof(k_bit_rate_num_bits);
 #endif
 
+			const scalar_segment_data_v0 segment_data0 = get_scalar_segment_data_v0(header, scalars_header, context.segment_indices[0]);
+			const scalar_segment_data_v0 segment_data1 = get_scalar_segment_data_v0(header, scalars_header, context.segment_indices[1]);
+
+			const acl_impl::track_metadata* per_track_metadata0 = segment_data0.per_track_metadata;
+			const acl_impl::track_metadata* per_track_metadata1 = segment_data1.per_track_metadata;
 			const float* constant_values = scalars_header.get_track_constant_values();
-			const float* range_values = scalars_header.get_track_range_values();
+			const float* range_values0 = segment_data0.range_values;
+			const float* range_values1 = segment_data1.range_values;
 
 			const track_type8 track_type = header.track_type;
 			const uint32_t num_element_components = get_track_num_sample_elements(track_type);
-			uint32_t track_bit_offset = 0;
+			uint32_t track_bit_offset0 = context.key_frame_bit_offsets[0];
+			uint32_t track_bit_offset1 = context.key_frame_bit_offsets[1];
 
-			const acl_impl::track_metadata* per_track_metadata = scalars_header.get_track_metadata();
 			for (uint32_t scan_track_index = 0; scan_track_index < track_index; ++scan_track_index)
 			{
-				const acl_impl::track_metadata& metadata = per_track_metadata[scan_track_index];
-				const uint32_t bit_rate = metadata.bit_rate;
-				ACL_ASSERT(bit_rate < max_bit_rate, "Invalid bit rate: %u", bit_rate);
-				const uint32_t num_bits_per_component = num_bits_at_bit_rate[bit_rate];
-				track_bit_offset += num_bits_per_component * num_element_components;
-
-				if (num_bits_per_component == 0)	// Constant bit rate
+				const uint32_t bit_rate0 = per_track_metadata0[scan_track_index].bit_rate;
+				const uint32_t bit_rate1 = per_track_metadata1[scan_track_index].bit_rate;
+				ACL_ASSERT(bit_rate0 < max_bit_rate, "Invalid bit rate: %u", bit_rate0);
+				ACL_ASSERT(bit_rate1 < max_bit_rate, "Invalid bit rate: %u", bit_rate1);
+				const uint32_t num_bits_per_component0 = num_bits_at_bit_rate[bit_rate0];
+				const uint32_t num_bits_per_component1 = num_bits_at_bit_rate[bit_rate1];
+				track_bit_offset0 += num_bits_per_component0 * num_element_components;
+				track_bit_offset1 += num_bits_per_component1 * num_element_components;
+
+				if (num_bits_per_component0 == 0)	// Constant bit rate
 					constant_values += num_element_components;
-				else if (num_bits_per_component < 32)	// Not raw bit rate
-					range_values += num_element_components * 2;
+				else
+				{
+					if (num_bits_per_component0 < 32)	// Not raw bit rate
+						range_values0 += num_element_components * 2;
+
+					if (num_bits_per_component1 < 32)	// Not raw bit rate
+						range_values1 += num_element_components * 2;
+				}
 			}
 
-			const acl_impl::track_metadata& metadata = per_track_metadata[track_index];
-			const uint32_t bit_rate = metadata.bit_rate;
-			ACL_ASSERT(bit_rate < max_bit_rate, "Invalid bit rate: %u", bit_rate);
-			const uint32_t num_bits_per_component = num_bits_at_bit_rate[bit_rate];
+			const uint32_t bit_rate0 = per_track_metadata0[track_index].bit_rate;
+			const uint32_t bit_rate1 = per_track_metadata1[track_index].bit_rate;
+			ACL_ASSERT(bit_rate0 < max_bit_rate, "Invalid bit rate: %u", bit_rate0);
+			ACL_ASSERT(bit_rate1 < max_bit_rate, "Invalid bit rate: %u", bit_rate1);
+			const uint32_t num_bits_per_component0 = num_bits_at_bit_rate[bit_rate0];
+			const uint32_t num_bits_per_component1 = num_bits_at_bit_rate[bit_rate1];
 
-			const uint8_t* animated_values = scalars_header.get_track_animated_values();
+			const bool is_constant = num_bits_per_component0 == 0;
+			const uint8_t* animated_values0 = context.animated_values[0];
+			const uint8_t* animated_values1 = context.animated_values[1];
 
 			if (track_type == track_type8::float1f && decompression_settings_type::is_track_type_supported(track_type8::float1f))
 			{
 				rtm::scalarf value;
-				if (num_bits_per_component == 0)	// Constant bit rate
+				if (is_constant)
 					value = rtm::scalar_load(constant_values);
 				else
 				{
-					rtm::scalarf value0;
-					rtm::scalarf value1;
-					if (num_bits_per_component == 32)	// Raw bit rate
-					{
-						value0 = unpack_scalarf_32_unsafe(animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_scalarf_32_unsafe(animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
-					}
-					else
-					{
-						value0 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
-
-						const rtm::scalarf range_min = rtm::scalar_load(range_values);
-						const rtm::scalarf range_extent = rtm::scalar_load(range_values + num_element_components);
-						value0 = rtm::scalar_mul_add(value0, range_extent, range_min);
-						value1 = rtm::scalar_mul_add(value1, range_extent, range_min);
-					}
-
+					const rtm::scalarf value0 = unpack_float1_sample_v0(num_bits_per_component0, animated_values0, track_bit_offset0, range_values0);
+					const rtm::scalarf value1 = unpack_float1_sample_v0(num_bits_per_component1, animated_values1, track_bit_offset1, range_values1);
 					value = rtm::scalar_lerp(value0, value1, interpolation_alpha);
 				}
 
@@ -577,28 +985,12 @@ namespace acl
 			else if (track_type == track_type8::float2f && decompression_settings_type::is_track_type_supported(track_type8::float2f))
 			{
 				rtm::vector4f value;
-				if (num_bits_per_component == 0)	// Constant bit rate
+				if (is_constant)
 					value = rtm::vector_load(constant_values);
 				else
 				{
-					rtm::vector4f value0;
-					rtm::vector4f value1;
-					if (num_bits_per_component == 32)	// Raw bit rate
-					{
-						value0 = unpack_vector2_64_unsafe(animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_vector2_64_unsafe(animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
-					}
-					else
-					{
-						value0 = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
-
-						const rtm::vector4f range_min = rtm::vector_load(range_values);
-						const rtm::vector4f range_extent = rtm::vector_load(range_values + num_element_components);
-						value0 = rtm::vector_mul_add(value0, range_extent, range_min);
-						value1 = rtm::vector_mul_add(value1, range_extent, range_min);
-					}
-
+					const rtm::vector4f value0 = unpack_float2_sample_v0(num_bits_per_component0, animated_values0, track_bit_offset0, range_values0);
+					const rtm::vector4f value1 = unpack_float2_sample_v0(num_bits_per_component1, animated_values1, track_bit_offset1, range_values1);
 					value = rtm::vector_lerp(value0, value1, interpolation_alpha);
 				}
 
@@ -607,28 +999,12 @@ namespace acl
 			else if (track_type == track_type8::float3f && decompression_settings_type::is_track_type_supported(track_type8::float3f))
 			{
 				rtm::vector4f value;
-				if (num_bits_per_component == 0)	// Constant bit rate
+				if (is_constant)
 					value = rtm::vector_load(constant_values);
 				else
 				{
-					rtm::vector4f value0;
-					rtm::vector4f value1;
-					if (num_bits_per_component == 32)	// Raw bit rate
-					{
-						value0 = unpack_vector3_96_unsafe(animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_vector3_96_unsafe(animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
-					}
-					else
-					{
-						value0 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
-
-						const rtm::vector4f range_min = rtm::vector_load(range_values);
-						const rtm::vector4f range_extent = rtm::vector_load(range_values + num_element_components);
-						value0 = rtm::vector_mul_add(value0, range_extent, range_min);
-						value1 = rtm::vector_mul_add(value1, range_extent, range_min);
-					}
-
+					const rtm::vector4f value0 = unpack_float3_sample_v0(num_bits_per_component0, animated_values0, track_bit_offset0, range_values0);
+					const rtm::vector4f value1 = unpack_float3_sample_v0(num_bits_per_component1, animated_values1, track_bit_offset1, range_values1);
 					value = rtm::vector_lerp(value0, value1, interpolation_alpha);
 				}
 
@@ -637,28 +1013,12 @@ namespace acl
 			else if (track_type == track_type8::float4f && decompression_settings_type::is_track_type_supported(track_type8::float4f))
 			{
 				rtm::vector4f value;
-				if (num_bits_per_component == 0)	// Constant bit rate
+				if (is_constant)
 					value = rtm::vector_load(constant_values);
 				else
 				{
-					rtm::vector4f value0;
-					rtm::vector4f value1;
-					if (num_bits_per_component == 32)	// Raw bit rate
-					{
-						value0 = unpack_vector4_128_unsafe(animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_vector4_128_unsafe(animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
-					}
-					else
-					{
-						value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
-
-						const rtm::vector4f range_min = rtm::vector_load(range_values);
-						const rtm::vector4f range_extent = rtm::vector_load(range_values + num_element_components);
-						value0 = rtm::vector_mul_add(value0, range_extent, range_min);
-						value1 = rtm::vector_mul_add(value1, range_extent, range_min);
-					}
-
+					const rtm::vector4f value0 = unpack_float4_sample_v0(num_bits_per_component0, animated_values0, track_bit_offset0, range_values0);
+					const rtm::vector4f value1 = unpack_float4_sample_v0(num_bits_per_component1, animated_values1, track_bit_offset1, range_values1);
 					value = rtm::vector_lerp(value0, value1, interpolation_alpha);
 				}
 
@@ -667,28 +1027,12 @@ namespace acl
 			else if (track_type == track_type8::vector4f && decompression_settings_type::is_track_type_supported(track_type8::vector4f))
 			{
 				rtm::vector4f value;
-				if (num_bits_per_component == 0)	// Constant bit rate
+				if (is_constant)
 					value = rtm::vector_load(constant_values);
 				else
 				{
-					rtm::vector4f value0;
-					rtm::vector4f value1;
-					if (num_bits_per_component == 32)	// Raw bit rate
-					{
-						value0 = unpack_vector4_128_unsafe(animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_vector4_128_unsafe(animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
-					}
-					else
-					{
-						value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
-
-						const rtm::vector4f range_min = rtm::vector_load(range_values);
-						const rtm::vector4f range_extent = rtm::vector_load(range_values + num_element_components);
-						value0 = rtm::vector_mul_add(value0, range_extent, range_min);
-						value1 = rtm::vector_mul_add(value1, range_extent, range_min);
-					}
-
+					const rtm::vector4f value0 = unpack_float4_sample_v0(num_bits_per_component0, animated_values0, track_bit_offset0, range_values0);
+					const rtm::vector4f value1 = unpack_float4_sample_v0(num_bits_per_component1, animated_values1, track_bit_offset1, range_values1);
 					value = rtm::vector_lerp(value0, value1, interpolation_alpha);
 				}
 
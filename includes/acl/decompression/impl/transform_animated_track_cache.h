@@ -28,6 +28,7 @@
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/decompression/impl/track_cache.h"
 #include "acl/decompression/impl/transform_decompression_context.h"
+#include "acl/decompression/impl/transform_keyframe_cache.h"
 #include "acl/math/quatf.h"
 #include "acl/math/vector4f.h"
 
@@ -55,13 +56,7 @@
 	#endif
 #endif
 
-// This defined enables the SIMD 8 wide AVX decompression code path
-// Note that currently, it is often slower than the regular SIMD 4 wide AVX code path
-// On Intel Haswell and AMD Zen2 CPUs, the 8 wide code is measurably slower
-// Perhaps it is faster on newer Intel CPUs but I don't have one to test with
-// Enable at your own risk
-//#define ACL_IMPL_USE_AVX_8_WIDE_DECOMP
-
+// The SIMD 8 wide AVX decompression code path is opt-in, see compiler_utils.h
 #if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
 	#if !defined(RTM_AVX_INTRINSICS)
 		// AVX isn't enabled, disable the 8 wide code path
@@ -380,9 +375,9 @@ namespace acl
 			segment_range_extent_yyyy0_yyyy1 = _mm256_blendv_ps(segment_range_extent_yyyy0_yyyy1, one_v, segment_range_mask0_mask1);
 			segment_range_extent_zzzz0_zzzz1 = _mm256_blendv_ps(segment_range_extent_zzzz0_zzzz1, one_v, segment_range_mask0_mask1);
 
-			xxxx0_xxxx1 = _mm256_add_ps(_mm256_mul_ps(xxxx0_xxxx1, segment_range_extent_xxxx0_xxxx1), segment_range_min_xxxx0_xxxx1);
-			yyyy0_yyyy1 = _mm256_add_ps(_mm256_mul_ps(yyyy0_yyyy1, segment_range_extent_yyyy0_yyyy1), segment_range_min_yyyy0_yyyy1);
-			zzzz0_zzzz1 = _mm256_add_ps(_mm256_mul_ps(zzzz0_zzzz1, segment_range_extent_zzzz0_zzzz1), segment_range_min_zzzz0_zzzz1);
+			xxxx0_xxxx1 = vector_mul_add_avx8(xxxx0_xxxx1, segment_range_extent_xxxx0_xxxx1, segment_range_min_xxxx0_xxxx1);
+			yyyy0_yyyy1 = vector_mul_add_avx8(yyyy0_yyyy1, segment_range_extent_yyyy0_yyyy1, segment_range_min_yyyy0_yyyy1);
+			zzzz0_zzzz1 = vector_mul_add_avx8(zzzz0_zzzz1, segment_range_extent_zzzz0_zzzz1, segment_range_min_zzzz0_zzzz1);
 		}
 #endif
 
@@ -506,9 +501,9 @@ namespace acl
 			clip_range_extent_yyyy_yyyy = _mm256_blendv_ps(clip_range_extent_yyyy_yyyy, one_v, clip_range_mask0_mask1);
 			clip_range_extent_zzzz_zzzz = _mm256_blendv_ps(clip_range_extent_zzzz_zzzz, one_v, clip_range_mask0_mask1);
 
-			xxxx0_xxxx1 = _mm256_add_ps(_mm256_mul_ps(xxxx0_xxxx1, clip_range_extent_xxxx_xxxx), clip_range_min_xxxx_xxxx);
-			yyyy0_yyyy1 = _mm256_add_ps(_mm256_mul_ps(yyyy0_yyyy1, clip_range_extent_yyyy_yyyy), clip_range_min_yyyy_yyyy);
-			zzzz0_zzzz1 = _mm256_add_ps(_mm256_mul_ps(zzzz0_zzzz1, clip_range_extent_zzzz_zzzz), clip_range_min_zzzz_zzzz);
+			xxxx0_xxxx1 = vector_mul_add_avx8(xxxx0_xxxx1, clip_range_extent_xxxx_xxxx, clip_range_min_xxxx_xxxx);
+			yyyy0_yyyy1 = vector_mul_add_avx8(yyyy0_yyyy1, clip_range_extent_yyyy_yyyy, clip_range_min_yyyy_yyyy);
+			zzzz0_zzzz1 = vector_mul_add_avx8(zzzz0_zzzz1, clip_range_extent_zzzz_zzzz, clip_range_min_zzzz_zzzz);
 		}
 #endif
 
@@ -989,6 +984,293 @@ namespace acl
 			ACL_IMPL_ANIMATED_PREFETCH(segment_range_data + 48);
 		}
 
+#if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
+		// Reads a single sample without undoing its range reduction, see unpack_animated_vector3(..)
+		// The segment range data pointer is left on the sample's segment range entry, if any
+		template<class decompression_settings_adapter_type>
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK rtm::vector4f RTM_SIMD_CALL read_animated_vector3_avx8(vector_format8 format, uint32_t num_raw_bit_rate_bits,
+			const uint8_t*& format_per_track_data, const uint8_t*& segment_range_data, const uint8_t* animated_track_data, uint32_t& animated_track_data_bit_offset,
+			uint32_t& range_ignore_flags)
+		{
+			rtm::vector4f sample;
+			if (format == vector_format8::vector3f_variable && decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable))
+			{
+				const uint32_t num_bits_at_bit_rate = *format_per_track_data;
+				format_per_track_data++;
+
+				if (num_bits_at_bit_rate == 0)	// Constant bit rate
+				{
+					sample = unpack_vector3_u48_unsafe(segment_range_data);
+					segment_range_data += sizeof(uint16_t) * 3;
+					range_ignore_flags = 0x01;	// Skip segment only
+				}
+				else if (num_bits_at_bit_rate == num_raw_bit_rate_bits)	// Raw bit rate
+				{
+					sample = unpack_vector3_96_unsafe(animated_track_data, animated_track_data_bit_offset);
+					animated_track_data_bit_offset += 96;
+					segment_range_data += sizeof(uint16_t) * 3;	// Raw bit rates have unused range data, skip it
+					range_ignore_flags = 0x03;	// Skip clip and segment
+				}
+				else
+				{
+					sample = unpack_vector3_uXX_unsafe(num_bits_at_bit_rate, animated_track_data, animated_track_data_bit_offset);
+					animated_track_data_bit_offset += num_bits_at_bit_rate * 3;
+					range_ignore_flags = 0x00;	// Don't skip range reduction
+				}
+			}
+			else // vector_format8::vector3f_full
+			{
+				sample = unpack_vector3_96_unsafe(animated_track_data, animated_track_data_bit_offset);
+				animated_track_data_bit_offset += 96;
+				range_ignore_flags = 0x03;	// Skip clip and segment
+			}
+
+			return sample;
+		}
+
+		// Range reduction data of a group of vector3 sub-tracks for both key frames, see unpack_animated_vector3_avx8(..)
+		struct animated_vector3_range_scratch_avx8
+		{
+			// Segment range data, per key frame and sub-track
+			rtm::vector4f segment_range_min[2][4];
+			rtm::vector4f segment_range_extent[2][4];
+
+			// Clip range data per sub-track, both key frames share it
+			rtm::vector4f clip_range_min[4];
+			rtm::vector4f clip_range_extent[4];
+
+			// Whether a sample ignores a range level (0xFFFFFFFF) or not (0x00000000)
+			// The first key frame uses the first 4 entries, one per sub-track, and the second key frame uses the last 4
+			uint32_t segment_range_ignore_masks[8];
+			uint32_t clip_range_ignore_masks[8];
+		};
+
+		// Undoes the range reduction of 4 vector3 sub-tracks for both key frames at once, 8 wide
+		// The samples are swizzled in SOA form and every lane performs the same operations as unpack_animated_vector3(..) to yield identical results
+		// A sample that ignores a range level is blended back untouched
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL remap_vector3_range_data_avx8(const animated_vector3_range_scratch_avx8& range_scratch, bool has_segments,
+			rtm::vector4f samples0[4], rtm::vector4f samples1[4])
+		{
+			rtm::vector4f samples0_xxxx;
+			rtm::vector4f samples0_yyyy;
+			rtm::vector4f samples0_zzzz;
+			rtm::vector4f samples0_wwww;
+			RTM_MATRIXF_TRANSPOSE_4X4(samples0[0], samples0[1], samples0[2], samples0[3], samples0_xxxx, samples0_yyyy, samples0_zzzz, samples0_wwww);
+
+			rtm::vector4f samples1_xxxx;
+			rtm::vector4f samples1_yyyy;
+			rtm::vector4f samples1_zzzz;
+			rtm::vector4f samples1_wwww;
+			RTM_MATRIXF_TRANSPOSE_4X4(samples1[0], samples1[1], samples1[2], samples1[3], samples1_xxxx, samples1_yyyy, samples1_zzzz, samples1_wwww);
+
+			__m256 xxxx0_xxxx1 = _mm256_set_m128(samples1_xxxx, samples0_xxxx);
+			__m256 yyyy0_yyyy1 = _mm256_set_m128(samples1_yyyy, samples0_yyyy);
+			__m256 zzzz0_zzzz1 = _mm256_set_m128(samples1_zzzz, samples0_zzzz);
+			__m256 wwww0_wwww1 = _mm256_set_m128(samples1_wwww, samples0_wwww);
+
+			if (has_segments)
+			{
+				// Apply segment range remapping
+				rtm::vector4f segment_range_min0_xxxx;
+				rtm::vector4f segment_range_min0_yyyy;
+				rtm::vector4f segment_range_min0_zzzz;
+				rtm::vector4f segment_range_min0_wwww;
+				RTM_MATRIXF_TRANSPOSE_4X4(range_scratch.segment_range_min[0][0], range_scratch.segment_range_min[0][1], range_scratch.segment_range_min[0][2], range_scratch.segment_range_min[0][3],
+					segment_range_min0_xxxx, segment_range_min0_yyyy, segment_range_min0_zzzz, segment_range_min0_wwww);
+
+				rtm::vector4f segment_range_min1_xxxx;
+				rtm::vector4f segment_range_min1_yyyy;
+				rtm::vector4f segment_range_min1_zzzz;
+				rtm::vector4f segment_range_min1_wwww;
+				RTM_MATRIXF_TRANSPOSE_4X4(range_scratch.segment_range_min[1][0], range_scratch.segment_range_min[1][1], range_scratch.segment_range_min[1][2], range_scratch.segment_range_min[1][3],
+					segment_range_min1_xxxx, segment_range_min1_yyyy, segment_range_min1_zzzz, segment_range_min1_wwww);
+
+				rtm::vector4f segment_range_extent0_xxxx;
+				rtm::vector4f segment_range_extent0_yyyy;
+				rtm::vector4f segment_range_extent0_zzzz;
+				rtm::vector4f segment_range_extent0_wwww;
+				RTM_MATRIXF_TRANSPOSE_4X4(range_scratch.segment_range_extent[0][0], range_scratch.segment_range_extent[0][1], range_scratch.segment_range_extent[0][2], range_scratch.segment_range_extent[0][3],
+					segment_range_extent0_xxxx, segment_range_extent0_yyyy, segment_range_extent0_zzzz, segment_range_extent0_wwww);
+
+				rtm::vector4f segment_range_extent1_xxxx;
+				rtm::vector4f segment_range_extent1_yyyy;
+				rtm::vector4f segment_range_extent1_zzzz;
+				rtm::vector4f segment_range_extent1_wwww;
+				RTM_MATRIXF_TRANSPOSE_4X4(range_scratch.segment_range_extent[1][0], range_scratch.segment_range_extent[1][1], range_scratch.segment_range_extent[1][2], range_scratch.segment_range_extent[1][3],
+					segment_range_extent1_xxxx, segment_range_extent1_yyyy, segment_range_extent1_zzzz, segment_range_extent1_wwww);
+
+				const __m256 segment_range_ignore_mask = _mm256_loadu_ps(reinterpret_cast<const float*>(&range_scratch.segment_range_ignore_masks[0]));
+
+				xxxx0_xxxx1 = _mm256_blendv_ps(vector_mul_add_avx8(xxxx0_xxxx1, _mm256_set_m128(segment_range_extent1_xxxx, segment_range_extent0_xxxx), _mm256_set_m128(segment_range_min1_xxxx, segment_range_min0_xxxx)), xxxx0_xxxx1, segment_range_ignore_mask);
+				yyyy0_yyyy1 = _mm256_blendv_ps(vector_mul_add_avx8(yyyy0_yyyy1, _mm256_set_m128(segment_range_extent1_yyyy, segment_range_extent0_yyyy), _mm256_set_m128(segment_range_min1_yyyy, segment_range_min0_yyyy)), yyyy0_yyyy1, segment_range_ignore_mask);
+				zzzz0_zzzz1 = _mm256_blendv_ps(vector_mul_add_avx8(zzzz0_zzzz1, _mm256_set_m128(segment_range_extent1_zzzz, segment_range_extent0_zzzz), _mm256_set_m128(segment_range_min1_zzzz, segment_range_min0_zzzz)), zzzz0_zzzz1, segment_range_ignore_mask);
+				wwww0_wwww1 = _mm256_blendv_ps(vector_mul_add_avx8(wwww0_wwww1, _mm256_set_m128(segment_range_extent1_wwww, segment_range_extent0_wwww), _mm256_set_m128(segment_range_min1_wwww, segment_range_min0_wwww)), wwww0_wwww1, segment_range_ignore_mask);
+			}
+
+			{
+				// Apply clip range remapping, both key frames share the same clip range
+				rtm::vector4f clip_range_min_xxxx;
+				rtm::vector4f clip_range_min_yyyy;
+				rtm::vector4f clip_range_min_zzzz;
+				rtm::vector4f clip_range_min_wwww;
+				RTM_MATRIXF_TRANSPOSE_4X4(range_scratch.clip_range_min[0], range_scratch.clip_range_min[1], range_scratch.clip_range_min[2], range_scratch.clip_range_min[3],
+					clip_range_min_xxxx, clip_range_min_yyyy, clip_range_min_zzzz, clip_range_min_wwww);
+
+				rtm::vector4f clip_range_extent_xxxx;
+				rtm::vector4f clip_range_extent_yyyy;
+				rtm::vector4f clip_range_extent_zzzz;
+				rtm::vector4f clip_range_extent_wwww;
+				RTM_MATRIXF_TRANSPOSE_4X4(range_scratch.clip_range_extent[0], range_scratch.clip_range_extent[1], range_scratch.clip_range_extent[2], range_scratch.clip_range_extent[3],
+					clip_range_extent_xxxx, clip_range_extent_yyyy, clip_range_extent_zzzz, clip_range_extent_wwww);
+
+				const __m256 clip_range_ignore_mask = _mm256_loadu_ps(reinterpret_cast<const float*>(&range_scratch.clip_range_ignore_masks[0]));
+
+				xxxx0_xxxx1 = _mm256_blendv_ps(vector_mul_add_avx8(xxxx0_xxxx1, _mm256_set_m128(clip_range_extent_xxxx, clip_range_extent_xxxx), _mm256_set_m128(clip_range_min_xxxx, clip_range_min_xxxx)), xxxx0_xxxx1, clip_range_ignore_mask);
+				yyyy0_yyyy1 = _mm256_blendv_ps(vector_mul_add_avx8(yyyy0_yyyy1, _mm256_set_m128(clip_range_extent_yyyy, clip_range_extent_yyyy), _mm256_set_m128(clip_range_min_yyyy, clip_range_min_yyyy)), yyyy0_yyyy1, clip_range_ignore_mask);
+				zzzz0_zzzz1 = _mm256_blendv_ps(vector_mul_add_avx8(zzzz0_zzzz1, _mm256_set_m128(clip_range_extent_zzzz, clip_range_extent_zzzz), _mm256_set_m128(clip_range_min_zzzz, clip_range_min_zzzz)), zzzz0_zzzz1, clip_range_ignore_mask);
+				wwww0_wwww1 = _mm256_blendv_ps(vector_mul_add_avx8(wwww0_wwww1, _mm256_set_m128(clip_range_extent_wwww, clip_range_extent_wwww), _mm256_set_m128(clip_range_min_wwww, clip_range_min_wwww)), wwww0_wwww1, clip_range_ignore_mask);
+			}
+
+			// Swizzle our samples back into AOS form
+			RTM_MATRIXF_TRANSPOSE_4X4(_mm256_castps256_ps128(xxxx0_xxxx1), _mm256_castps256_ps128(yyyy0_yyyy1), _mm256_castps256_ps128(zzzz0_zzzz1), _mm256_castps256_ps128(wwww0_wwww1),
+				samples0[0], samples0[1], samples0[2], samples0[3]);
+			RTM_MATRIXF_TRANSPOSE_4X4(_mm256_extractf128_ps(xxxx0_xxxx1, 1), _mm256_extractf128_ps(yyyy0_yyyy1, 1), _mm256_extractf128_ps(zzzz0_zzzz1, 1), _mm256_extractf128_ps(wwww0_wwww1, 1),
+				samples1[0], samples1[1], samples1[2], samples1[3]);
+		}
+
+		// Same as unpack_animated_vector3(..) but both key frames of 4 sub-tracks are unpacked at once
+		// Samples are read one at a time and their range reduction is then undone 8 wide, see remap_vector3_range_data_avx8(..)
+		template<class decompression_settings_adapter_type>
+		inline RTM_DISABLE_SECURITY_COOKIE_CHECK void unpack_animated_vector3_avx8(const persistent_transform_decompression_context_v0& decomp_context,
+			rtm::vector4f output_scratch0[4], rtm::vector4f output_scratch1[4],
+			uint32_t num_to_unpack,
+			const clip_animated_sampling_context_v0& clip_sampling_context,
+			segment_animated_sampling_context_v0& segment_sampling_context0, segment_animated_sampling_context_v0& segment_sampling_context1)
+		{
+			const vector_format8 format = get_vector_format<decompression_settings_adapter_type>(decompression_settings_adapter_type::get_vector_format(decomp_context));
+			const compressed_tracks_version16 version = get_version<decompression_settings_adapter_type>(decomp_context.get_version());
+			const bool is_variable = format == vector_format8::vector3f_variable && decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable);
+
+			// See write_format_per_track_data(..) for details
+			const uint32_t num_raw_bit_rate_bits = version >= compressed_tracks_version16::v02_01_99_1 ? 31 : 32;
+
+			const uint8_t* format_per_track_data0 = segment_sampling_context0.format_per_track_data;
+			const uint8_t* segment_range_data0 = segment_sampling_context0.segment_range_data;
+			const uint8_t* animated_track_data0 = segment_sampling_context0.animated_track_data;
+			uint32_t animated_track_data_bit_offset0 = segment_sampling_context0.animated_track_data_bit_offset;
+
+			const uint8_t* format_per_track_data1 = segment_sampling_context1.format_per_track_data;
+			const uint8_t* segment_range_data1 = segment_sampling_context1.segment_range_data;
+			const uint8_t* animated_track_data1 = segment_sampling_context1.animated_track_data;
+			uint32_t animated_track_data_bit_offset1 = segment_sampling_context1.animated_track_data_bit_offset;
+
+			const uint8_t* clip_range_data = clip_sampling_context.clip_range_data;
+
+			const rtm::vector4f zero_v = rtm::vector_zero();
+			const rtm::vector4f one_v = rtm::vector_set(1.0F);
+
+			animated_vector3_range_scratch_avx8 range_scratch;
+
+			for (uint32_t unpack_index = 0; unpack_index < num_to_unpack; ++unpack_index)
+			{
+				// Range ignore flags are used to skip range normalization at the clip and/or segment levels
+				// Each sample has two bits like so:
+				//    - 0x01 = ignore segment level
+				//    - 0x02 = ignore clip level
+				uint32_t range_ignore_flags0;
+				uint32_t range_ignore_flags1;
+
+				output_scratch0[unpack_index] = read_animated_vector3_avx8<decompression_settings_adapter_type>(format, num_raw_bit_rate_bits, format_per_track_data0, segment_range_data0, animated_track_data0, animated_track_data_bit_offset0, range_ignore_flags0);
+				output_scratch1[unpack_index] = read_animated_vector3_avx8<decompression_settings_adapter_type>(format, num_raw_bit_rate_bits, format_per_track_data1, segment_range_data1, animated_track_data1, animated_track_data_bit_offset1, range_ignore_flags1);
+
+				if (!is_variable)
+					continue;	// Full precision samples have no range reduction
+
+				const uint32_t segment_range_entry_size = 3 * sizeof(uint8_t);
+
+				if (decomp_context.has_segments && (range_ignore_flags0 & 0x01) == 0)
+				{
+					range_scratch.segment_range_min[0][unpack_index] = unpack_vector3_u24_unsafe(segment_range_data0);
+					range_scratch.segment_range_extent[0][unpack_index] = unpack_vector3_u24_unsafe(segment_range_data0 + segment_range_entry_size);
+					segment_range_data0 += segment_range_entry_size * 2;
+				}
+				else
+				{
+					range_scratch.segment_range_min[0][unpack_index] = zero_v;
+					range_scratch.segment_range_extent[0][unpack_index] = one_v;
+				}
+
+				if (decomp_context.has_segments && (range_ignore_flags1 & 0x01) == 0)
+				{
+					range_scratch.segment_range_min[1][unpack_index] = unpack_vector3_u24_unsafe(segment_range_data1);
+					range_scratch.segment_range_extent[1][unpack_index] = unpack_vector3_u24_unsafe(segment_range_data1 + segment_range_entry_size);
+					segment_range_data1 += segment_range_entry_size * 2;
+				}
+				else
+				{
+					range_scratch.segment_range_min[1][unpack_index] = zero_v;
+					range_scratch.segment_range_extent[1][unpack_index] = one_v;
+				}
+
+				// Every animated sub-track has clip range data
+				const uint32_t clip_range_entry_size = 3 * sizeof(float);
+				const uint8_t* clip_range_min_ptr = clip_range_data + (clip_range_entry_size * 2 * unpack_index);
+				range_scratch.clip_range_min[unpack_index] = rtm::vector_load(clip_range_min_ptr);
+				range_scratch.clip_range_extent[unpack_index] = rtm::vector_load(clip_range_min_ptr + clip_range_entry_size);
+
+				range_scratch.segment_range_ignore_masks[unpack_index + 0] = (range_ignore_flags0 & 0x01) != 0 ? 0xFFFFFFFFU : 0;
+				range_scratch.segment_range_ignore_masks[unpack_index + 4] = (range_ignore_flags1 & 0x01) != 0 ? 0xFFFFFFFFU : 0;
+				range_scratch.clip_range_ignore_masks[unpack_index + 0] = (range_ignore_flags0 & 0x02) != 0 ? 0xFFFFFFFFU : 0;
+				range_scratch.clip_range_ignore_masks[unpack_index + 4] = (range_ignore_flags1 & 0x02) != 0 ? 0xFFFFFFFFU : 0;
+			}
+
+			if (is_variable)
+			{
+				// Unused entries of a partial group are left untouched
+				for (uint32_t unpack_index = num_to_unpack; unpack_index < 4; ++unpack_index)
+				{
+					output_scratch0[unpack_index] = zero_v;
+					output_scratch1[unpack_index] = zero_v;
+					range_scratch.segment_range_min[0][unpack_index] = zero_v;
+					range_scratch.segment_range_min[1][unpack_index] = zero_v;
+					range_scratch.segment_range_extent[0][unpack_index] = one_v;
+					range_scratch.segment_range_extent[1][unpack_index] = one_v;
+					range_scratch.clip_range_min[unpack_index] = zero_v;
+					range_scratch.clip_range_extent[unpack_index] = one_v;
+					range_scratch.segment_range_ignore_masks[unpack_index + 0] = 0xFFFFFFFFU;
+					range_scratch.segment_range_ignore_masks[unpack_index + 4] = 0xFFFFFFFFU;
+					range_scratch.clip_range_ignore_masks[unpack_index + 0] = 0xFFFFFFFFU;
+					range_scratch.clip_range_ignore_masks[unpack_index + 4] = 0xFFFFFFFFU;
+				}
+
+				remap_vector3_range_data_avx8(range_scratch, decomp_context.has_segments != 0, output_scratch0, output_scratch1);
+			}
+
+			for (uint32_t unpack_index = 0; unpack_index < num_to_unpack; ++unpack_index)
+			{
+				ACL_ASSERT(rtm::vector_is_finite3(output_scratch0[unpack_index]), "Vector3 is not valid!");
+				ACL_ASSERT(rtm::vector_is_finite3(output_scratch1[unpack_index]), "Vector3 is not valid!");
+			}
+
+			// Update our pointers
+			segment_sampling_context0.format_per_track_data = format_per_track_data0;
+			segment_sampling_context0.segment_range_data = segment_range_data0;
+			segment_sampling_context0.animated_track_data_bit_offset = animated_track_data_bit_offset0;
+
+			segment_sampling_context1.format_per_track_data = format_per_track_data1;
+			segment_sampling_context1.segment_range_data = segment_range_data1;
+			segment_sampling_context1.animated_track_data_bit_offset = animated_track_data_bit_offset1;
+
+			// See unpack_animated_vector3(..) for details
+			ACL_IMPL_ANIMATED_PREFETCH(format_per_track_data0 + 60);
+			ACL_IMPL_ANIMATED_PREFETCH(animated_track_data0 + (animated_track_data_bit_offset0 / 8) + 63);
+			ACL_IMPL_ANIMATED_PREFETCH(segment_range_data0 + 48);
+			ACL_IMPL_ANIMATED_PREFETCH(format_per_track_data1 + 60);
+			ACL_IMPL_ANIMATED_PREFETCH(animated_track_data1 + (animated_track_data_bit_offset1 / 8) + 63);
+			ACL_IMPL_ANIMATED_PREFETCH(segment_range_data1 + 48);
+		}
+#endif
+
 		template<class decompression_settings_adapter_type>
 		inline RTM_DISABLE_SECURITY_COOKIE_CHECK rtm::vector4f RTM_SIMD_CALL unpack_single_animated_vector3(const persistent_transform_decompression_context_v0& decomp_context,
 			uint32_t unpack_index,
@@ -1191,6 +1473,65 @@ namespace acl
 #endif
 		}
 
+		// Returns the bit size prefixes of the segment that owns the provided segment header, see k_num_sub_tracks_per_bit_size_prefix
+		// Requires a sub-track prefix index
+		inline const uint32_t* get_segment_bit_size_prefixes(const persistent_transform_decompression_context_v0& decomp_context, const segment_header* header)
+		{
+			const compressed_tracks* tracks = decomp_context.tracks;
+			const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
+
+			const uint32_t num_sub_tracks_per_bone = decomp_context.has_scale ? 3 : 2;
+			const uint32_t num_sub_track_entries = ((tracks->get_num_tracks() + k_num_sub_tracks_per_packed_entry - 1) / k_num_sub_tracks_per_packed_entry) * num_sub_tracks_per_bone;
+
+			// Segment headers contain the sample indices when we have a database or stripped keyframes
+			const uint32_t segment_header_size = (tracks->has_database() || tracks->has_stripped_keyframes()) ? sizeof(stripped_segment_header_t) : sizeof(segment_header);
+			const uint32_t segment_index = uint32_t(reinterpret_cast<const uint8_t*>(header) - reinterpret_cast<const uint8_t*>(transform_header.get_segment_headers())) / segment_header_size;
+
+			const uint32_t num_prefixes_per_segment = get_num_segment_bit_size_prefixes(transform_header.num_animated_variable_sub_tracks);
+			return transform_header.get_segment_bit_size_prefixes(num_sub_track_entries) + (segment_index * num_prefixes_per_segment);
+		}
+
+		// Returns the number of bits per component used by the animated variable sub-tracks that precede the provided one within its segment
+		RTM_FORCE_INLINE uint32_t count_preceding_animated_bit_size(const uint32_t* segment_bit_size_prefixes, const uint8_t* segment_format_per_track_data, uint32_t format_index)
+		{
+			const uint32_t prefix_index = format_index / k_num_sub_tracks_per_bit_size_prefix;
+			uint32_t bit_size_per_component = prefix_index != 0 ? segment_bit_size_prefixes[prefix_index - 1] : 0;
+
+			// Add the few that remain since the last prefix, see count_animated_group_bit_size(..) for the raw bit rate
+			for (uint32_t sub_track_index = prefix_index * k_num_sub_tracks_per_bit_size_prefix; sub_track_index < format_index; ++sub_track_index)
+			{
+				const uint32_t num_bits = segment_format_per_track_data[sub_track_index];
+				bit_size_per_component += num_bits == 31 ? 32 : num_bits;
+			}
+
+			return bit_size_per_component;
+		}
+
+		// Same as count_animated_group_bit_size(..) but uses the segment bit size prefixes to not read the bit rate of every skipped group
+		template<class decompression_settings_adapter_type>
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void count_animated_group_bit_size(
+			const persistent_transform_decompression_context_v0& decomp_context, const uint32_t* const segment_bit_size_prefixes[2],
+			const uint8_t* format_per_track_data0, const uint8_t* format_per_track_data1, uint32_t num_groups_to_skip,
+			uint32_t& out_group_bit_size_per_component0, uint32_t& out_group_bit_size_per_component1)
+		{
+			// Only worth it when we skip past at least one prefix, otherwise summing the groups is cheaper
+			if (segment_bit_size_prefixes[0] == nullptr || num_groups_to_skip * 4 < k_num_sub_tracks_per_bit_size_prefix)
+			{
+				count_animated_group_bit_size<decompression_settings_adapter_type>(decomp_context, format_per_track_data0, format_per_track_data1, num_groups_to_skip, out_group_bit_size_per_component0, out_group_bit_size_per_component1);
+				return;
+			}
+
+			const uint8_t* segment_format_per_track_data0 = decomp_context.format_per_track_data[0];
+			const uint8_t* segment_format_per_track_data1 = decomp_context.format_per_track_data[1];
+
+			const uint32_t format_index0 = uint32_t(format_per_track_data0 - segment_format_per_track_data0);
+			const uint32_t format_index1 = uint32_t(format_per_track_data1 - segment_format_per_track_data1);
+			const uint32_t num_to_skip = num_groups_to_skip * 4;
+
+			out_group_bit_size_per_component0 = count_preceding_animated_bit_size(segment_bit_size_prefixes[0], segment_format_per_track_data0, format_index0 + num_to_skip) - count_preceding_animated_bit_size(segment_bit_size_prefixes[0], segment_format_per_track_data0, format_index0);
+			out_group_bit_size_per_component1 = count_preceding_animated_bit_size(segment_bit_size_prefixes[1], segment_format_per_track_data1, format_index1 + num_to_skip) - count_preceding_animated_bit_size(segment_bit_size_prefixes[1], segment_format_per_track_data1, format_index1);
+		}
+
 		// Performance notes:
 		//    - Using SOA after unpacking vec3 appears to be slightly slower. Full groups aren't super common
 		//      because animated translation/scale isn't common. But even with clips with lots of full groups,
@@ -1220,6 +1561,20 @@ namespace acl
 			segment_animated_sampling_context_v0 segment_sampling_context_translations[2];
 			segment_animated_sampling_context_v0 segment_sampling_context_scales[2];
 
+			// Decoded key frame cache groups to read from or write to next, optional
+			rtm::vector4f* keyframe_cache_rotations;
+			rtm::vector4f* keyframe_cache_translations;
+			rtm::vector4f* keyframe_cache_scales;
+
+			// Whether the decoded key frame cache contains the key frames we interpolate between
+			bool is_keyframe_cache_hit;
+
+			// Whether both key frames are the same stored sample, we only unpack it once
+			bool is_single_key_frame;
+
+			// Bit size prefixes of the segment of each key frame, only present with a sub-track prefix index
+			const uint32_t* segment_bit_size_prefixes[2];
+
 			template<class decompression_settings_type, class decompression_settings_translation_adapter_type>
 			void RTM_DISABLE_SECURITY_COOKIE_CHECK initialize(const persistent_transform_decompression_context_v0& decomp_context)
 			{
@@ -1229,6 +1584,17 @@ namespace acl
 				const segment_header* segment0 = decomp_context.segment_offsets[0].add_to(tracks);
 				const segment_header* segment1 = decomp_context.segment_offsets[1].add_to(tracks);
 
+				if (decomp_context.has_sub_track_prefix_index)
+				{
+					segment_bit_size_prefixes[0] = get_segment_bit_size_prefixes(decomp_context, segment0);
+					segment_bit_size_prefixes[1] = get_segment_bit_size_prefixes(decomp_context, segment1);
+				}
+				else
+				{
+					segment_bit_size_prefixes[0] = nullptr;
+					segment_bit_size_prefixes[1] = nullptr;
+				}
+
 				const uint8_t* animated_track_data0 = decomp_context.animated_track_data[0];
 				const uint8_t* animated_track_data1 = decomp_context.animated_track_data[1];
 
@@ -1311,6 +1677,35 @@ namespace acl
 				rotations.num_left_to_unpack = transform_header.num_animated_rotation_sub_tracks;
 				translations.num_left_to_unpack = transform_header.num_animated_translation_sub_tracks;
 				scales.num_left_to_unpack = transform_header.num_animated_scale_sub_tracks;
+
+				keyframe_cache_rotations = nullptr;
+				keyframe_cache_translations = nullptr;
+				keyframe_cache_scales = nullptr;
+				is_keyframe_cache_hit = false;
+
+				is_single_key_frame = decomp_context.uses_single_segment && animated_track_data0 == animated_track_data1 && animated_track_data_bit_offset_rotations0 == animated_track_data_bit_offset_rotations1;
+			}
+
+			// Binds the decoded key frame cache if we have one
+			// Must only be called when every animated group will be unpacked since a cache miss will populate it entirely
+			// A cache miss writes into the cache owned by the context, it cannot be shared between threads
+			template<class decompression_settings_type>
+			void RTM_DISABLE_SECURITY_COOKIE_CHECK initialize_keyframe_cache(persistent_transform_decompression_context_v0& decomp_context)
+			{
+				if (!decompression_settings_type::is_keyframe_cache_supported() || decomp_context.keyframe_cache == nullptr)
+					return;	// No cache, we'll unpack everything
+
+				keyframe_cache_header_v0* header = reinterpret_cast<keyframe_cache_header_v0*>(decomp_context.keyframe_cache);
+
+				is_keyframe_cache_hit = header->is_cached(decomp_context);
+				if (!is_keyframe_cache_hit)
+					header->set_cached(decomp_context);	// We'll populate it as we unpack
+
+				const transform_tracks_header& transform_header = get_transform_tracks_header(*decomp_context.tracks);
+
+				keyframe_cache_rotations = reinterpret_cast<rtm::vector4f*>(decomp_context.keyframe_cache + sizeof(keyframe_cache_header_v0));
+				keyframe_cache_translations = keyframe_cache_rotations + (get_num_keyframe_cache_groups(transform_header.num_animated_rotation_sub_tracks) * k_num_keyframe_cache_entries_per_group);
+				keyframe_cache_scales = keyframe_cache_translations + (get_num_keyframe_cache_groups(transform_header.num_animated_translation_sub_tracks) * k_num_keyframe_cache_entries_per_group);
 			}
 
 			template<class decompression_settings_type>
@@ -1336,141 +1731,196 @@ namespace acl
 				const float interpolation_alpha = decomp_context.interpolation_alpha;
 				const bool should_interpolate = should_interpolate_samples<decompression_settings_type>(rotation_format, interpolation_alpha);
 
-				segment_animated_scratch_v0 segment_scratch;
+				// Our unpacked samples in SOA form
+				rtm::vector4f scratch0_xxxx;
+				rtm::vector4f scratch0_yyyy;
+				rtm::vector4f scratch0_zzzz;
+				rtm::vector4f scratch0_wwww;
+				rtm::vector4f scratch1_xxxx;
+				rtm::vector4f scratch1_yyyy;
+				rtm::vector4f scratch1_zzzz;
+				rtm::vector4f scratch1_wwww;
 
-				// We start by unpacking our segment range data into our scratch memory
-				// We often only use a single segment to interpolate, we can avoid redundant work
-				if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
+				// If the key frames we interpolate between haven't changed, we already unpacked them before
+				rtm::vector4f* keyframe_cache_group = nullptr;
+				if (decompression_settings_type::is_keyframe_cache_supported() && keyframe_cache_rotations != nullptr)
 				{
-					if (decomp_context.has_segments)
+					keyframe_cache_group = keyframe_cache_rotations;
+					keyframe_cache_rotations += k_num_keyframe_cache_entries_per_group;
+				}
+
+				if (decompression_settings_type::is_keyframe_cache_supported() && keyframe_cache_group != nullptr && is_keyframe_cache_hit)
+				{
+					scratch0_xxxx = keyframe_cache_group[0];
+					scratch0_yyyy = keyframe_cache_group[1];
+					scratch0_zzzz = keyframe_cache_group[2];
+					scratch0_wwww = keyframe_cache_group[3];
+					scratch1_xxxx = keyframe_cache_group[4];
+					scratch1_yyyy = keyframe_cache_group[5];
+					scratch1_zzzz = keyframe_cache_group[6];
+					scratch1_wwww = keyframe_cache_group[7];
+				}
+				else
+				{
+					segment_animated_scratch_v0 segment_scratch;
+
+					// We start by unpacking our segment range data into our scratch memory
+					// We often only use a single segment to interpolate, we can avoid redundant work
+					if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
 					{
-						unpack_segment_range_data(segment_sampling_context_rotations[0].segment_range_data, 0, segment_scratch);
+						if (decomp_context.has_segments)
+						{
+							unpack_segment_range_data(segment_sampling_context_rotations[0].segment_range_data, 0, segment_scratch);
 
-						// We are interpolating between two segments (rare)
-						if (!decomp_context.uses_single_segment)
-							unpack_segment_range_data(segment_sampling_context_rotations[1].segment_range_data, 1, segment_scratch);
+							// We are interpolating between two segments (rare)
+							if (!decomp_context.uses_single_segment)
+								unpack_segment_range_data(segment_sampling_context_rotations[1].segment_range_data, 1, segment_scratch);
 
 #if !defined(ACL_IMPL_PREFETCH_EARLY)
-						// Our segment range data takes 24 bytes per group (4 samples, 6 bytes each), each cache line fits 2.67 groups
-						// Prefetch every time while alternating between both segments
-						ACL_IMPL_ANIMATED_PREFETCH(segment_sampling_context_rotations[cache_write_index % 2].segment_range_data + 64);
+							// Our segment range data takes 24 bytes per group (4 samples, 6 bytes each), each cache line fits 2.67 groups
+							// Prefetch every time while alternating between both segments
+							ACL_IMPL_ANIMATED_PREFETCH(segment_sampling_context_rotations[cache_write_index % 2].segment_range_data + 64);
 #endif
+						}
 					}
-				}
 
-				const range_reduction_masks_t range_reduction_masks0 = unpack_animated_quat<decompression_settings_type>(decomp_context, scratch0, num_to_unpack, segment_sampling_context_rotations[0]);
-				const range_reduction_masks_t range_reduction_masks1 = unpack_animated_quat<decompression_settings_type>(decomp_context, scratch1, num_to_unpack, segment_sampling_context_rotations[1]);
+					const range_reduction_masks_t range_reduction_masks0 = unpack_animated_quat<decompression_settings_type>(decomp_context, scratch0, num_to_unpack, segment_sampling_context_rotations[0]);
+					range_reduction_masks_t range_reduction_masks1;
+					if (is_single_key_frame)
+					{
+						// Both key frames are the same sample, copy it instead of unpacking it again
+						range_reduction_masks1 = range_reduction_masks0;
+						scratch1[0] = scratch0[0];
+						scratch1[1] = scratch0[1];
+						scratch1[2] = scratch0[2];
+						scratch1[3] = scratch0[3];
+					}
+					else
+						range_reduction_masks1 = unpack_animated_quat<decompression_settings_type>(decomp_context, scratch1, num_to_unpack, segment_sampling_context_rotations[1]);
 
-				// Swizzle our samples into SOA form
-				rtm::vector4f scratch0_xxxx;
-				rtm::vector4f scratch0_yyyy;
-				rtm::vector4f scratch0_zzzz;
-				rtm::vector4f scratch0_wwww;
-				RTM_MATRIXF_TRANSPOSE_4X4(scratch0[0], scratch0[1], scratch0[2], scratch0[3], scratch0_xxxx, scratch0_yyyy, scratch0_zzzz, scratch0_wwww);
+					// Swizzle our samples into SOA form
+					RTM_MATRIXF_TRANSPOSE_4X4(scratch0[0], scratch0[1], scratch0[2], scratch0[3], scratch0_xxxx, scratch0_yyyy, scratch0_zzzz, scratch0_wwww);
 
-				rtm::vector4f scratch1_xxxx;
-				rtm::vector4f scratch1_yyyy;
-				rtm::vector4f scratch1_zzzz;
-				rtm::vector4f scratch1_wwww;
-				RTM_MATRIXF_TRANSPOSE_4X4(scratch1[0], scratch1[1], scratch1[2], scratch1[3], scratch1_xxxx, scratch1_yyyy, scratch1_zzzz, scratch1_wwww);
+					RTM_MATRIXF_TRANSPOSE_4X4(scratch1[0], scratch1[1], scratch1[2], scratch1[3], scratch1_xxxx, scratch1_yyyy, scratch1_zzzz, scratch1_wwww);
 
 #if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
-				__m256 scratch_xxxx0_xxxx1 = _mm256_set_m128(scratch1_xxxx, scratch0_xxxx);
-				__m256 scratch_yyyy0_yyyy1 = _mm256_set_m128(scratch1_yyyy, scratch0_yyyy);
-				__m256 scratch_zzzz0_zzzz1 = _mm256_set_m128(scratch1_zzzz, scratch0_zzzz);
+					__m256 scratch_xxxx0_xxxx1 = _mm256_set_m128(scratch1_xxxx, scratch0_xxxx);
+					__m256 scratch_yyyy0_yyyy1 = _mm256_set_m128(scratch1_yyyy, scratch0_yyyy);
+					__m256 scratch_zzzz0_zzzz1 = _mm256_set_m128(scratch1_zzzz, scratch0_zzzz);
 #endif
 
-				// If we have a variable bit rate, we perform range reduction, skip the data we used
-				if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
-				{
-					if (decomp_context.has_segments)
+					// If we have a variable bit rate, we perform range reduction, skip the data we used
+					if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
 					{
+						if (decomp_context.has_segments)
+						{
 #if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
-						remap_segment_range_data_avx8(segment_scratch, range_reduction_masks0, range_reduction_masks1, scratch_xxxx0_xxxx1, scratch_yyyy0_yyyy1, scratch_zzzz0_zzzz1);
+							remap_segment_range_data_avx8(segment_scratch, range_reduction_masks0, range_reduction_masks1, scratch_xxxx0_xxxx1, scratch_yyyy0_yyyy1, scratch_zzzz0_zzzz1);
 #else
-						remap_segment_range_data4(segment_scratch, 0, range_reduction_masks0, scratch0_xxxx, scratch0_yyyy, scratch0_zzzz);
-						remap_segment_range_data4(segment_scratch, uint32_t(!decomp_context.uses_single_segment), range_reduction_masks1, scratch1_xxxx, scratch1_yyyy, scratch1_zzzz);
+							remap_segment_range_data4(segment_scratch, 0, range_reduction_masks0, scratch0_xxxx, scratch0_yyyy, scratch0_zzzz);
+							remap_segment_range_data4(segment_scratch, uint32_t(!decomp_context.uses_single_segment), range_reduction_masks1, scratch1_xxxx, scratch1_yyyy, scratch1_zzzz);
 #endif
-					}
+						}
 
-					const uint8_t* clip_range_data = clip_sampling_context_rotations.clip_range_data;
+						const uint8_t* clip_range_data = clip_sampling_context_rotations.clip_range_data;
 
 #if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
-					remap_clip_range_data_avx8(clip_range_data, num_to_unpack, range_reduction_masks0, range_reduction_masks1, scratch_xxxx0_xxxx1, scratch_yyyy0_yyyy1, scratch_zzzz0_zzzz1);
+						remap_clip_range_data_avx8(clip_range_data, num_to_unpack, range_reduction_masks0, range_reduction_masks1, scratch_xxxx0_xxxx1, scratch_yyyy0_yyyy1, scratch_zzzz0_zzzz1);
 #else
-					remap_clip_range_data4(clip_range_data, num_to_unpack, range_reduction_masks0, range_reduction_masks1, scratch0_xxxx, scratch0_yyyy, scratch0_zzzz, scratch1_xxxx, scratch1_yyyy, scratch1_zzzz);
+						remap_clip_range_data4(clip_range_data, num_to_unpack, range_reduction_masks0, range_reduction_masks1, scratch0_xxxx, scratch0_yyyy, scratch0_zzzz, scratch1_xxxx, scratch1_yyyy, scratch1_zzzz);
 #endif
 
-					// Skip our data
-					clip_range_data += num_to_unpack * sizeof(rtm::float3f) * 2;
-					clip_sampling_context_rotations.clip_range_data = clip_range_data;
+						// Skip our data
+						clip_range_data += num_to_unpack * sizeof(rtm::float3f) * 2;
+						clip_sampling_context_rotations.clip_range_data = clip_range_data;
 
 #if defined(ACL_IMPL_PREFETCH_EARLY)
-					// Clip range data is 24 bytes per sub-track and as such we need to prefetch two cache lines ahead to process 4 sub-tracks
-					ACL_IMPL_ANIMATED_PREFETCH(clip_range_data + 64);
-					ACL_IMPL_ANIMATED_PREFETCH(clip_range_data + 128);
+						// Clip range data is 24 bytes per sub-track and as such we need to prefetch two cache lines ahead to process 4 sub-tracks
+						ACL_IMPL_ANIMATED_PREFETCH(clip_range_data + 64);
+						ACL_IMPL_ANIMATED_PREFETCH(clip_range_data + 128);
 #endif
-				}
+					}
 
-				// Reconstruct our quaternion W component in SOA
-				if (rotation_format != rotation_format8::quatf_full || !decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_full))
-				{
+					// Reconstruct our quaternion W component in SOA
+					if (rotation_format != rotation_format8::quatf_full || !decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_full))
+					{
 #if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
-					const __m256 scratch_wwww0_wwww1 = quat_from_positive_w_avx8(scratch_xxxx0_xxxx1, scratch_yyyy0_yyyy1, scratch_zzzz0_zzzz1);
-
-					// This is the last AVX step, unpack everything
-					scratch0_xxxx = _mm256_extractf128_ps(scratch_xxxx0_xxxx1, 0);
-					scratch1_xxxx = _mm256_extractf128_ps(scratch_xxxx0_xxxx1, 1);
-					scratch0_yyyy = _mm256_extractf128_ps(scratch_yyyy0_yyyy1, 0);
-					scratch1_yyyy = _mm256_extractf128_ps(scratch_yyyy0_yyyy1, 1);
-					scratch0_zzzz = _mm256_extractf128_ps(scratch_zzzz0_zzzz1, 0);
-					scratch1_zzzz = _mm256_extractf128_ps(scratch_zzzz0_zzzz1, 1);
-					scratch0_wwww = _mm256_extractf128_ps(scratch_wwww0_wwww1, 0);
-					scratch1_wwww = _mm256_extractf128_ps(scratch_wwww0_wwww1, 1);
+						__m256 scratch_wwww0_wwww1 = quat_from_positive_w_avx8(scratch_xxxx0_xxxx1, scratch_yyyy0_yyyy1, scratch_zzzz0_zzzz1);
+
+						if (decompression_settings_type::get_rotation_normalization_policy() == rotation_normalization_policy_t::always)
+						{
+							// See below, we normalize both samples at once while we are still 8 wide
+							if (decompression_settings_type::is_per_track_rounding_supported() || !should_interpolate)
+								quat_normalize_avx8(scratch_xxxx0_xxxx1, scratch_yyyy0_yyyy1, scratch_zzzz0_zzzz1, scratch_wwww0_wwww1);
+						}
+
+						// This is the last AVX step, unpack everything
+						scratch0_xxxx = _mm256_extractf128_ps(scratch_xxxx0_xxxx1, 0);
+						scratch1_xxxx = _mm256_extractf128_ps(scratch_xxxx0_xxxx1, 1);
+						scratch0_yyyy = _mm256_extractf128_ps(scratch_yyyy0_yyyy1, 0);
+						scratch1_yyyy = _mm256_extractf128_ps(scratch_yyyy0_yyyy1, 1);
+						scratch0_zzzz = _mm256_extractf128_ps(scratch_zzzz0_zzzz1, 0);
+						scratch1_zzzz = _mm256_extractf128_ps(scratch_zzzz0_zzzz1, 1);
+						scratch0_wwww = _mm256_extractf128_ps(scratch_wwww0_wwww1, 0);
+						scratch1_wwww = _mm256_extractf128_ps(scratch_wwww0_wwww1, 1);
 #else
-					scratch0_wwww = quat_from_positive_w4(scratch0_xxxx, scratch0_yyyy, scratch0_zzzz);
+						scratch0_wwww = quat_from_positive_w4(scratch0_xxxx, scratch0_yyyy, scratch0_zzzz);
 
 #if !defined(ACL_IMPL_PREFETCH_EARLY)
-					if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
-					{
-						// Our segment per track metadata takes 4 bytes per group (4 samples, 1 byte each), each cache line fits 16 groups
-						// Prefetch every other 8th group
-						// We prefetch here because we have a square-root in quat_from_positive_w4(..) that we'll wait after
-						// This allows us to insert the prefetch basically for free in its shadow
-						// Branching is faster than prefetching every time and alternating between the two
-						if (cache_write_index == 0)
-							ACL_IMPL_ANIMATED_PREFETCH(segment_sampling_context_rotations[0].format_per_track_data + 64);
-						else if (cache_write_index == 4)
-							ACL_IMPL_ANIMATED_PREFETCH(segment_sampling_context_rotations[1].format_per_track_data + 64);
-					}
+						if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
+						{
+							// Our segment per track metadata takes 4 bytes per group (4 samples, 1 byte each), each cache line fits 16 groups
+							// Prefetch every other 8th group
+							// We prefetch here because we have a square-root in quat_from_positive_w4(..) that we'll wait after
+							// This allows us to insert the prefetch basically for free in its shadow
+							// Branching is faster than prefetching every time and alternating between the two
+							if (cache_write_index == 0)
+								ACL_IMPL_ANIMATED_PREFETCH(segment_sampling_context_rotations[0].format_per_track_data + 64);
+							else if (cache_write_index == 4)
+								ACL_IMPL_ANIMATED_PREFETCH(segment_sampling_context_rotations[1].format_per_track_data + 64);
+						}
 #endif
 
-					scratch1_wwww = quat_from_positive_w4(scratch1_xxxx, scratch1_yyyy, scratch1_zzzz);
+						scratch1_wwww = quat_from_positive_w4(scratch1_xxxx, scratch1_yyyy, scratch1_zzzz);
 
 #if !defined(ACL_IMPL_PREFETCH_EARLY)
-					if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
-					{
-						// Our clip range data is 24 bytes per sub-track and as such we need to prefetch two cache lines ahead to process 4 sub-tracks
-						// Each group is 96 bytes (4 samples, 24 bytes each), each cache line fits 0.67 groups
-						// We prefetch here because we have a square-root in quat_from_positive_w4(..) that we'll wait after
-						// This allows us to insert the prefetch basically for free in its shadow
-						ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_rotations.clip_range_data + 64);
-						ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_rotations.clip_range_data + 128);
-					}
-#endif
+						if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
+						{
+							// Our clip range data is 24 bytes per sub-track and as such we need to prefetch two cache lines ahead to process 4 sub-tracks
+							// Each group is 96 bytes (4 samples, 24 bytes each), each cache line fits 0.67 groups
+							// We prefetch here because we have a square-root in quat_from_positive_w4(..) that we'll wait after
+							// This allows us to insert the prefetch basically for free in its shadow
+							ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_rotations.clip_range_data + 64);
+							ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_rotations.clip_range_data + 128);
+						}
 #endif
 
-					if (decompression_settings_type::get_rotation_normalization_policy() == rotation_normalization_policy_t::always)
-					{
-						// quat_from_positive_w might not yield an accurate quaternion because the square-root instruction
-						// isn't very accurate on small inputs, we need to normalize
-						// If we support per track rounding, we need to normalize as we might not interpolate
-						// Otherwise, if we don't interpolate we also need to normalize
-						if (decompression_settings_type::is_per_track_rounding_supported() || !should_interpolate)
+						if (decompression_settings_type::get_rotation_normalization_policy() == rotation_normalization_policy_t::always)
 						{
-							quat_normalize4(scratch0_xxxx, scratch0_yyyy, scratch0_zzzz, scratch0_wwww);
-							quat_normalize4(scratch1_xxxx, scratch1_yyyy, scratch1_zzzz, scratch1_wwww);
+							// quat_from_positive_w might not yield an accurate quaternion because the square-root instruction
+							// isn't very accurate on small inputs, we need to normalize
+							// If we support per track rounding, we need to normalize as we might not interpolate
+							// Otherwise, if we don't interpolate we also need to normalize
+							if (decompression_settings_type::is_per_track_rounding_supported() || !should_interpolate)
+							{
+								quat_normalize4(scratch0_xxxx, scratch0_yyyy, scratch0_zzzz, scratch0_wwww);
+								quat_normalize4(scratch1_xxxx, scratch1_yyyy, scratch1_zzzz, scratch1_wwww);
+							}
 						}
+#endif
+					}
+
+					if (decompression_settings_type::is_keyframe_cache_supported() && keyframe_cache_group != nullptr)
+					{
+						// Our samples are ready to be interpolated, retain them in case we seek between the same key frames again
+						keyframe_cache_group[0] = scratch0_xxxx;
+						keyframe_cache_group[1] = scratch0_yyyy;
+						keyframe_cache_group[2] = scratch0_zzzz;
+						keyframe_cache_group[3] = scratch0_wwww;
+						keyframe_cache_group[4] = scratch1_xxxx;
+						keyframe_cache_group[5] = scratch1_yyyy;
+						keyframe_cache_group[6] = scratch1_zzzz;
+						keyframe_cache_group[7] = scratch1_wwww;
 					}
 				}
 
@@ -1678,7 +2128,7 @@ namespace acl
 
 					uint32_t group_bit_size_per_component0;
 					uint32_t group_bit_size_per_component1;
-					count_animated_group_bit_size<decompression_settings_type>(decomp_context, format_per_track_data0, format_per_track_data1, num_groups_to_skip, group_bit_size_per_component0, group_bit_size_per_component1);
+					count_animated_group_bit_size<decompression_settings_type>(decomp_context, segment_bit_size_prefixes, format_per_track_data0, format_per_track_data1, num_groups_to_skip, group_bit_size_per_component0, group_bit_size_per_component1);
 
 					const uint32_t format_per_track_data_skip_size = num_groups_to_skip * 4;
 					const uint32_t segment_range_data_skip_size = num_groups_to_skip * 6 * 4;
@@ -1771,6 +2221,21 @@ namespace acl
 				return rotations.cached_samples[static_cast<int>(policy)][cache_read_index % 8];
 			}
 
+			// Discards the samples cached that haven't been consumed and unpacks the next group of 4 rotations
+			// The unpacked samples can then be read in any order with read_cached_rotation(..)
+			template<class decompression_settings_type>
+			RTM_DISABLE_SECURITY_COOKIE_CHECK void unpack_next_rotation_group(const persistent_transform_decompression_context_v0& decomp_context)
+			{
+				rotations.cache_read_index = rotations.cache_write_index;
+				unpack_rotation_group<decompression_settings_type>(decomp_context);
+			}
+
+			RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK const rtm::quatf& read_cached_rotation(sample_rounding_policy policy, uint32_t group_sample_index) const
+			{
+				ACL_ASSERT(group_sample_index < rotations.get_num_cached(), "Attempting to read an animated sample that isn't cached");
+				return rotations.cached_samples[static_cast<int>(policy)][(rotations.cache_read_index + group_sample_index) % 8];
+			}
+
 			template<class decompression_settings_adapter_type>
 			RTM_DISABLE_SECURITY_COOKIE_CHECK void unpack_translation_group(const persistent_transform_decompression_context_v0& decomp_context)
 			{
@@ -1790,8 +2255,53 @@ namespace acl
 				const uint32_t cache_write_index = translations.cache_write_index % 8;
 				translations.cache_write_index += num_to_unpack;
 
-				unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch0, num_to_unpack, clip_sampling_context_translations, segment_sampling_context_translations[0]);
-				unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch1, num_to_unpack, clip_sampling_context_translations, segment_sampling_context_translations[1]);
+				// If the key frames we interpolate between haven't changed, we already unpacked them before
+				rtm::vector4f* keyframe_cache_group = nullptr;
+				if (decompression_settings_adapter_type::is_keyframe_cache_supported() && keyframe_cache_translations != nullptr)
+				{
+					keyframe_cache_group = keyframe_cache_translations;
+					keyframe_cache_translations += k_num_keyframe_cache_entries_per_group;
+				}
+
+				const rtm::vector4f* samples0 = scratch0;
+				const rtm::vector4f* samples1 = scratch1;
+
+				if (decompression_settings_adapter_type::is_keyframe_cache_supported() && keyframe_cache_group != nullptr && is_keyframe_cache_hit)
+				{
+					samples0 = keyframe_cache_group + 0;
+					samples1 = keyframe_cache_group + 4;
+				}
+				else
+				{
+					if (is_single_key_frame)
+					{
+						// Both key frames are the same sample, copy it instead of unpacking it again
+						unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch0, num_to_unpack, clip_sampling_context_translations, segment_sampling_context_translations[0]);
+						scratch1[0] = scratch0[0];
+						scratch1[1] = scratch0[1];
+						scratch1[2] = scratch0[2];
+						scratch1[3] = scratch0[3];
+					}
+					else
+					{
+#if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
+						unpack_animated_vector3_avx8<decompression_settings_adapter_type>(decomp_context, scratch0, scratch1, num_to_unpack, clip_sampling_context_translations, segment_sampling_context_translations[0], segment_sampling_context_translations[1]);
+#else
+						unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch0, num_to_unpack, clip_sampling_context_translations, segment_sampling_context_translations[0]);
+						unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch1, num_to_unpack, clip_sampling_context_translations, segment_sampling_context_translations[1]);
+#endif
+					}
+
+					if (decompression_settings_adapter_type::is_keyframe_cache_supported() && keyframe_cache_group != nullptr)
+					{
+						// Retain our samples in case we seek between the same key frames again
+						for (uint32_t unpack_index = 0; unpack_index < num_to_unpack; ++unpack_index)
+						{
+							keyframe_cache_group[unpack_index + 0] = scratch0[unpack_index];
+							keyframe_cache_group[unpack_index + 4] = scratch1[unpack_index];
+						}
+					}
+				}
 
 				const rtm::vector4f interpolation_alpha = rtm::vector_set(decomp_context.interpolation_alpha);
 				const rtm::mask4f use_sample0 = rtm::vector_less_than(interpolation_alpha, rtm::vector_set(0.5F));
@@ -1807,8 +2317,8 @@ namespace acl
 
 				for (uint32_t unpack_index = 0; unpack_index < num_to_unpack; ++unpack_index)
 				{
-					const rtm::vector4f sample0 = scratch0[unpack_index];
-					const rtm::vector4f sample1 = scratch1[unpack_index];
+					const rtm::vector4f sample0 = samples0[unpack_index];
+					const rtm::vector4f sample1 = samples1[unpack_index];
 
 					if (decompression_settings_adapter_type::is_per_track_rounding_supported())
 					{
@@ -1852,7 +2362,7 @@ namespace acl
 
 					uint32_t group_bit_size_per_component0;
 					uint32_t group_bit_size_per_component1;
-					count_animated_group_bit_size<decompression_settings_adapter_type>(decomp_context, format_per_track_data0, format_per_track_data1, num_groups_to_skip, group_bit_size_per_component0, group_bit_size_per_component1);
+					count_animated_group_bit_size<decompression_settings_adapter_type>(decomp_context, segment_bit_size_prefixes, format_per_track_data0, format_per_track_data1, num_groups_to_skip, group_bit_size_per_component0, group_bit_size_per_component1);
 
 					const uint32_t format_per_track_data_skip_size = num_groups_to_skip * 4;
 					const uint32_t segment_range_data_skip_size = num_groups_to_skip * 6 * 4;
@@ -1893,6 +2403,21 @@ namespace acl
 				return translations.cached_samples[static_cast<int>(policy)][cache_read_index % 8];
 			}
 
+			// Discards the samples cached that haven't been consumed and unpacks the next group of 4 translations
+			// The unpacked samples can then be read in any order with read_cached_translation(..)
+			template<class decompression_settings_adapter_type>
+			RTM_DISABLE_SECURITY_COOKIE_CHECK void unpack_next_translation_group(const persistent_transform_decompression_context_v0& decomp_context)
+			{
+				translations.cache_read_index = translations.cache_write_index;
+				unpack_translation_group<decompression_settings_adapter_type>(decomp_context);
+			}
+
+			RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK const rtm::vector4f& read_cached_translation(sample_rounding_policy policy, uint32_t group_sample_index) const
+			{
+				ACL_ASSERT(group_sample_index < translations.get_num_cached(), "Attempting to read an animated sample that isn't cached");
+				return translations.cached_samples[static_cast<int>(policy)][(translations.cache_read_index + group_sample_index) % 8];
+			}
+
 			template<class decompression_settings_adapter_type>
 			RTM_DISABLE_SECURITY_COOKIE_CHECK void unpack_scale_group(const persistent_transform_decompression_context_v0& decomp_context)
 			{
@@ -1912,8 +2437,53 @@ namespace acl
 				const uint32_t cache_write_index = scales.cache_write_index % 8;
 				scales.cache_write_index += num_to_unpack;
 
-				unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch0, num_to_unpack, clip_sampling_context_scales, segment_sampling_context_scales[0]);
-				unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch1, num_to_unpack, clip_sampling_context_scales, segment_sampling_context_scales[1]);
+				// If the key frames we interpolate between haven't changed, we already unpacked them before
+				rtm::vector4f* keyframe_cache_group = nullptr;
+				if (decompression_settings_adapter_type::is_keyframe_cache_supported() && keyframe_cache_scales != nullptr)
+				{
+					keyframe_cache_group = keyframe_cache_scales;
+					keyframe_cache_scales += k_num_keyframe_cache_entries_per_group;
+				}
+
+				const rtm::vector4f* samples0 = scratch0;
+				const rtm::vector4f* samples1 = scratch1;
+
+				if (decompression_settings_adapter_type::is_keyframe_cache_supported() && keyframe_cache_group != nullptr && is_keyframe_cache_hit)
+				{
+					samples0 = keyframe_cache_group + 0;
+					samples1 = keyframe_cache_group + 4;
+				}
+				else
+				{
+					if (is_single_key_frame)
+					{
+						// Both key frames are the same sample, copy it instead of unpacking it again
+						unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch0, num_to_unpack, clip_sampling_context_scales, segment_sampling_context_scales[0]);
+						scratch1[0] = scratch0[0];
+						scratch1[1] = scratch0[1];
+						scratch1[2] = scratch0[2];
+						scratch1[3] = scratch0[3];
+					}
+					else
+					{
+#if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
+						unpack_animated_vector3_avx8<decompression_settings_adapter_type>(decomp_context, scratch0, scratch1, num_to_unpack, clip_sampling_context_scales, segment_sampling_context_scales[0], segment_sampling_context_scales[1]);
+#else
+						unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch0, num_to_unpack, clip_sampling_context_scales, segment_sampling_context_scales[0]);
+						unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch1, num_to_unpack, clip_sampling_context_scales, segment_sampling_context_scales[1]);
+#endif
+					}
+
+					if (decompression_settings_adapter_type::is_keyframe_cache_supported() && keyframe_cache_group != nullptr)
+					{
+						// Retain our samples in case we seek between the same key frames again
+						for (uint32_t unpack_index = 0; unpack_index < num_to_unpack; ++unpack_index)
+						{
+							keyframe_cache_group[unpack_index + 0] = scratch0[unpack_index];
+							keyframe_cache_group[unpack_index + 4] = scratch1[unpack_index];
+						}
+					}
+				}
 
 				const rtm::vector4f interpolation_alpha = rtm::vector_set(decomp_context.interpolation_alpha);
 				const rtm::mask4f use_sample0 = rtm::vector_less_than(interpolation_alpha, rtm::vector_set(0.5F));
@@ -1929,8 +2499,8 @@ namespace acl
 
 				for (uint32_t unpack_index = 0; unpack_index < num_to_unpack; ++unpack_index)
 				{
-					const rtm::vector4f sample0 = scratch0[unpack_index];
-					const rtm::vector4f sample1 = scratch1[unpack_index];
+					const rtm::vector4f sample0 = samples0[unpack_index];
+					const rtm::vector4f sample1 = samples1[unpack_index];
 
 					if (decompression_settings_adapter_type::is_per_track_rounding_supported())
 					{
@@ -1974,7 +2544,7 @@ namespace acl
 
 					uint32_t group_bit_size_per_component0;
 					uint32_t group_bit_size_per_component1;
-					count_animated_group_bit_size<decompression_settings_adapter_type>(decomp_context, format_per_track_data0, format_per_track_data1, num_groups_to_skip, group_bit_size_per_component0, group_bit_size_per_component1);
+					count_animated_group_bit_size<decompression_settings_adapter_type>(decomp_context, segment_bit_size_prefixes, format_per_track_data0, format_per_track_data1, num_groups_to_skip, group_bit_size_per_component0, group_bit_size_per_component1);
 
 					const uint32_t format_per_track_data_skip_size = num_groups_to_skip * 4;
 					const uint32_t segment_range_data_skip_size = num_groups_to_skip * 6 * 4;
@@ -2014,6 +2584,21 @@ namespace acl
 				const uint32_t cache_read_index = scales.cache_read_index++;
 				return scales.cached_samples[static_cast<int>(policy)][cache_read_index % 8];
 			}
+
+			// Discards the samples cached that haven't been consumed and unpacks the next group of 4 scales
+			// The unpacked samples can then be read in any order with read_cached_scale(..)
+			template<class decompression_settings_adapter_type>
+			RTM_DISABLE_SECURITY_COOKIE_CHECK void unpack_next_scale_group(const persistent_transform_decompression_context_v0& decomp_context)
+			{
+				scales.cache_read_index = scales.cache_write_index;
+				unpack_scale_group<decompression_settings_adapter_type>(decomp_context);
+			}
+
+			RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK const rtm::vector4f& read_cached_scale(sample_rounding_policy policy, uint32_t group_sample_index) const
+			{
+				ACL_ASSERT(group_sample_index < scales.get_num_cached(), "Attempting to read an animated sample that isn't cached");
+				return scales.cached_samples[static_cast<int>(policy)][(scales.cache_read_index + group_sample_index) % 8];
+			}
 		};
 	}
 
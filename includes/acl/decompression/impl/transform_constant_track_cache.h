@@ -108,6 +108,38 @@ namespace acl
 				constant_data_scales = constant_data_translations + packed_translation_size * transform_header.num_constant_translation_samples;
 			}
 
+			// Unpacks a group of up to 4 rotations with a dropped W component stored in SOA form
+			// Always writes 4 samples, those past the group size contain garbage
+			template<class decompression_settings_type>
+			static RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void unpack_drop_w_rotation_group(const uint8_t* constant_track_data, uint32_t unpack_count, rtm::quatf* out_samples)
+			{
+				// Always load 4x rotations, we might contain garbage in a few lanes but it's fine
+				// The last group contains no padding so we have to make to align our reads properly
+				const uint32_t load_size = unpack_count * sizeof(float);
+
+				rtm::vector4f xxxx = rtm::vector_load(reinterpret_cast<const float*>(constant_track_data + load_size * 0));
+				rtm::vector4f yyyy = rtm::vector_load(reinterpret_cast<const float*>(constant_track_data + load_size * 1));
+				rtm::vector4f zzzz = rtm::vector_load(reinterpret_cast<const float*>(constant_track_data + load_size * 2));
+
+				rtm::vector4f wwww = quat_from_positive_w4(xxxx, yyyy, zzzz);
+
+				// quat_from_positive_w might not yield an accurate quaternion because the square-root instruction
+				// isn't very accurate on small inputs, we need to normalize
+				if (decompression_settings_type::get_rotation_normalization_policy() == rotation_normalization_policy_t::always)
+					quat_normalize4(xxxx, yyyy, zzzz, wwww);
+
+				rtm::vector4f sample0;
+				rtm::vector4f sample1;
+				rtm::vector4f sample2;
+				rtm::vector4f sample3;
+				RTM_MATRIXF_TRANSPOSE_4X4(xxxx, yyyy, zzzz, wwww, sample0, sample1, sample2, sample3);
+
+				out_samples[0] = rtm::vector_to_quat(sample0);
+				out_samples[1] = rtm::vector_to_quat(sample1);
+				out_samples[2] = rtm::vector_to_quat(sample2);
+				out_samples[3] = rtm::vector_to_quat(sample3);
+			}
+
 			template<class decompression_settings_type>
 			RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void unpack_rotation_group(const persistent_transform_decompression_context_v0& decomp_context)
 			{
@@ -154,36 +186,10 @@ namespace acl
 						const uint32_t unpack_count = std::min<uint32_t>(num_to_unpack, 4);
 						num_to_unpack -= unpack_count;
 
-						// Unpack
-						// Always load 4x rotations, we might contain garbage in a few lanes but it's fine
-						// The last group contains no padding so we have to make to align our reads properly
-						const uint32_t load_size = unpack_count * sizeof(float);
-
-						rtm::vector4f xxxx = rtm::vector_load(reinterpret_cast<const float*>(constant_track_data + load_size * 0));
-						rtm::vector4f yyyy = rtm::vector_load(reinterpret_cast<const float*>(constant_track_data + load_size * 1));
-						rtm::vector4f zzzz = rtm::vector_load(reinterpret_cast<const float*>(constant_track_data + load_size * 2));
-
-						// Update our read ptr
-						constant_track_data += load_size * 3;
+						unpack_drop_w_rotation_group<decompression_settings_type>(constant_track_data, unpack_count, cache_ptr);
 
-						rtm::vector4f wwww = quat_from_positive_w4(xxxx, yyyy, zzzz);
-
-						// quat_from_positive_w might not yield an accurate quaternion because the square-root instruction
-						// isn't very accurate on small inputs, we need to normalize
-						if (decompression_settings_type::get_rotation_normalization_policy() == rotation_normalization_policy_t::always)
-							quat_normalize4(xxxx, yyyy, zzzz, wwww);
-
-						rtm::vector4f sample0;
-						rtm::vector4f sample1;
-						rtm::vector4f sample2;
-						rtm::vector4f sample3;
-						RTM_MATRIXF_TRANSPOSE_4X4(xxxx, yyyy, zzzz, wwww, sample0, sample1, sample2, sample3);
-
-						// Cache
-						cache_ptr[0] = rtm::vector_to_quat(sample0);
-						cache_ptr[1] = rtm::vector_to_quat(sample1);
-						cache_ptr[2] = rtm::vector_to_quat(sample2);
-						cache_ptr[3] = rtm::vector_to_quat(sample3);
+						// Update our pointers
+						constant_track_data += unpack_count * sizeof(float) * 3;
 						cache_ptr += 4;
 					}
 				}
@@ -203,6 +209,30 @@ namespace acl
 				constant_data_rotations = constant_track_data;
 			}
 
+			// Unpacks every rotation of the current group the same way unpack_rotation_group(..) does without consuming them
+			// Up to 4 samples are written to the output
+			template<class decompression_settings_type>
+			RTM_DISABLE_SECURITY_COOKIE_CHECK void unpack_rotations_within_group(const persistent_transform_decompression_context_v0& decomp_context, rtm::quatf* out_samples) const
+			{
+				const uint32_t group_size = std::min<uint32_t>(rotations.num_left_to_unpack, 4);
+				ACL_ASSERT(group_size != 0, "Cannot unpack samples that aren't present");
+
+				const rotation_format8 rotation_format = get_rotation_format<decompression_settings_type>(decomp_context.rotation_format);
+				if (rotation_format == rotation_format8::quatf_full && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_full))
+				{
+					for (uint32_t unpack_index = 0; unpack_index < group_size; ++unpack_index)
+						out_samples[unpack_index] = unpack_quat_128(constant_data_rotations + (unpack_index * sizeof(rtm::float4f)));
+				}
+				else
+				{
+					rtm::quatf samples[4];
+					unpack_drop_w_rotation_group<decompression_settings_type>(constant_data_rotations, group_size, samples);
+
+					for (uint32_t unpack_index = 0; unpack_index < group_size; ++unpack_index)
+						out_samples[unpack_index] = samples[unpack_index];
+				}
+			}
+
 			template<class decompression_settings_type>
 			RTM_DISABLE_SECURITY_COOKIE_CHECK void skip_rotation_groups(const persistent_transform_decompression_context_v0& decomp_context, uint32_t num_groups_to_skip)
 			{
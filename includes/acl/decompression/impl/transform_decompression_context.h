@@ -74,8 +74,14 @@ namespace acl
 			uint8_t has_segments;								//  24 |  32
 
 			uint8_t looping_policy;								//  25 |  33
+			uint8_t has_sub_track_prefix_index;					//  26 |  34
 
-			uint8_t padding0[16];								//  26 |  34
+			uint8_t padding0[sizeof(void*) == 4 ? 1 : 5];		//  27 |  35
+
+			// Decoded key frame cache, optional, see transform_keyframe_cache.h
+			uint8_t* keyframe_cache;							//  28 |  40
+
+			uint8_t padding1[sizeof(void*) == 4 ? 10 : 2];		//  32 |  48
 
 			// Seeking related data
 			uint8_t rounding_policy;							//  42 |  50
@@ -95,7 +101,7 @@ namespace acl
 
 			float interpolation_alpha;							//  88 | 120
 
-			uint8_t padding1[sizeof(void*) == 4 ? 36 : 4];		//  92 | 124
+			uint8_t padding2[sizeof(void*) == 4 ? 36 : 4];		//  92 | 124
 
 			//										Total size:	   128 | 128
 
@@ -127,6 +133,7 @@ namespace acl
 			static constexpr vector_format8 get_vector_format(const persistent_transform_decompression_context_v0& context) { return context.translation_format; }
 			static constexpr bool is_vector_format_supported(vector_format8 format) { return decompression_settings_type::is_translation_format_supported(format); }
 			static constexpr bool is_per_track_rounding_supported() { return decompression_settings_type::is_per_track_rounding_supported(); }
+			static constexpr bool is_keyframe_cache_supported() { return decompression_settings_type::is_keyframe_cache_supported(); }
 			static constexpr compressed_tracks_version16 version_supported() { return decompression_settings_type::version_supported(); }
 		};
 
@@ -138,6 +145,7 @@ namespace acl
 			static constexpr vector_format8 get_vector_format(const persistent_transform_decompression_context_v0& context) { return context.scale_format; }
 			static constexpr bool is_vector_format_supported(vector_format8 format) { return decompression_settings_type::is_scale_format_supported(format); }
 			static constexpr bool is_per_track_rounding_supported() { return decompression_settings_type::is_per_track_rounding_supported(); }
+			static constexpr bool is_keyframe_cache_supported() { return decompression_settings_type::is_keyframe_cache_supported(); }
 			static constexpr compressed_tracks_version16 version_supported() { return decompression_settings_type::version_supported(); }
 		};
 
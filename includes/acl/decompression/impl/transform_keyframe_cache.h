@@ -0,0 +1,113 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+#include "acl/decompression/impl/transform_decompression_context.h"
+
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The decoded key frame cache lives in memory provided by the caller.
+		// It starts with this header followed by the unpacked samples of both key frames
+		// we interpolate between. Samples are stored in groups of 4 sub-tracks in the order
+		// we unpack them: rotations, translations, and scales.
+		// Every group contains 8 vector4f: 4 for the first key frame followed by 4 for the second.
+		// Rotations are stored in SOA form (xxxx, yyyy, zzzz, wwww) and vector3 sub-tracks in AOS form.
+		//////////////////////////////////////////////////////////////////////////
+		struct alignas(16) keyframe_cache_header_v0
+		{
+			// The compressed tracks instance our cached samples belong to
+			const compressed_tracks* tracks;
+
+			// The animated data of both key frames when we unpacked our samples
+			// This will differ if we seek to other key frames or if the database streams data in/out
+			const uint8_t* animated_track_data[2];
+			uint32_t key_frame_bit_offsets[2];
+
+			// Whether or not our cached samples are valid
+			uint32_t is_valid;
+
+			//////////////////////////////////////////////////////////////////////////
+
+			bool is_cached(const persistent_transform_decompression_context_v0& context) const
+			{
+				return is_valid != 0
+					&& tracks == context.tracks
+					&& animated_track_data[0] == context.animated_track_data[0]
+					&& animated_track_data[1] == context.animated_track_data[1]
+					&& key_frame_bit_offsets[0] == context.key_frame_bit_offsets[0]
+					&& key_frame_bit_offsets[1] == context.key_frame_bit_offsets[1];
+			}
+
+			void set_cached(const persistent_transform_decompression_context_v0& context)
+			{
+				tracks = context.tracks;
+				animated_track_data[0] = context.animated_track_data[0];
+				animated_track_data[1] = context.animated_track_data[1];
+				key_frame_bit_offsets[0] = context.key_frame_bit_offsets[0];
+				key_frame_bit_offsets[1] = context.key_frame_bit_offsets[1];
+				is_valid = 1;
+			}
+		};
+
+		// Each group holds both key frames of 4 sub-tracks
+		constexpr uint32_t k_num_keyframe_cache_entries_per_group = 8;
+
+		constexpr uint32_t get_num_keyframe_cache_groups(uint32_t num_animated_sub_tracks)
+		{
+			return (num_animated_sub_tracks + 3) / 4;
+		}
+
+		// Returns the size in bytes of the decoded key frame cache required for the provided compressed tracks instance
+		inline uint32_t get_keyframe_cache_size_v0(const compressed_tracks& tracks)
+		{
+			const transform_tracks_header& transform_header = get_transform_tracks_header(tracks);
+
+			const uint32_t num_groups = get_num_keyframe_cache_groups(transform_header.num_animated_rotation_sub_tracks)
+				+ get_num_keyframe_cache_groups(transform_header.num_animated_translation_sub_tracks)
+				+ get_num_keyframe_cache_groups(transform_header.num_animated_scale_sub_tracks);
+
+			return uint32_t(sizeof(keyframe_cache_header_v0)) + (num_groups * k_num_keyframe_cache_entries_per_group * uint32_t(sizeof(rtm::vector4f)));
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
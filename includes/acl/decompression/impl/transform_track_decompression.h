@@ -30,6 +30,7 @@
 #include "acl/core/compressed_tracks.h"
 #include "acl/core/compressed_tracks_version.h"
 #include "acl/core/interpolation_utils.h"
+#include "acl/core/memory_utils.h"
 #include "acl/core/range_reduction_types.h"
 #include "acl/core/track_formats.h"
 #include "acl/core/track_writer.h"
@@ -40,6 +41,7 @@
 #include "acl/decompression/impl/transform_animated_track_cache.h"
 #include "acl/decompression/impl/transform_constant_track_cache.h"
 #include "acl/decompression/impl/transform_decompression_context.h"
+#include "acl/decompression/impl/transform_keyframe_cache.h"
 #include "acl/math/quatf.h"
 #include "acl/math/quat_packing.h"
 #include "acl/math/vector4f.h"
@@ -48,6 +50,7 @@
 #include <rtm/scalarf.h>
 #include <rtm/vector4f.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <type_traits>
 
@@ -74,12 +77,6 @@ namespace acl
 #define ACL_IMPL_SEEK_PREFETCH(ptr) (void)(ptr)
 #endif
 
-		template<class decompression_settings_type>
-		constexpr bool is_database_supported_impl()
-		{
-			return decompression_settings_type::database_settings_type::version_supported() != compressed_tracks_version16::none;
-		}
-
 		template<class decompression_settings_type, class database_settings_type>
 		inline bool initialize_v0(persistent_transform_decompression_context_v0& context, const compressed_tracks& tracks, const database_context<database_settings_type>* database)
 		{
@@ -115,6 +112,8 @@ namespace acl
 			context.scale_format = scale_format;
 			context.has_scale = header.get_has_scale();
 			context.has_segments = transform_header.has_multiple_segments();
+			context.has_sub_track_prefix_index = header.get_has_sub_track_prefix_index();
+			context.keyframe_cache = nullptr;
 
 			if (decompression_settings_type::is_wrapping_supported())
 			{
@@ -202,6 +201,37 @@ namespace acl
 			}
 		}
 
+		inline uint32_t get_keyframe_cache_size_v0(const persistent_transform_decompression_context_v0& context)
+		{
+			return get_keyframe_cache_size_v0(*context.tracks);
+		}
+
+		template<class decompression_settings_type>
+		inline bool set_keyframe_cache_v0(persistent_transform_decompression_context_v0& context, void* buffer, uint32_t buffer_size)
+		{
+			if (!decompression_settings_type::is_keyframe_cache_supported())
+				return false;	// Not supported
+
+			if (buffer == nullptr)
+			{
+				// Unbind our cache
+				context.keyframe_cache = nullptr;
+				return true;
+			}
+
+			ACL_ASSERT(is_aligned_to(buffer, alignof(keyframe_cache_header_v0)), "Key frame cache buffer must be aligned to %u bytes", uint32_t(alignof(keyframe_cache_header_v0)));
+			ACL_ASSERT(buffer_size >= get_keyframe_cache_size_v0(context), "Key frame cache buffer is too small, expected at least %u bytes", get_keyframe_cache_size_v0(context));
+			if (!is_aligned_to(buffer, alignof(keyframe_cache_header_v0)) || buffer_size < get_keyframe_cache_size_v0(context))
+				return false;	// Invalid buffer
+
+			// Nothing is cached yet
+			keyframe_cache_header_v0* header = static_cast<keyframe_cache_header_v0*>(buffer);
+			header->is_valid = 0;
+
+			context.keyframe_cache = static_cast<uint8_t*>(buffer);
+			return true;
+		}
+
 		template<class decompression_settings_type>
 		inline void seek_v0(persistent_transform_decompression_context_v0& context, float sample_time, sample_rounding_policy rounding_policy)
 		{
@@ -214,7 +244,10 @@ namespace acl
 			if (decompression_settings_type::clamp_sample_time())
 				sample_time = rtm::scalar_clamp(sample_time, 0.0F, context.clip_duration);
 
-			if (context.sample_time == sample_time && context.get_rounding_policy() == rounding_policy)
+			// Seeking resolves which database chunks are resident, they can stream out as soon as the decompression scope
+			// that seeked ends. We always seek again to avoid reading samples that are no longer resident.
+			const bool has_resident_database_samples = is_database_supported_impl<decompression_settings_type>() && header.get_has_database() && context.db != nullptr;
+			if (!has_resident_database_samples && context.sample_time == sample_time && context.get_rounding_policy() == rounding_policy)
 				return;
 
 			const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
@@ -281,8 +314,7 @@ namespace acl
 					// When we load our sample indices and offsets from the database, there can be another thread writing
 					// to those memory locations at the same time (e.g. streaming in/out).
 					// To ensure thread safety, we atomically load the offset and sample indices.
-					uint64_t medium_importance_tier_metadata0 = 0;
-					uint64_t low_importance_tier_metadata0 = 0;
+					uint64_t tier_metadata0[k_num_database_tiers] = { 0 };
 
 					// Combine all our loaded samples into a single bit set to find which samples we need to interpolate
 					if (is_database_supported && db != nullptr)
@@ -293,13 +325,12 @@ namespace acl
 						const database_runtime_clip_header* db_clip_header = tracks_db_header->get_clip_header(db->clip_segment_headers);
 						const database_runtime_segment_header* db_segment_headers = db_clip_header->get_segment_headers();
 
+						if (is_clip_usage_tracking_supported_impl<decompression_settings_type>())
+							record_clip_usage(*db, *db_clip_header);
+
 						// Cache miss for the db segment headers
 						const database_runtime_segment_header* db_segment_header0 = db_segment_headers;
-						medium_importance_tier_metadata0 = db_segment_header0->tier_metadata[0].load(k_memory_order_relaxed);
-						low_importance_tier_metadata0 = db_segment_header0->tier_metadata[1].load(k_memory_order_relaxed);
-
-						sample_indices0 |= uint32_t(medium_importance_tier_metadata0);
-						sample_indices0 |= uint32_t(low_importance_tier_metadata0);
+						sample_indices0 |= load_segment_tiers_metadata(*db, *db_clip_header, *db_segment_header0, tier_metadata0);
 					}
 
 					// Find the closest loaded samples
@@ -325,30 +356,10 @@ namespace acl
 						const uint64_t sample_index0 = uint64_t(1) << (31 - key_frame0);
 						const uint64_t sample_index1 = uint64_t(1) << (31 - key_frame1);
 
-						const uint8_t* bulk_data_medium = db->bulk_data[0];		// Might be nullptr if we haven't streamed in yet
-						const uint8_t* bulk_data_low = db->bulk_data[1];		// Might be nullptr if we haven't streamed in yet
-						if ((medium_importance_tier_metadata0 & sample_index0) != 0)
-						{
-							sample_indices0 = uint32_t(medium_importance_tier_metadata0);
-							db_animated_track_data0 = bulk_data_medium + uint32_t(medium_importance_tier_metadata0 >> 32);
-						}
-						else if ((low_importance_tier_metadata0 & sample_index0) != 0)
-						{
-							sample_indices0 = uint32_t(low_importance_tier_metadata0);
-							db_animated_track_data0 = bulk_data_low + uint32_t(low_importance_tier_metadata0 >> 32);
-						}
+						db_animated_track_data0 = find_segment_tier_samples(*db, tier_metadata0, sample_index0, sample_indices0);
 
 						// Only one segment, our metadata is the same for our second key frame
-						if ((medium_importance_tier_metadata0 & sample_index1) != 0)
-						{
-							sample_indices1 = uint32_t(medium_importance_tier_metadata0);
-							db_animated_track_data1 = bulk_data_medium + uint32_t(medium_importance_tier_metadata0 >> 32);
-						}
-						else if ((low_importance_tier_metadata0 & sample_index1) != 0)
-						{
-							sample_indices1 = uint32_t(low_importance_tier_metadata0);
-							db_animated_track_data1 = bulk_data_low + uint32_t(low_importance_tier_metadata0 >> 32);
-						}
+						db_animated_track_data1 = find_segment_tier_samples(*db, tier_metadata0, sample_index1, sample_indices1);
 					}
 
 					// Remap our sample indices within the ones actually stored (e.g. index 3 might be the second frame stored)
@@ -422,10 +433,8 @@ namespace acl
 					// When we load our sample indices and offsets from the database, there can be another thread writing
 					// to those memory locations at the same time (e.g. streaming in/out).
 					// To ensure thread safety, we atomically load the offset and sample indices.
-					uint64_t medium_importance_tier_metadata0 = 0;
-					uint64_t medium_importance_tier_metadata1 = 0;
-					uint64_t low_importance_tier_metadata0 = 0;
-					uint64_t low_importance_tier_metadata1 = 0;
+					uint64_t tier_metadata0[k_num_database_tiers] = { 0 };
+					uint64_t tier_metadata1[k_num_database_tiers] = { 0 };
 
 					// Combine all our loaded samples into a single bit set to find which samples we need to interpolate
 					if (is_database_supported && db != nullptr)
@@ -436,20 +445,15 @@ namespace acl
 						const database_runtime_clip_header* db_clip_header = tracks_db_header->get_clip_header(db->clip_segment_headers);
 						const database_runtime_segment_header* db_segment_headers = db_clip_header->get_segment_headers();
 
+						if (is_clip_usage_tracking_supported_impl<decompression_settings_type>())
+							record_clip_usage(*db, *db_clip_header);
+
 						// Cache miss for the db segment headers
 						const database_runtime_segment_header* db_segment_header0 = db_segment_headers + segment_index0;
-						medium_importance_tier_metadata0 = db_segment_header0->tier_metadata[0].load(k_memory_order_relaxed);
-						low_importance_tier_metadata0 = db_segment_header0->tier_metadata[1].load(k_memory_order_relaxed);
-
-						sample_indices0 |= uint32_t(medium_importance_tier_metadata0);
-						sample_indices0 |= uint32_t(low_importance_tier_metadata0);
+						sample_indices0 |= load_segment_tiers_metadata(*db, *db_clip_header, *db_segment_header0, tier_metadata0);
 
 						const database_runtime_segment_header* db_segment_header1 = db_segment_headers + segment_index1;
-						medium_importance_tier_metadata1 = db_segment_header1->tier_metadata[0].load(k_memory_order_relaxed);
-						low_importance_tier_metadata1 = db_segment_header1->tier_metadata[1].load(k_memory_order_relaxed);
-
-						sample_indices1 |= uint32_t(medium_importance_tier_metadata1);
-						sample_indices1 |= uint32_t(low_importance_tier_metadata1);
+						sample_indices1 |= load_segment_tiers_metadata(*db, *db_clip_header, *db_segment_header1, tier_metadata1);
 					}
 
 					// Find the closest loaded samples
@@ -479,29 +483,8 @@ namespace acl
 						const uint64_t sample_index0 = uint64_t(1) << (31 - segment_key_frame0);
 						const uint64_t sample_index1 = uint64_t(1) << (31 - segment_key_frame1);
 
-						const uint8_t* bulk_data_medium = db->bulk_data[0];		// Might be nullptr if we haven't streamed in yet
-						const uint8_t* bulk_data_low = db->bulk_data[1];		// Might be nullptr if we haven't streamed in yet
-						if ((medium_importance_tier_metadata0 & sample_index0) != 0)
-						{
-							sample_indices0 = uint32_t(medium_importance_tier_metadata0);
-							db_animated_track_data0 = bulk_data_medium + uint32_t(medium_importance_tier_metadata0 >> 32);
-						}
-						else if ((low_importance_tier_metadata0 & sample_index0) != 0)
-						{
-							sample_indices0 = uint32_t(low_importance_tier_metadata0);
-							db_animated_track_data0 = bulk_data_low + uint32_t(low_importance_tier_metadata0 >> 32);
-						}
-
-						if ((medium_importance_tier_metadata1 & sample_index1) != 0)
-						{
-							sample_indices1 = uint32_t(medium_importance_tier_metadata1);
-							db_animated_track_data1 = bulk_data_medium + uint32_t(medium_importance_tier_metadata1 >> 32);
-						}
-						else if ((low_importance_tier_metadata1 & sample_index1) != 0)
-						{
-							sample_indices1 = uint32_t(low_importance_tier_metadata1);
-							db_animated_track_data1 = bulk_data_low + uint32_t(low_importance_tier_metadata1 >> 32);
-						}
+						db_animated_track_data0 = find_segment_tier_samples(*db, tier_metadata0, sample_index0, sample_indices0);
+						db_animated_track_data1 = find_segment_tier_samples(*db, tier_metadata1, sample_index1, sample_indices1);
 					}
 
 					// Remap our sample indices within the ones actually stored (e.g. index 3 might be the second frame stored)
@@ -561,6 +544,51 @@ namespace acl
 			context.segment_offsets[1] = ptr_offset32<segment_header>(tracks, segment_header1);
 		}
 
+		// Seeks to a sample time that lies between the two key frames we are already seeked to, only our interpolation alpha changes
+		// The segment data and key frame offsets are retained, a bound key frame cache will hit when we decompress every track
+		// Returns false if other key frames are needed, or if we cannot tell, in which case a regular seek is required
+		template<class decompression_settings_type>
+		inline bool seek_within_key_frames_v0(persistent_transform_decompression_context_v0& context, float sample_time, sample_rounding_policy rounding_policy)
+		{
+			const compressed_tracks* tracks = context.tracks;
+			const tracks_header& header = get_tracks_header(*tracks);
+			if (header.num_tracks == 0)
+				return false;	// Empty track list
+
+			if (context.sample_time < 0.0F || context.get_rounding_policy() != rounding_policy)
+				return false;	// We didn't seek yet or we seeked with another rounding policy
+
+			// Stripped key frames and database samples change which key frames we interpolate between
+			// and seeking must always resolve which database chunks are resident
+			const bool has_database = is_database_supported_impl<decompression_settings_type>() && tracks->has_database();
+			if (has_database || tracks->has_stripped_keyframes())
+				return false;
+
+			// Clamp for safety, the caller should normally handle this but in practice, it often isn't the case
+			if (decompression_settings_type::clamp_sample_time())
+				sample_time = rtm::scalar_clamp(sample_time, 0.0F, context.clip_duration);
+
+			// If the wrap looping policy isn't supported, use our statically known value
+			const sample_looping_policy looping_policy_ = decompression_settings_type::is_wrapping_supported() ? static_cast<sample_looping_policy>(context.looping_policy) : sample_looping_policy::clamp;
+
+			uint32_t seeked_key_frame0;
+			uint32_t seeked_key_frame1;
+			float seeked_interpolation_alpha;
+			find_linear_interpolation_samples_with_sample_rate(header.num_samples, header.sample_rate, context.sample_time, rounding_policy, looping_policy_, seeked_key_frame0, seeked_key_frame1, seeked_interpolation_alpha);
+
+			uint32_t key_frame0;
+			uint32_t key_frame1;
+			float interpolation_alpha;
+			find_linear_interpolation_samples_with_sample_rate(header.num_samples, header.sample_rate, sample_time, rounding_policy, looping_policy_, key_frame0, key_frame1, interpolation_alpha);
+
+			if (key_frame0 != seeked_key_frame0 || key_frame1 != seeked_key_frame1)
+				return false;	// Different key frames
+
+			context.sample_time = sample_time;
+			context.interpolation_alpha = interpolation_alpha;
+			return true;
+		}
+
 
 		// TODO: Merge the per track format and segment range info into a single buffer? Less to prefetch and used together
 		// TODO: Remove segment data alignment, no longer required?
@@ -1522,8 +1550,9 @@ namespace acl
 			}
 		}
 
+		// The context isn't const since a bound key frame cache is populated on a cache miss
 		template<class decompression_settings_type, class track_writer_type>
-		inline void decompress_tracks_v0(const persistent_transform_decompression_context_v0& context, track_writer_type& writer)
+		inline void decompress_tracks_v0(persistent_transform_decompression_context_v0& context, track_writer_type& writer)
 		{
 			const compressed_tracks* tracks = context.tracks;
 			const tracks_header& header = get_tracks_header(*tracks);
@@ -1580,6 +1609,9 @@ namespace acl
 			animated_track_cache_v0 animated_track_cache;
 			animated_track_cache.initialize<decompression_settings_type, translation_adapter>(context);
 
+			// We unpack every animated group, we can use our decoded key frame cache if we have one
+			animated_track_cache.initialize_keyframe_cache<decompression_settings_type>(context);
+
 			{
 				// Start prefetching the per track metadata of both segments
 				// They might live in a different memory page than the clip's header and constant data
@@ -1735,6 +1767,95 @@ namespace acl
 				restore_fp_exceptions(fp_env);
 		}
 
+		// Walks the stored samples within [start_sample_index, end_sample_index) in order and decompresses every track
+		// Both key frames point to the stored sample, it is unpacked once and written out as-is
+		// The segment data is only looked up when we enter a new segment
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_samples_v0(persistent_transform_decompression_context_v0& context, uint32_t start_sample_index, uint32_t end_sample_index, uint32_t sample_stride, track_writer_type& writer)
+		{
+			const compressed_tracks* tracks = context.tracks;
+			const tracks_header& header = get_tracks_header(*tracks);
+			if (header.num_tracks == 0)
+				return;	// Empty track list
+
+			const uint32_t num_samples = header.num_samples;
+			const float sample_rate = header.sample_rate;
+
+			ACL_ASSERT(end_sample_index <= num_samples, "End sample index out of bounds: %u > %u", end_sample_index, num_samples);
+
+			// Stripped key frames and database samples might not be stored where we expect them, seek to each sample instead
+			const bool has_database = is_database_supported_impl<decompression_settings_type>() && tracks->has_database();
+			if (has_database || tracks->has_stripped_keyframes())
+			{
+				for (uint32_t sample_index = start_sample_index; sample_index < end_sample_index; sample_index += sample_stride)
+				{
+					const float sample_time = rtm::scalar_min(float(sample_index) / sample_rate, context.clip_duration);
+
+					seek_v0<decompression_settings_type>(context, sample_time, sample_rounding_policy::nearest);
+					writer.set_sample_index(sample_index);
+
+					decompress_tracks_v0<decompression_settings_type>(context, writer);
+				}
+
+				return;
+			}
+
+			const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
+			const segment_header* segment_headers = transform_header.get_segment_headers();
+			const uint32_t num_segments = transform_header.num_segments;
+
+			// When we have a single segment, its start index (zero) isn't stored
+			const uint32_t* segment_start_indices = num_segments > 1 ? transform_header.get_segment_start_indices() : nullptr;
+
+			const segment_header* segment_header_ = segment_headers;
+			uint32_t segment_index = 0;
+			uint32_t segment_start_index = 0;
+			uint32_t segment_end_index = 0;	// Forces us to look up our first segment
+
+			// We land directly on our samples, our interpolation alpha is zero as if we had rounded to the nearest sample
+			context.interpolation_alpha = 0.0F;
+			context.rounding_policy = static_cast<uint8_t>(sample_rounding_policy::nearest);
+
+			for (uint32_t sample_index = start_sample_index; sample_index < end_sample_index; sample_index += sample_stride)
+			{
+				if (sample_index >= segment_end_index)
+				{
+					// Segments are visited in order, move forward to the one that contains our sample
+					while (segment_index + 1 < num_segments && sample_index >= segment_start_indices[segment_index + 1])
+						segment_index++;
+
+					segment_start_index = num_segments > 1 ? segment_start_indices[segment_index] : 0;
+					segment_end_index = segment_index + 1 < num_segments ? segment_start_indices[segment_index + 1] : num_samples;
+					segment_header_ = segment_headers + segment_index;
+
+					// Both key frames live in our segment
+					transform_header.get_segment_data(*segment_header_, context.format_per_track_data[0], context.segment_range_data[0], context.animated_track_data[0]);
+					context.format_per_track_data[1] = context.format_per_track_data[0];
+					context.segment_range_data[1] = context.segment_range_data[0];
+					context.animated_track_data[1] = context.animated_track_data[0];
+
+					context.uses_single_segment = true;
+					context.segment_offsets[0] = ptr_offset32<segment_header>(tracks, segment_header_);
+					context.segment_offsets[1] = context.segment_offsets[0];
+				}
+
+				const uint32_t key_frame_bit_offset = (sample_index - segment_start_index) * segment_header_->animated_pose_bit_size;
+				context.key_frame_bit_offsets[0] = key_frame_bit_offset;
+				context.key_frame_bit_offsets[1] = key_frame_bit_offset;
+
+				context.sample_time = rtm::scalar_min(float(sample_index) / sample_rate, context.clip_duration);
+
+				writer.set_sample_index(sample_index);
+
+				decompress_tracks_v0<decompression_settings_type>(context, writer);
+			}
+
+			// Our sample time might not map back exactly onto the last sample visited, seek to it to leave the context
+			// in the same state as a regular seek would
+			if (start_sample_index < end_sample_index)
+				seek_v0<decompression_settings_type>(context, context.sample_time, sample_rounding_policy::nearest);
+		}
+
 		// We only initialize some variables when we need them which prompts the compiler to complain
 		// The usage is perfectly safe and because this code is VERY hot and needs to be as fast as possible,
 		// we disable the warning to avoid zeroing out things we don't need
@@ -1869,7 +1990,31 @@ namespace acl
 			// Sub-tracks that are kept have their bits set to 0 to mask them with logical ANDNOT later
 			const uint32_t padding_mask = num_padded_sub_tracks != 0 ? (0xFFFFFFFF >> ((k_num_sub_tracks_per_packed_entry - num_padded_sub_tracks) * 2)) : 0x00000000;
 
-			for (uint32_t sub_track_entry_index_ = 0; sub_track_entry_index_ <= last_entry_index; ++sub_track_entry_index_)
+			// If we have a prefix index, the counts of every entry that precedes ours are known and we only need to count within our own entry
+			// Otherwise, we count every entry up to and including ours
+			uint32_t first_entry_index = 0;
+			if (context.has_sub_track_prefix_index)
+			{
+				const uint32_t num_sub_tracks_per_bone = 2 + has_scale;
+				const packed_sub_track_prefix_counts* rotation_prefix_counts = get_transform_tracks_header(*tracks).get_sub_track_prefix_counts(num_sub_track_entries * num_sub_tracks_per_bone);
+				const packed_sub_track_prefix_counts* translation_prefix_counts = rotation_prefix_counts + num_sub_track_entries;
+
+				// If we have no scale, we'll load the rotation prefix counts and mask them out like we do with the sub-track types
+				const packed_sub_track_prefix_counts* scale_prefix_counts = has_scale ? (translation_prefix_counts + num_sub_track_entries) : rotation_prefix_counts;
+
+				num_constant_rotations = rotation_prefix_counts[last_entry_index].num_constant;
+				num_animated_rotations = rotation_prefix_counts[last_entry_index].num_animated;
+
+				num_constant_translations = translation_prefix_counts[last_entry_index].num_constant;
+				num_animated_translations = translation_prefix_counts[last_entry_index].num_animated;
+
+				num_constant_scales = scale_sub_track_mask & scale_prefix_counts[last_entry_index].num_constant;
+				num_animated_scales = scale_sub_track_mask & scale_prefix_counts[last_entry_index].num_animated;
+
+				first_entry_index = last_entry_index;
+			}
+
+			for (uint32_t sub_track_entry_index_ = first_entry_index; sub_track_entry_index_ <= last_entry_index; ++sub_track_entry_index_)
 			{
 				// Our last entry might contain more information than we need so we strip the padding we don't need
 				const uint32_t entry_padding_mask = (sub_track_entry_index_ == last_entry_index) ? padding_mask : 0x00000000;
@@ -2048,6 +2193,386 @@ namespace acl
 				restore_fp_exceptions(fp_env);
 		}
 
+		// Decompresses the tracks within [first_track_index, end_track_index) and if a track subset is provided,
+		// only those whose bit is set. The groups of 4 sub-tracks that contain a requested track are unpacked whole
+		// with the same code path as decompress_tracks_v0, the others are skipped without being unpacked.
+		// The context is only read from which allows disjoint ranges to be decompressed concurrently.
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_track_selection_v0(const persistent_transform_decompression_context_v0& context, const uint32_t* track_subset, uint32_t first_track_index, uint32_t end_track_index, track_writer_type& writer)
+		{
+			const compressed_tracks* tracks = context.tracks;
+			const tracks_header& tracks_header_ = get_tracks_header(*tracks);
+			const uint32_t num_tracks = tracks_header_.num_tracks;
+
+			// Due to the SIMD operations, we sometimes overflow in the SIMD lanes not used.
+			// Disable floating point exceptions to avoid issues.
+			fp_environment fp_env;
+			if (decompression_settings_type::disable_fp_exeptions())
+				disable_fp_exceptions(fp_env);
+
+			using translation_adapter = acl_impl::translation_decompression_settings_adapter<decompression_settings_type>;
+			using scale_adapter = acl_impl::scale_decompression_settings_adapter<decompression_settings_type>;
+
+			constexpr default_sub_track_mode default_rotation_mode = track_writer_type::get_default_rotation_mode();
+			constexpr default_sub_track_mode default_translation_mode = track_writer_type::get_default_translation_mode();
+			constexpr default_sub_track_mode default_scale_mode = track_writer_type::get_default_scale_mode();
+
+			static_assert(default_rotation_mode != default_sub_track_mode::legacy, "Not supported for rotations");
+			static_assert(default_translation_mode != default_sub_track_mode::legacy, "Not supported for translations");
+
+			// Grab our constant default values if we have one, otherwise init with some value
+			const rtm::quatf default_rotation = default_rotation_mode == default_sub_track_mode::constant ? writer.get_constant_default_rotation() : rtm::quat_identity();
+			const rtm::vector4f default_translation = default_translation_mode == default_sub_track_mode::constant ? writer.get_constant_default_translation() : rtm::vector_zero();
+
+			rtm::vector4f default_scale;
+			if (default_scale_mode == default_sub_track_mode::constant)
+				default_scale = writer.get_constant_default_scale();
+			else if (default_scale_mode == default_sub_track_mode::legacy)
+				default_scale = rtm::vector_set(float(tracks_header_.get_default_scale()));
+			else
+				default_scale = rtm::vector_zero();
+
+			const uint32_t has_scale = context.has_scale;
+
+			const packed_sub_track_types* sub_track_types = get_transform_tracks_header(*tracks).get_sub_track_types();
+			const uint32_t num_sub_track_entries = (num_tracks + k_num_sub_tracks_per_packed_entry - 1) / k_num_sub_tracks_per_packed_entry;
+
+			const packed_sub_track_types* rotation_sub_track_types = sub_track_types;
+			const packed_sub_track_types* translation_sub_track_types = rotation_sub_track_types + num_sub_track_entries;
+
+			// If we have no scale, we'll load the rotation sub-track types and mask it out to avoid branching, forcing it to be the default value
+			const packed_sub_track_types* scale_sub_track_types = has_scale ? (translation_sub_track_types + num_sub_track_entries) : sub_track_types;
+
+			// Build a mask to strip out the scale sub-track types if we have no scale present
+			// has_scale is either 0 or 1, negating yields 0 (0x00000000) or -1 (0xFFFFFFFF)
+			// Equivalent to: has_scale ? 0xFFFFFFFF : 0x00000000
+			const uint32_t scale_sub_track_mask = -int32_t(has_scale);
+
+			constant_track_cache_v0 constant_track_cache;
+			constant_track_cache.initialize<decompression_settings_type>(context);
+
+			animated_track_cache_v0 animated_track_cache;
+			animated_track_cache.initialize<decompression_settings_type, translation_adapter>(context);
+
+			// Our caches can only move forward, one group of 4 sub-tracks at a time
+			// We track which group each cache currently points to so we can skip ahead to the next group we need
+			// Constant rotation groups and animated groups are unpacked whole, like decompress_tracks(..) does, to yield identical results
+			// Once an animated group is unpacked, its cache points to the group that follows
+			uint32_t constant_rotation_group_index = 0;
+			uint32_t constant_translation_group_index = 0;
+			uint32_t constant_scale_group_index = 0;
+			uint32_t animated_rotation_group_index = 0;
+			uint32_t animated_translation_group_index = 0;
+			uint32_t animated_scale_group_index = 0;
+
+			// The constant rotation group we last unpacked, if any
+			uint32_t unpacked_constant_rotation_group_index = ~0U;
+			rtm::quatf constant_rotations[4];
+
+			// Number of constant/animated sub-tracks contained in the entries that precede the current one
+			uint32_t num_constant_rotations = 0;
+			uint32_t num_constant_translations = 0;
+			uint32_t num_constant_scales = 0;
+			uint32_t num_animated_rotations = 0;
+			uint32_t num_animated_translations = 0;
+			uint32_t num_animated_scales = 0;
+
+			const uint32_t first_entry_index = first_track_index / k_num_sub_tracks_per_packed_entry;
+			const uint32_t end_entry_index = (end_track_index + k_num_sub_tracks_per_packed_entry - 1) / k_num_sub_tracks_per_packed_entry;
+
+			if (first_entry_index != 0)
+			{
+				// Our first track doesn't live in the first entry, count the sub-tracks that precede its entry
+				// If we have a prefix index, the counts are known, otherwise we count every entry that precedes ours
+				if (context.has_sub_track_prefix_index)
+				{
+					const uint32_t num_sub_tracks_per_bone = 2 + has_scale;
+					const packed_sub_track_prefix_counts* rotation_prefix_counts = get_transform_tracks_header(*tracks).get_sub_track_prefix_counts(num_sub_track_entries * num_sub_tracks_per_bone);
+					const packed_sub_track_prefix_counts* translation_prefix_counts = rotation_prefix_counts + num_sub_track_entries;
+
+					// If we have no scale, we'll load the rotation prefix counts and mask them out like we do with the sub-track types
+					const packed_sub_track_prefix_counts* scale_prefix_counts = has_scale ? (translation_prefix_counts + num_sub_track_entries) : rotation_prefix_counts;
+
+					num_constant_rotations = rotation_prefix_counts[first_entry_index].num_constant;
+					num_animated_rotations = rotation_prefix_counts[first_entry_index].num_animated;
+
+					num_constant_translations = translation_prefix_counts[first_entry_index].num_constant;
+					num_animated_translations = translation_prefix_counts[first_entry_index].num_animated;
+
+					num_constant_scales = scale_sub_track_mask & scale_prefix_counts[first_entry_index].num_constant;
+					num_animated_scales = scale_sub_track_mask & scale_prefix_counts[first_entry_index].num_animated;
+				}
+				else
+				{
+					for (uint32_t sub_track_entry_index = 0; sub_track_entry_index < first_entry_index; ++sub_track_entry_index)
+					{
+						const uint32_t rotation_sub_track_types_ = rotation_sub_track_types[sub_track_entry_index].types;
+						const uint32_t translation_sub_track_types_ = translation_sub_track_types[sub_track_entry_index].types;
+						const uint32_t scale_sub_track_types_ = scale_sub_track_mask & scale_sub_track_types[sub_track_entry_index].types;
+
+						num_constant_rotations += count_set_bits(rotation_sub_track_types_ & 0x55555555);
+						num_animated_rotations += count_set_bits(rotation_sub_track_types_ & 0xAAAAAAAA);
+
+						num_constant_translations += count_set_bits(translation_sub_track_types_ & 0x55555555);
+						num_animated_translations += count_set_bits(translation_sub_track_types_ & 0xAAAAAAAA);
+
+						num_constant_scales += count_set_bits(scale_sub_track_types_ & 0x55555555);
+						num_animated_scales += count_set_bits(scale_sub_track_types_ & 0xAAAAAAAA);
+					}
+				}
+			}
+
+			const sample_rounding_policy rounding_policy = context.get_rounding_policy();
+
+			for (uint32_t sub_track_entry_index = first_entry_index; sub_track_entry_index < end_entry_index; ++sub_track_entry_index)
+			{
+				const uint32_t rotation_sub_track_types_ = rotation_sub_track_types[sub_track_entry_index].types;
+				const uint32_t translation_sub_track_types_ = translation_sub_track_types[sub_track_entry_index].types;
+				const uint32_t scale_sub_track_types_ = scale_sub_track_mask & scale_sub_track_types[sub_track_entry_index].types;
+
+				// Strip the tracks of this entry that fall outside of our range, the first track of the entry is the MSB of the lower 16 bits
+				const uint32_t entry_first_track_index = sub_track_entry_index * k_num_sub_tracks_per_packed_entry;
+				const uint32_t range_start = first_track_index > entry_first_track_index ? (first_track_index - entry_first_track_index) : 0;
+				const uint32_t range_end = std::min<uint32_t>(end_track_index - entry_first_track_index, k_num_sub_tracks_per_packed_entry);
+				const uint32_t range_mask = (0xFFFF >> range_start) & (0xFFFF0000 >> range_end);
+
+				uint32_t subset_mask = range_mask;
+				if (track_subset != nullptr)
+				{
+					// Each bit set word contains two sub-track entries, the first one lives in the upper 16 bits
+					const uint32_t subset_word = track_subset[sub_track_entry_index / 2];
+					subset_mask &= (sub_track_entry_index % 2) == 0 ? (subset_word >> 16) : (subset_word & 0xFFFF);
+				}
+
+				while (subset_mask != 0)
+				{
+					// Our mask lives in the lower 16 bits, the first track of the entry is its MSB
+					const uint32_t packed_index = count_leading_zeros(subset_mask) - 16;
+					subset_mask &= ~(0x8000 >> packed_index);
+
+					const uint32_t track_index = (sub_track_entry_index * k_num_sub_tracks_per_packed_entry) + packed_index;
+					if (track_index >= num_tracks)
+						break;	// Bits past our last track live in the padding
+
+					// Shift our sub-track types so that the sub-track we care about ends up in the LSB position
+					const uint32_t packed_shift = (15 - packed_index) * 2;
+
+					// Mask of the sub-tracks that precede ours within this entry
+					const uint32_t preceding_mask = packed_index != 0 ? ~(0xFFFFFFFF >> (packed_index * 2)) : 0x00000000;
+
+					const uint32_t rotation_sub_track_type = (rotation_sub_track_types_ >> packed_shift) & 0x3;
+					const uint32_t translation_sub_track_type = (translation_sub_track_types_ >> packed_shift) & 0x3;
+					const uint32_t scale_sub_track_type = (scale_sub_track_types_ >> packed_shift) & 0x3;
+
+					// We need the true rounding policy to be statically known when per track rounding is not supported
+					// When it isn't supported, we always use 'none' since the interpolation alpha was properly calculated
+					// and rounding has already been performed for us.
+					sample_rounding_policy rounding_policy_ = sample_rounding_policy::none;
+					if (decompression_settings_type::is_per_track_rounding_supported() && ((rotation_sub_track_type | translation_sub_track_type | scale_sub_track_type) & 2) != 0)
+					{
+						rounding_policy_ = writer.get_rounding_policy(rounding_policy, track_index);
+						ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+					}
+
+					if (!track_writer_type::skip_all_rotations() && !writer.skip_track_rotation(track_index))
+					{
+						if (rotation_sub_track_type == 0)
+						{
+							if (default_rotation_mode != default_sub_track_mode::skipped)
+							{
+								if (default_rotation_mode == default_sub_track_mode::variable)
+									writer.write_rotation(track_index, writer.get_variable_default_rotation(track_index));
+								else
+									writer.write_rotation(track_index, default_rotation);
+							}
+						}
+						else
+						{
+							rtm::quatf rotation;
+							if (rotation_sub_track_type & 1)
+							{
+								const uint32_t sample_index = num_constant_rotations + count_set_bits(rotation_sub_track_types_ & preceding_mask & 0x55555555);
+								const uint32_t group_index = sample_index / 4;
+								if (group_index != unpacked_constant_rotation_group_index)
+								{
+									if (group_index != constant_rotation_group_index)
+									{
+										constant_track_cache.skip_rotation_groups<decompression_settings_type>(context, group_index - constant_rotation_group_index);
+										constant_rotation_group_index = group_index;
+									}
+
+									constant_track_cache.unpack_rotations_within_group<decompression_settings_type>(context, &constant_rotations[0]);
+									unpacked_constant_rotation_group_index = group_index;
+								}
+
+								rotation = constant_rotations[sample_index % 4];
+							}
+							else
+							{
+								const uint32_t sample_index = num_animated_rotations + count_set_bits(rotation_sub_track_types_ & preceding_mask & 0xAAAAAAAA);
+								const uint32_t group_index = sample_index / 4;
+								if (group_index + 1 != animated_rotation_group_index)
+								{
+									if (group_index != animated_rotation_group_index)
+										animated_track_cache.skip_rotation_groups<decompression_settings_type>(context, group_index - animated_rotation_group_index);
+
+									animated_track_cache.unpack_next_rotation_group<decompression_settings_type>(context);
+									animated_rotation_group_index = group_index + 1;
+								}
+
+								rotation = animated_track_cache.read_cached_rotation(rounding_policy_, sample_index % 4);
+							}
+
+							writer.write_rotation(track_index, rotation);
+						}
+					}
+
+					if (!track_writer_type::skip_all_translations() && !writer.skip_track_translation(track_index))
+					{
+						if (translation_sub_track_type == 0)
+						{
+							if (default_translation_mode != default_sub_track_mode::skipped)
+							{
+								if (default_translation_mode == default_sub_track_mode::variable)
+									writer.write_translation(track_index, writer.get_variable_default_translation(track_index));
+								else
+									writer.write_translation(track_index, default_translation);
+							}
+						}
+						else
+						{
+							rtm::vector4f translation;
+							if (translation_sub_track_type & 1)
+							{
+								const uint32_t sample_index = num_constant_translations + count_set_bits(translation_sub_track_types_ & preceding_mask & 0x55555555);
+								const uint32_t group_index = sample_index / 4;
+								if (group_index != constant_translation_group_index)
+								{
+									constant_track_cache.skip_translation_groups(group_index - constant_translation_group_index);
+									constant_translation_group_index = group_index;
+								}
+
+								translation = constant_track_cache.unpack_translation_within_group(sample_index % 4);
+							}
+							else
+							{
+								const uint32_t sample_index = num_animated_translations + count_set_bits(translation_sub_track_types_ & preceding_mask & 0xAAAAAAAA);
+								const uint32_t group_index = sample_index / 4;
+								if (group_index + 1 != animated_translation_group_index)
+								{
+									if (group_index != animated_translation_group_index)
+										animated_track_cache.skip_translation_groups<translation_adapter>(context, group_index - animated_translation_group_index);
+
+									animated_track_cache.unpack_next_translation_group<translation_adapter>(context);
+									animated_translation_group_index = group_index + 1;
+								}
+
+								translation = animated_track_cache.read_cached_translation(rounding_policy_, sample_index % 4);
+							}
+
+							writer.write_translation(track_index, translation);
+						}
+					}
+
+					if (!track_writer_type::skip_all_scales() && !writer.skip_track_scale(track_index))
+					{
+						if (scale_sub_track_type == 0)
+						{
+							if (default_scale_mode != default_sub_track_mode::skipped)
+							{
+								if (default_scale_mode == default_sub_track_mode::variable)
+									writer.write_scale(track_index, writer.get_variable_default_scale(track_index));
+								else
+									writer.write_scale(track_index, default_scale);
+							}
+						}
+						else
+						{
+							rtm::vector4f scale;
+							if (scale_sub_track_type & 1)
+							{
+								const uint32_t sample_index = num_constant_scales + count_set_bits(scale_sub_track_types_ & preceding_mask & 0x55555555);
+								const uint32_t group_index = sample_index / 4;
+								if (group_index != constant_scale_group_index)
+								{
+									constant_track_cache.skip_scale_groups(group_index - constant_scale_group_index);
+									constant_scale_group_index = group_index;
+								}
+
+								scale = constant_track_cache.unpack_scale_within_group(sample_index % 4);
+							}
+							else
+							{
+								const uint32_t sample_index = num_animated_scales + count_set_bits(scale_sub_track_types_ & preceding_mask & 0xAAAAAAAA);
+								const uint32_t group_index = sample_index / 4;
+								if (group_index + 1 != animated_scale_group_index)
+								{
+									if (group_index != animated_scale_group_index)
+										animated_track_cache.skip_scale_groups<scale_adapter>(context, group_index - animated_scale_group_index);
+
+									animated_track_cache.unpack_next_scale_group<scale_adapter>(context);
+									animated_scale_group_index = group_index + 1;
+								}
+
+								scale = animated_track_cache.read_cached_scale(rounding_policy_, sample_index % 4);
+							}
+
+							writer.write_scale(track_index, scale);
+						}
+					}
+				}
+
+				// Padding sub-tracks are default and do not contribute to our counts
+				num_constant_rotations += count_set_bits(rotation_sub_track_types_ & 0x55555555);
+				num_animated_rotations += count_set_bits(rotation_sub_track_types_ & 0xAAAAAAAA);
+
+				num_constant_translations += count_set_bits(translation_sub_track_types_ & 0x55555555);
+				num_animated_translations += count_set_bits(translation_sub_track_types_ & 0xAAAAAAAA);
+
+				num_constant_scales += count_set_bits(scale_sub_track_types_ & 0x55555555);
+				num_animated_scales += count_set_bits(scale_sub_track_types_ & 0xAAAAAAAA);
+			}
+
+			if (decompression_settings_type::disable_fp_exeptions())
+				restore_fp_exceptions(fp_env);
+		}
+
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_tracks_v0(const persistent_transform_decompression_context_v0& context, const uint32_t* track_subset, bitset_description track_subset_desc, track_writer_type& writer)
+		{
+			const uint32_t num_tracks = get_tracks_header(*context.tracks).num_tracks;
+			if (num_tracks == 0)
+				return;	// Empty track list
+
+			ACL_ASSERT(context.sample_time >= 0.0f, "Context not set to a valid sample time");
+			if (context.sample_time < 0.0F)
+				return;	// Invalid sample time, we didn't seek yet
+
+			ACL_ASSERT(track_subset_desc.get_num_bits() >= num_tracks, "Track subset bit set is too small");
+			if (track_subset_desc.get_num_bits() < num_tracks)
+				return;	// Invalid track subset
+
+			decompress_track_selection_v0<decompression_settings_type>(context, track_subset, 0, num_tracks, writer);
+		}
+
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_track_range_v0(const persistent_transform_decompression_context_v0& context, uint32_t first_track_index, uint32_t num_tracks_in_range, track_writer_type& writer)
+		{
+			const uint32_t num_tracks = get_tracks_header(*context.tracks).num_tracks;
+
+			ACL_ASSERT(context.sample_time >= 0.0f, "Context not set to a valid sample time");
+			if (context.sample_time < 0.0F)
+				return;	// Invalid sample time, we didn't seek yet
+
+			ACL_ASSERT(first_track_index <= num_tracks && num_tracks_in_range <= num_tracks - first_track_index, "Invalid track range");
+			if (first_track_index >= num_tracks || num_tracks_in_range == 0)
+				return;	// Empty range
+
+			const uint32_t end_track_index = std::min<uint32_t>(first_track_index + num_tracks_in_range, num_tracks);
+
+			decompress_track_selection_v0<decompression_settings_type>(context, nullptr, first_track_index, end_track_index, writer);
+		}
+
 		// Restore our warnings
 #if defined(RTM_COMPILER_MSVC)
 		#pragma warning(pop)
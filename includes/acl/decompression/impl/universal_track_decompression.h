@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/bitset.h"
 #include "acl/core/compressed_tracks.h"
 #include "acl/core/compressed_tracks_version.h"
 #include "acl/core/interpolation_utils.h"
@@ -193,6 +194,45 @@ namespace acl
 			}
 		}
 
+		inline uint32_t get_keyframe_cache_size_v0(const persistent_universal_decompression_context& context)
+		{
+			const track_type8 track_type = context.scalar.tracks->get_track_type();
+			switch (track_type)
+			{
+			case track_type8::float1f:
+			case track_type8::float2f:
+			case track_type8::float3f:
+			case track_type8::float4f:
+			case track_type8::vector4f:
+				return get_keyframe_cache_size_v0(context.scalar);
+			case track_type8::qvvf:
+				return get_keyframe_cache_size_v0(context.transform);
+			default:
+				ACL_ASSERT(false, "Invalid track type");
+				return 0;
+			}
+		}
+
+		template<class decompression_settings_type>
+		inline bool set_keyframe_cache_v0(persistent_universal_decompression_context& context, void* buffer, uint32_t buffer_size)
+		{
+			const track_type8 track_type = context.scalar.tracks->get_track_type();
+			switch (track_type)
+			{
+			case track_type8::float1f:
+			case track_type8::float2f:
+			case track_type8::float3f:
+			case track_type8::float4f:
+			case track_type8::vector4f:
+				return set_keyframe_cache_v0<decompression_settings_type>(context.scalar, buffer, buffer_size);
+			case track_type8::qvvf:
+				return set_keyframe_cache_v0<decompression_settings_type>(context.transform, buffer, buffer_size);
+			default:
+				ACL_ASSERT(false, "Invalid track type");
+				return false;
+			}
+		}
+
 		template<class decompression_settings_type>
 		inline void seek_v0(persistent_universal_decompression_context& context, float sample_time, sample_rounding_policy rounding_policy)
 		{
@@ -217,8 +257,30 @@ namespace acl
 			}
 		}
 
+		template<class decompression_settings_type>
+		inline bool seek_within_key_frames_v0(persistent_universal_decompression_context& context, float sample_time, sample_rounding_policy rounding_policy)
+		{
+			ACL_ASSERT(context.is_initialized(), "Context is not initialized");
+
+			const track_type8 track_type = context.scalar.tracks->get_track_type();
+			switch (track_type)
+			{
+			case track_type8::float1f:
+			case track_type8::float2f:
+			case track_type8::float3f:
+			case track_type8::float4f:
+			case track_type8::vector4f:
+				return seek_within_key_frames_v0<decompression_settings_type>(context.scalar, sample_time, rounding_policy);
+			case track_type8::qvvf:
+				return seek_within_key_frames_v0<decompression_settings_type>(context.transform, sample_time, rounding_policy);
+			default:
+				ACL_ASSERT(false, "Invalid track type");
+				return false;
+			}
+		}
+
 		template<class decompression_settings_type, class track_writer_type>
-		inline void decompress_tracks_v0(const persistent_universal_decompression_context& context, track_writer_type& writer)
+		inline void decompress_tracks_v0(persistent_universal_decompression_context& context, track_writer_type& writer)
 		{
 			ACL_ASSERT(context.is_initialized(), "Context is not initialized");
 
@@ -241,6 +303,78 @@ namespace acl
 			}
 		}
 
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_samples_v0(persistent_universal_decompression_context& context, uint32_t start_sample_index, uint32_t end_sample_index, uint32_t sample_stride, track_writer_type& writer)
+		{
+			ACL_ASSERT(context.is_initialized(), "Context is not initialized");
+
+			const track_type8 track_type = context.scalar.tracks->get_track_type();
+			switch (track_type)
+			{
+			case track_type8::float1f:
+			case track_type8::float2f:
+			case track_type8::float3f:
+			case track_type8::float4f:
+			case track_type8::vector4f:
+				decompress_samples_v0<decompression_settings_type>(context.scalar, start_sample_index, end_sample_index, sample_stride, writer);
+				break;
+			case track_type8::qvvf:
+				decompress_samples_v0<decompression_settings_type>(context.transform, start_sample_index, end_sample_index, sample_stride, writer);
+				break;
+			default:
+				ACL_ASSERT(false, "Invalid track type");
+				break;
+			}
+		}
+
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_tracks_v0(const persistent_universal_decompression_context& context, const uint32_t* track_subset, bitset_description track_subset_desc, track_writer_type& writer)
+		{
+			ACL_ASSERT(context.is_initialized(), "Context is not initialized");
+
+			const track_type8 track_type = context.scalar.tracks->get_track_type();
+			switch (track_type)
+			{
+			case track_type8::float1f:
+			case track_type8::float2f:
+			case track_type8::float3f:
+			case track_type8::float4f:
+			case track_type8::vector4f:
+				decompress_tracks_v0<decompression_settings_type>(context.scalar, track_subset, track_subset_desc, writer);
+				break;
+			case track_type8::qvvf:
+				decompress_tracks_v0<decompression_settings_type>(context.transform, track_subset, track_subset_desc, writer);
+				break;
+			default:
+				ACL_ASSERT(false, "Invalid track type");
+				break;
+			}
+		}
+
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_track_range_v0(const persistent_universal_decompression_context& context, uint32_t first_track_index, uint32_t num_tracks, track_writer_type& writer)
+		{
+			ACL_ASSERT(context.is_initialized(), "Context is not initialized");
+
+			const track_type8 track_type = context.scalar.tracks->get_track_type();
+			switch (track_type)
+			{
+			case track_type8::float1f:
+			case track_type8::float2f:
+			case track_type8::float3f:
+			case track_type8::float4f:
+			case track_type8::vector4f:
+				decompress_track_range_v0<decompression_settings_type>(context.scalar, first_track_index, num_tracks, writer);
+				break;
+			case track_type8::qvvf:
+				decompress_track_range_v0<decompression_settings_type>(context.transform, first_track_index, num_tracks, writer);
+				break;
+			default:
+				ACL_ASSERT(false, "Invalid track type");
+				break;
+			}
+		}
+
 		template<class decompression_settings_type, class track_writer_type>
 		inline void decompress_track_v0(const persistent_universal_decompression_context& context, uint32_t track_index, track_writer_type& writer)
 		{
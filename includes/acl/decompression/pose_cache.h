@@ -0,0 +1,191 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/sample_rounding_policy.h"
+#include "acl/core/impl/atomic.impl.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		struct pose_cache_entry_v0;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// A key that identifies a decompressed pose within a pose_cache.
+	// Use make_pose_cache_key(..) to create one.
+	//////////////////////////////////////////////////////////////////////////
+	struct pose_cache_key
+	{
+		// The hash of the compressed tracks instance decompressed
+		uint32_t tracks_hash = 0;
+
+		// The sample time quantized to the desired precision
+		uint32_t quantized_sample_time = 0;
+
+		// The rounding policy used when seeking
+		sample_rounding_policy rounding_policy = sample_rounding_policy::none;
+
+		// A host runtime provided value identifying how the pose was written out (e.g. track remapping, output type)
+		uint32_t writer_layout_id = 0;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a pose cache key.
+	// Sample times that quantize to the same value share their pose. The quantum is in seconds,
+	// if it is zero or negative, only identical sample times share their pose.
+	//////////////////////////////////////////////////////////////////////////
+	pose_cache_key make_pose_cache_key(const compressed_tracks& tracks, float sample_time, sample_rounding_policy rounding_policy, uint32_t writer_layout_id, float sample_time_quantum = 0.0F);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Pose cache statistics
+	//////////////////////////////////////////////////////////////////////////
+	struct pose_cache_stats
+	{
+		uint64_t num_hits = 0;
+		uint64_t num_misses = 0;
+		uint64_t num_insertions = 0;
+		uint64_t num_evictions = 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the ratio of lookups that found their pose, in [0.0, 1.0].
+		float get_hit_rate() const;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A bounded memory cache of decompressed poses.
+	//
+	// When many instances play back the same compressed tracks at the same sample time
+	// (e.g. crowds), the pose can be decompressed once and shared. Before decompressing,
+	// the host runtime looks up the pose with find(..) and on a miss, decompresses it
+	// with a decompression_context as usual and then calls insert(..).
+	//
+	// Poses are opaque blobs of a fixed size, as written out by the host runtime's track_writer.
+	// The cache is set associative and every set evicts its least recently used pose.
+	//
+	// find(..) and insert(..) are safe to call from any thread. Lookups never block and
+	// never write to the pose memory. An insertion that races with another insertion in the same
+	// slot is dropped, the cache is best effort. A lookup that races with an insertion in the
+	// same slot is reported as a miss.
+	//////////////////////////////////////////////////////////////////////////
+	class pose_cache
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs an empty pose cache instance.
+		pose_cache();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Destructs a pose cache instance and releases its memory.
+		~pose_cache();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Initializes the pose cache to hold at least the requested number of poses of the
+		// specified size in bytes. Memory is allocated once here and never again.
+		// Returns whether initialization was successful or not.
+		bool initialize(iallocator& allocator, uint32_t max_num_poses, uint32_t pose_size);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if the pose cache is initialized, false otherwise.
+		bool is_initialized() const { return m_allocator != nullptr; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Releases the memory and resets the cache to its default constructed state.
+		// Cannot be called while other threads use the cache.
+		void reset();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the size in bytes of every pose held.
+		uint32_t get_pose_size() const { return m_pose_size; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of poses the cache can hold.
+		uint32_t get_num_poses() const { return m_num_sets * k_num_ways; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Looks up the pose for the provided key and if present, copies it into the provided buffer.
+		// The buffer must be at least 'get_pose_size()' bytes.
+		// Returns true on a hit, false otherwise.
+		bool find(const pose_cache_key& key, void* out_pose, uint32_t out_pose_size);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Inserts or updates the pose for the provided key.
+		// The pose size must match 'get_pose_size()'.
+		void insert(const pose_cache_key& key, const void* pose, uint32_t pose_size);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Removes every pose from the cache. Statistics are retained.
+		// Cannot be called while other threads use the cache.
+		void clear();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the statistics accumulated since initialization or since they were last reset.
+		pose_cache_stats get_stats() const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Resets the statistics.
+		void reset_stats();
+
+	private:
+		pose_cache(const pose_cache& other) = delete;
+		pose_cache& operator=(const pose_cache& other) = delete;
+
+		// Every set holds this many poses
+		static constexpr uint32_t k_num_ways = 4;
+
+		acl_impl::pose_cache_entry_v0*	m_entries;
+		std::atomic<uint64_t>*			m_poses;		// Poses are copied word by word, they are read while being written
+		iallocator*						m_allocator;
+
+		uint32_t						m_num_sets;
+		uint32_t						m_pose_size;
+		uint32_t						m_pose_stride;	// In 64 bit words
+
+		// Monotonic clock used to track the least recently used pose
+		std::atomic<uint32_t>			m_access_clock;
+
+		std::atomic<uint64_t>			m_num_hits;
+		std::atomic<uint64_t>			m_num_misses;
+		std::atomic<uint64_t>			m_num_insertions;
+		std::atomic<uint64_t>			m_num_evictions;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/decompression/impl/pose_cache.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
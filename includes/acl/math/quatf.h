@@ -26,6 +26,7 @@
 
 #include "acl/version.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/math/vector4f.h"
 
 #include <rtm/quatf.h>
 
@@ -146,17 +147,17 @@ namespace acl
 			return rtm::vector_sqrt(rtm::vector_abs(wwww_squared));
 		}
 
-#if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
+#if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP) && defined(RTM_AVX_INTRINSICS)
 		// Force inline this function, we only use it to keep the code readable
 		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK __m256 RTM_SIMD_CALL quat_from_positive_w_avx8(__m256 xxxx0_xxxx1, __m256 yyyy0_yyyy1, __m256 zzzz0_zzzz1)
 		{
-			const __m256 one_v = _mm256_set1_ps(1.0F);
-
-			const __m256 xxxx0_xxxx1_squared = _mm256_mul_ps(xxxx0_xxxx1, xxxx0_xxxx1);
-			const __m256 yyyy0_yyyy1_squared = _mm256_mul_ps(yyyy0_yyyy1, yyyy0_yyyy1);
-			const __m256 zzzz0_zzzz1_squared = _mm256_mul_ps(zzzz0_zzzz1, zzzz0_zzzz1);
-
-			const __m256 wwww0_wwww1_squared = _mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(one_v, xxxx0_xxxx1_squared), yyyy0_yyyy1_squared), zzzz0_zzzz1_squared);
+			// Same operations as quat_from_positive_w4(..) to yield identical results
+			// 1.0 - (x * x)
+			__m256 result = vector_neg_mul_sub_avx8(xxxx0_xxxx1, xxxx0_xxxx1, _mm256_set1_ps(1.0F));
+			// result - (y * y)
+			result = vector_neg_mul_sub_avx8(yyyy0_yyyy1, yyyy0_yyyy1, result);
+			// result - (z * z)
+			const __m256 wwww0_wwww1_squared = vector_neg_mul_sub_avx8(zzzz0_zzzz1, zzzz0_zzzz1, result);
 
 			const __m256i abs_mask = _mm256_set1_epi32(0x7FFFFFFFULL);
 			const __m256 wwww0_wwww1_squared_abs = _mm256_and_ps(wwww0_wwww1_squared, _mm256_castsi256_ps(abs_mask));
@@ -209,6 +210,23 @@ namespace acl
 			zzzz = rtm::vector_mul(zzzz, inv_len4);
 			wwww = rtm::vector_mul(wwww, inv_len4);
 		}
+
+#if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP) && defined(RTM_AVX_INTRINSICS)
+		// Force inline this function, we only use it to keep the code readable
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL quat_normalize_avx8(__m256& xxxx0_xxxx1, __m256& yyyy0_yyyy1, __m256& zzzz0_zzzz1, __m256& wwww0_wwww1)
+		{
+			// Same operations as quat_normalize4(..), FMA included when RTM uses it, to yield identical results
+			const __m256 dot8 = vector_mul_add_avx8(wwww0_wwww1, wwww0_wwww1, vector_mul_add_avx8(zzzz0_zzzz1, zzzz0_zzzz1, vector_mul_add_avx8(yyyy0_yyyy1, yyyy0_yyyy1, _mm256_mul_ps(xxxx0_xxxx1, xxxx0_xxxx1))));
+
+			const __m256 len8 = _mm256_sqrt_ps(dot8);
+			const __m256 inv_len8 = _mm256_div_ps(_mm256_set1_ps(1.0F), len8);
+
+			xxxx0_xxxx1 = _mm256_mul_ps(xxxx0_xxxx1, inv_len8);
+			yyyy0_yyyy1 = _mm256_mul_ps(yyyy0_yyyy1, inv_len8);
+			zzzz0_zzzz1 = _mm256_mul_ps(zzzz0_zzzz1, inv_len8);
+			wwww0_wwww1 = _mm256_mul_ps(wwww0_wwww1, inv_len8);
+		}
+#endif
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
@@ -41,6 +41,29 @@ namespace acl
 	// Temporary put here until they are included in RTM
 	namespace acl_impl
 	{
+#if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP) && defined(RTM_AVX_INTRINSICS)
+		// 8 wide equivalent of rtm::vector_mul_add(..): (input0 * input1) + input2
+		// Like RTM, we use FMA when it is available to yield identical results to the SIMD 4 wide code path
+		RTM_FORCE_INLINE __m256 RTM_SIMD_CALL vector_mul_add_avx8(__m256 input0, __m256 input1, __m256 input2)
+		{
+#if defined(RTM_FMA_INTRINSICS)
+			return _mm256_fmadd_ps(input0, input1, input2);
+#else
+			return _mm256_add_ps(_mm256_mul_ps(input0, input1), input2);
+#endif
+		}
+
+		// 8 wide equivalent of rtm::vector_neg_mul_sub(..): input2 - (input0 * input1)
+		// Like RTM, we use FMA when it is available to yield identical results to the SIMD 4 wide code path
+		RTM_FORCE_INLINE __m256 RTM_SIMD_CALL vector_neg_mul_sub_avx8(__m256 input0, __m256 input1, __m256 input2)
+		{
+#if defined(RTM_FMA_INTRINSICS)
+			return _mm256_fnmadd_ps(input0, input1, input2);
+#else
+			return _mm256_sub_ps(input2, _mm256_mul_ps(input0, input1));
+#endif
+		}
+#endif
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
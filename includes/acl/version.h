@@ -51,12 +51,33 @@
 	#endif
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+// The number of database tiers sizes the runtime types, see acl/core/quality_tiers.h.
+// Code built with a different number of tiers must not share symbols, the tier
+// count is part of the namespace when it isn't the default.
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(ACL_NUM_DATABASE_TIERS)
+	#define ACL_NUM_DATABASE_TIERS 2
+#endif
+
 // Force macro expansion to concatenate namespace identifier
 #define ACL_IMPL_VERSION_CONCAT_IMPL(prefix, major, minor, patch) prefix ## major ## minor ## patch
 #define ACL_IMPL_VERSION_CONCAT(prefix, major, minor, patch) ACL_IMPL_VERSION_CONCAT_IMPL(prefix, major, minor, patch)
+#define ACL_IMPL_TIERS_CONCAT_IMPL(prefix, num_tiers) prefix ## num_tiers
+#define ACL_IMPL_TIERS_CONCAT(prefix, num_tiers) ACL_IMPL_TIERS_CONCAT_IMPL(prefix, num_tiers)
+#define ACL_IMPL_TIERS_STRINGIFY_IMPL(num_tiers) #num_tiers
+#define ACL_IMPL_TIERS_STRINGIFY(num_tiers) ACL_IMPL_TIERS_STRINGIFY_IMPL(num_tiers)
 
-// Name of the namespace, e.g. v205
-#define ACL_IMPL_VERSION_NAMESPACE_NAME ACL_IMPL_VERSION_CONCAT(v, ACL_VERSION_MAJOR, ACL_VERSION_MINOR, ACL_VERSION_PATCH)
+// Name of the namespace, e.g. v205 or v205_tiers4 with 4 database tiers
+#if ACL_NUM_DATABASE_TIERS == 2
+	#define ACL_IMPL_VERSION_NAMESPACE_NAME ACL_IMPL_VERSION_CONCAT(v, ACL_VERSION_MAJOR, ACL_VERSION_MINOR, ACL_VERSION_PATCH)
+#else
+	#define ACL_IMPL_VERSION_NAMESPACE_NAME ACL_IMPL_TIERS_CONCAT(ACL_IMPL_VERSION_CONCAT(v, ACL_VERSION_MAJOR, ACL_VERSION_MINOR, ACL_VERSION_PATCH), ACL_IMPL_TIERS_CONCAT(_tiers, ACL_NUM_DATABASE_TIERS))
+#endif
+
+// Name of the namespace used when the versioned namespace is disabled, e.g. tiers4 with 4 database tiers
+#define ACL_IMPL_TIERS_NAMESPACE_NAME ACL_IMPL_TIERS_CONCAT(tiers, ACL_NUM_DATABASE_TIERS)
 
 // Because this is being introduced in a patch release, as caution, it is disabled
 // by default. It does break ABI if host runtimes forward declare types but that
@@ -67,8 +88,19 @@
 	// full version everywhere
 	#define ACL_IMPL_NAMESPACE acl
 
-	#define ACL_IMPL_VERSION_NAMESPACE_BEGIN
-	#define ACL_IMPL_VERSION_NAMESPACE_END
+	#if !defined(ACL_NO_VERSION_NAMESPACE) && ACL_NUM_DATABASE_TIERS != 2
+		// The versioned namespace is disabled but our types differ from those built
+		// with the default number of database tiers, keep their symbols apart
+		#define ACL_IMPL_VERSION_NAMESPACE_BEGIN \
+			inline namespace ACL_IMPL_TIERS_NAMESPACE_NAME \
+			{
+
+		#define ACL_IMPL_VERSION_NAMESPACE_END \
+			}
+	#else
+		#define ACL_IMPL_VERSION_NAMESPACE_BEGIN
+		#define ACL_IMPL_VERSION_NAMESPACE_END
+	#endif
 #elif defined(ACL_NO_INLINE_NAMESPACE)
 	// Namespace won't be inlined, its usage will have to be qualified with the
 	// full version everywhere
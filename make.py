@@ -50,6 +50,7 @@ def parse_argv():
 
 	misc = parser.add_argument_group(title='Miscellaneous')
 	misc.add_argument('-avx', dest='use_avx', action='store_true', help='Compile using AVX instructions on Windows, OS X, and Linux')
+	misc.add_argument('-avx8', dest='use_avx8', action='store_true', help='Compile using AVX instructions and the AVX 8 wide decompression code path')
 	misc.add_argument('-pop', dest='use_popcnt', action='store_true', help='Compile using the POPCNT instruction')
 	misc.add_argument('-nosimd', dest='use_simd', action='store_false', help='Compile without SIMD instructions')
 	misc.add_argument('-simd', dest='use_simd', action='store_true', help='Compile with default SIMD instructions')
@@ -66,7 +67,7 @@ def parse_argv():
 		num_threads = 4
 
 	parser.set_defaults(build=False, clean=False, clean_only=False, unit_test=False, regression_test=False, bench=False, run_bench=False, pull_bench=False,
-		compiler=None, config='Release', cpu=None, cpp_version='11', use_avx=False, use_popcnt=False, use_simd=True, use_sjson=True,
+		compiler=None, config='Release', cpu=None, cpp_version='11', use_avx=False, use_avx8=False, use_popcnt=False, use_simd=True, use_sjson=True,
 		num_threads=num_threads, tests_matching='')
 
 	args = parser.parse_args()
@@ -74,9 +75,13 @@ def parse_argv():
 	is_arm64_cpu = is_host_cpu_arm64()
 
 	# Sanitize and validate our options
+	if args.use_avx8:
+		args.use_avx = True
+
 	if args.use_avx and not args.use_simd:
 		print('SIMD is disabled; AVX cannot be used')
 		args.use_avx = False
+		args.use_avx8 = False
 
 	if args.compiler == 'android':
 		if not args.cpu:
@@ -336,6 +341,10 @@ def do_generate_solution(build_dir, cmake_script_dir, regression_test_data_dir,
 		print('Enabling AVX usage')
 		extra_switches.append('-DUSE_AVX_INSTRUCTIONS:BOOL=true')
 
+	if args.use_avx8:
+		print('Enabling AVX 8 wide decompression')
+		extra_switches.append('-DUSE_AVX_8_WIDE_DECOMP:BOOL=true')
+
 	if args.use_popcnt:
 		print('Enabling POPCOUNT usage')
 		extra_switches.append('-DUSE_POPCNT_INSTRUCTIONS:BOOL=true')
@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+#include <acl/compression/impl/scalar_segment_context.h>
+
+TEST_CASE("Scalar segment splitting", "[compression][impl]")
+{
+	// Segmenting is disabled
+	CHECK(acl::acl_impl::get_num_scalar_segments(0, 0) == 0);
+	CHECK(acl::acl_impl::get_num_scalar_segments(1000, 0) == 0);
+
+	// Not enough samples for more than a single segment
+	CHECK(acl::acl_impl::get_num_scalar_segments(0, 64) == 0);
+	CHECK(acl::acl_impl::get_num_scalar_segments(64, 64) == 0);
+	CHECK(acl::acl_impl::get_num_scalar_segments(127, 64) == 0);
+
+	// The last segment holds the remaining samples
+	CHECK(acl::acl_impl::get_num_scalar_segments(128, 64) == 2);
+	CHECK(acl::acl_impl::get_num_scalar_segments(191, 64) == 2);
+	CHECK(acl::acl_impl::get_num_scalar_segments(192, 64) == 3);
+}
+
+TEST_CASE("Scalar database segment splitting", "[compression][impl]")
+{
+	// Segments are always used unless the track list is empty
+	CHECK(acl::acl_impl::get_num_scalar_database_segments(0, 16) == 0);
+	CHECK(acl::acl_impl::get_num_scalar_database_segments(10, 16) == 1);
+	CHECK(acl::acl_impl::get_num_scalar_database_segments(31, 16) == 1);
+	CHECK(acl::acl_impl::get_num_scalar_database_segments(32, 16) == 2);
+
+	// The first sample is the MSB, segments that are too large cannot be stripped
+	CHECK(acl::acl_impl::get_scalar_segment_sample_indices(0) == 0);
+	CHECK(acl::acl_impl::get_scalar_segment_sample_indices(16) == 0xFFFF0000U);
+	CHECK(acl::acl_impl::get_scalar_segment_sample_indices(32) == 0xFFFFFFFFU);
+	CHECK(acl::acl_impl::get_scalar_segment_sample_indices(33) == 0);
+}
@@ -0,0 +1,244 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include <catch2/catch.hpp>
+
+#include <acl/core/buffer_tag.h>
+#include <acl/core/bulk_data_codec.h>
+
+#include <cstdint>
+#include <cstring>
+
+using namespace acl;
+
+// Worst case size of the compressed data, incompressible data is stored as a single sequence of literals
+static constexpr uint32_t calculate_max_compressed_size(uint32_t size) { return 1 + (size / 255) + 1 + size; }
+
+static bool lz_round_trip(const uint8_t* input, uint32_t input_size, uint32_t& out_compressed_size)
+{
+	uint8_t compressed[8 * 1024];
+	uint8_t decompressed[8 * 1024];
+	REQUIRE(calculate_max_compressed_size(input_size) <= sizeof(compressed));
+	REQUIRE(input_size <= sizeof(decompressed));
+
+	out_compressed_size = acl_impl::lz_compress(input, input_size, compressed, sizeof(compressed));
+	if (out_compressed_size == 0)
+		return false;
+
+	std::memset(decompressed, 0xCD, sizeof(decompressed));
+	if (!acl_impl::lz_decompress(compressed, out_compressed_size, decompressed, input_size))
+		return false;
+
+	return std::memcmp(decompressed, input, input_size) == 0;
+}
+
+TEST_CASE("lz codec round trip", "[core][bulk_data_codec]")
+{
+	uint8_t buffer[4096];
+	uint32_t compressed_size = 0;
+
+	{
+		// An empty chunk only holds the last sequence token
+		CHECK(lz_round_trip(buffer, 0, compressed_size));
+		CHECK(compressed_size == 1);
+	}
+
+	{
+		// Incompressible data is stored as literals
+		uint32_t state = 12345;
+		for (uint8_t& value : buffer)
+		{
+			state = (state * 1664525U) + 1013904223U;
+			value = uint8_t(state >> 24);
+		}
+
+		CHECK(lz_round_trip(buffer, sizeof(buffer), compressed_size));
+		CHECK(compressed_size >= sizeof(buffer));
+		CHECK(compressed_size <= calculate_max_compressed_size(sizeof(buffer)));
+
+		// The output buffer must hold the worst case
+		uint8_t compressed[64];
+		CHECK(acl_impl::lz_compress(buffer, sizeof(buffer), compressed, sizeof(compressed)) == 0);
+	}
+
+	{
+		// Fully repetitive data is a single match that overlaps with its own output
+		std::memset(buffer, 0xAB, sizeof(buffer));
+
+		CHECK(lz_round_trip(buffer, sizeof(buffer), compressed_size));
+		CHECK(compressed_size < 32);
+	}
+
+	{
+		// A repeating pattern shorter than the match overlaps as well
+		for (uint32_t index = 0; index < sizeof(buffer); ++index)
+			buffer[index] = uint8_t("abc"[index % 3]);
+
+		CHECK(lz_round_trip(buffer, sizeof(buffer), compressed_size));
+		CHECK(compressed_size < 32);
+	}
+
+	{
+		// Small chunks shorter than a match and literal runs that need extra length bytes
+		for (uint32_t index = 0; index < sizeof(buffer); ++index)
+			buffer[index] = uint8_t(index < 300 ? index * 13 : index % 7);
+
+		for (uint32_t size = 1; size < 8; ++size)
+			CHECK(lz_round_trip(buffer, size, compressed_size));
+
+		CHECK(lz_round_trip(buffer, sizeof(buffer), compressed_size));
+	}
+}
+
+TEST_CASE("lz codec rejects invalid input", "[core][bulk_data_codec]")
+{
+	uint8_t buffer[1024];
+	for (uint32_t index = 0; index < sizeof(buffer); ++index)
+		buffer[index] = uint8_t(index < 100 ? index * 13 : index % 5);
+
+	uint8_t compressed[calculate_max_compressed_size(sizeof(buffer))];
+	const uint32_t compressed_size = acl_impl::lz_compress(buffer, sizeof(buffer), compressed, sizeof(compressed));
+	REQUIRE(compressed_size != 0);
+
+	uint8_t decompressed[sizeof(buffer)];
+	REQUIRE(acl_impl::lz_decompress(compressed, compressed_size, decompressed, sizeof(buffer)));
+
+	// Every truncation is rejected
+	for (uint32_t size = 0; size < compressed_size; ++size)
+		CHECK(!acl_impl::lz_decompress(compressed, size, decompressed, sizeof(buffer)));
+
+	// The output must match the expected size exactly
+	CHECK(!acl_impl::lz_decompress(compressed, compressed_size, decompressed, sizeof(buffer) - 1));
+	CHECK(!acl_impl::lz_decompress(compressed, compressed_size, decompressed, 0));
+
+	{
+		// More literals than the input contains
+		const uint8_t corrupted[] = { 0x50, 'a', 'b' };
+		CHECK(!acl_impl::lz_decompress(corrupted, sizeof(corrupted), decompressed, 5));
+	}
+
+	{
+		// A match offset of zero
+		const uint8_t corrupted[] = { 0x10, 'a', 0x00, 0x00, 0x00 };
+		CHECK(!acl_impl::lz_decompress(corrupted, sizeof(corrupted), decompressed, 5));
+	}
+
+	{
+		// A match offset before the start of the output
+		const uint8_t corrupted[] = { 0x10, 'a', 0x02, 0x00, 0x00 };
+		CHECK(!acl_impl::lz_decompress(corrupted, sizeof(corrupted), decompressed, 5));
+	}
+
+	{
+		// A match longer than the output
+		const uint8_t corrupted[] = { 0x1F, 'a', 0x01, 0x00, 0x10, 0x00 };
+		CHECK(!acl_impl::lz_decompress(corrupted, sizeof(corrupted), decompressed, 8));
+	}
+
+	{
+		// A truncated length
+		const uint8_t corrupted[] = { 0xF0, 0xFF };
+		CHECK(!acl_impl::lz_decompress(corrupted, sizeof(corrupted), decompressed, 300));
+	}
+
+	{
+		// A valid stream for reference: 'a' followed by a match of 4 and the last sequence
+		const uint8_t valid[] = { 0x10, 'a', 0x01, 0x00, 0x00 };
+		CHECK(acl_impl::lz_decompress(valid, sizeof(valid), decompressed, 5));
+		CHECK(std::memcmp(decompressed, "aaaaa", 5) == 0);
+	}
+}
+
+TEST_CASE("decompress_database_bulk_data", "[core][bulk_data_codec]")
+{
+	constexpr uint32_t k_chunk_size = 256;
+	constexpr uint32_t k_bulk_data_size = 3 * k_chunk_size;
+
+	// Our first chunk is compressed, the second is stored as is, and the third is padding
+	uint8_t bulk_data[k_bulk_data_size] = { 0 };
+	for (uint32_t index = 0; index < k_chunk_size; ++index)
+	{
+		bulk_data[index] = uint8_t(index % 4);
+		bulk_data[k_chunk_size + index] = uint8_t(index * 151);
+	}
+
+	uint8_t compressed_bulk_data[1024];
+	acl_impl::compressed_bulk_data_header& header = *reinterpret_cast<acl_impl::compressed_bulk_data_header*>(&compressed_bulk_data[0]);
+	acl_impl::compressed_bulk_data_chunk* chunks = reinterpret_cast<acl_impl::compressed_bulk_data_chunk*>(&header + 1);
+
+	uint32_t offset = sizeof(acl_impl::compressed_bulk_data_header) + 2 * sizeof(acl_impl::compressed_bulk_data_chunk);
+
+	chunks[0].bulk_data_offset = 0;
+	chunks[0].size = k_chunk_size;
+	chunks[0].compressed_offset = offset;
+	chunks[0].compressed_size = acl_impl::lz_compress(bulk_data, k_chunk_size, compressed_bulk_data + offset, sizeof(compressed_bulk_data) - offset);
+	REQUIRE(chunks[0].compressed_size != 0);
+	REQUIRE(chunks[0].is_compressed());
+	offset += chunks[0].compressed_size;
+
+	chunks[1].bulk_data_offset = k_chunk_size;
+	chunks[1].size = k_chunk_size;
+	chunks[1].compressed_offset = offset;
+	chunks[1].compressed_size = k_chunk_size;
+	std::memcpy(compressed_bulk_data + offset, bulk_data + k_chunk_size, k_chunk_size);
+	offset += k_chunk_size;
+
+	header.tag = buffer_tag32::compressed_bulk_data;
+	header.num_chunks = 2;
+	header.bulk_data_size = k_bulk_data_size;
+	header.compressed_bulk_data_size = offset;
+
+	uint8_t decompressed[k_bulk_data_size];
+	std::memset(decompressed, 0xCD, sizeof(decompressed));
+	CHECK(decompress_database_bulk_data(compressed_bulk_data, offset, decompressed, k_bulk_data_size));
+	CHECK(std::memcmp(decompressed, bulk_data, k_bulk_data_size) == 0);
+
+	// The sizes must match
+	CHECK(!decompress_database_bulk_data(compressed_bulk_data, offset - 1, decompressed, k_bulk_data_size));
+	CHECK(!decompress_database_bulk_data(compressed_bulk_data, offset, decompressed, k_bulk_data_size - 1));
+	CHECK(!decompress_database_bulk_data(nullptr, offset, decompressed, k_bulk_data_size));
+
+	// A corrupted chunk is rejected, our first sequence is 4 literals followed by the offset of its match
+	// Corrupted literals decompress fine, the chunk hashes of the database catch those
+	REQUIRE(compressed_bulk_data[chunks[0].compressed_offset] >> 4 == 4);
+	compressed_bulk_data[chunks[0].compressed_offset + 6] ^= 0xFF;
+	CHECK(!decompress_database_bulk_data(compressed_bulk_data, offset, decompressed, k_bulk_data_size));
+	compressed_bulk_data[chunks[0].compressed_offset + 6] ^= 0xFF;
+
+	// A chunk outside of the bulk data is rejected
+	chunks[1].bulk_data_offset = k_bulk_data_size;
+	CHECK(!decompress_database_bulk_data(compressed_bulk_data, offset, decompressed, k_bulk_data_size));
+	chunks[1].bulk_data_offset = k_chunk_size;
+
+	// Too many chunks for the buffer
+	header.num_chunks = 0x10000000;
+	CHECK(!decompress_database_bulk_data(compressed_bulk_data, offset, decompressed, k_bulk_data_size));
+	header.num_chunks = 2;
+
+	// Other buffers are rejected
+	header.tag = buffer_tag32::compressed_database;
+	CHECK(!decompress_database_bulk_data(compressed_bulk_data, offset, decompressed, k_bulk_data_size));
+	header.tag = buffer_tag32::compressed_bulk_data;
+
+	CHECK(decompress_database_bulk_data(compressed_bulk_data, offset, decompressed, k_bulk_data_size));
+}
@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+#include <acl/core/hash.h>
+
+#include <cstdint>
+
+using namespace acl;
+
+TEST_CASE("fast_hash32", "[core][hash]")
+{
+	// Reference XXH32 values with a seed of 0
+	CHECK(fast_hash32("", 0) == 0x02CC5D05U);
+	CHECK(fast_hash32("abc", 3) == 0x32D153FFU);
+	CHECK(fast_hash32("Nobody inspects the spammish repetition", 39) == 0xE2293B2FU);
+
+	// Every size exercises the 16 byte blocks, the words, and the trailing bytes
+	uint8_t buffer[64];
+	for (uint32_t index = 0; index < 64; ++index)
+		buffer[index] = uint8_t(index * 7);
+
+	for (uint32_t size = 1; size < 64; ++size)
+	{
+		const uint32_t hash = fast_hash32(buffer, size);
+		CHECK(hash != fast_hash32(buffer, size - 1));
+
+		buffer[size - 1] ^= 0x01;
+		CHECK(hash != fast_hash32(buffer, size));
+		buffer[size - 1] ^= 0x01;
+
+		CHECK(hash == fast_hash32(buffer, size));
+	}
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <acl/compression/compress.h>
+#include <acl/compression/track.h>
+#include <acl/compression/track_array.h>
+#include <acl/core/compressed_database.h>
+#include <acl/core/compressed_tracks.h>
+#include <acl/core/floating_point_exceptions.h>
+#include <acl/core/iallocator.h>
+#include <acl/core/impl/debug_track_writer.h>
+#include <acl/decompression/decompress.h>
+#include <acl/decompression/database/database.h>
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+// Helpers shared by the database unit tests, the clips are made of noisy float1f tracks
+// that do not compress well in order to fill several small database chunks.
+
+struct test_scalar_decompression_settings final : public acl::debug_scalar_decompression_settings
+{
+	using database_settings_type = acl::debug_database_settings;
+};
+
+constexpr float k_test_clip_sample_rate = 30.0F;
+
+// Returns a compressed clip with database support or nullptr if compression failed, free it with the allocator
+inline acl::compressed_tracks* make_test_clip(acl::iallocator& allocator, uint32_t seed, uint32_t num_tracks, uint32_t num_samples)
+{
+	acl::track_array track_list(allocator, num_tracks);
+
+	uint32_t state = (seed + 1) * 0x9E3779B9U;
+	for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+	{
+		acl::track_desc_scalarf desc;
+		desc.output_index = track_index;
+		desc.precision = 0.0001F;
+
+		acl::track_float1f track = acl::track_float1f::make_reserve(desc, allocator, num_samples, k_test_clip_sample_rate);
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			state = (state * 1664525U) + 1013904223U;
+			track[sample_index] = float(state >> 8) * (1.0F / 16777216.0F);
+		}
+
+		track_list[track_index] = std::move(track);
+	}
+
+	acl::compression_settings settings = acl::get_default_compression_settings();
+	settings.enable_database_support = true;
+
+	acl::output_stats stats;
+	acl::compressed_tracks* compressed_tracks = nullptr;
+	const acl::error_result result = acl::compress_track_list(allocator, track_list, settings, compressed_tracks, stats);
+	return result.empty() ? compressed_tracks : nullptr;
+}
+
+// Returns a database with inline bulk data that spreads the least important half of the samples over
+// the medium and low importance tiers, or nullptr if it failed to build. The clips bound to it are
+// written to 'out_db_clips'.
+inline acl::compressed_database* make_test_database(acl::iallocator& allocator, const acl::compressed_tracks* const* clips, uint32_t num_clips, acl::compressed_tracks** out_db_clips)
+{
+	acl::compression_database_settings settings;
+	settings.medium_importance_tier_proportion = 0.25F;
+	settings.low_importance_tier_proportion = 0.25F;
+	settings.max_chunk_size = 4 * 1024;
+
+	acl::compressed_database* database = nullptr;
+	const acl::error_result result = acl::build_database(allocator, settings, clips, num_clips, out_db_clips, database);
+	return result.empty() ? database : nullptr;
+}
+
+// Returns the size of the tier bulk data that holds chunks, streamers never read the padding that follows
+inline uint32_t get_test_chunk_data_size(const acl::compressed_database& db, acl::quality_tier tier)
+{
+	const uint32_t num_chunks = db.get_num_chunks(tier);
+	if (num_chunks == 0)
+		return 0;
+
+	const acl::acl_impl::database_chunk_description& last_chunk = acl::acl_impl::get_database_header(db).get_chunk_descriptions(uint32_t(tier) - 1)[num_chunks - 1];
+	return last_chunk.offset + last_chunk.size;
+}
+
+// Decompresses every sample of the clip bound to the context, 'out_values' holds num_samples * num_tracks values
+template<class decompression_context_type>
+inline void decompress_test_clip(acl::iallocator& allocator, decompression_context_type& context, float* out_values)
+{
+	// Disable floating point exceptions since decompression assumes it
+	acl::scope_disable_fp_exceptions fp_off;
+
+	const acl::compressed_tracks& tracks = *context.get_compressed_tracks();
+	const uint32_t num_tracks = tracks.get_num_tracks();
+	const uint32_t num_samples = tracks.get_num_samples_per_track();
+
+	acl::acl_impl::debug_track_writer writer(allocator, acl::track_type8::float1f, num_tracks);
+
+	for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+	{
+		context.seek(float(sample_index) / tracks.get_sample_rate(), acl::sample_rounding_policy::nearest);
+		context.decompress_tracks(writer);
+
+		std::memcpy(out_values + (sample_index * num_tracks), writer.tracks_typed.float1f, num_tracks * sizeof(float));
+	}
+}
@@ -0,0 +1,860 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch2/catch.hpp>
+
+#include "database_test_utils.h"
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/core/bitset.h>
+#include <acl/decompression/database/database.h>
+#include <acl/decompression/database/database_budget_manager.h>
+#include <acl/decompression/database/database_usage_trace.h>
+#include <acl/decompression/database/impl/debug_database_streamer.h>
+
+#include <cstdint>
+#include <cstring>
+
+using namespace acl;
+
+TEST_CASE("database chunk bitsets", "[decompression][database]")
+{
+	constexpr uint32_t k_num_chunks = 40;
+	const bitset_description desc = bitset_description::make_from_num_bits(k_num_chunks);
+
+	uint32_t loaded_chunks[2] = { 0, 0 };
+	uint32_t streaming_chunks[2] = { 0, 0 };
+
+	acl_impl::chunk_bitset_set_range(loaded_chunks, desc, 30, 4, true);
+	CHECK(loaded_chunks[0] == 0x00000003U);
+	CHECK(loaded_chunks[1] == 0xC0000000U);
+	CHECK(acl_impl::chunk_bitset_count_set_bits(loaded_chunks, desc) == 4);
+
+	acl_impl::chunk_bitset_set_range(loaded_chunks, desc, 31, 2, false);
+	CHECK(loaded_chunks[0] == 0x00000002U);
+	CHECK(loaded_chunks[1] == 0x40000000U);
+
+	acl_impl::chunk_bitset_set_range(loaded_chunks, desc, 0, 32, true);
+	CHECK(loaded_chunks[0] == 0xFFFFFFFFU);
+
+	// Chunks [0, 32) are loaded, [32, 34) are streaming in, [34, 40) aren't loaded
+	acl_impl::chunk_bitset_set_range(loaded_chunks, desc, 32, 8, false);
+	acl_impl::chunk_bitset_set_range(streaming_chunks, desc, 32, 2, true);
+
+	uint32_t first_chunk_index = ~0U;
+	CHECK(acl_impl::find_streamable_chunk_range(loaded_chunks, streaming_chunks, k_num_chunks, false, ~0U, first_chunk_index) == 6);
+	CHECK(first_chunk_index == 34);
+
+	CHECK(acl_impl::find_streamable_chunk_range(loaded_chunks, streaming_chunks, k_num_chunks, false, 2, first_chunk_index) == 2);
+	CHECK(first_chunk_index == 34);
+
+	// Chunks [4, 8) are streaming out
+	acl_impl::chunk_bitset_set_range(streaming_chunks, desc, 4, 4, true);
+
+	CHECK(acl_impl::find_streamable_chunk_range(loaded_chunks, streaming_chunks, k_num_chunks, true, ~0U, first_chunk_index) == 4);
+	CHECK(first_chunk_index == 0);
+
+	acl_impl::chunk_bitset_set_range(loaded_chunks, desc, 0, 4, false);
+	CHECK(acl_impl::find_streamable_chunk_range(loaded_chunks, streaming_chunks, k_num_chunks, true, ~0U, first_chunk_index) == 24);
+	CHECK(first_chunk_index == 8);
+
+	// A request that completes out of order leaves a gap
+	acl_impl::chunk_bitset_set_range(loaded_chunks, desc, 34, 6, true);
+	CHECK(acl_impl::find_streamable_chunk_range(loaded_chunks, streaming_chunks, k_num_chunks, false, ~0U, first_chunk_index) == 4);
+	CHECK(first_chunk_index == 0);
+
+	// Nothing left to stream in, the padding bits are ignored
+	acl_impl::chunk_bitset_set_range(loaded_chunks, desc, 0, 4, true);
+	CHECK(acl_impl::find_streamable_chunk_range(loaded_chunks, streaming_chunks, k_num_chunks, false, ~0U, first_chunk_index) == 0);
+}
+
+TEST_CASE("database budget manager", "[decompression][database]")
+{
+	ansi_allocator allocator;
+
+	database_budget_settings settings;
+	settings.budget_size = 1024 * 1024;
+
+	database_budget_manager<default_database_settings> manager;
+	CHECK(!manager.is_initialized());
+	CHECK(manager.initialize(allocator, settings, 4));
+	CHECK(manager.is_initialized());
+	CHECK(manager.get_num_databases() == 0);
+	CHECK(manager.get_budget_size() == settings.budget_size);
+
+	manager.set_budget_size(2 * 1024 * 1024);
+	CHECK(manager.get_budget_size() == 2 * 1024 * 1024);
+
+	// Updating without databases does nothing
+	manager.update();
+	manager.update();
+	CHECK(manager.get_stats().num_updates == 2);
+	CHECK(manager.get_stats().num_over_budget_updates == 0);
+	CHECK(manager.get_stats().num_stream_in_requests == 0);
+	CHECK(manager.get_stats().num_stream_out_requests == 0);
+	CHECK(manager.get_stats().resident_size == 0);
+
+	manager.reset();
+	CHECK(!manager.is_initialized());
+}
+
+// Returns the size of the chunks that hold the samples of a clip for a tier
+static uint32_t calculate_test_clip_tier_size(const compressed_database& db, quality_tier tier, uint32_t clip_index)
+{
+	const acl_impl::database_header& header = acl_impl::get_database_header(db);
+	const uint32_t tier_index = uint32_t(tier) - 1;
+	const acl_impl::database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
+	const acl_impl::database_clip_chunk_range& clip_chunk_range = header.get_clip_chunk_ranges()[clip_index];
+
+	uint32_t size = 0;
+	for (uint32_t chunk_index = 0; chunk_index < clip_chunk_range.num_chunks[tier_index]; ++chunk_index)
+		size += chunk_descriptions[clip_chunk_range.first_chunk_index[tier_index] + chunk_index].size;
+
+	return size;
+}
+
+TEST_CASE("database budget manager streaming", "[decompression][database]")
+{
+	constexpr uint32_t k_num_clips = 4;
+	constexpr uint32_t k_num_tracks = 32;
+	constexpr uint32_t k_num_samples = 512;
+
+	ansi_allocator allocator;
+
+	compressed_tracks* clips[k_num_clips];
+	for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+	{
+		clips[clip_index] = make_test_clip(allocator, clip_index, k_num_tracks, k_num_samples);
+		REQUIRE(clips[clip_index] != nullptr);
+	}
+
+	compressed_tracks* db_clips[k_num_clips] = { nullptr };
+	compressed_database* db = make_test_database(allocator, clips, k_num_clips, db_clips);
+	REQUIRE(db != nullptr);
+
+	// Our clips span multiple chunks, the first chunk of the first clip and the chunks of its neighbor
+	// are only released once both clips are
+	const acl_impl::database_clip_chunk_range* clip_chunk_ranges = acl_impl::get_database_header(*db).get_clip_chunk_ranges();
+	REQUIRE(clip_chunk_ranges != nullptr);
+
+	for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+	{
+		for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+			REQUIRE(clip_chunk_ranges[clip_index].num_chunks[tier_index] >= 2);
+	}
+
+	compressed_database* split_db = nullptr;
+	uint8_t* bulk_data_medium = nullptr;
+	uint8_t* bulk_data_low = nullptr;
+	REQUIRE(split_database_bulk_data(allocator, *db, split_db, bulk_data_medium, bulk_data_low).empty());
+
+	uint64_t total_size = 0;
+	for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+	{
+		const acl_impl::database_chunk_description* chunk_descriptions = acl_impl::get_database_header(*split_db).get_chunk_descriptions(tier_index);
+		for (uint32_t chunk_index = 0; chunk_index < split_db->get_num_chunks(quality_tier(tier_index + 1)); ++chunk_index)
+			total_size += chunk_descriptions[chunk_index].size;
+	}
+
+	// Seeking records when a clip is used, seeking twice to the same time is skipped so we move forward every time
+	uint32_t num_seeks = 0;
+	auto use_clip = [&num_seeks](decompression_context<test_scalar_decompression_settings>& context)
+	{
+		scope_disable_fp_exceptions fp_off;
+		context.seek(float(++num_seeks) / k_test_clip_sample_rate, sample_rounding_policy::nearest);
+	};
+
+	{
+		// The least recently used clips are streamed out first, lowest importance tier first
+		debug_database_streamer medium_streamer(allocator, bulk_data_medium, split_db->get_bulk_data_size(quality_tier::medium_importance));
+		debug_database_streamer low_streamer(allocator, bulk_data_low, split_db->get_bulk_data_size(quality_tier::lowest_importance));
+
+		database_context<debug_database_settings> db_context;
+		REQUIRE(db_context.initialize(allocator, *split_db, medium_streamer, low_streamer));
+
+		decompression_context<test_scalar_decompression_settings> contexts[k_num_clips];
+		for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+			REQUIRE(contexts[clip_index].initialize(*db_clips[clip_index], db_context));
+
+		database_budget_settings settings;
+		settings.budget_size = total_size;
+
+		database_budget_manager<debug_database_settings> manager;
+		REQUIRE(manager.initialize(allocator, settings));
+		REQUIRE(manager.register_database(db_context));
+
+		// Everything fits
+		for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+			use_clip(contexts[clip_index]);
+
+		manager.update();
+		CHECK(db_context.is_streamed_in(quality_tier::medium_importance));
+		CHECK(db_context.is_streamed_in(quality_tier::lowest_importance));
+		CHECK(manager.get_stats().resident_size == total_size);
+		CHECK(manager.get_stats().bulk_data_size == uint64_t(split_db->get_bulk_data_size(quality_tier::medium_importance)) + split_db->get_bulk_data_size(quality_tier::lowest_importance));
+		CHECK(manager.get_stats().num_stream_out_requests == 0);
+
+		// Our clips are used in order, the first is the least recently used
+		for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+		{
+			use_clip(contexts[clip_index]);
+			manager.update();
+		}
+
+		const uint64_t num_stream_in_requests = manager.get_stats().num_stream_in_requests;
+		CHECK(manager.get_stats().resident_size == total_size);
+		CHECK(manager.get_stats().num_over_budget_updates == 0);
+
+		// Releasing the first clip is enough
+		manager.set_budget_size(total_size - 1);
+		manager.update();
+		CHECK(manager.get_stats().num_over_budget_updates == 1);
+		CHECK(manager.get_stats().num_stream_out_requests == 1);
+		CHECK(manager.get_stats().resident_size <= total_size - 1);
+		CHECK(!db_context.is_streamed_in(quality_tier::lowest_importance, *db_clips[0]));
+		CHECK(db_context.is_streamed_in(quality_tier::medium_importance, *db_clips[0]));
+		for (uint32_t clip_index = 1; clip_index < k_num_clips; ++clip_index)
+			CHECK(db_context.is_streamed_in(quality_tier::lowest_importance, *db_clips[clip_index]));
+
+		// The first clip has nothing left to release in the lowest importance tier, the second clip goes next
+		const uint64_t resident_size = manager.get_stats().resident_size;
+		manager.set_budget_size(resident_size - 1);
+		manager.update();
+		CHECK(manager.get_stats().num_over_budget_updates == 2);
+		CHECK(manager.get_stats().num_stream_out_requests == 2);
+		CHECK(manager.get_stats().resident_size < resident_size);
+		CHECK(!db_context.is_streamed_in(quality_tier::lowest_importance, *db_clips[1]));
+		CHECK(db_context.is_streamed_in(quality_tier::medium_importance, *db_clips[1]));
+		CHECK(db_context.is_streamed_in(quality_tier::lowest_importance, *db_clips[2]));
+		CHECK(db_context.is_streamed_in(quality_tier::lowest_importance, *db_clips[3]));
+
+		// Nothing streamed back in since it doesn't fit
+		CHECK(manager.get_stats().num_stream_in_requests == num_stream_in_requests);
+
+		// Chunks still count as resident while their stream out is deferred, but they aren't evicted twice
+		const uint64_t resident_size_before_scope = manager.get_stats().resident_size;
+		manager.set_budget_size(resident_size_before_scope - 1);
+		{
+			database_decompression_scope scope(db_context);
+
+			manager.update();
+			CHECK(manager.get_stats().num_stream_out_requests == 3);
+			CHECK(manager.get_stats().resident_size == resident_size_before_scope);
+			CHECK(!db_context.is_streamed_in(quality_tier::lowest_importance, *db_clips[2]));
+
+			manager.update();
+			CHECK(manager.get_stats().num_over_budget_updates == 4);
+			CHECK(manager.get_stats().num_stream_out_requests == 3);
+			CHECK(manager.get_stats().resident_size == resident_size_before_scope);
+			CHECK(db_context.is_streamed_in(quality_tier::lowest_importance, *db_clips[3]));
+		}
+
+		manager.update();
+		CHECK(manager.get_stats().num_stream_out_requests == 3);
+		CHECK(manager.get_stats().resident_size <= resident_size_before_scope - 1);
+		CHECK(db_context.is_streamed_in(quality_tier::lowest_importance, *db_clips[3]));
+
+		manager.unregister_database(db_context);
+	}
+
+	{
+		// The most recently used clips are streamed in first while they fit, medium importance tier first
+		debug_database_streamer medium_streamer(allocator, bulk_data_medium, split_db->get_bulk_data_size(quality_tier::medium_importance));
+		debug_database_streamer low_streamer(allocator, bulk_data_low, split_db->get_bulk_data_size(quality_tier::lowest_importance));
+
+		database_context<debug_database_settings> db_context;
+		REQUIRE(db_context.initialize(allocator, *split_db, medium_streamer, low_streamer));
+
+		decompression_context<test_scalar_decompression_settings> contexts[k_num_clips];
+		for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+			REQUIRE(contexts[clip_index].initialize(*db_clips[clip_index], db_context));
+
+		database_budget_settings settings;
+		settings.budget_size = 0;
+		settings.max_num_idle_updates = 2;
+
+		database_budget_manager<debug_database_settings> manager;
+		REQUIRE(manager.initialize(allocator, settings));
+		REQUIRE(manager.register_database(db_context));
+
+		// Nothing fits
+		for (uint32_t clip_index = 0; clip_index < k_num_clips - 1; ++clip_index)
+		{
+			use_clip(contexts[clip_index]);
+			manager.update();
+		}
+
+		CHECK(manager.get_stats().num_stream_in_requests == 0);
+		CHECK(manager.get_stats().resident_size == 0);
+
+		// Only the medium importance tier of the last clip fits
+		const uint32_t last_clip_size = calculate_test_clip_tier_size(*split_db, quality_tier::medium_importance, k_num_clips - 1);
+		manager.set_budget_size(last_clip_size);
+
+		use_clip(contexts[k_num_clips - 1]);
+		manager.update();
+		CHECK(manager.get_stats().num_stream_in_requests == 1);
+		CHECK(manager.get_stats().resident_size == last_clip_size);
+		CHECK(db_context.is_streamed_in(quality_tier::medium_importance, *db_clips[k_num_clips - 1]));
+		CHECK(!db_context.is_streamed_in(quality_tier::lowest_importance, *db_clips[k_num_clips - 1]));
+		CHECK(!db_context.is_streamed_in(quality_tier::medium_importance, *db_clips[k_num_clips - 2]));
+
+		// Everything fits but the first clips have been idle for too long
+		manager.set_budget_size(total_size);
+		manager.update();
+		CHECK(manager.get_stats().num_over_budget_updates == 0);
+		CHECK(manager.get_stats().num_stream_out_requests == 0);
+		CHECK(manager.get_stats().resident_size < total_size);
+		CHECK(db_context.is_streamed_in(quality_tier::medium_importance, *db_clips[k_num_clips - 1]));
+		CHECK(db_context.is_streamed_in(quality_tier::lowest_importance, *db_clips[k_num_clips - 1]));
+		CHECK(db_context.is_streamed_in(quality_tier::medium_importance, *db_clips[k_num_clips - 2]));
+		CHECK(db_context.is_streamed_in(quality_tier::lowest_importance, *db_clips[k_num_clips - 2]));
+		CHECK(!db_context.is_streamed_in(quality_tier::medium_importance, *db_clips[0]));
+		CHECK(!db_context.is_streamed_in(quality_tier::lowest_importance, *db_clips[0]));
+
+		// The tracked resident size matches what the manager streamed in
+		const uint64_t resident_size = manager.get_stats().resident_size;
+		manager.update();
+		CHECK(manager.get_stats().resident_size == resident_size);
+
+		manager.unregister_database(db_context);
+	}
+
+	allocator.deallocate(bulk_data_medium, split_db->get_bulk_data_size(quality_tier::medium_importance));
+	allocator.deallocate(bulk_data_low, split_db->get_bulk_data_size(quality_tier::lowest_importance));
+	allocator.deallocate(split_db, split_db->get_size());
+	allocator.deallocate(db, db->get_size());
+
+	for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+	{
+		allocator.deallocate(db_clips[clip_index], db_clips[clip_index]->get_size());
+		allocator.deallocate(clips[clip_index], clips[clip_index]->get_size());
+	}
+}
+
+TEST_CASE("database seek after stream out", "[decompression][database]")
+{
+	constexpr uint32_t k_num_tracks = 16;
+	constexpr uint32_t k_num_samples = 128;
+	constexpr uint32_t k_num_values = k_num_tracks * k_num_samples;
+
+	ansi_allocator allocator;
+
+	compressed_tracks* clip = make_test_clip(allocator, 0, k_num_tracks, k_num_samples);
+	REQUIRE(clip != nullptr);
+
+	compressed_tracks* db_clip = nullptr;
+	compressed_database* db = make_test_database(allocator, &clip, 1, &db_clip);
+	REQUIRE(db != nullptr);
+
+	compressed_database* split_db = nullptr;
+	uint8_t* bulk_data_medium = nullptr;
+	uint8_t* bulk_data_low = nullptr;
+	REQUIRE(split_database_bulk_data(allocator, *db, split_db, bulk_data_medium, bulk_data_low).empty());
+
+	float* full_values = allocate_type_array<float>(allocator, k_num_values);
+	float* values = allocate_type_array<float>(allocator, k_num_values);
+
+	{
+		debug_database_streamer medium_streamer(allocator, bulk_data_medium, split_db->get_bulk_data_size(quality_tier::medium_importance));
+		debug_database_streamer low_streamer(allocator, bulk_data_low, split_db->get_bulk_data_size(quality_tier::lowest_importance));
+
+		database_context<debug_database_settings> db_context;
+		REQUIRE(db_context.initialize(allocator, *split_db, medium_streamer, low_streamer));
+
+		decompression_context<test_scalar_decompression_settings> context;
+		REQUIRE(context.initialize(*db_clip, db_context));
+
+		// Our reference values with only the samples that live in the clip
+		decompress_test_clip(allocator, context, values);
+
+		CHECK(db_context.stream_in(quality_tier::medium_importance) == database_stream_request_result::dispatched);
+		CHECK(db_context.stream_in(quality_tier::lowest_importance) == database_stream_request_result::dispatched);
+		decompress_test_clip(allocator, context, full_values);
+
+		// Find a sample that lives in the database
+		uint32_t sample_index = k_num_samples;
+		for (uint32_t sample_index_ = 0; sample_index_ < k_num_samples && sample_index == k_num_samples; ++sample_index_)
+		{
+			if (std::memcmp(values + (sample_index_ * k_num_tracks), full_values + (sample_index_ * k_num_tracks), k_num_tracks * sizeof(float)) != 0)
+				sample_index = sample_index_;
+		}
+
+		REQUIRE(sample_index < k_num_samples);
+
+		const float sample_time = float(sample_index) / k_test_clip_sample_rate;
+		acl_impl::debug_track_writer writer(allocator, track_type8::float1f, k_num_tracks);
+
+		{
+			database_decompression_scope scope(db_context);
+
+			scope_disable_fp_exceptions fp_off;
+			context.seek(sample_time, sample_rounding_policy::nearest);
+			context.decompress_tracks(writer);
+			CHECK(std::memcmp(writer.tracks_typed.float1f, full_values + (sample_index * k_num_tracks), k_num_tracks * sizeof(float)) == 0);
+
+			// Our chunks are released once our scope ends
+			CHECK(db_context.stream_out(quality_tier::medium_importance) == database_stream_request_result::dispatched);
+			CHECK(db_context.stream_out(quality_tier::lowest_importance) == database_stream_request_result::dispatched);
+			CHECK(medium_streamer.get_bulk_data(quality_tier::medium_importance) != nullptr);
+		}
+
+		CHECK(db_context.dispatch_deferred_stream_outs() == 0);
+		CHECK(medium_streamer.get_bulk_data(quality_tier::medium_importance) == nullptr);
+		CHECK(low_streamer.get_bulk_data(quality_tier::lowest_importance) == nullptr);
+
+		// Seeking to the same time no longer uses the chunks that streamed out
+		{
+			database_decompression_scope scope(db_context);
+
+			scope_disable_fp_exceptions fp_off;
+			context.seek(sample_time, sample_rounding_policy::nearest);
+			context.decompress_tracks(writer);
+			CHECK(std::memcmp(writer.tracks_typed.float1f, values + (sample_index * k_num_tracks), k_num_tracks * sizeof(float)) == 0);
+		}
+	}
+
+	deallocate_type_array(allocator, values, k_num_values);
+	deallocate_type_array(allocator, full_values, k_num_values);
+
+	allocator.deallocate(bulk_data_medium, split_db->get_bulk_data_size(quality_tier::medium_importance));
+	allocator.deallocate(bulk_data_low, split_db->get_bulk_data_size(quality_tier::lowest_importance));
+	allocator.deallocate(split_db, split_db->get_size());
+	allocator.deallocate(db, db->get_size());
+	allocator.deallocate(db_clip, db_clip->get_size());
+	allocator.deallocate(clip, clip->get_size());
+}
+
+// Streams in with memcpy like the debug streamer but cancels requests whose chunks fail verification
+class verifying_test_database_streamer final : public database_streamer
+{
+public:
+	verifying_test_database_streamer(iallocator& allocator, const uint8_t* bulk_data, uint32_t bulk_data_size)
+		: database_streamer(m_requests, k_num_database_tiers)
+		, m_allocator(allocator)
+		, m_src_bulk_data(bulk_data)
+		, m_streamed_bulk_data(nullptr)
+		, m_bulk_data_size(bulk_data_size)
+		, m_num_corrupted_requests(0)
+	{
+	}
+
+	virtual ~verifying_test_database_streamer() override
+	{
+		deallocate_type_array(m_allocator, m_streamed_bulk_data, m_bulk_data_size);
+	}
+
+	virtual bool is_initialized() const override { return true; }
+	virtual const uint8_t* get_bulk_data(quality_tier /*tier*/) const override { return m_streamed_bulk_data; }
+
+	virtual void stream_in(uint32_t offset, uint32_t size, bool /*can_allocate_bulk_data*/, quality_tier /*tier*/, streaming_request_id request_id) override
+	{
+		// A canceled first request leaves the bulk data allocated, it is reused by the next one
+		if (m_streamed_bulk_data == nullptr)
+			m_streamed_bulk_data = allocate_type_array<uint8_t>(m_allocator, m_bulk_data_size);
+
+		std::memcpy(m_streamed_bulk_data + offset, m_src_bulk_data + offset, size);
+
+		if (verify(request_id))
+			complete(request_id);
+		else
+		{
+			m_num_corrupted_requests++;
+			cancel(request_id);
+		}
+	}
+
+	virtual void stream_out(uint32_t /*offset*/, uint32_t /*size*/, bool can_deallocate_bulk_data, quality_tier /*tier*/, streaming_request_id request_id) override
+	{
+		if (can_deallocate_bulk_data)
+		{
+			deallocate_type_array(m_allocator, m_streamed_bulk_data, m_bulk_data_size);
+			m_streamed_bulk_data = nullptr;
+		}
+
+		complete(request_id);
+	}
+
+	uint32_t get_num_corrupted_requests() const { return m_num_corrupted_requests; }
+
+private:
+	verifying_test_database_streamer(const verifying_test_database_streamer&) = delete;
+	verifying_test_database_streamer& operator=(const verifying_test_database_streamer&) = delete;
+
+	iallocator& m_allocator;
+	const uint8_t* m_src_bulk_data;
+	uint8_t* m_streamed_bulk_data;
+	uint32_t m_bulk_data_size;
+	uint32_t m_num_corrupted_requests;
+
+	streaming_request m_requests[k_num_database_tiers];
+};
+
+TEST_CASE("database chunk verification", "[decompression][database]")
+{
+	constexpr uint32_t k_num_clips = 4;
+	constexpr uint32_t k_num_tracks = 32;
+	constexpr uint32_t k_num_samples = 512;
+
+	ansi_allocator allocator;
+
+	compressed_tracks* clips[k_num_clips];
+	for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+	{
+		clips[clip_index] = make_test_clip(allocator, clip_index, k_num_tracks, k_num_samples);
+		REQUIRE(clips[clip_index] != nullptr);
+	}
+
+	compressed_tracks* db_clips[k_num_clips] = { nullptr };
+	compressed_database* db = make_test_database(allocator, clips, k_num_clips, db_clips);
+	REQUIRE(db != nullptr);
+	REQUIRE(db->get_num_chunks(quality_tier::lowest_importance) >= 2);
+
+	compressed_database* split_db = nullptr;
+	uint8_t* bulk_data_medium = nullptr;
+	uint8_t* bulk_data_low = nullptr;
+	REQUIRE(split_database_bulk_data(allocator, *db, split_db, bulk_data_medium, bulk_data_low).empty());
+
+	const uint32_t bulk_data_low_size = split_db->get_bulk_data_size(quality_tier::lowest_importance);
+
+	// Flip a single bit in the middle of the second chunk
+	const acl_impl::database_chunk_description& chunk_description = acl_impl::get_database_header(*split_db).get_chunk_descriptions(1)[1];
+	const uint32_t corrupted_offset = chunk_description.offset + (chunk_description.size / 2);
+
+	{
+		debug_database_streamer medium_streamer(allocator, bulk_data_medium, split_db->get_bulk_data_size(quality_tier::medium_importance));
+		verifying_test_database_streamer low_streamer(allocator, bulk_data_low, bulk_data_low_size);
+
+		database_context<debug_database_settings> db_context;
+		REQUIRE(db_context.initialize(allocator, *split_db, medium_streamer, low_streamer));
+
+		// The first chunk is intact
+		CHECK(db_context.stream_in(quality_tier::lowest_importance, 1) == database_stream_request_result::dispatched);
+		CHECK(!db_context.is_streaming(quality_tier::lowest_importance));
+		CHECK(low_streamer.get_num_corrupted_requests() == 0);
+
+		bulk_data_low[corrupted_offset] ^= 0x01;
+
+		// The second chunk no longer matches its hash, the request is canceled
+		CHECK(db_context.stream_in(quality_tier::lowest_importance, 1) == database_stream_request_result::dispatched);
+		CHECK(!db_context.is_streaming(quality_tier::lowest_importance));
+		CHECK(!db_context.is_streamed_in(quality_tier::lowest_importance));
+		CHECK(low_streamer.get_num_corrupted_requests() == 1);
+
+		bulk_data_low[corrupted_offset] ^= 0x01;
+
+		// Once repaired, the remaining chunks stream in
+		CHECK(db_context.stream_in(quality_tier::lowest_importance) == database_stream_request_result::dispatched);
+		CHECK(db_context.is_streamed_in(quality_tier::lowest_importance));
+		CHECK(low_streamer.get_num_corrupted_requests() == 1);
+		CHECK(std::memcmp(low_streamer.get_bulk_data(quality_tier::lowest_importance), bulk_data_low, get_test_chunk_data_size(*split_db, quality_tier::lowest_importance)) == 0);
+
+		CHECK(db_context.stream_out(quality_tier::lowest_importance) == database_stream_request_result::dispatched);
+		CHECK(low_streamer.get_bulk_data(quality_tier::lowest_importance) == nullptr);
+	}
+
+	allocator.deallocate(bulk_data_medium, split_db->get_bulk_data_size(quality_tier::medium_importance));
+	allocator.deallocate(bulk_data_low, bulk_data_low_size);
+	allocator.deallocate(split_db, split_db->get_size());
+	allocator.deallocate(db, db->get_size());
+
+	for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+	{
+		allocator.deallocate(db_clips[clip_index], db_clips[clip_index]->get_size());
+		allocator.deallocate(clips[clip_index], clips[clip_index]->get_size());
+	}
+}
+
+TEST_CASE("database usage trace", "[decompression][database]")
+{
+	ansi_allocator allocator;
+
+	database_usage_trace trace;
+	CHECK(!trace.is_initialized());
+	CHECK(trace.initialize(allocator, 2, 3));
+	CHECK(trace.is_initialized());
+	CHECK(trace.get_num_edges() == 0);
+
+	// Clips 1 and 4 are used together twice, clip 2 once with both
+	const uint32_t sample0[] = { 4, 1 };
+	const uint32_t sample1[] = { 1, 4, 2 };
+	trace.record_clips(sample0, 2);
+	trace.record_clips(sample1, 3);
+	CHECK(trace.get_num_samples() == 2);
+	CHECK(trace.get_num_edges() == 2);
+	CHECK(trace.get_num_dropped_edges() == 1);
+
+	database_clip_co_usage edges[4];
+	CHECK(trace.get_edges(edges, 4) == 2);
+	CHECK(edges[0].clip_index0 == 1);
+	CHECK(edges[0].clip_index1 == 4);
+	CHECK(edges[0].weight == 2);
+	CHECK(edges[1].clip_index0 == 1);
+	CHECK(edges[1].clip_index1 == 2);
+	CHECK(edges[1].weight == 1);
+
+	// Only the heaviest edges are written when the buffer is too small
+	CHECK(trace.get_edges(edges, 1) == 1);
+	CHECK(edges[0].weight == 2);
+
+	// Samples are truncated and clips used twice are ignored
+	const uint32_t sample2[] = { 3, 3, 5, 6 };
+	trace.clear();
+	trace.record_clips(sample2, 4);
+	CHECK(trace.get_num_edges() == 1);
+	CHECK(trace.get_num_dropped_edges() == 0);
+
+	trace.reset();
+	CHECK(!trace.is_initialized());
+}
+
+TEST_CASE("database clip lookup", "[decompression][database]")
+{
+	constexpr uint32_t k_num_clips = 12;
+
+	ansi_allocator allocator;
+
+	compressed_tracks* clips[k_num_clips + 1];
+	for (uint32_t clip_index = 0; clip_index < k_num_clips + 1; ++clip_index)
+	{
+		clips[clip_index] = make_test_clip(allocator, clip_index, 2, 32);
+		REQUIRE(clips[clip_index] != nullptr);
+	}
+
+	compressed_tracks* db_clips[k_num_clips] = { nullptr };
+	compressed_database* db = make_test_database(allocator, clips, k_num_clips, db_clips);
+	REQUIRE(db != nullptr);
+	REQUIRE(acl_impl::get_database_header(*db).get_clip_hash_index() != nullptr);
+
+	// The last clip lives in its own database
+	compressed_tracks* other_db_clip = nullptr;
+	compressed_database* other_db = make_test_database(allocator, &clips[k_num_clips], 1, &other_db_clip);
+	REQUIRE(other_db != nullptr);
+
+	database_context<debug_database_settings> db_context;
+	REQUIRE(db_context.initialize(allocator, *db));
+
+	// Every clip is found through the hash index
+	for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+	{
+		CHECK(db->contains(*db_clips[clip_index]));
+		CHECK(db_context.contains(*db_clips[clip_index]));
+	}
+
+	// Clips that aren't bound to a database or that are bound to another one are missing
+	CHECK(!db->contains(*clips[0]));
+	CHECK(!db->contains(*other_db_clip));
+	CHECK(!db_context.contains(*other_db_clip));
+	CHECK(other_db->contains(*other_db_clip));
+	CHECK(!other_db->contains(*db_clips[0]));
+
+	// Removed clips are missing while the others are still found
+	const compressed_tracks* removed_clips[2] = { db_clips[3], db_clips[7] };
+	compressed_database* removed_db = nullptr;
+	REQUIRE(remove_from_database(allocator, *db, removed_clips, 2, removed_db).empty());
+	REQUIRE(acl_impl::get_database_header(*removed_db).get_clip_hash_index() != nullptr);
+
+	database_context<debug_database_settings> removed_db_context;
+	REQUIRE(removed_db_context.initialize(allocator, *removed_db));
+
+	for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+	{
+		const bool is_removed = clip_index == 3 || clip_index == 7;
+		CHECK(removed_db->contains(*db_clips[clip_index]) == !is_removed);
+		CHECK(removed_db_context.contains(*db_clips[clip_index]) == !is_removed);
+	}
+
+	CHECK(!removed_db->contains(*other_db_clip));
+
+	// Removing clips from a database without its bulk data keeps the segment streaming metadata
+	compressed_database* split_db = nullptr;
+	uint8_t* bulk_data_medium = nullptr;
+	uint8_t* bulk_data_low = nullptr;
+	REQUIRE(split_database_bulk_data(allocator, *db, split_db, bulk_data_medium, bulk_data_low).empty());
+
+	compressed_database* removed_split_db = nullptr;
+	REQUIRE(remove_from_database(allocator, *split_db, removed_clips, 2, removed_split_db).empty());
+	CHECK(removed_split_db->is_valid(true).empty());
+
+	const acl_impl::database_header& split_header = acl_impl::get_database_header(*split_db);
+	const acl_impl::database_header& removed_split_header = acl_impl::get_database_header(*removed_split_db);
+	REQUIRE(split_header.get_segment_streaming_metadatas() != nullptr);
+	REQUIRE(removed_split_header.get_segment_streaming_metadatas() != nullptr);
+	CHECK(std::memcmp(removed_split_header.get_segment_streaming_metadatas(), split_header.get_segment_streaming_metadatas(), split_header.num_segments * sizeof(acl_impl::database_segment_streaming_metadata)) == 0);
+
+	removed_db_context.reset();
+	db_context.reset();
+
+	allocator.deallocate(removed_split_db, removed_split_db->get_size());
+	allocator.deallocate(bulk_data_medium, split_db->get_bulk_data_size(quality_tier::medium_importance));
+	allocator.deallocate(bulk_data_low, split_db->get_bulk_data_size(quality_tier::lowest_importance));
+	allocator.deallocate(split_db, split_db->get_size());
+	allocator.deallocate(removed_db, removed_db->get_size());
+	allocator.deallocate(other_db, other_db->get_size());
+	allocator.deallocate(other_db_clip, other_db_clip->get_size());
+	allocator.deallocate(db, db->get_size());
+
+	for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+		allocator.deallocate(db_clips[clip_index], db_clips[clip_index]->get_size());
+
+	for (uint32_t clip_index = 0; clip_index < k_num_clips + 1; ++clip_index)
+		allocator.deallocate(clips[clip_index], clips[clip_index]->get_size());
+}
+
+TEST_CASE("database per clip streaming", "[decompression][database]")
+{
+	constexpr uint32_t k_num_clips = 12;
+	constexpr uint32_t k_num_tracks = 16;
+	constexpr uint32_t k_num_samples = 128;
+	constexpr uint32_t k_num_values = k_num_tracks * k_num_samples;
+	constexpr quality_tier k_tier = quality_tier::lowest_importance;
+
+	ansi_allocator allocator;
+
+	compressed_tracks* clips[k_num_clips];
+	for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+	{
+		clips[clip_index] = make_test_clip(allocator, clip_index, k_num_tracks, k_num_samples);
+		REQUIRE(clips[clip_index] != nullptr);
+	}
+
+	compressed_tracks* db_clips[k_num_clips] = { nullptr };
+	compressed_database* db = make_test_database(allocator, clips, k_num_clips, db_clips);
+	REQUIRE(db != nullptr);
+	REQUIRE(db->get_num_chunks(k_tier) > 1);
+
+	// Find two clips that share a chunk, clips are laid out in the order provided
+	const acl_impl::database_clip_chunk_range* clip_chunk_ranges = acl_impl::get_database_header(*db).get_clip_chunk_ranges();
+	REQUIRE(clip_chunk_ranges != nullptr);
+
+	const uint32_t tier_index = uint32_t(k_tier) - 1;
+	uint32_t clip_index0 = k_num_clips;
+	for (uint32_t clip_index = 0; clip_index + 1 < k_num_clips && clip_index0 == k_num_clips; ++clip_index)
+	{
+		const acl_impl::database_clip_chunk_range& range0 = clip_chunk_ranges[clip_index];
+		const acl_impl::database_clip_chunk_range& range1 = clip_chunk_ranges[clip_index + 1];
+		const uint32_t last_chunk_index0 = range0.first_chunk_index[tier_index] + range0.num_chunks[tier_index] - 1;
+		if (range0.num_chunks[tier_index] != 0 && range1.num_chunks[tier_index] != 0 && last_chunk_index0 == range1.first_chunk_index[tier_index])
+			clip_index0 = clip_index;
+	}
+
+	REQUIRE(clip_index0 < k_num_clips);
+	const compressed_tracks& clip0 = *db_clips[clip_index0];
+	const compressed_tracks& clip1 = *db_clips[clip_index0 + 1];
+
+	float* ref_values = allocate_type_array<float>(allocator, k_num_values);
+	float* values = allocate_type_array<float>(allocator, k_num_values);
+
+	// Our reference has every tier inline
+	{
+		database_context<debug_database_settings> db_context;
+		REQUIRE(db_context.initialize(allocator, *db));
+
+		decompression_context<test_scalar_decompression_settings> context;
+		REQUIRE(context.initialize(clip1, db_context));
+
+		decompress_test_clip(allocator, context, ref_values);
+	}
+
+	compressed_database* split_db = nullptr;
+	uint8_t* bulk_data_medium = nullptr;
+	uint8_t* bulk_data_low = nullptr;
+	REQUIRE(split_database_bulk_data(allocator, *db, split_db, bulk_data_medium, bulk_data_low).empty());
+
+	{
+		debug_database_streamer medium_streamer(allocator, bulk_data_medium, split_db->get_bulk_data_size(quality_tier::medium_importance));
+		debug_database_streamer low_streamer(allocator, bulk_data_low, split_db->get_bulk_data_size(quality_tier::lowest_importance));
+
+		database_context<debug_database_settings> db_context;
+		REQUIRE(db_context.initialize(allocator, *split_db, medium_streamer, low_streamer));
+
+		decompression_context<test_scalar_decompression_settings> context;
+		REQUIRE(context.initialize(clip1, db_context));
+
+		// Only the chunks of the requested clips are streamed in
+		CHECK(db_context.stream_in(k_tier, clip0) == database_stream_request_result::dispatched);
+		CHECK(db_context.is_streamed_in(k_tier, clip0));
+		CHECK(!db_context.is_streamed_in(k_tier));
+
+		// The shared chunk is already loaded, only the rest of the second clip streams in
+		const bool is_clip1_in_one_chunk = clip_chunk_ranges[clip_index0 + 1].num_chunks[tier_index] == 1;
+		CHECK(db_context.stream_in(k_tier, clip1) == (is_clip1_in_one_chunk ? database_stream_request_result::done : database_stream_request_result::dispatched));
+		CHECK(db_context.is_streamed_in(k_tier, clip1));
+
+		// Requesting a clip again does nothing
+		CHECK(db_context.stream_in(k_tier, clip0) == database_stream_request_result::done);
+
+		// The shared chunk remains loaded while the second clip references it
+		db_context.stream_out(k_tier, clip0);
+		CHECK(!db_context.is_streamed_in(k_tier, clip0) || clip_chunk_ranges[clip_index0].num_chunks[tier_index] == 1);
+		CHECK(db_context.is_streamed_in(k_tier, clip1));
+
+		// Releasing a clip twice does nothing
+		CHECK(db_context.stream_out(k_tier, clip0) == database_stream_request_result::done);
+		CHECK(db_context.is_streamed_in(k_tier, clip1));
+
+		// Our clip decompresses at full quality once every tier is streamed in
+		CHECK(db_context.stream_in(quality_tier::medium_importance, clip1) == database_stream_request_result::dispatched);
+		decompress_test_clip(allocator, context, values);
+		CHECK(std::memcmp(values, ref_values, k_num_values * sizeof(float)) == 0);
+
+		// Streaming out a whole tier skips the chunks of requested clips
+		// The chunks of our clip split the tier in two ranges, one request is dispatched per range
+		CHECK(db_context.stream_in(k_tier) == database_stream_request_result::dispatched);
+		while (db_context.stream_in(k_tier) == database_stream_request_result::dispatched)
+			continue;
+		CHECK(db_context.is_streamed_in(k_tier));
+		CHECK(db_context.stream_out(k_tier) == database_stream_request_result::dispatched);
+		CHECK(!db_context.is_streamed_in(k_tier, clip0) || clip_chunk_ranges[clip_index0].num_chunks[tier_index] == 1);
+		CHECK(db_context.is_streamed_in(k_tier, clip1));
+		CHECK(db_context.stream_out(k_tier) == database_stream_request_result::done);
+		CHECK(low_streamer.get_bulk_data(k_tier) != nullptr);
+
+		decompress_test_clip(allocator, context, values);
+		CHECK(std::memcmp(values, ref_values, k_num_values * sizeof(float)) == 0);
+
+		// Releasing the last clip streams out the remaining chunks and frees the bulk data
+		CHECK(db_context.stream_out(k_tier, clip1) == database_stream_request_result::dispatched);
+		CHECK(!db_context.is_streamed_in(k_tier, clip1));
+		CHECK(low_streamer.get_bulk_data(k_tier) == nullptr);
+
+		CHECK(db_context.stream_out(quality_tier::medium_importance, clip1) == database_stream_request_result::dispatched);
+		CHECK(medium_streamer.get_bulk_data(quality_tier::medium_importance) == nullptr);
+	}
+
+	deallocate_type_array(allocator, values, k_num_values);
+	deallocate_type_array(allocator, ref_values, k_num_values);
+
+	allocator.deallocate(bulk_data_medium, split_db->get_bulk_data_size(quality_tier::medium_importance));
+	allocator.deallocate(bulk_data_low, split_db->get_bulk_data_size(quality_tier::lowest_importance));
+	allocator.deallocate(split_db, split_db->get_size());
+	allocator.deallocate(db, db->get_size());
+
+	for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+	{
+		allocator.deallocate(db_clips[clip_index], db_clips[clip_index]->get_size());
+		allocator.deallocate(clips[clip_index], clips[clip_index]->get_size());
+	}
+}
@@ -0,0 +1,390 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch2/catch.hpp>
+
+#include "database_test_utils.h"
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/decompression/database/file_database_streamer.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#if defined(__linux__)
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+using namespace acl;
+
+// Worker threads and /tmp are only available on desktop Linux
+#if defined(__linux__) && !defined(__ANDROID__)
+struct async_read_counters
+{
+	uint32_t num_completed = 0;
+	uint32_t num_failed = 0;
+};
+
+static void on_test_read_completed(void* user_context, uint64_t user_data, bool success)
+{
+	async_read_counters* counters = static_cast<async_read_counters*>(user_context);
+	counters->num_completed++;
+	counters->num_failed += success ? 0 : 1;
+	(void)user_data;
+}
+
+TEST_CASE("async_file_reader", "[decompression][database]")
+{
+	char filename[1024];
+	snprintf(filename, sizeof(filename), "/tmp/acl_async_file_reader_%u.bin", std::rand());
+
+	constexpr uint32_t k_file_size = 256 * 1024;
+	constexpr uint32_t k_read_size = 16 * 1024;
+	constexpr uint32_t k_num_reads = k_file_size / k_read_size;
+
+	ansi_allocator allocator;
+	uint8_t* file_data = allocate_type_array<uint8_t>(allocator, k_file_size);
+	for (uint32_t offset = 0; offset < k_file_size; ++offset)
+		file_data[offset] = uint8_t(offset + (offset >> 8));
+
+	std::FILE* file = std::fopen(filename, "wb");
+	REQUIRE(file != nullptr);
+	REQUIRE(std::fwrite(file_data, 1, k_file_size, file) == k_file_size);
+	std::fclose(file);
+
+	uint8_t* buffer = allocate_type_array_aligned<uint8_t>(allocator, k_file_size, k_direct_io_alignment);
+
+	{
+		file_database_streamer_settings settings;
+		settings.num_worker_threads = 1;
+		settings.max_num_pending_reads = k_num_reads;
+
+		async_read_counters counters;
+		acl_impl::async_file_reader reader(allocator, settings, &on_test_read_completed, &counters);
+		REQUIRE(reader.open(filename));
+
+		// Adjacent reads that are still queued are coalesced
+		std::memset(buffer, 0, k_file_size);
+		for (uint32_t read_index = 0; read_index < k_num_reads; ++read_index)
+			CHECK(reader.try_enqueue(buffer, read_index * k_read_size, k_read_size, read_index));
+
+		reader.wait_idle();
+		CHECK(counters.num_completed == k_num_reads);
+		CHECK(counters.num_failed == 0);
+		CHECK(std::memcmp(buffer, file_data, k_file_size) == 0);
+
+		file_database_streamer_stats stats = reader.get_stats();
+		CHECK(stats.num_requests == k_num_reads);
+		CHECK(stats.num_completed_requests == k_num_reads);
+		CHECK(stats.num_rejected_requests == 0);
+		CHECK(stats.num_reads >= 1);
+		CHECK(stats.num_reads <= k_num_reads);
+		CHECK(stats.num_bytes_read == k_file_size);
+
+		// Reading past the end of the file fails
+		CHECK(reader.try_enqueue(buffer, k_file_size - 16, 32, 0));
+		reader.wait_idle();
+		CHECK(counters.num_failed == 1);
+
+		stats = reader.get_stats();
+		CHECK(stats.num_failed_requests == 1);
+
+		reader.close();
+		CHECK(!reader.is_open());
+	}
+
+	deallocate_type_array(allocator, buffer, k_file_size);
+	deallocate_type_array(allocator, file_data, k_file_size);
+	std::remove(filename);
+}
+
+static bool write_test_file(const char* filename, const uint8_t* data, uint32_t size)
+{
+	std::FILE* file = std::fopen(filename, "wb");
+	if (file == nullptr)
+		return false;
+
+	const bool success = size == 0 || std::fwrite(data, 1, size, file) == size;
+	std::fclose(file);
+	return success;
+}
+
+// Some file systems like tmpfs do not support direct IO
+static bool is_direct_io_supported(const char* filename)
+{
+	const int fd = ::open(filename, O_RDONLY | O_DIRECT);
+	if (fd < 0)
+		return false;
+
+	::close(fd);
+	return true;
+}
+
+static bool wait_for_streaming(const database_context<debug_database_settings>& db_context, quality_tier tier)
+{
+	// Requests complete on the worker threads
+	for (uint32_t iteration = 0; iteration < 10000000 && db_context.is_streaming(tier); ++iteration)
+		std::this_thread::yield();
+
+	return !db_context.is_streaming(tier);
+}
+
+TEST_CASE("file_database_streamer", "[decompression][database]")
+{
+	constexpr uint32_t k_num_clips = 8;
+	constexpr uint32_t k_num_tracks = 32;
+	constexpr uint32_t k_num_samples = 128;
+	constexpr uint32_t k_num_values = k_num_tracks * k_num_samples;
+
+	ansi_allocator allocator;
+
+	compressed_tracks* clips[k_num_clips];
+	for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+	{
+		clips[clip_index] = make_test_clip(allocator, clip_index, k_num_tracks, k_num_samples);
+		REQUIRE(clips[clip_index] != nullptr);
+	}
+
+	compressed_tracks* db_clips[k_num_clips] = { nullptr };
+	compressed_database* db = make_test_database(allocator, clips, k_num_clips, db_clips);
+	REQUIRE(db != nullptr);
+	REQUIRE(db->get_num_chunks(quality_tier::medium_importance) > 1);
+	REQUIRE(db->get_num_chunks(quality_tier::lowest_importance) > 1);
+
+	float* ref_values = allocate_type_array<float>(allocator, k_num_values);
+	float* values = allocate_type_array<float>(allocator, k_num_values);
+
+	// Our reference has every tier inline
+	{
+		database_context<debug_database_settings> db_context;
+		REQUIRE(db_context.initialize(allocator, *db));
+
+		decompression_context<test_scalar_decompression_settings> context;
+		REQUIRE(context.initialize(*db_clips[0], db_context));
+
+		decompress_test_clip(allocator, context, ref_values);
+	}
+
+	compressed_database* split_db = nullptr;
+	uint8_t* bulk_data_medium = nullptr;
+	uint8_t* bulk_data_low = nullptr;
+	REQUIRE(split_database_bulk_data(allocator, *db, split_db, bulk_data_medium, bulk_data_low).empty());
+
+	const uint32_t bulk_data_medium_size = split_db->get_bulk_data_size(quality_tier::medium_importance);
+	const uint32_t bulk_data_low_size = split_db->get_bulk_data_size(quality_tier::lowest_importance);
+	const uint32_t chunk_data_medium_size = get_test_chunk_data_size(*split_db, quality_tier::medium_importance);
+	const uint32_t chunk_data_low_size = get_test_chunk_data_size(*split_db, quality_tier::lowest_importance);
+
+	const int file_id = std::rand();
+	char medium_filename[1024];
+	char low_filename[1024];
+	snprintf(medium_filename, sizeof(medium_filename), "/tmp/acl_file_database_streamer_%d_medium.bin", file_id);
+	snprintf(low_filename, sizeof(low_filename), "/tmp/acl_file_database_streamer_%d_low.bin", file_id);
+	REQUIRE(write_test_file(medium_filename, bulk_data_medium, bulk_data_medium_size));
+	REQUIRE(write_test_file(low_filename, bulk_data_low, bulk_data_low_size));
+
+	{
+		// Stream every tier in and out
+		file_database_streamer medium_streamer(allocator, medium_filename, bulk_data_medium_size);
+		file_database_streamer low_streamer(allocator, low_filename, bulk_data_low_size);
+		REQUIRE(medium_streamer.is_initialized());
+		REQUIRE(low_streamer.is_initialized());
+
+		database_context<debug_database_settings> db_context;
+		REQUIRE(db_context.initialize(allocator, *split_db, medium_streamer, low_streamer));
+
+		decompression_context<test_scalar_decompression_settings> context;
+		REQUIRE(context.initialize(*db_clips[0], db_context));
+
+		// The first request allocates the bulk data, we wait for it before streaming the rest
+		CHECK(db_context.stream_in(quality_tier::medium_importance, 1) == database_stream_request_result::dispatched);
+		REQUIRE(wait_for_streaming(db_context, quality_tier::medium_importance));
+		CHECK(db_context.stream_in(quality_tier::medium_importance) == database_stream_request_result::dispatched);
+		CHECK(db_context.stream_in(quality_tier::lowest_importance) == database_stream_request_result::dispatched);
+		REQUIRE(wait_for_streaming(db_context, quality_tier::medium_importance));
+		REQUIRE(wait_for_streaming(db_context, quality_tier::lowest_importance));
+
+		CHECK(db_context.is_streamed_in(quality_tier::medium_importance));
+		CHECK(db_context.is_streamed_in(quality_tier::lowest_importance));
+		CHECK(std::memcmp(medium_streamer.get_bulk_data(quality_tier::medium_importance), bulk_data_medium, chunk_data_medium_size) == 0);
+		CHECK(std::memcmp(low_streamer.get_bulk_data(quality_tier::lowest_importance), bulk_data_low, chunk_data_low_size) == 0);
+
+		file_database_streamer_stats stats = medium_streamer.get_stats();
+		CHECK(stats.num_requests == 2);
+		CHECK(stats.num_completed_requests == 2);
+		CHECK(stats.num_rejected_requests == 0);
+		CHECK(stats.num_failed_requests == 0);
+
+		decompress_test_clip(allocator, context, values);
+		CHECK(std::memcmp(values, ref_values, k_num_values * sizeof(float)) == 0);
+
+		// Stream out requests complete right away and free the bulk data
+		CHECK(db_context.stream_out(quality_tier::medium_importance) == database_stream_request_result::dispatched);
+		CHECK(db_context.stream_out(quality_tier::lowest_importance) == database_stream_request_result::dispatched);
+		CHECK(!db_context.is_streaming(quality_tier::medium_importance));
+		CHECK(!db_context.is_streaming(quality_tier::lowest_importance));
+		CHECK(!db_context.is_streamed_in(quality_tier::medium_importance));
+		CHECK(!db_context.is_streamed_in(quality_tier::lowest_importance));
+		CHECK(medium_streamer.get_bulk_data(quality_tier::medium_importance) == nullptr);
+		CHECK(low_streamer.get_bulk_data(quality_tier::lowest_importance) == nullptr);
+	}
+
+	{
+		// Requests beyond the pending limit are canceled, their chunks remain unloaded and can be requested again
+		file_database_streamer_settings settings;
+		settings.num_worker_threads = 1;
+		settings.max_num_pending_reads = 4;
+		settings.max_num_pending_bytes = 1;
+
+		file_database_streamer medium_streamer(allocator, medium_filename, bulk_data_medium_size, settings);
+		file_database_streamer low_streamer(allocator, low_filename, bulk_data_low_size, settings);
+
+		database_context<debug_database_settings> db_context;
+		REQUIRE(db_context.initialize(allocator, *split_db, medium_streamer, low_streamer));
+
+		for (uint32_t iteration = 0; iteration < 10000000 && !db_context.is_streamed_in(quality_tier::medium_importance); ++iteration)
+			db_context.stream_in(quality_tier::medium_importance, 1);
+
+		REQUIRE(wait_for_streaming(db_context, quality_tier::medium_importance));
+		CHECK(db_context.is_streamed_in(quality_tier::medium_importance));
+		CHECK(std::memcmp(medium_streamer.get_bulk_data(quality_tier::medium_importance), bulk_data_medium, chunk_data_medium_size) == 0);
+
+		// Every request is either rejected or completed, how many are rejected depends on the worker thread timing
+		const file_database_streamer_stats stats = medium_streamer.get_stats();
+		CHECK(stats.num_requests == stats.num_completed_requests + stats.num_rejected_requests);
+		CHECK(stats.num_completed_requests >= split_db->get_num_chunks(quality_tier::medium_importance));
+		CHECK(stats.num_failed_requests == 0);
+
+		CHECK(db_context.stream_out(quality_tier::medium_importance) == database_stream_request_result::dispatched);
+		CHECK(!db_context.is_streamed_in(quality_tier::medium_importance));
+	}
+
+	if (is_direct_io_supported(low_filename))
+	{
+		// Direct IO reads whole aligned blocks, the bulk data is padded to hold the end of the last one
+		file_database_streamer_settings settings;
+		settings.use_direct_io = true;
+
+		file_database_streamer medium_streamer(allocator, medium_filename, bulk_data_medium_size, settings);
+		file_database_streamer low_streamer(allocator, low_filename, bulk_data_low_size, settings);
+
+		database_context<debug_database_settings> db_context;
+		REQUIRE(db_context.initialize(allocator, *split_db, medium_streamer, low_streamer));
+
+		decompression_context<test_scalar_decompression_settings> context;
+		REQUIRE(context.initialize(*db_clips[0], db_context));
+
+		// Stream the last chunk first, its read ends past the end of the file
+		const uint32_t num_low_chunks = split_db->get_num_chunks(quality_tier::lowest_importance);
+		CHECK(db_context.stream_in(quality_tier::lowest_importance, *db_clips[k_num_clips - 1]) == database_stream_request_result::dispatched);
+		REQUIRE(wait_for_streaming(db_context, quality_tier::lowest_importance));
+		CHECK(db_context.is_streamed_in(quality_tier::lowest_importance, *db_clips[k_num_clips - 1]));
+
+		const uint8_t* streamed_bulk_data_low = low_streamer.get_bulk_data(quality_tier::lowest_importance);
+		REQUIRE(streamed_bulk_data_low != nullptr);
+		CHECK(is_aligned_to(streamed_bulk_data_low, k_direct_io_alignment));
+
+		const uint32_t last_chunk_offset = (num_low_chunks - 1) * split_db->get_max_chunk_size();
+		CHECK(std::memcmp(streamed_bulk_data_low + last_chunk_offset, bulk_data_low + last_chunk_offset, chunk_data_low_size - last_chunk_offset) == 0);
+
+		CHECK(db_context.stream_in(quality_tier::medium_importance) == database_stream_request_result::dispatched);
+		CHECK(db_context.stream_in(quality_tier::lowest_importance) == database_stream_request_result::dispatched);
+		REQUIRE(wait_for_streaming(db_context, quality_tier::medium_importance));
+		REQUIRE(wait_for_streaming(db_context, quality_tier::lowest_importance));
+
+		CHECK(db_context.is_streamed_in(quality_tier::medium_importance));
+		CHECK(db_context.is_streamed_in(quality_tier::lowest_importance));
+		CHECK(std::memcmp(medium_streamer.get_bulk_data(quality_tier::medium_importance), bulk_data_medium, chunk_data_medium_size) == 0);
+		CHECK(std::memcmp(low_streamer.get_bulk_data(quality_tier::lowest_importance), bulk_data_low, chunk_data_low_size) == 0);
+
+		decompress_test_clip(allocator, context, values);
+		CHECK(std::memcmp(values, ref_values, k_num_values * sizeof(float)) == 0);
+
+		CHECK(db_context.stream_out(quality_tier::medium_importance) == database_stream_request_result::dispatched);
+		CHECK(db_context.stream_out(quality_tier::lowest_importance) == database_stream_request_result::dispatched);
+	}
+
+	{
+		// Requests with corrupted chunks are canceled when verifying
+		const acl_impl::database_chunk_description& chunk_description = acl_impl::get_database_header(*split_db).get_chunk_descriptions(1)[0];
+		bulk_data_low[chunk_description.offset + (chunk_description.size / 2)] ^= 0x01;
+
+		char corrupted_filename[1024];
+		snprintf(corrupted_filename, sizeof(corrupted_filename), "/tmp/acl_file_database_streamer_%d_corrupted.bin", file_id);
+		REQUIRE(write_test_file(corrupted_filename, bulk_data_low, bulk_data_low_size));
+
+		bulk_data_low[chunk_description.offset + (chunk_description.size / 2)] ^= 0x01;
+
+		file_database_streamer_settings settings;
+		settings.verify_chunks = true;
+
+		file_database_streamer medium_streamer(allocator, medium_filename, bulk_data_medium_size, settings);
+		file_database_streamer low_streamer(allocator, corrupted_filename, bulk_data_low_size, settings);
+
+		database_context<debug_database_settings> db_context;
+		REQUIRE(db_context.initialize(allocator, *split_db, medium_streamer, low_streamer));
+
+		CHECK(db_context.stream_in(quality_tier::lowest_importance) == database_stream_request_result::dispatched);
+		CHECK(db_context.stream_in(quality_tier::medium_importance) == database_stream_request_result::dispatched);
+		REQUIRE(wait_for_streaming(db_context, quality_tier::lowest_importance));
+		REQUIRE(wait_for_streaming(db_context, quality_tier::medium_importance));
+
+		CHECK(!db_context.is_streamed_in(quality_tier::lowest_importance));
+		CHECK(!db_context.is_streamed_in(quality_tier::lowest_importance, *db_clips[0]));
+		CHECK(low_streamer.get_stats().num_completed_requests == 1);
+		CHECK(low_streamer.get_stats().num_failed_requests == 0);
+		CHECK(low_streamer.get_stats().num_corrupted_requests == 1);
+
+		// Chunks that match their hash stream in
+		CHECK(db_context.is_streamed_in(quality_tier::medium_importance));
+		CHECK(medium_streamer.get_stats().num_corrupted_requests == 0);
+
+		CHECK(db_context.stream_out(quality_tier::medium_importance) == database_stream_request_result::dispatched);
+
+		std::remove(corrupted_filename);
+	}
+
+	std::remove(medium_filename);
+	std::remove(low_filename);
+
+	deallocate_type_array(allocator, values, k_num_values);
+	deallocate_type_array(allocator, ref_values, k_num_values);
+
+	allocator.deallocate(bulk_data_medium, bulk_data_medium_size);
+	allocator.deallocate(bulk_data_low, bulk_data_low_size);
+	allocator.deallocate(split_db, split_db->get_size());
+	allocator.deallocate(db, db->get_size());
+
+	for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+	{
+		allocator.deallocate(db_clips[clip_index], db_clips[clip_index]->get_size());
+		allocator.deallocate(clips[clip_index], clips[clip_index]->get_size());
+	}
+}
+#endif
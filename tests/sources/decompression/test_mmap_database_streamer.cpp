@@ -0,0 +1,255 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch2/catch.hpp>
+
+#include "database_test_utils.h"
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/decompression/database/mmap_database_streamer.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace acl;
+
+// Memory mapping and /tmp are only available on desktop Linux
+#if defined(__linux__) && !defined(__ANDROID__)
+static bool write_test_file(const char* filename, const uint8_t* data, uint32_t size)
+{
+	std::FILE* file = std::fopen(filename, "wb");
+	if (file == nullptr)
+		return false;
+
+	const bool success = size == 0 || std::fwrite(data, 1, size, file) == size;
+	std::fclose(file);
+	return success;
+}
+
+TEST_CASE("mmap_database_streamer", "[decompression][database]")
+{
+	constexpr uint32_t k_num_clips = 4;
+	constexpr uint32_t k_num_tracks = 16;
+	constexpr uint32_t k_num_samples = 64;
+	constexpr uint32_t k_num_values = k_num_tracks * k_num_samples;
+
+	ansi_allocator allocator;
+
+	compressed_tracks* clips[k_num_clips];
+	for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+	{
+		clips[clip_index] = make_test_clip(allocator, clip_index, k_num_tracks, k_num_samples);
+		REQUIRE(clips[clip_index] != nullptr);
+	}
+
+	compressed_tracks* db_clips[k_num_clips] = { nullptr };
+	compressed_database* db = make_test_database(allocator, clips, k_num_clips, db_clips);
+	REQUIRE(db != nullptr);
+	REQUIRE(db->get_num_chunks(quality_tier::medium_importance) != 0);
+	REQUIRE(db->get_num_chunks(quality_tier::lowest_importance) != 0);
+
+	float* ref_values = allocate_type_array<float>(allocator, k_num_values);
+	float* low_values = allocate_type_array<float>(allocator, k_num_values);
+	float* values = allocate_type_array<float>(allocator, k_num_values);
+
+	// Our reference has every tier inline
+	{
+		database_context<debug_database_settings> db_context;
+		REQUIRE(db_context.initialize(allocator, *db));
+
+		decompression_context<test_scalar_decompression_settings> context;
+		REQUIRE(context.initialize(*db_clips[0], db_context));
+
+		decompress_test_clip(allocator, context, ref_values);
+	}
+
+	compressed_database* split_db = nullptr;
+	uint8_t* bulk_data_medium = nullptr;
+	uint8_t* bulk_data_low = nullptr;
+	REQUIRE(split_database_bulk_data(allocator, *db, split_db, bulk_data_medium, bulk_data_low).empty());
+
+	const uint32_t bulk_data_medium_size = split_db->get_bulk_data_size(quality_tier::medium_importance);
+	const uint32_t bulk_data_low_size = split_db->get_bulk_data_size(quality_tier::lowest_importance);
+
+	const int file_id = std::rand();
+	char medium_filename[1024];
+	char low_filename[1024];
+	snprintf(medium_filename, sizeof(medium_filename), "/tmp/acl_mmap_database_streamer_%d_medium.bin", file_id);
+	snprintf(low_filename, sizeof(low_filename), "/tmp/acl_mmap_database_streamer_%d_low.bin", file_id);
+	REQUIRE(write_test_file(medium_filename, bulk_data_medium, bulk_data_medium_size));
+	REQUIRE(write_test_file(low_filename, bulk_data_low, bulk_data_low_size));
+
+	{
+		mmap_database_streamer medium_streamer(medium_filename, bulk_data_medium_size);
+		mmap_database_streamer low_streamer(low_filename, bulk_data_low_size);
+		CHECK(medium_streamer.is_initialized());
+		CHECK(low_streamer.is_initialized());
+
+		database_context<debug_database_settings> db_context;
+		REQUIRE(db_context.initialize(allocator, *split_db, medium_streamer, low_streamer));
+
+		decompression_context<test_scalar_decompression_settings> context;
+		REQUIRE(context.initialize(*db_clips[0], db_context));
+
+		// Nothing is streamed in, only the samples within the compressed tracks are used
+		CHECK(!db_context.is_streamed_in(quality_tier::medium_importance));
+		CHECK(!db_context.is_streamed_in(quality_tier::lowest_importance));
+		decompress_test_clip(allocator, context, low_values);
+
+		// Requests complete synchronously, the bulk data is read straight from the mapping
+		CHECK(db_context.stream_in(quality_tier::medium_importance) == database_stream_request_result::dispatched);
+		CHECK(db_context.stream_in(quality_tier::lowest_importance) == database_stream_request_result::dispatched);
+		CHECK(db_context.is_streamed_in(quality_tier::medium_importance));
+		CHECK(db_context.is_streamed_in(quality_tier::lowest_importance));
+		CHECK(!db_context.is_streaming(quality_tier::medium_importance));
+		CHECK(!db_context.is_streaming(quality_tier::lowest_importance));
+		CHECK(db_context.stream_in(quality_tier::lowest_importance) == database_stream_request_result::done);
+		CHECK(medium_streamer.get_bulk_data(quality_tier::medium_importance) != nullptr);
+		CHECK(std::memcmp(low_streamer.get_bulk_data(quality_tier::lowest_importance), bulk_data_low, bulk_data_low_size) == 0);
+
+		decompress_test_clip(allocator, context, values);
+		CHECK(std::memcmp(values, ref_values, k_num_values * sizeof(float)) == 0);
+
+		// Streaming out releases the pages, decompression falls back to the compressed tracks
+		CHECK(db_context.stream_out(quality_tier::lowest_importance) == database_stream_request_result::dispatched);
+		CHECK(db_context.stream_out(quality_tier::medium_importance) == database_stream_request_result::dispatched);
+		CHECK(!db_context.is_streamed_in(quality_tier::medium_importance));
+		CHECK(!db_context.is_streamed_in(quality_tier::lowest_importance));
+		CHECK(db_context.dispatch_deferred_stream_outs() == 0);
+
+		decompress_test_clip(allocator, context, values);
+		CHECK(std::memcmp(values, low_values, k_num_values * sizeof(float)) == 0);
+
+		// Released pages are read back from the file when streamed in again
+		CHECK(db_context.stream_in(quality_tier::medium_importance, *db_clips[0]) == database_stream_request_result::dispatched);
+		CHECK(db_context.stream_in(quality_tier::lowest_importance, *db_clips[0]) == database_stream_request_result::dispatched);
+		CHECK(db_context.is_streamed_in(quality_tier::medium_importance, *db_clips[0]));
+		CHECK(db_context.is_streamed_in(quality_tier::lowest_importance, *db_clips[0]));
+
+		decompress_test_clip(allocator, context, values);
+		CHECK(std::memcmp(values, ref_values, k_num_values * sizeof(float)) == 0);
+
+		CHECK(db_context.stream_out(quality_tier::medium_importance, *db_clips[0]) == database_stream_request_result::dispatched);
+		CHECK(db_context.stream_out(quality_tier::lowest_importance, *db_clips[0]) == database_stream_request_result::dispatched);
+		CHECK(!db_context.is_streamed_in(quality_tier::medium_importance, *db_clips[0]));
+		CHECK(!db_context.is_streamed_in(quality_tier::lowest_importance, *db_clips[0]));
+	}
+
+	std::remove(medium_filename);
+	std::remove(low_filename);
+
+	deallocate_type_array(allocator, values, k_num_values);
+	deallocate_type_array(allocator, low_values, k_num_values);
+	deallocate_type_array(allocator, ref_values, k_num_values);
+
+	allocator.deallocate(bulk_data_medium, bulk_data_medium_size);
+	allocator.deallocate(bulk_data_low, bulk_data_low_size);
+	allocator.deallocate(split_db, split_db->get_size());
+	allocator.deallocate(db, db->get_size());
+
+	for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+	{
+		allocator.deallocate(db_clips[clip_index], db_clips[clip_index]->get_size());
+		allocator.deallocate(clips[clip_index], clips[clip_index]->get_size());
+	}
+}
+
+TEST_CASE("mmap_database_streamer deferred stream outs", "[decompression][database]")
+{
+	constexpr uint32_t k_num_clips = 2;
+	constexpr uint32_t k_num_tracks = 32;
+	constexpr uint32_t k_num_samples = 512;
+
+	ansi_allocator allocator;
+
+	compressed_tracks* clips[k_num_clips];
+	for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+	{
+		clips[clip_index] = make_test_clip(allocator, clip_index, k_num_tracks, k_num_samples);
+		REQUIRE(clips[clip_index] != nullptr);
+	}
+
+	compressed_tracks* db_clips[k_num_clips] = { nullptr };
+	compressed_database* db = make_test_database(allocator, clips, k_num_clips, db_clips);
+	REQUIRE(db != nullptr);
+
+	compressed_database* split_db = nullptr;
+	uint8_t* bulk_data_medium = nullptr;
+	uint8_t* bulk_data_low = nullptr;
+	REQUIRE(split_database_bulk_data(allocator, *db, split_db, bulk_data_medium, bulk_data_low).empty());
+
+	const uint32_t bulk_data_medium_size = split_db->get_bulk_data_size(quality_tier::medium_importance);
+	const uint32_t bulk_data_low_size = split_db->get_bulk_data_size(quality_tier::lowest_importance);
+
+	const int file_id = std::rand();
+	char medium_filename[1024];
+	char low_filename[1024];
+	snprintf(medium_filename, sizeof(medium_filename), "/tmp/acl_mmap_database_streamer_%d_medium.bin", file_id);
+	snprintf(low_filename, sizeof(low_filename), "/tmp/acl_mmap_database_streamer_%d_low.bin", file_id);
+	REQUIRE(write_test_file(medium_filename, bulk_data_medium, bulk_data_medium_size));
+	REQUIRE(write_test_file(low_filename, bulk_data_low, bulk_data_low_size));
+
+	{
+		mmap_database_streamer medium_streamer(medium_filename, bulk_data_medium_size);
+		mmap_database_streamer low_streamer(low_filename, bulk_data_low_size);
+
+		database_context<debug_database_settings> db_context;
+		REQUIRE(db_context.initialize(allocator, *split_db, medium_streamer, low_streamer));
+
+		for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+			CHECK(db_context.stream_in(quality_tier::medium_importance, *db_clips[clip_index]) == database_stream_request_result::dispatched);
+
+		{
+			database_decompression_scope scope(db_context);
+
+			// Deferred stream out requests hold on to their request, others can still be issued
+			CHECK(db_context.stream_out(quality_tier::medium_importance, *db_clips[0]) == database_stream_request_result::dispatched);
+			CHECK(db_context.stream_out(quality_tier::medium_importance, *db_clips[1]) == database_stream_request_result::dispatched);
+			CHECK(db_context.dispatch_deferred_stream_outs() == 2);
+		}
+
+		CHECK(db_context.dispatch_deferred_stream_outs() == 0);
+		CHECK(!db_context.is_streamed_in(quality_tier::medium_importance, *db_clips[0]));
+		CHECK(!db_context.is_streamed_in(quality_tier::medium_importance, *db_clips[1]));
+		CHECK(!db_context.is_streaming(quality_tier::medium_importance));
+	}
+
+	std::remove(medium_filename);
+	std::remove(low_filename);
+
+	allocator.deallocate(bulk_data_medium, bulk_data_medium_size);
+	allocator.deallocate(bulk_data_low, bulk_data_low_size);
+	allocator.deallocate(split_db, split_db->get_size());
+	allocator.deallocate(db, db->get_size());
+
+	for (uint32_t clip_index = 0; clip_index < k_num_clips; ++clip_index)
+	{
+		allocator.deallocate(db_clips[clip_index], db_clips[clip_index]->get_size());
+		allocator.deallocate(clips[clip_index], clips[clip_index]->get_size());
+	}
+}
+#endif
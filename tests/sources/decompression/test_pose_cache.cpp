@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/decompression/pose_cache.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+using namespace acl;
+
+TEST_CASE("pose_cache", "[decompression][pose_cache]")
+{
+	ansi_allocator allocator;
+
+	{
+		pose_cache cache;
+		CHECK(!cache.is_initialized());
+		CHECK(cache.initialize(allocator, 6, sizeof(uint32_t) * 4));
+		CHECK(cache.is_initialized());
+		CHECK(cache.get_pose_size() == sizeof(uint32_t) * 4);
+		CHECK(cache.get_num_poses() == 8);
+
+		pose_cache_key key0;
+		key0.tracks_hash = 0x12345678;
+		key0.quantized_sample_time = 3;
+
+		pose_cache_key key1 = key0;
+		key1.writer_layout_id = 1;
+
+		const uint32_t pose0[4] = { 1, 2, 3, 4 };
+		uint32_t pose[4] = { 0, 0, 0, 0 };
+
+		CHECK(!cache.find(key0, pose, sizeof(pose)));
+
+		cache.insert(key0, pose0, sizeof(pose0));
+		CHECK(cache.find(key0, pose, sizeof(pose)));
+		CHECK(pose[0] == 1);
+		CHECK(pose[3] == 4);
+		CHECK(!cache.find(key1, pose, sizeof(pose)));
+
+		pose_cache_stats stats = cache.get_stats();
+		CHECK(stats.num_hits == 1);
+		CHECK(stats.num_misses == 2);
+		CHECK(stats.num_insertions == 1);
+		CHECK(stats.num_evictions == 0);
+		CHECK(stats.get_hit_rate() > 0.33F);
+		CHECK(stats.get_hit_rate() < 0.34F);
+
+		// Filling the cache well past its capacity evicts the least recently used poses
+		for (uint32_t sample_index = 0; sample_index < 64; ++sample_index)
+		{
+			pose_cache_key key = key1;
+			key.quantized_sample_time = sample_index;
+			cache.insert(key, pose0, sizeof(pose0));
+		}
+
+		stats = cache.get_stats();
+		CHECK(stats.num_insertions == 65);
+		CHECK(stats.num_evictions != 0);
+
+		cache.clear();
+		CHECK(!cache.find(key0, pose, sizeof(pose)));
+
+		cache.reset_stats();
+		stats = cache.get_stats();
+		CHECK(stats.num_hits == 0);
+		CHECK(stats.num_misses == 0);
+		CHECK(stats.get_hit_rate() == 0.0F);
+
+		cache.reset();
+		CHECK(!cache.is_initialized());
+	}
+
+#if defined(ACL_ALLOCATOR_TRACK_NUM_ALLOCATIONS)
+	CHECK(allocator.get_allocation_count() == 0);
+#endif
+}
+
+TEST_CASE("pose_cache concurrent access", "[decompression][pose_cache]")
+{
+	// Every pose is filled with a single value that identifies its key and its writer,
+	// a hit that returns values from two different poses means a lookup raced with an insertion
+	constexpr uint32_t k_num_threads = 4;
+	constexpr uint32_t k_num_keys = 8;
+	constexpr uint32_t k_num_iterations = 20000;
+	constexpr uint32_t k_num_pose_values = 67;	// Not a multiple of 64 bits to exercise the last partial word
+
+	ansi_allocator allocator;
+
+	{
+		pose_cache cache;
+		REQUIRE(cache.initialize(allocator, 4, sizeof(uint32_t) * k_num_pose_values));
+
+		std::atomic<uint32_t> num_torn_poses(0);
+		std::atomic<uint32_t> num_wrong_keys(0);
+
+		auto thread_main = [&](uint32_t thread_index)
+		{
+			uint32_t pose[k_num_pose_values];
+			for (uint32_t iteration = 0; iteration < k_num_iterations; ++iteration)
+			{
+				const uint32_t key_index = (iteration * 7 + thread_index) % k_num_keys;
+
+				pose_cache_key key;
+				key.tracks_hash = 0x12345678;
+				key.quantized_sample_time = key_index;
+
+				if (cache.find(key, pose, sizeof(pose)))
+				{
+					for (uint32_t value_index = 1; value_index < k_num_pose_values; ++value_index)
+					{
+						if (pose[value_index] != pose[0])
+						{
+							num_torn_poses.fetch_add(1);
+							break;
+						}
+					}
+
+					if ((pose[0] >> 24) != key_index)
+						num_wrong_keys.fetch_add(1);
+				}
+				else
+				{
+					const uint32_t value = (key_index << 24) | (thread_index << 20) | (iteration & 0xFFFFF);
+					for (uint32_t value_index = 0; value_index < k_num_pose_values; ++value_index)
+						pose[value_index] = value;
+
+					cache.insert(key, pose, sizeof(pose));
+				}
+			}
+		};
+
+		std::thread threads[k_num_threads];
+		for (uint32_t thread_index = 0; thread_index < k_num_threads; ++thread_index)
+			threads[thread_index] = std::thread(thread_main, thread_index);
+
+		for (uint32_t thread_index = 0; thread_index < k_num_threads; ++thread_index)
+			threads[thread_index].join();
+
+		CHECK(num_torn_poses.load() == 0);
+		CHECK(num_wrong_keys.load() == 0);
+
+		const pose_cache_stats stats = cache.get_stats();
+		CHECK(stats.num_hits + stats.num_misses == uint64_t(k_num_threads) * k_num_iterations);
+		CHECK(stats.num_hits != 0);
+		CHECK(stats.num_evictions != 0);
+	}
+
+#if defined(ACL_ALLOCATOR_TRACK_NUM_ALLOCATIONS)
+	CHECK(allocator.get_allocation_count() == 0);
+#endif
+}
@@ -53,8 +53,16 @@ void validate_db(acl::iallocator& allocator, const acl::track_array_qvvf& raw_tr
 	const acl::compression_database_settings& settings, const acl::itransform_error_metric& error_metric,
 	const acl::compressed_tracks& compressed_tracks0, const acl::compressed_tracks& compressed_tracks1);
 
+void validate_db(acl::iallocator& allocator, const acl::track_array& raw_tracks,
+	const acl::compression_database_settings& settings, const acl::compressed_tracks& compressed_tracks_);
+
 struct debug_transform_decompression_settings_with_db final : public acl::debug_transform_decompression_settings
 {
 	using database_settings_type = acl::debug_database_settings;
 };
+
+struct debug_scalar_decompression_settings_with_db final : public acl::debug_scalar_decompression_settings
+{
+	using database_settings_type = acl::debug_database_settings;
+};
 #endif
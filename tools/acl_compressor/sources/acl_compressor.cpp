@@ -587,6 +587,26 @@ static void try_algorithm(const Options& options, iallocator& allocator, const t
 		{
 			validate_accuracy(allocator, track_list, *compressed_tracks_, regression_error_threshold);
 			validate_metadata(track_list, *compressed_tracks_);
+
+			{
+				// Make a second copy with database support for testing
+				compression_settings db_settings = settings;
+				db_settings.enable_database_support = true;
+
+				// No logging for second copy
+				output_stats db_stats;
+
+				compressed_tracks* db_compressed_tracks = nullptr;
+				const error_result db_result = compress_track_list(allocator, track_list, db_settings, db_compressed_tracks, db_stats);
+
+				ACL_ASSERT(db_result.empty(), db_result.c_str()); (void)db_result;
+				ACL_ASSERT(db_compressed_tracks->is_valid(true).empty(), "Compressed tracks are invalid");
+
+				const compression_database_settings database_settings;
+				validate_db(allocator, track_list, database_settings, *db_compressed_tracks);
+
+				allocator.deallocate(db_compressed_tracks, db_compressed_tracks->get_size());
+			}
 		}
 #endif
 
@@ -855,6 +875,14 @@ static bool read_config(iallocator& allocator, Options& options, compression_set
 	if (parser.try_read("split_into_database", split_into_database, default_settings.enable_database_support))
 		out_settings.enable_database_support = split_into_database;
 
+	bool include_sub_track_prefix_index;
+	if (parser.try_read("include_sub_track_prefix_index", include_sub_track_prefix_index, default_settings.include_sub_track_prefix_index))
+		out_settings.include_sub_track_prefix_index = include_sub_track_prefix_index;
+
+	uint32_t scalar_segment_num_samples;
+	if (parser.try_read("scalar_segment_num_samples", scalar_segment_num_samples, default_settings.scalar_segment_num_samples))
+		out_settings.scalar_segment_num_samples = scalar_segment_num_samples;
+
 	compression_database_settings default_database_settings;
 
 	uint32_t database_max_chunk_size;
@@ -24,6 +24,7 @@
 
 #include "acl_compressor.h"
 
+#include "acl/core/bulk_data_codec.h"
 #include "acl/core/compressed_database.h"
 #include "acl/core/compressed_tracks.h"
 #include "acl/core/floating_point_exceptions.h"
@@ -213,6 +214,30 @@ static void validate_db_streaming(iallocator& allocator, const track_array_qvvf&
 		const track_error low_quality_tier_error1_ = calculate_compression_error(allocator, raw_tracks, context1, error_metric, additive_base_tracks);
 		ACL_ASSERT(low_quality_tier_error1_.error == low_quality_tier_error1.error, "Low quality should be restored");
 	}
+
+	// Stream out while a decompression scope is in flight, the chunks are released once it ends
+	stream_in_database_tier(db_context, db_medium_streamer, db, quality_tier::medium_importance);
+
+	if (db.get_num_chunks(quality_tier::medium_importance) != 0)
+	{
+		{
+			database_decompression_scope scope(db_context);
+
+			const database_stream_request_result stream_out_result = db_context.stream_out(quality_tier::medium_importance);
+			ACL_ASSERT(stream_out_result == database_stream_request_result::dispatched, "Failed to stream out tier");
+			ACL_ASSERT(db_medium_streamer.get_bulk_data(quality_tier::medium_importance) != nullptr, "Bulk data should remain allocated while the scope is in flight");
+			ACL_ASSERT(db_context.dispatch_deferred_stream_outs() == 1, "Stream out request should be deferred");
+			ACL_ASSERT(!db_context.is_streamed_in(quality_tier::medium_importance), "Chunks should no longer be used by decompression");
+
+			// New seeks no longer see the medium importance tier
+			const track_error low_quality_tier_error0_ = calculate_compression_error(allocator, raw_tracks, context0, error_metric, additive_base_tracks);
+			ACL_ASSERT(low_quality_tier_error0_.error == low_quality_tier_error0.error, "Low quality should be restored");
+		}
+
+		ACL_ASSERT(db_context.dispatch_deferred_stream_outs() == 0, "Stream out request should be dispatched");
+		ACL_ASSERT(db_medium_streamer.get_bulk_data(quality_tier::medium_importance) == nullptr, "Bulk data should not be allocated");
+		ACL_ASSERT(!db_context.is_streaming(quality_tier::medium_importance), "Stream out request should be complete");
+	}
 }
 
 static void validate_db_stripping(iallocator& allocator, const track_array_qvvf& raw_tracks, const track_array_qvvf& additive_base_tracks, const itransform_error_metric& error_metric,
@@ -495,6 +520,86 @@ static bool has_zero_scale(const track_array_qvvf& raw_tracks)
 	return false;
 }
 
+static void validate_db_incremental(iallocator& allocator, const track_array_qvvf& raw_tracks, const track_array_qvvf& additive_base_tracks, const itransform_error_metric& error_metric,
+	const compression_database_settings& settings, const track_error& high_quality_tier_error_ref, float threshold,
+	const compressed_tracks& input_tracks1, const compressed_tracks& db_tracks0, const compressed_database& db0)
+{
+	// Append our second clip to the first database
+	const compressed_tracks* appended_tracks[1] = { &input_tracks1 };
+	compressed_tracks* db_tracks1[1] = { nullptr };
+	compressed_database* db01 = nullptr;
+
+	const error_result append_result = append_to_database(allocator, settings, db0, &appended_tracks[0], 1, db_tracks1, db01);
+	ACL_ASSERT(append_result.empty(), append_result.c_str());
+	ACL_ASSERT(db01->is_valid(true).empty(), "Failed to append to database");
+	ACL_ASSERT(db01->get_num_clips() == 2, "Database should contain both clips");
+	ACL_ASSERT(db01->contains(db_tracks0), "Database should contain our clip");
+	ACL_ASSERT(db01->contains(*db_tracks1[0]), "Database should contain our clip");
+
+	// Existing chunks must remain identical
+	const quality_tier tiers[2] = { quality_tier::medium_importance, quality_tier::lowest_importance };
+	for (quality_tier tier : tiers)
+	{
+		const uint32_t bulk_data_size = db0.get_bulk_data_size(tier);
+		ACL_ASSERT(db01->get_num_chunks(tier) >= db0.get_num_chunks(tier), "Chunks should only be appended");
+		ACL_ASSERT(bulk_data_size == 0 || std::memcmp(db01->get_bulk_data(tier), db0.get_bulk_data(tier), bulk_data_size) == 0, "Existing chunks should remain identical");
+	}
+
+	{
+		decompression_context<debug_transform_decompression_settings_with_db> context0;
+		decompression_context<debug_transform_decompression_settings_with_db> context1;
+		database_context<acl::debug_database_settings> db_context;
+
+		bool initialized = db_context.initialize(allocator, *db01);
+		initialized = initialized && context0.initialize(db_tracks0, db_context);
+		initialized = initialized && context1.initialize(*db_tracks1[0], db_context);
+		ACL_ASSERT(initialized, "Failed to initialize decompression context");
+
+		const track_error error_tier0 = calculate_compression_error(allocator, raw_tracks, context0, error_metric, additive_base_tracks);
+		ACL_ASSERT(rtm::scalar_near_equal(error_tier0.error, high_quality_tier_error_ref.error, threshold), "Appended database should have the same error");
+
+		const track_error error_tier1 = calculate_compression_error(allocator, raw_tracks, context1, error_metric, additive_base_tracks);
+		ACL_ASSERT(rtm::scalar_near_equal(error_tier1.error, high_quality_tier_error_ref.error, threshold), "Appended database should have the same error");
+	}
+
+	// Remove our first clip
+	const compressed_tracks* removed_tracks[1] = { &db_tracks0 };
+	compressed_database* db1 = nullptr;
+
+	const error_result remove_result = remove_from_database(allocator, *db01, &removed_tracks[0], 1, db1);
+	ACL_ASSERT(remove_result.empty(), remove_result.c_str());
+	ACL_ASSERT(db1->is_valid(true).empty(), "Failed to remove from database");
+	ACL_ASSERT(!db1->contains(db_tracks0), "Database should no longer contain our clip");
+	ACL_ASSERT(db1->contains(*db_tracks1[0]), "Database should contain our clip");
+
+	// Compact our database, our remaining clip must remain bound
+	compressed_database* compacted_db1 = nullptr;
+
+	const error_result compact_result = compact_database(allocator, *db1, compacted_db1);
+	ACL_ASSERT(compact_result.empty(), compact_result.c_str());
+	ACL_ASSERT(compacted_db1->is_valid(true).empty(), "Failed to compact database");
+	ACL_ASSERT(compacted_db1->get_size() <= db1->get_size(), "Compaction should not grow the database");
+	ACL_ASSERT(!compacted_db1->contains(db_tracks0), "Database should no longer contain our clip");
+	ACL_ASSERT(compacted_db1->contains(*db_tracks1[0]), "Database should contain our clip");
+
+	{
+		decompression_context<debug_transform_decompression_settings_with_db> context;
+		database_context<acl::debug_database_settings> db_context;
+
+		bool initialized = db_context.initialize(allocator, *compacted_db1);
+		initialized = initialized && context.initialize(*db_tracks1[0], db_context);
+		ACL_ASSERT(initialized, "Failed to initialize decompression context");
+
+		const track_error error_tier1 = calculate_compression_error(allocator, raw_tracks, context, error_metric, additive_base_tracks);
+		ACL_ASSERT(rtm::scalar_near_equal(error_tier1.error, high_quality_tier_error_ref.error, threshold), "Compacted database should have the same error");
+	}
+
+	allocator.deallocate(db_tracks1[0], db_tracks1[0]->get_size());
+	allocator.deallocate(compacted_db1, compacted_db1->get_size());
+	allocator.deallocate(db1, db1->get_size());
+	allocator.deallocate(db01, db01->get_size());
+}
+
 void validate_db(iallocator& allocator, const track_array_qvvf& raw_tracks, const track_array_qvvf& additive_base_tracks,
 	const compression_database_settings& settings, const itransform_error_metric& error_metric,
 	const compressed_tracks& compressed_tracks0, const compressed_tracks& compressed_tracks1)
@@ -660,6 +765,9 @@ void validate_db(iallocator& allocator, const track_array_qvvf& raw_tracks, cons
 		ACL_ASSERT(db_context0.relocated(*db0), "Relocation should succeed");
 	}
 
+	// Append, remove, and compact incrementally
+	validate_db_incremental(allocator, raw_tracks, additive_base_tracks, error_metric, settings, high_quality_tier_error_ref, threshold, *input_tracks[1], *db_tracks0[0], *db0);
+
 	// Measure the tier error when stripping
 	validate_db_stripping(allocator, raw_tracks, additive_base_tracks, error_metric, *db_tracks01[0], *db_tracks01[1], *db01, db01->get_bulk_data(quality_tier::medium_importance), db01->get_bulk_data(quality_tier::lowest_importance));
 
@@ -680,6 +788,31 @@ void validate_db(iallocator& allocator, const track_array_qvvf& raw_tracks, cons
 	// Measure the tier error when stripping
 	validate_db_stripping(allocator, raw_tracks, additive_base_tracks, error_metric, *db_tracks01[0], *db_tracks01[1], *split_db, split_db_bulk_data_medium, split_db_bulk_data_low);
 
+	// Compress the bulk data chunks, they must decompress into the original bulk data
+	{
+		const quality_tier tiers[2] = { quality_tier::medium_importance, quality_tier::lowest_importance };
+		const uint8_t* tier_bulk_data[2] = { split_db_bulk_data_medium, split_db_bulk_data_low };
+
+		for (uint32_t tier_index = 0; tier_index < 2; ++tier_index)
+		{
+			const uint32_t bulk_data_size = split_db->get_bulk_data_size(tiers[tier_index]);
+
+			uint8_t* compressed_bulk_data = nullptr;
+			uint32_t compressed_bulk_data_size = 0;
+			const error_result compress_result = compress_database_bulk_data(allocator, *split_db, tiers[tier_index], tier_bulk_data[tier_index], compressed_bulk_data, compressed_bulk_data_size);
+			ACL_ASSERT(compress_result.empty(), "Failed to compress bulk data");
+
+			uint8_t* decompressed_bulk_data = allocate_type_array<uint8_t>(allocator, bulk_data_size);
+			const bool is_decompressed = decompress_database_bulk_data(compressed_bulk_data, compressed_bulk_data_size, decompressed_bulk_data, bulk_data_size);
+			ACL_ASSERT(is_decompressed, "Failed to decompress bulk data");
+			ACL_ASSERT(bulk_data_size == 0 || std::memcmp(decompressed_bulk_data, tier_bulk_data[tier_index], bulk_data_size) == 0, "Decompressed bulk data should be identical");
+			(void)is_decompressed;
+
+			deallocate_type_array(allocator, decompressed_bulk_data, bulk_data_size);
+			deallocate_type_array(allocator, compressed_bulk_data, compressed_bulk_data_size);
+		}
+	}
+
 	// Duplicate our clips so we can modify them
 	compressed_tracks* compressed_tracks_copy0 = safe_ptr_cast<compressed_tracks>(allocate_type_array_aligned<uint8_t>(allocator, db_tracks0[0]->get_size(), alignof(compressed_tracks)));
 	compressed_tracks* compressed_tracks_copy1 = safe_ptr_cast<compressed_tracks>(allocate_type_array_aligned<uint8_t>(allocator, db_tracks1[0]->get_size(), alignof(compressed_tracks)));
@@ -715,4 +848,123 @@ void validate_db(iallocator& allocator, const track_array_qvvf& raw_tracks, cons
 	allocator.deallocate(db1, db1->get_size());
 	allocator.deallocate(db01, db01->get_size());
 }
+
+void validate_db(iallocator& allocator, const track_array& raw_tracks, const compression_database_settings& settings, const compressed_tracks& compressed_tracks_)
+{
+	using namespace acl_impl;
+
+	// We do not support building empty databases
+	if (compressed_tracks_.get_num_tracks() == 0 || compressed_tracks_.get_num_samples_per_track() == 0)
+		return;
+
+	// Disable floating point exceptions since decompression assumes it
+	scope_disable_fp_exceptions fp_off;
+
+	// Our desired error threshold, see above
+#if !defined(RTM_SSE2_INTRINSICS) && defined(RTM_ARCH_X86)
+	const float threshold = 1.0E-3F;
+#else
+	const float threshold = 1.0E-4F;
+#endif
+
+	// Build our database
+	const compressed_tracks* input_tracks[1] = { &compressed_tracks_ };
+	compressed_tracks* db_tracks[1] = { nullptr };
+	compressed_database* db = nullptr;
+
+	const error_result db_result = build_database(allocator, settings, &input_tracks[0], 1, db_tracks, db);
+	ACL_ASSERT(db_result.empty(), db_result.c_str());
+
+#if defined(RTM_COMPILER_MSVC)
+	#pragma warning(push)
+	// warning C6011: Dereferencing NULL pointer '...'.
+	// Crashing is fine since this is used for regression testing
+	#pragma warning(disable : 6011)
+#endif
+
+	ACL_ASSERT(db->contains(*db_tracks[0]), "Database should contain our clip");
+
+#if defined(RTM_COMPILER_MSVC)
+	#pragma warning(pop)
+#endif
+
+	// Reference error without the database with everything highest quality
+	track_error high_quality_tier_error_ref;
+	{
+		acl::decompression_context<debug_scalar_decompression_settings_with_db> context;
+
+		const bool initialized = context.initialize(compressed_tracks_);
+		ACL_ASSERT(initialized, "Failed to initialize decompression context"); (void)initialized;
+
+		high_quality_tier_error_ref = calculate_compression_error(allocator, raw_tracks, context);
+	}
+
+	// Split the database bulk data out so we can stream each tier in and out
+	compressed_database* split_db = nullptr;
+	uint8_t* split_db_bulk_data_medium = nullptr;
+	uint8_t* split_db_bulk_data_low = nullptr;
+	const error_result split_result = split_database_bulk_data(allocator, *db, split_db, split_db_bulk_data_medium, split_db_bulk_data_low);
+	ACL_ASSERT(split_result.empty(), "Failed to split database");
+	ACL_ASSERT(split_db->is_valid(true).empty(), "Failed to split database");
+	ACL_ASSERT(split_db->contains(*db_tracks[0]), "Database should contain our clip");
+
+	{
+		acl::decompression_context<debug_scalar_decompression_settings_with_db> context;
+		acl::database_context<acl::debug_database_settings> db_context;
+		debug_database_streamer db_medium_streamer(allocator, split_db_bulk_data_medium, split_db->get_bulk_data_size(quality_tier::medium_importance));
+		debug_database_streamer db_low_streamer(allocator, split_db_bulk_data_low, split_db->get_bulk_data_size(quality_tier::lowest_importance));
+
+		bool initialized = db_context.initialize(allocator, *split_db, db_medium_streamer, db_low_streamer);
+		initialized = initialized && context.initialize(*db_tracks[0], db_context);
+		ACL_ASSERT(initialized, "Failed to initialize decompression context");
+
+		bool is_bound = db_context.is_bound_to(*split_db);
+		is_bound = is_bound && context.is_bound_to(*db_tracks[0]);
+		is_bound = is_bound && context.is_bound_to(*split_db);
+		ACL_ASSERT(is_bound, "Failed to bind decompression context");
+
+		// Nothing is streamed in yet, we have low quality
+		const track_error low_quality_tier_error = calculate_compression_error(allocator, raw_tracks, context);
+		ACL_ASSERT(rtm::scalar_is_finite(low_quality_tier_error.error), "Returned error is not a finite value");
+		ACL_ASSERT(low_quality_tier_error.error + threshold >= high_quality_tier_error_ref.error, "Low quality tier split error should be higher or equal to high quality tier inline");
+
+		// Stream in our medium importance tier
+		stream_in_database_tier(db_context, db_medium_streamer, *split_db, quality_tier::medium_importance);
+
+		const track_error medium_quality_tier_error = calculate_compression_error(allocator, raw_tracks, context);
+		ACL_ASSERT(medium_quality_tier_error.error + threshold >= high_quality_tier_error_ref.error, "Medium quality tier split error should be higher or equal to high quality tier inline");
+		ACL_ASSERT(low_quality_tier_error.error + threshold >= medium_quality_tier_error.error, "Low quality tier split error should be higher or equal to medium quality tier split error");
+
+		// Stream in our low importance tier, restoring the full high quality
+		stream_in_database_tier(db_context, db_low_streamer, *split_db, quality_tier::lowest_importance);
+
+		const track_error high_quality_tier_error = calculate_compression_error(allocator, raw_tracks, context);
+		ACL_ASSERT(rtm::scalar_near_equal(high_quality_tier_error.error, high_quality_tier_error_ref.error, threshold), "High quality tier split error should be equal to high quality tier inline");
+
+		// Stream out our low importance tier, restoring medium quality
+		stream_out_database_tier(db_context, db_low_streamer, *split_db, quality_tier::lowest_importance);
+
+		const track_error medium_quality_tier_error_ = calculate_compression_error(allocator, raw_tracks, context);
+		ACL_ASSERT(medium_quality_tier_error_.error == medium_quality_tier_error.error, "Medium quality should be restored");
+
+		// Stream out our medium importance tier, restoring low quality
+		stream_out_database_tier(db_context, db_medium_streamer, *split_db, quality_tier::medium_importance);
+
+		const track_error low_quality_tier_error_ = calculate_compression_error(allocator, raw_tracks, context);
+		ACL_ASSERT(low_quality_tier_error_.error == low_quality_tier_error.error, "Low quality should be restored");
+
+		(void)low_quality_tier_error;
+		(void)medium_quality_tier_error;
+		(void)high_quality_tier_error;
+		(void)medium_quality_tier_error_;
+		(void)low_quality_tier_error_;
+	}
+
+	// Free our memory
+	allocator.deallocate(split_db_bulk_data_medium, split_db->get_bulk_data_size(quality_tier::medium_importance));
+	allocator.deallocate(split_db_bulk_data_low, split_db->get_bulk_data_size(quality_tier::lowest_importance));
+	allocator.deallocate(split_db, split_db->get_size());
+	allocator.deallocate(db_tracks[0], db_tracks[0]->get_size());
+	allocator.deallocate(db, db->get_size());
+}
 #endif
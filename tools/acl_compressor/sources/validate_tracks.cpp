@@ -88,6 +88,98 @@ void validate_transform_tracks(const acl::acl_impl::debug_track_writer& referenc
 	}
 }
 
+// Validates that the tracks within [first_track_index, end_track_index) decompressed through another API match
+// the reference pose decompressed with decompress_tracks
+static void validate_transform_tracks_match(const rtm::qvvf* reference, const rtm::qvvf* transforms, const char* api_name,
+	uint32_t first_track_index, uint32_t end_track_index, float sample_time, float quat_error_threshold, float vec3_error_threshold)
+{
+	(void)api_name;
+	(void)sample_time;
+
+	for (uint32_t track_index = first_track_index; track_index < end_track_index; ++track_index)
+	{
+		const rtm::qvvf& ref_transform = reference[track_index];
+		const rtm::qvvf& transform = transforms[track_index];
+
+		ACL_ASSERT(rtm::quat_near_equal(ref_transform.rotation, transform.rotation, quat_error_threshold),
+			"Failed to sample rotation with %s for bone index %u at sample time %.4f. Expected [%.5f, %.5f, %.5f, %.5f], got [%.5f, %.5f, %.5f, %.5f].",
+			api_name, track_index, sample_time,
+			(float)rtm::quat_get_x(ref_transform.rotation), (float)rtm::quat_get_y(ref_transform.rotation), (float)rtm::quat_get_z(ref_transform.rotation), (float)rtm::quat_get_w(ref_transform.rotation),
+			(float)rtm::quat_get_x(transform.rotation), (float)rtm::quat_get_y(transform.rotation), (float)rtm::quat_get_z(transform.rotation), (float)rtm::quat_get_w(transform.rotation));
+
+		ACL_ASSERT(rtm::vector_all_near_equal3(ref_transform.translation, transform.translation, vec3_error_threshold),
+			"Failed to sample translation with %s for bone index %u at sample time %.4f. Expected [%.5f, %.5f, %.5f], got [%.5f, %.5f, %.5f].",
+			api_name, track_index, sample_time,
+			(float)rtm::vector_get_x(ref_transform.translation), (float)rtm::vector_get_y(ref_transform.translation), (float)rtm::vector_get_z(ref_transform.translation),
+			(float)rtm::vector_get_x(transform.translation), (float)rtm::vector_get_y(transform.translation), (float)rtm::vector_get_z(transform.translation));
+
+		ACL_ASSERT(rtm::vector_all_near_equal3(ref_transform.scale, transform.scale, vec3_error_threshold),
+			"Failed to sample scale with %s for bone index %u at sample time %.4f. Expected [%.5f, %.5f, %.5f], got [%.5f, %.5f, %.5f].",
+			api_name, track_index, sample_time,
+			(float)rtm::vector_get_x(ref_transform.scale), (float)rtm::vector_get_y(ref_transform.scale), (float)rtm::vector_get_z(ref_transform.scale),
+			(float)rtm::vector_get_x(transform.scale), (float)rtm::vector_get_y(transform.scale), (float)rtm::vector_get_z(transform.scale));
+	}
+}
+
+// Same as our debug settings but with the decoded key frame cache enabled
+struct keyframe_cache_decompression_settings : public debug_transform_decompression_settings
+{
+	static constexpr bool is_keyframe_cache_supported() { return true; }
+};
+
+// Writes the pose of every sample time or sample decompressed in a single call one after the other
+// Default sub-tracks are written from the provided default pose
+struct multi_pose_track_writer final : public track_writer
+{
+	multi_pose_track_writer(iallocator& allocator_, uint32_t num_tracks_, uint32_t num_poses_, const rtm::qvvf* default_sub_tracks_)
+		: allocator(allocator_)
+		, poses(allocate_type_array<rtm::qvvf>(allocator_, size_t(num_tracks_) * num_poses_))
+		, default_sub_tracks(default_sub_tracks_)
+		, num_tracks(num_tracks_)
+		, num_poses(num_poses_)
+		, pose_offset(0)
+	{
+	}
+
+	~multi_pose_track_writer()
+	{
+		deallocate_type_array(allocator, poses, size_t(num_tracks) * num_poses);
+	}
+
+	multi_pose_track_writer(const multi_pose_track_writer&) = delete;
+	multi_pose_track_writer& operator=(const multi_pose_track_writer&) = delete;
+
+	static constexpr default_sub_track_mode get_default_rotation_mode() { return default_sub_track_mode::variable; }
+	static constexpr default_sub_track_mode get_default_translation_mode() { return default_sub_track_mode::variable; }
+	static constexpr default_sub_track_mode get_default_scale_mode() { return default_sub_track_mode::variable; }
+
+	rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t track_index) const { return default_sub_tracks[track_index].rotation; }
+	rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t track_index) const { return default_sub_tracks[track_index].translation; }
+	rtm::vector4f RTM_SIMD_CALL get_variable_default_scale(uint32_t track_index) const { return default_sub_tracks[track_index].scale; }
+
+	void set_sample_time_index(uint32_t sample_time_index) { set_pose_index(sample_time_index); }
+	void set_sample_index(uint32_t sample_index) { set_pose_index(sample_index); }
+
+	void set_pose_index(uint32_t pose_index)
+	{
+		ACL_ASSERT(pose_index < num_poses, "Invalid pose index");
+		pose_offset = pose_index * num_tracks;
+	}
+
+	void RTM_SIMD_CALL write_rotation(uint32_t track_index, rtm::quatf_arg0 rotation) { poses[pose_offset + track_index].rotation = rotation; }
+	void RTM_SIMD_CALL write_translation(uint32_t track_index, rtm::vector4f_arg0 translation) { poses[pose_offset + track_index].translation = translation; }
+	void RTM_SIMD_CALL write_scale(uint32_t track_index, rtm::vector4f_arg0 scale) { poses[pose_offset + track_index].scale = scale; }
+
+	const rtm::qvvf* get_pose(uint32_t pose_index) const { return poses + (pose_index * num_tracks); }
+
+	iallocator& allocator;
+	rtm::qvvf* poses;
+	const rtm::qvvf* default_sub_tracks;
+	uint32_t num_tracks;
+	uint32_t num_poses;
+	uint32_t pose_offset;
+};
+
 void validate_accuracy(
 	iallocator& allocator,
 	const track_array_qvvf& raw_tracks,
@@ -210,6 +302,15 @@ void validate_accuracy(
 		}
 	}
 
+	// The other decompression APIs must match decompress_tracks exactly unless x87 rounding is at play (see above)
+#if !defined(RTM_SSE2_INTRINSICS) && defined(RTM_ARCH_X86)
+	const float exact_quat_error_threshold = quat_error_threshold;
+	const float exact_vec3_error_threshold = vec3_error_threshold;
+#else
+	const float exact_quat_error_threshold = 0.0F;
+	const float exact_vec3_error_threshold = 0.0F;
+#endif
+
 	// Regression test
 	for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
 	{
@@ -256,6 +357,244 @@ void validate_accuracy(
 				(float)rtm::vector_get_x(transform1.scale), (float)rtm::vector_get_y(transform1.scale), (float)rtm::vector_get_z(transform1.scale));
 		}
 	}
+
+	// Validate the subset decompression against decompress_tracks with a few sparse selections of tracks
+	{
+		debug_track_writer track_writer_subset(allocator, track_type8::qvvf, num_tracks);
+		track_writer_subset.initialize_with_defaults(raw_tracks);
+
+		const bitset_description subset_desc = bitset_description::make_from_num_bits(num_tracks);
+		uint32_t* track_subset = allocate_type_array<uint32_t>(allocator, subset_desc.get_size());
+
+		const uint32_t subset_strides[] = { 2, 3, 7 };
+
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			const float sample_time = rtm::scalar_min(float(sample_index) / sample_rate, duration);
+
+			context.seek(sample_time, rounding_policy);
+			context.decompress_tracks(track_writer);
+
+			for (uint32_t subset_stride : make_iterator(subset_strides))
+			{
+				// Offset every selection to avoid always starting on the first track of a group
+				bitset_reset(track_subset, subset_desc, false);
+				for (uint32_t track_index = sample_index % subset_stride; track_index < num_tracks; track_index += subset_stride)
+					bitset_set(track_subset, subset_desc, track_index, true);
+
+				context.decompress_tracks(track_subset, subset_desc, track_writer_subset);
+
+				for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+				{
+					if (bitset_test(track_subset, subset_desc, track_index))
+						validate_transform_tracks_match(track_writer.tracks_typed.qvvf, track_writer_subset.tracks_typed.qvvf, "decompress_tracks with a track subset", track_index, track_index + 1, sample_time, exact_quat_error_threshold, exact_vec3_error_threshold);
+				}
+			}
+		}
+
+		deallocate_type_array(allocator, track_subset, subset_desc.get_size());
+	}
+
+	// Validate decompress_track_range against decompress_tracks with ranges that start and end within groups of 4 and sub-track entries
+	{
+		debug_track_writer track_writer_range(allocator, track_type8::qvvf, num_tracks);
+		track_writer_range.initialize_with_defaults(raw_tracks);
+
+		const uint32_t range_sizes[] = { 1, 3, 16, 21 };
+
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			const float sample_time = rtm::scalar_min(float(sample_index) / sample_rate, duration);
+
+			context.seek(sample_time, rounding_policy);
+			context.decompress_tracks(track_writer);
+
+			for (uint32_t range_size : make_iterator(range_sizes))
+			{
+				for (uint32_t first_track_index = 0; first_track_index < num_tracks; first_track_index += range_size)
+				{
+					const uint32_t num_tracks_left = num_tracks - first_track_index;
+					const uint32_t num_tracks_in_range = range_size < num_tracks_left ? range_size : num_tracks_left;
+
+					context.decompress_track_range(first_track_index, num_tracks_in_range, track_writer_range);
+					validate_transform_tracks_match(track_writer.tracks_typed.qvvf, track_writer_range.tracks_typed.qvvf, "decompress_track_range", first_track_index, first_track_index + num_tracks_in_range, sample_time, exact_quat_error_threshold, exact_vec3_error_threshold);
+				}
+			}
+		}
+	}
+
+	// Validate decompress_tracks_at against seeking and calling decompress_tracks for every sample time
+	// Our sample times are unsorted, repeat, and fall between samples to exercise the sorting and interpolation
+	if (num_samples != 0)
+	{
+		const uint32_t num_sample_times = num_samples * 2;
+		float* sample_times = allocate_type_array<float>(allocator, num_sample_times);
+
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			const float sample_time = rtm::scalar_min((float(num_samples - sample_index - 1) + 0.5F) / sample_rate, duration);
+			sample_times[sample_index * 2 + 0] = sample_time;
+			sample_times[sample_index * 2 + 1] = (sample_index % 3) == 0 ? sample_time : (float(sample_index) / sample_rate);
+		}
+
+		debug_track_writer default_pose(allocator, track_type8::qvvf, num_tracks);
+		default_pose.initialize_with_defaults(raw_tracks);
+
+		multi_pose_track_writer track_writer_multi(allocator, num_tracks, num_sample_times, default_pose.tracks_typed.qvvf);
+
+		const bitset_description subset_desc = bitset_description::make_from_num_bits(num_tracks);
+		uint32_t* track_subset = allocate_type_array<uint32_t>(allocator, subset_desc.get_size());
+
+		bitset_reset(track_subset, subset_desc, false);
+		for (uint32_t track_index = 1; track_index < num_tracks; track_index += 2)
+			bitset_set(track_subset, subset_desc, track_index, true);
+
+		for (uint32_t subset_index = 0; subset_index < 2; ++subset_index)
+		{
+			const uint32_t* subset = subset_index == 0 ? nullptr : track_subset;
+
+			context.decompress_tracks_at(sample_times, num_sample_times, sample_rounding_policy::none, subset, subset_desc, track_writer_multi);
+
+			for (uint32_t sample_time_index = 0; sample_time_index < num_sample_times; ++sample_time_index)
+			{
+				const float sample_time = sample_times[sample_time_index];
+
+				context.seek(sample_time, sample_rounding_policy::none);
+				context.decompress_tracks(track_writer);
+
+				const rtm::qvvf* pose = track_writer_multi.get_pose(sample_time_index);
+				for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+				{
+					if (subset == nullptr || bitset_test(subset, subset_desc, track_index))
+						validate_transform_tracks_match(track_writer.tracks_typed.qvvf, pose, "decompress_tracks_at", track_index, track_index + 1, sample_time, exact_quat_error_threshold, exact_vec3_error_threshold);
+				}
+			}
+		}
+
+		deallocate_type_array(allocator, track_subset, subset_desc.get_size());
+		deallocate_type_array(allocator, sample_times, num_sample_times);
+	}
+
+	// Validate decompress_samples against seeking and calling decompress_tracks for every sample visited
+	// When the samples are walked, we seek a quarter sample past each one to land on it exactly with nearest rounding
+	// The last sample can be clamped, seeking can then land on the previous sample with full weight which introduces rounding
+	// When samples can be missing, every sample is seeked to and we match exactly
+	if (num_samples != 0)
+	{
+		debug_track_writer default_pose(allocator, track_type8::qvvf, num_tracks);
+		default_pose.initialize_with_defaults(raw_tracks);
+
+		multi_pose_track_writer track_writer_multi(allocator, num_tracks, num_samples, default_pose.tracks_typed.qvvf);
+
+		const bool are_samples_seeked = compressed_tracks_.has_stripped_keyframes() || compressed_tracks_.has_database();
+		const float sample_offset = are_samples_seeked ? 0.0F : 0.25F;
+		const uint32_t sample_strides[] = { 1, 3 };
+
+		for (uint32_t sample_stride : make_iterator(sample_strides))
+		{
+			// Start past the first sample with larger strides and request more samples than we have, it must be clamped
+			const uint32_t start_sample_index = sample_stride == 1 ? 0 : (1 % num_samples);
+			context.decompress_samples(start_sample_index, num_samples + sample_stride, sample_stride, track_writer_multi);
+
+			for (uint32_t sample_index = start_sample_index; sample_index < num_samples; sample_index += sample_stride)
+			{
+				const float unclamped_sample_time = (float(sample_index) + sample_offset) / sample_rate;
+				const float sample_time = rtm::scalar_min(unclamped_sample_time, duration);
+				const bool is_exact = are_samples_seeked || unclamped_sample_time <= duration;
+
+				context.seek(sample_time, sample_rounding_policy::nearest);
+				context.decompress_tracks(track_writer);
+
+				const rtm::qvvf* pose = track_writer_multi.get_pose(sample_index);
+				if (is_exact)
+					validate_transform_tracks_match(track_writer.tracks_typed.qvvf, pose, "decompress_samples", 0, num_tracks, sample_time, exact_quat_error_threshold, exact_vec3_error_threshold);
+				else
+				{
+					for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+					{
+						const rtm::qvvf& ref_transform = track_writer.tracks_typed.qvvf[track_index];
+						const rtm::qvvf& transform = pose[track_index];
+
+						ACL_ASSERT(are_rotations_equal(ref_transform.rotation, transform.rotation, quat_error_threshold), "Failed to sample rotation with decompress_samples for bone index %u at sample time %.4f", track_index, sample_time);
+						ACL_ASSERT(rtm::vector_all_near_equal3(ref_transform.translation, transform.translation, rtm::scalar_max(vec3_error_threshold, 0.0001F)), "Failed to sample translation with decompress_samples for bone index %u at sample time %.4f", track_index, sample_time);
+						ACL_ASSERT(rtm::vector_all_near_equal3(ref_transform.scale, transform.scale, rtm::scalar_max(vec3_error_threshold, 0.0001F)), "Failed to sample scale with decompress_samples for bone index %u at sample time %.4f", track_index, sample_time);
+					}
+				}
+			}
+		}
+	}
+
+	// Validate the decoded key frame cache against decompress_tracks, a cache hit must return the same pose as a cache miss
+	if (num_samples != 0)
+	{
+		acl::decompression_context<keyframe_cache_decompression_settings> cache_context;
+
+		const bool cache_context_initialized = cache_context.initialize(compressed_tracks_);
+		ACL_ASSERT(cache_context_initialized, "Failed to initialize decompression context"); (void)cache_context_initialized;
+
+		const uint32_t keyframe_cache_size = cache_context.get_keyframe_cache_size();
+		void* keyframe_cache = allocator.allocate(keyframe_cache_size, 16);
+
+		const bool is_cache_bound = cache_context.set_keyframe_cache(keyframe_cache, keyframe_cache_size);
+		ACL_ASSERT(is_cache_bound, "Failed to bind the key frame cache"); (void)is_cache_bound;
+
+		debug_track_writer track_writer_cache(allocator, track_type8::qvvf, num_tracks);
+		track_writer_cache.initialize_with_defaults(raw_tracks);
+
+		const float sample_offsets[] = { 0.25F, 0.75F };
+
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			// The first sample time between two key frames misses, the second and any repeat hits
+			for (float sample_offset : make_iterator(sample_offsets))
+			{
+				const float sample_time = rtm::scalar_min((float(sample_index) + sample_offset) / sample_rate, duration);
+
+				context.seek(sample_time, sample_rounding_policy::none);
+				context.decompress_tracks(track_writer);
+
+				cache_context.seek(sample_time, sample_rounding_policy::none);
+				cache_context.decompress_tracks(track_writer_cache);
+				validate_transform_tracks_match(track_writer.tracks_typed.qvvf, track_writer_cache.tracks_typed.qvvf, "decompress_tracks with a key frame cache", 0, num_tracks, sample_time, exact_quat_error_threshold, exact_vec3_error_threshold);
+
+				cache_context.decompress_tracks(track_writer_cache);
+				validate_transform_tracks_match(track_writer.tracks_typed.qvvf, track_writer_cache.tracks_typed.qvvf, "decompress_tracks with a key frame cache hit", 0, num_tracks, sample_time, exact_quat_error_threshold, exact_vec3_error_threshold);
+			}
+		}
+
+		// decompress_tracks_at unpacks the key frames shared by consecutive sample times once and interpolates the others from the cache
+		{
+			const uint32_t num_sample_times = num_samples * 2;
+			float* sample_times = allocate_type_array<float>(allocator, num_sample_times);
+
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				sample_times[sample_index * 2 + 0] = rtm::scalar_min((float(sample_index) + sample_offsets[0]) / sample_rate, duration);
+				sample_times[sample_index * 2 + 1] = rtm::scalar_min((float(sample_index) + sample_offsets[1]) / sample_rate, duration);
+			}
+
+			debug_track_writer default_pose(allocator, track_type8::qvvf, num_tracks);
+			default_pose.initialize_with_defaults(raw_tracks);
+
+			multi_pose_track_writer track_writer_multi(allocator, num_tracks, num_sample_times, default_pose.tracks_typed.qvvf);
+
+			cache_context.decompress_tracks_at(sample_times, num_sample_times, sample_rounding_policy::none, nullptr, bitset_description(), track_writer_multi);
+
+			for (uint32_t sample_time_index = 0; sample_time_index < num_sample_times; ++sample_time_index)
+			{
+				const float sample_time = sample_times[sample_time_index];
+
+				context.seek(sample_time, sample_rounding_policy::none);
+				context.decompress_tracks(track_writer);
+
+				validate_transform_tracks_match(track_writer.tracks_typed.qvvf, track_writer_multi.get_pose(sample_time_index), "decompress_tracks_at with a key frame cache", 0, num_tracks, sample_time, exact_quat_error_threshold, exact_vec3_error_threshold);
+			}
+
+			deallocate_type_array(allocator, sample_times, num_sample_times);
+		}
+
+		allocator.deallocate(keyframe_cache, keyframe_cache_size);
+	}
 }
 
 void RTM_SIMD_CALL validate_scalar_tracks(const track_array& raw_tracks, const acl::acl_impl::debug_track_writer& reference, const acl::acl_impl::debug_track_writer& tracks, rtm::vector4f_arg0 regression_error_thresholdv, float sample_time)
@@ -323,6 +662,17 @@ void RTM_SIMD_CALL validate_scalar_tracks(const track_array& raw_tracks, const a
 	}
 }
 
+// Hides the float1 output buffer to force the per track decompression path
+struct per_track_float1_track_writer final : public acl::acl_impl::debug_track_writer
+{
+	per_track_float1_track_writer(iallocator& allocator_, track_type8 type_, uint32_t num_tracks_)
+		: debug_track_writer(allocator_, type_, num_tracks_)
+	{
+	}
+
+	float* get_float1_output_buffer() { return nullptr; }
+};
+
 void validate_accuracy(
 	iallocator& allocator,
 	const track_array& raw_tracks,
@@ -368,6 +718,7 @@ void validate_accuracy(
 	debug_track_writer lossy_track_writer(allocator, track_type, num_tracks);
 
 	debug_track_writer_per_track_rounding track_writer_per_track_rounding(allocator, track_type, num_tracks);
+	per_track_float1_track_writer per_track_float1_writer(allocator, track_type, num_tracks);
 
 	{
 		// Try to decompress something at 0.0, if we have no tracks or samples, it should be handled
@@ -431,6 +782,28 @@ void validate_accuracy(
 		// Validate decompress_tracks
 		validate_scalar_tracks(raw_tracks, raw_tracks_writer, lossy_tracks_writer, regression_error_thresholdv, sample_time);
 
+		if (track_type == track_type8::float1f)
+		{
+			// Validate that the float1 bulk path matches the per track path exactly unless x87 rounding is at play
+#if !defined(RTM_SSE2_INTRINSICS) && defined(RTM_ARCH_X86)
+			const float exact_error_threshold = 0.00001F;
+#else
+			const float exact_error_threshold = 0.0F;
+#endif
+
+			context.decompress_tracks(per_track_float1_writer);
+
+			for (uint32_t output_index = 0; output_index < num_tracks; ++output_index)
+			{
+				const float bulk_value = lossy_tracks_writer.read_float1(output_index);
+				const float per_track_value = per_track_float1_writer.read_float1(output_index);
+				ACL_ASSERT(rtm::scalar_near_equal(bulk_value, per_track_value, exact_error_threshold), "Float1 bulk path mismatch for output track %u at time %f", output_index, sample_time);
+				(void)bulk_value;
+				(void)per_track_value;
+				(void)exact_error_threshold;
+			}
+		}
+
 		// Validate decompress_track
 		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
 		{
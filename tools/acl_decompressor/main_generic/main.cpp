@@ -26,6 +26,8 @@
 
 #include <benchmark/benchmark.h>
 
+#include <cstdlib>
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -88,9 +90,39 @@ static bool is_sjson_file(const char* filename)
 	return filename_len >= 6 && strncmp(filename + filename_len - 6, ".sjson", 6) == 0;
 }
 
-static bool parse_options(int argc, char* argv[], const char*& out_metadata_filename)
+// Parses the database tier proportions, one per database tier from most to least important: -db_tier_proportions=0.2,0.5
+static bool parse_tier_proportions(const char* proportions, acl::compression_database_settings& out_db_settings)
+{
+	const char* cursor = proportions;
+	for (uint32_t tier_index = 0; tier_index < acl::k_num_database_tiers; ++tier_index)
+	{
+		char* end = nullptr;
+		const float proportion = std::strtof(cursor, &end);
+		if (end == cursor)
+			return false;
+
+		const acl::quality_tier tier = acl::quality_tier(tier_index + 1);
+		if (tier == acl::quality_tier::medium_importance)
+			out_db_settings.medium_importance_tier_proportion = proportion;
+		else if (tier == acl::quality_tier::lowest_importance)
+			out_db_settings.low_importance_tier_proportion = proportion;
+		else
+			out_db_settings.intermediate_tier_proportions[tier_index - 1] = proportion;
+
+		const bool is_last_tier = tier_index + 1 == acl::k_num_database_tiers;
+		if (is_last_tier != (*end == '\0'))
+			return false;
+
+		cursor = end + 1;	// Skip the comma
+	}
+
+	return true;
+}
+
+static bool parse_options(int argc, char* argv[], const char*& out_metadata_filename, bool& out_use_database, acl::compression_database_settings& out_db_settings)
 {
 	out_metadata_filename = nullptr;
+	out_use_database = false;
 
 	for (int arg_index = 1; arg_index < argc; ++arg_index)
 	{
@@ -109,6 +141,44 @@ static bool parse_options(int argc, char* argv[], const char*& out_metadata_file
 
 			continue;
 		}
+
+		static constexpr const char* k_database_option = "-database";
+		if (std::strcmp(argument, k_database_option) == 0)
+		{
+			out_use_database = true;
+			continue;
+		}
+
+		static constexpr const char* k_database_max_chunk_size_option = "-db_max_chunk_size=";
+		option_length = std::strlen(k_database_max_chunk_size_option);
+		if (std::strncmp(argument, k_database_max_chunk_size_option, option_length) == 0)
+		{
+			out_db_settings.max_chunk_size = uint32_t(std::strtoul(argument + option_length, nullptr, 10));
+			continue;
+		}
+
+		static constexpr const char* k_database_tier_proportions_option = "-db_tier_proportions=";
+		option_length = std::strlen(k_database_tier_proportions_option);
+		if (std::strncmp(argument, k_database_tier_proportions_option, option_length) == 0)
+		{
+			if (!parse_tier_proportions(argument + option_length, out_db_settings))
+			{
+				printf("Tier proportions must contain one value per database tier: -db_tier_proportions=0.2,0.5\n");
+				return false;
+			}
+
+			continue;
+		}
+	}
+
+	if (out_use_database)
+	{
+		const acl::error_result result = out_db_settings.is_valid();
+		if (result.any())
+		{
+			printf("Invalid database settings: %s\n", result.c_str());
+			return false;
+		}
 	}
 
 	return out_metadata_filename != nullptr;
@@ -180,7 +250,9 @@ int main(int argc, char* argv[])
 #endif
 
 	const char* metadata_filename = nullptr;
-	if (!parse_options(argc, argv, metadata_filename))
+	bool use_database = false;
+	acl::compression_database_settings db_settings;
+	if (!parse_options(argc, argv, metadata_filename, use_database, db_settings))
 		return -1;
 
 	const char* metadata_buffer = nullptr;
@@ -206,11 +278,21 @@ int main(int argc, char* argv[])
 			continue;
 		}
 
-		prepare_clip(clip, *raw_tracks, compressed_clips);
+		if (use_database)
+			prepare_database_clip(clip, *raw_tracks);
+		else
+			prepare_clip(clip, *raw_tracks, compressed_clips);
 
 		s_allocator.deallocate(raw_tracks, raw_tracks->get_size());
 	}
 
+	// In database mode, every clip is merged into a single database
+	if (use_database && !prepare_database(db_settings))
+	{
+		clear_database_benchmark_state();
+		return -4;
+	}
+
 	benchmark::Initialize(&argc, argv);
 
 	// Run benchmarks
@@ -218,6 +300,7 @@ int main(int argc, char* argv[])
 
 	// Clean up
 	clear_benchmark_state();
+	clear_database_benchmark_state();
 
 	for (acl::compressed_tracks* compressed_tracks : compressed_clips)
 		s_allocator.deallocate(compressed_tracks, compressed_tracks->get_size());
@@ -24,6 +24,7 @@
 
 #include <acl/core/ansi_allocator.h>
 #include <acl/core/compressed_tracks.h>
+#include <acl/compression/compression_settings.h>
 
 #include <benchmark/benchmark.h>
 
@@ -39,3 +40,9 @@ bool parse_metadata(const char* buffer, size_t buffer_size, std::string& out_cli
 bool read_clip(const std::string& clip_dir, const std::string& clip, acl::iallocator& allocator, acl::compressed_tracks*& out_compressed_tracks);
 
 bool prepare_clip(const std::string& clip_name, const acl::compressed_tracks& raw_tracks, std::vector<acl::compressed_tracks*>& out_compressed_clips);
+
+bool prepare_database_clip(const std::string& clip_name, const acl::compressed_tracks& raw_tracks);
+
+bool prepare_database(const acl::compression_database_settings& settings);
+
+void clear_database_benchmark_state();
@@ -0,0 +1,798 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/core/compressed_database.h>
+#include <acl/core/compressed_tracks.h>
+#include <acl/core/memory_utils.h>
+#include <acl/compression/compress.h>
+#include <acl/compression/convert.h>
+#include <acl/compression/track_error.h>
+#include <acl/compression/transform_error_metrics.h>
+#include <acl/decompression/decompress.h>
+#include <acl/decompression/database/database.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+// Constants
+
+// Each stream in request reads a single chunk, the chunk size (see compression_database_settings::max_chunk_size)
+// determines how many bytes each read transfers
+static constexpr uint32_t k_num_chunks_per_request = 1;
+
+// How many stream requests can be in flight at the same time, devices with a lower queue depth delay them
+static constexpr uint32_t k_max_num_streaming_requests = 64;
+
+//////////////////////////////////////////////////////////////////////////
+
+using benchmark_clock = std::chrono::steady_clock;
+
+// The timing of a simulated storage device.
+// Every read pays the access latency, even when reading sequentially. This is pessimistic for hard
+// drives that only seek once for adjacent chunks but it matches a fragmented file or a busy device.
+struct storage_device_profile
+{
+	const char* name;
+	uint32_t access_latency_us;		// Time before the first byte of a read is available
+	uint32_t bandwidth_mb_per_sec;	// Transfer rate shared by every read in flight, 0 is unlimited
+	uint32_t queue_depth;			// Number of reads whose access latency can overlap
+};
+
+static const storage_device_profile k_storage_devices[] =
+{
+	{ "HDD", 8000, 160, 1 },		// 7200 RPM hard drive
+	{ "SSD", 90, 530, 32 },			// SATA solid state drive
+	{ "NVMe", 20, 3500, 64 },		// PCIe 3.0 x4 NVMe drive
+};
+
+// Streams from memory without any delay, used to measure decompression and quality
+static const storage_device_profile k_memory_device = { "Memory", 0, 0, k_max_num_streaming_requests };
+
+struct simulated_streamer_stats
+{
+	uint64_t num_requests = 0;
+	uint64_t num_bytes = 0;
+	uint64_t total_latency_ns = 0;
+	uint64_t max_latency_ns = 0;
+	uint64_t total_completion_ns = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// A streamer that imitates the timing of a storage device. The bulk data is copied from
+// memory once the simulated device would have finished reading it and a worker thread
+// completes the requests in the order the device finishes them.
+// A single instance streams every tier of a database.
+////////////////////////////////////////////////////////////////////////////////
+class simulated_database_streamer final : public acl::database_streamer
+{
+public:
+	simulated_database_streamer(acl::iallocator& allocator, const acl::compressed_database& database, const uint8_t* const* tier_bulk_data, const storage_device_profile& device)
+		: acl::database_streamer(m_requests, k_max_num_streaming_requests)
+		, m_allocator(allocator)
+		, m_device(device)
+		, m_lane_available_times(std::max<uint32_t>(device.queue_depth, 1))
+		, m_bus_available_time()
+		, m_is_stopping(false)
+	{
+		for (uint32_t tier_index = 0; tier_index < acl::k_num_database_tiers; ++tier_index)
+		{
+			m_src_bulk_data[tier_index] = tier_bulk_data[tier_index];
+			m_bulk_data[tier_index] = nullptr;
+			m_bulk_data_size[tier_index] = database.get_bulk_data_size(acl::quality_tier(tier_index + 1));
+		}
+
+		m_worker = std::thread(&simulated_database_streamer::worker_main, this);
+	}
+
+	~simulated_database_streamer()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_is_stopping = true;
+		}
+
+		m_wake_up.notify_one();
+		m_worker.join();
+
+		for (uint32_t tier_index = 0; tier_index < acl::k_num_database_tiers; ++tier_index)
+			acl::deallocate_type_array(m_allocator, m_bulk_data[tier_index], m_bulk_data_size[tier_index]);
+	}
+
+	virtual bool is_initialized() const override { return true; }
+
+	virtual const uint8_t* get_bulk_data(acl::quality_tier tier) const override
+	{
+		return m_bulk_data[uint32_t(tier) - 1];
+	}
+
+	virtual void stream_in(uint32_t offset, uint32_t size, bool can_allocate_bulk_data, acl::quality_tier tier, acl::streaming_request_id request_id) override
+	{
+		const uint32_t tier_index = uint32_t(tier) - 1;
+
+		if (can_allocate_bulk_data)
+			m_bulk_data[tier_index] = acl::allocate_type_array_aligned<uint8_t>(m_allocator, m_bulk_data_size[tier_index], 16);
+
+		pending_read read;
+		read.src = m_src_bulk_data[tier_index] + offset;
+		read.dst = m_bulk_data[tier_index] + offset;
+		read.size = size;
+		read.request_id = request_id;
+		read.issue_time = benchmark_clock::now();
+
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			read.done_time = schedule_read(read.issue_time, size);
+			m_pending_reads.push_back(read);
+		}
+
+		m_wake_up.notify_one();
+	}
+
+	virtual void stream_out(uint32_t offset, uint32_t size, bool can_deallocate_bulk_data, acl::quality_tier tier, acl::streaming_request_id request_id) override
+	{
+		(void)offset;
+		(void)size;
+
+		// Releasing memory does not touch the device, complete right away
+		if (can_deallocate_bulk_data)
+		{
+			const uint32_t tier_index = uint32_t(tier) - 1;
+			acl::deallocate_type_array(m_allocator, m_bulk_data[tier_index], m_bulk_data_size[tier_index]);
+			m_bulk_data[tier_index] = nullptr;
+		}
+
+		complete(request_id);
+	}
+
+	simulated_streamer_stats get_stats() const
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		return m_stats;
+	}
+
+private:
+	simulated_database_streamer(const simulated_database_streamer&) = delete;
+	simulated_database_streamer& operator=(const simulated_database_streamer&) = delete;
+
+	struct pending_read
+	{
+		const uint8_t* src;
+		uint8_t* dst;
+		uint32_t size;
+		acl::streaming_request_id request_id;
+		benchmark_clock::time_point issue_time;
+		benchmark_clock::time_point done_time;
+	};
+
+	// Returns when the device finishes the read, must be called with the lock held
+	benchmark_clock::time_point schedule_read(benchmark_clock::time_point issue_time, uint32_t size)
+	{
+		// The read waits for a free slot in the device queue, pays the access latency and
+		// transfers its data once the reads ahead of it are done with the bus
+		auto lane_it = std::min_element(m_lane_available_times.begin(), m_lane_available_times.end());
+
+		const benchmark_clock::time_point start_time = std::max(issue_time, *lane_it);
+		const benchmark_clock::time_point data_ready_time = start_time + std::chrono::microseconds(m_device.access_latency_us);
+		const benchmark_clock::time_point transfer_start_time = std::max(data_ready_time, m_bus_available_time);
+
+		// Bandwidths are in decimal megabytes like device specifications
+		const uint64_t transfer_duration_ns = m_device.bandwidth_mb_per_sec != 0 ? (uint64_t(size) * 1000) / m_device.bandwidth_mb_per_sec : 0;
+		const benchmark_clock::time_point done_time = transfer_start_time + std::chrono::duration_cast<benchmark_clock::duration>(std::chrono::nanoseconds(transfer_duration_ns));
+
+		m_bus_available_time = done_time;
+		*lane_it = done_time;
+
+		return done_time;
+	}
+
+	void worker_main()
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+
+		while (true)
+		{
+			if (m_pending_reads.empty())
+			{
+				if (m_is_stopping)
+					break;
+
+				m_wake_up.wait(lock);
+				continue;
+			}
+
+			auto read_it = std::min_element(m_pending_reads.begin(), m_pending_reads.end(), [](const pending_read& lhs, const pending_read& rhs) { return lhs.done_time < rhs.done_time; });
+			if (benchmark_clock::now() < read_it->done_time)
+			{
+				// A new read might finish sooner, wake up when it is queued
+				m_wake_up.wait_until(lock, read_it->done_time);
+				continue;
+			}
+
+			const pending_read read = *read_it;
+			m_pending_reads.erase(read_it);
+
+			lock.unlock();
+
+			std::memcpy(read.dst, read.src, read.size);
+
+			const benchmark_clock::time_point complete_start = benchmark_clock::now();
+			complete(read.request_id);
+			const benchmark_clock::time_point complete_end = benchmark_clock::now();
+
+			lock.lock();
+
+			const uint64_t latency_ns = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(complete_end - read.issue_time).count());
+			const uint64_t completion_ns = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(complete_end - complete_start).count());
+
+			m_stats.num_requests++;
+			m_stats.num_bytes += read.size;
+			m_stats.total_latency_ns += latency_ns;
+			m_stats.max_latency_ns = std::max(m_stats.max_latency_ns, latency_ns);
+			m_stats.total_completion_ns += completion_ns;
+		}
+	}
+
+	acl::iallocator& m_allocator;
+	const storage_device_profile& m_device;
+
+	const uint8_t* m_src_bulk_data[acl::k_num_database_tiers];
+	uint8_t* m_bulk_data[acl::k_num_database_tiers];
+	uint32_t m_bulk_data_size[acl::k_num_database_tiers];
+
+	// Everything below is protected by the lock
+	mutable std::mutex m_lock;
+	std::condition_variable m_wake_up;
+
+	std::vector<pending_read> m_pending_reads;
+	std::vector<benchmark_clock::time_point> m_lane_available_times;
+	benchmark_clock::time_point m_bus_available_time;
+	simulated_streamer_stats m_stats;
+	bool m_is_stopping;
+
+	std::thread m_worker;
+
+	acl::streaming_request m_requests[k_max_num_streaming_requests];
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+struct benchmark_database_settings final : public acl::database_settings
+{
+	// Only support our latest version
+	static constexpr acl::compressed_tracks_version16 version_supported() { return acl::compressed_tracks_version16::latest; }
+
+	// No budget manager, no need to track clip usage
+	static constexpr bool is_clip_usage_tracking_supported() { return false; }
+};
+
+struct benchmark_database_decompression_settings final : public acl::default_transform_decompression_settings
+{
+	// Only support our latest version
+	static constexpr acl::compressed_tracks_version16 version_supported() { return acl::compressed_tracks_version16::latest; }
+
+	// No need for safety checks
+	static constexpr bool skip_initialize_safety_checks() { return true; }
+
+	using database_settings_type = benchmark_database_settings;
+};
+
+using benchmark_database_context = acl::database_context<benchmark_database_settings>;
+using benchmark_decompression_context = acl::decompression_context<benchmark_database_decompression_settings>;
+
+struct database_benchmark_state
+{
+	std::vector<acl::compressed_tracks*> input_clips;		// Contain the contributing error, freed once the database is built
+	std::vector<acl::track_array> raw_clips;				// Used to measure the error, freed once reported
+
+	std::vector<acl::compressed_tracks*> clips;				// Bound to the database
+	acl::compressed_database* database = nullptr;
+	uint8_t* bulk_data[acl::k_num_database_tiers] = {};
+
+	// Decompression streams from memory, the quality level is the number of database tiers streamed in
+	simulated_database_streamer* streamer = nullptr;
+	benchmark_database_context* db_context = nullptr;
+	benchmark_decompression_context* decompression_contexts = nullptr;
+
+	uint32_t quality_level = 0;
+	uint32_t max_num_tracks = 0;
+};
+
+static database_benchmark_state s_database_benchmark_state;
+
+static const char* get_quality_level_name(uint32_t quality_level)
+{
+	static const char* k_intermediate_names[] = { "high+tier 2", "high+tier 3", "high+tier 4", "high+tier 5", "high+tier 6" };
+
+	if (quality_level == 0)
+		return "high";	// Only the data inside the compressed tracks
+	else if (quality_level == acl::k_num_database_tiers)
+		return "all";
+	else if (quality_level == 1)
+		return "high+medium";
+	else
+		return k_intermediate_names[quality_level - 2];
+}
+
+static bool can_retry_stream_request(acl::database_stream_request_result result)
+{
+	return result == acl::database_stream_request_result::done
+		|| result == acl::database_stream_request_result::streaming_in_progress
+		|| result == acl::database_stream_request_result::no_free_streaming_requests;
+}
+
+// Streams in the first 'quality_level' database tiers one after the other and streams the others out.
+// The time at which each tier is streamed in is written in milliseconds since the call started.
+static bool stream_to_quality_level(benchmark_database_context& context, uint32_t quality_level, double* out_tier_times_ms)
+{
+	const benchmark_clock::time_point start_time = benchmark_clock::now();
+
+	for (uint32_t tier_index = 0; tier_index < acl::k_num_database_tiers; ++tier_index)
+	{
+		const acl::quality_tier tier = acl::quality_tier(tier_index + 1);
+
+		if (tier_index < quality_level)
+		{
+			while (!context.is_streamed_in(tier))
+			{
+				const acl::database_stream_request_result result = context.stream_in(tier, k_num_chunks_per_request);
+				if (result == acl::database_stream_request_result::dispatched)
+					continue;	// Keep the device queue full
+
+				if (!can_retry_stream_request(result))
+					return false;
+
+				// Wait for a request in flight to complete
+				std::this_thread::yield();
+			}
+
+			if (out_tier_times_ms != nullptr)
+				out_tier_times_ms[tier_index] = std::chrono::duration<double, std::milli>(benchmark_clock::now() - start_time).count();
+		}
+		else
+		{
+			while (true)
+			{
+				const acl::database_stream_request_result result = context.stream_out(tier);
+				if (result == acl::database_stream_request_result::done)
+					break;	// Stream out requests complete right away
+
+				if (result != acl::database_stream_request_result::dispatched && !can_retry_stream_request(result))
+					return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+static bool initialize_database_context(benchmark_database_context& context, simulated_database_streamer& streamer)
+{
+	acl::database_streamer* tier_streamers[acl::k_num_database_tiers];
+	for (uint32_t tier_index = 0; tier_index < acl::k_num_database_tiers; ++tier_index)
+		tier_streamers[tier_index] = &streamer;
+
+	return context.initialize(s_allocator, *s_database_benchmark_state.database, tier_streamers, acl::k_num_database_tiers);
+}
+
+static bool set_decompression_quality_level(uint32_t quality_level)
+{
+	database_benchmark_state& state = s_database_benchmark_state;
+	if (state.quality_level == quality_level)
+		return true;
+
+	if (!stream_to_quality_level(*state.db_context, quality_level, nullptr))
+		return false;
+
+	state.quality_level = quality_level;
+	return true;
+}
+
+static void benchmark_database_streaming(benchmark::State& state)
+{
+	const storage_device_profile& device = k_storage_devices[state.range(0)];
+
+	// The streamer must outlive the context
+	simulated_database_streamer streamer(s_allocator, *s_database_benchmark_state.database, s_database_benchmark_state.bulk_data, device);
+	benchmark_database_context context;
+	if (!initialize_database_context(context, streamer))
+	{
+		state.SkipWithError("Failed to initialize the database context");
+		return;
+	}
+
+	double total_tier_times_ms[acl::k_num_database_tiers] = { 0.0 };
+	double total_time_ms = 0.0;
+
+	for (auto _ : state)
+	{
+		(void)_;
+
+		double tier_times_ms[acl::k_num_database_tiers] = { 0.0 };
+		if (!stream_to_quality_level(context, acl::k_num_database_tiers, tier_times_ms))
+		{
+			state.SkipWithError("Failed to stream in the database");
+			break;
+		}
+
+		const double elapsed_ms = tier_times_ms[acl::k_num_database_tiers - 1];
+		state.SetIterationTime(elapsed_ms / 1000.0);
+
+		for (uint32_t tier_index = 0; tier_index < acl::k_num_database_tiers; ++tier_index)
+			total_tier_times_ms[tier_index] += tier_times_ms[tier_index];
+		total_time_ms += elapsed_ms;
+
+		// Stream everything out for the next iteration, this is not measured
+		if (!stream_to_quality_level(context, 0, nullptr))
+		{
+			state.SkipWithError("Failed to stream out the database");
+			break;
+		}
+	}
+
+	const simulated_streamer_stats stats = streamer.get_stats();
+	if (stats.num_requests == 0 || state.iterations() == 0)
+		return;
+
+	const double num_requests = double(stats.num_requests);
+	const double num_iterations = double(state.iterations());
+
+	// Stream in latency is measured from the request until complete(..) returns, completion is the cost of complete(..) itself
+	state.counters["Latency_us"] = double(stats.total_latency_ns) / num_requests / 1000.0;
+	state.counters["MaxLatency_us"] = double(stats.max_latency_ns) / 1000.0;
+	state.counters["Complete_ns"] = double(stats.total_completion_ns) / num_requests;
+	state.counters["Requests"] = num_requests / num_iterations;
+	// Decimal megabytes like the device bandwidths
+	state.counters["Throughput_MBps"] = total_time_ms > 0.0 ? (double(stats.num_bytes) / 1.0E6) / (total_time_ms / 1000.0) : 0.0;
+
+	// When each quality level becomes available
+	for (uint32_t tier_index = 0; tier_index < acl::k_num_database_tiers; ++tier_index)
+		state.counters[std::string(get_quality_level_name(tier_index + 1)) + "_ms"] = total_tier_times_ms[tier_index] / num_iterations;
+}
+
+static void benchmark_database_decompression(benchmark::State& state)
+{
+	const uint32_t quality_level = uint32_t(state.range(0));
+
+	database_benchmark_state& db_state = s_database_benchmark_state;
+	if (!set_decompression_quality_level(quality_level))
+	{
+		state.SkipWithError("Failed to stream the database");
+		return;
+	}
+
+	const uint32_t num_clips = uint32_t(db_state.clips.size());
+	acl::acl_impl::debug_track_writer pose_writer(s_allocator, acl::track_type8::qvvf, db_state.max_num_tracks);
+
+	// Unlike the clip benchmark, we decompress every clip in turn without copying them and we do not flush
+	// the CPU cache. Only large clip sets will measure a cold cache.
+	constexpr uint32_t k_num_decompression_samples = 100;
+
+	uint32_t current_clip_index = 0;
+	uint32_t current_sample_index = 0;
+	for (auto _ : state)
+	{
+		(void)_;
+
+		benchmark_decompression_context& context = db_state.decompression_contexts[current_clip_index];
+
+		// Use clamp policy as it is the most common
+		const float duration = db_state.clips[current_clip_index]->get_finite_duration(acl::sample_looping_policy::non_looping);
+		const float normalized_sample_time = float(current_sample_index) / float(k_num_decompression_samples - 1);
+		const float sample_time = rtm::scalar_clamp(normalized_sample_time, 0.0F, 1.0F) * duration;
+
+		const auto start = std::chrono::high_resolution_clock::now();
+
+		// Interpolate as this is the most common scenario
+		context.seek(sample_time, acl::sample_rounding_policy::none);
+		context.decompress_tracks(pose_writer);
+
+		const auto end = std::chrono::high_resolution_clock::now();
+		const auto elapsed_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+		state.SetIterationTime(elapsed_seconds.count());
+
+		// We only move on to the next sample once every clip has been touched
+		current_clip_index++;
+		if (current_clip_index >= num_clips)
+		{
+			current_clip_index = 0;
+			current_sample_index++;
+
+			if (current_sample_index >= k_num_decompression_samples)
+				current_sample_index = 0;
+		}
+	}
+}
+
+static void print_quality_report()
+{
+	database_benchmark_state& state = s_database_benchmark_state;
+	const acl::compressed_database& database = *state.database;
+
+	const uint32_t num_clips = uint32_t(state.clips.size());
+	constexpr uint32_t k_num_devices = uint32_t(acl::get_array_size(k_storage_devices));
+
+	// The data that is always resident: the compressed clips and the database metadata
+	uint32_t resident_size = database.get_size();
+	for (const acl::compressed_tracks* clip : state.clips)
+		resident_size += clip->get_size();
+
+	// When each tier is streamed in from an idle device
+	double tier_times_ms[k_num_devices][acl::k_num_database_tiers] = {};
+	bool is_device_simulated[k_num_devices] = {};
+	for (uint32_t device_index = 0; device_index < k_num_devices; ++device_index)
+	{
+		simulated_database_streamer streamer(s_allocator, database, state.bulk_data, k_storage_devices[device_index]);
+		benchmark_database_context context;
+		is_device_simulated[device_index] = initialize_database_context(context, streamer) && stream_to_quality_level(context, acl::k_num_database_tiers, tier_times_ms[device_index]) && stream_to_quality_level(context, 0, nullptr);
+		if (!is_device_simulated[device_index])
+			printf("    Failed to simulate streaming with %s!\n", k_storage_devices[device_index].name);
+	}
+
+	printf("Quality over time:\n");
+	printf("    %-16s %10s %12s %12s", "Level", "Size (MB)", "Max error", "Avg error");
+	for (const storage_device_profile& device : k_storage_devices)
+		printf(" %10s", device.name);
+	printf("\n");
+
+	acl::qvvf_transform_error_metric error_metric;
+
+	for (uint32_t quality_level = 0; quality_level <= acl::k_num_database_tiers; ++quality_level)
+	{
+		if (quality_level != 0)
+			resident_size += database.get_bulk_data_size(acl::quality_tier(quality_level));
+
+		float max_error = 0.0F;
+		float total_error = 0.0F;
+		if (set_decompression_quality_level(quality_level))
+		{
+			for (uint32_t clip_index = 0; clip_index < num_clips; ++clip_index)
+			{
+				const acl::track_error error = acl::calculate_compression_error(s_allocator, state.raw_clips[clip_index], state.decompression_contexts[clip_index], error_metric);
+				max_error = std::max(max_error, error.error);
+				total_error += error.error;
+			}
+		}
+		else
+			printf("    Failed to stream the database!\n");
+
+		printf("    %-16s %10.2f %12.6f %12.6f", get_quality_level_name(quality_level), double(resident_size) / (1024.0 * 1024.0), double(max_error), double(total_error / float(num_clips)));
+		for (uint32_t device_index = 0; device_index < k_num_devices; ++device_index)
+		{
+			if (!is_device_simulated[device_index])
+				printf(" %10s", "n/a");
+			else
+				printf(" %8.2fms", quality_level != 0 ? tier_times_ms[device_index][quality_level - 1] : 0.0);
+		}
+		printf("\n");
+	}
+}
+
+bool prepare_database_clip(const std::string& clip_name, const acl::compressed_tracks& raw_tracks)
+{
+	printf("Preparing clip %s ...\n", clip_name.c_str());
+
+	acl::error_result result = raw_tracks.is_valid(false);
+	if (result.any())
+	{
+		printf("    Failed to validate clip!\n");
+		return false;
+	}
+
+	acl::track_array track_list;
+	result = acl::convert_track_list(s_allocator, raw_tracks, track_list);
+	if (result.any())
+	{
+		printf("    Failed to convert clip!\n");
+		return false;
+	}
+
+	if (track_list.get_track_type() != acl::track_type8::qvvf)
+	{
+		printf("    Invalid clip track type!\n");
+		return false;
+	}
+
+	// The contributing error is required to build the database
+	acl::compression_settings settings = acl::get_default_compression_settings();
+	settings.metadata.include_contributing_error = true;
+
+	acl::qvvf_transform_error_metric error_metric;
+	settings.error_metric = &error_metric;
+
+	acl::output_stats stats;
+
+	acl::compressed_tracks* compressed_tracks = nullptr;
+	result = acl::compress_track_list(s_allocator, track_list, settings, compressed_tracks, stats);
+	if (result.any())
+	{
+		printf("    Failed to compress clip!\n");
+		return false;
+	}
+
+	if (compressed_tracks->is_valid(false).any())
+	{
+		printf("    Invalid compressed clip!\n");
+		s_allocator.deallocate(compressed_tracks, compressed_tracks->get_size());
+		return false;
+	}
+
+	s_database_benchmark_state.input_clips.push_back(compressed_tracks);
+	s_database_benchmark_state.raw_clips.push_back(std::move(track_list));
+	return true;
+}
+
+bool prepare_database(const acl::compression_database_settings& settings)
+{
+	database_benchmark_state& state = s_database_benchmark_state;
+
+	const uint32_t num_clips = uint32_t(state.input_clips.size());
+	if (num_clips == 0)
+	{
+		printf("No clip to build the database with!\n");
+		return false;
+	}
+
+	printf("Building database with %u clips ...\n", num_clips);
+
+	state.clips.resize(num_clips, nullptr);
+
+	acl::compressed_database* inline_database = nullptr;
+	acl::error_result result = acl::build_database(s_allocator, settings, state.input_clips.data(), num_clips, state.clips.data(), inline_database);
+
+	// The clips bound to the database replace the ones we compressed
+	for (acl::compressed_tracks* input_clip : state.input_clips)
+		s_allocator.deallocate(input_clip, input_clip->get_size());
+	state.input_clips.clear();
+
+	if (result.any())
+	{
+		printf("    Failed to build database: %s\n", result.c_str());
+		state.clips.clear();
+		return false;
+	}
+
+	result = acl::split_database_bulk_data(s_allocator, *inline_database, state.database, state.bulk_data, acl::k_num_database_tiers);
+	s_allocator.deallocate(inline_database, inline_database->get_size());
+
+	if (result.any())
+	{
+		printf("    Failed to split database bulk data: %s\n", result.c_str());
+		return false;
+	}
+
+	const acl::compressed_database& database = *state.database;
+	printf("Database size: %.2f MB, max chunk size: %u KB\n", double(database.get_total_size()) / (1024.0 * 1024.0), database.get_max_chunk_size() / 1024);
+	for (uint32_t tier_index = 0; tier_index < acl::k_num_database_tiers; ++tier_index)
+	{
+		const acl::quality_tier tier = acl::quality_tier(tier_index + 1);
+		printf("    Tier %u: %u chunks, %.2f MB\n", tier_index + 1, database.get_num_chunks(tier), double(database.get_bulk_data_size(tier)) / (1024.0 * 1024.0));
+	}
+
+	// Setup our decompression contexts, they stream from memory
+	state.streamer = acl::allocate_type<simulated_database_streamer>(s_allocator, s_allocator, database, state.bulk_data, k_memory_device);
+	state.db_context = acl::allocate_type<benchmark_database_context>(s_allocator);
+	state.decompression_contexts = acl::allocate_type_array<benchmark_decompression_context>(s_allocator, num_clips);
+
+	bool initialized = initialize_database_context(*state.db_context, *state.streamer);
+	for (uint32_t clip_index = 0; clip_index < num_clips; ++clip_index)
+	{
+		initialized = initialized && state.decompression_contexts[clip_index].initialize(*state.clips[clip_index], *state.db_context);
+		state.max_num_tracks = std::max(state.max_num_tracks, state.clips[clip_index]->get_num_tracks());
+	}
+
+	if (!initialized)
+	{
+		printf("    Failed to initialize decompression contexts!\n");
+		return false;
+	}
+
+	print_quality_report();
+
+	// The raw clips are no longer needed once the error is measured
+	state.raw_clips.clear();
+
+	// Dynamically register our benchmarks
+	for (uint32_t device_index = 0; device_index < uint32_t(acl::get_array_size(k_storage_devices)); ++device_index)
+	{
+		const std::string name = std::string("database_stream_in_") + k_storage_devices[device_index].name;
+		benchmark::internal::Benchmark* bench = benchmark::internal::RegisterBenchmarkInternal(new benchmark::internal::FunctionBenchmark(name.c_str(), benchmark_database_streaming));
+
+		bench->Arg(device_index);
+		bench->ArgNames({ "Device" });
+
+		// Streaming from slow devices takes a while, a few iterations are enough
+		bench->Iterations(3);
+		bench->Unit(benchmark::kMillisecond);
+
+		// Use manual timing since we stream out between iterations
+		bench->UseManualTime();
+	}
+
+	{
+		benchmark::internal::Benchmark* bench = benchmark::internal::RegisterBenchmarkInternal(new benchmark::internal::FunctionBenchmark("database_decompression", benchmark_database_decompression));
+
+		// High importance only, with the medium importance tier, and with every tier
+		bench->Arg(0);
+		bench->Arg(1);
+		bench->Arg(acl::k_num_database_tiers);
+		bench->ArgNames({ "Level" });
+
+		// Sometimes the numbers are slightly different from run to run, we'll run a few times
+		bench->Repetitions(3);
+
+		// Our benchmark has a very low standard deviation, there is no need to run 100k+ times
+		bench->Iterations(10000);
+
+		// Use manual timing to exclude the sample time calculation
+		bench->UseManualTime();
+
+		// Add min/max tracking
+		bench->ComputeStatistics("min", [](const std::vector<double>& v) { return *std::min_element(std::begin(v), std::end(v)); });
+		bench->ComputeStatistics("max", [](const std::vector<double>& v) { return *std::max_element(std::begin(v), std::end(v)); });
+	}
+
+	return true;
+}
+
+void clear_database_benchmark_state()
+{
+	database_benchmark_state& state = s_database_benchmark_state;
+	const uint32_t num_clips = uint32_t(state.clips.size());
+
+	// The contexts must be released before the streamer
+	acl::deallocate_type_array(s_allocator, state.decompression_contexts, num_clips);
+	acl::deallocate_type(s_allocator, state.db_context);
+	acl::deallocate_type(s_allocator, state.streamer);
+
+	for (acl::compressed_tracks* input_clip : state.input_clips)
+		s_allocator.deallocate(input_clip, input_clip->get_size());
+
+	for (acl::compressed_tracks* clip : state.clips)
+	{
+		if (clip != nullptr)
+			s_allocator.deallocate(clip, clip->get_size());
+	}
+
+	if (state.database != nullptr)
+	{
+		for (uint32_t tier_index = 0; tier_index < acl::k_num_database_tiers; ++tier_index)
+			acl::deallocate_type_array(s_allocator, state.bulk_data[tier_index], state.database->get_bulk_data_size(acl::quality_tier(tier_index + 1)));
+
+		s_allocator.deallocate(state.database, state.database->get_size());
+	}
+
+	s_database_benchmark_state = database_benchmark_state();
+}